@@ -559,6 +559,36 @@ def compute_wire_params(api_params, wire_json):
             command.update_metadata()
         commands.sort(key=lambda c: c.name.canonical_case())
 
+    # Commands with a compact encoding are tagged by their index in the list
+    # and only support the members that the compact encoding knows about.
+    commands_by_suffix = {
+        command.name.CamelCase(): command
+        for command in wire_params['cmd_records']['command']
+    }
+    for commands in wire_params['cmd_records'].values():
+        for command in commands:
+            command.compact_tag = 0
+    compact_commands = []
+    for command_suffix in wire_json['special items'].get(
+            'compact_commands', []):
+        assert command_suffix not in (
+            wire_json['special items']['server_custom_pre_handler_commands'])
+        command = commands_by_suffix[command_suffix]
+        assert command.derived_method
+        for member in command.members:
+            assert not member.is_return_value
+            if member.annotation == 'value':
+                assert member.type.category in ('object', 'enum', 'bitmask',
+                                                'native')
+            else:
+                assert member.annotation == 'const*'
+                assert member.type.category == 'native'
+                assert isinstance(member.length, RecordMember)
+        compact_commands.append(command)
+        command.compact_tag = len(compact_commands)
+    assert len(compact_commands) < 256
+    wire_params['compact_cmd_records'] = compact_commands
+
     wire_params.update(wire_json.get('special items', {}))
 
     return wire_params
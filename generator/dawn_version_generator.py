@@ -0,0 +1,86 @@
+#!/usr/bin/env python3
+# Copyright 2022 The Dawn Authors
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import os, subprocess, sys
+
+from generator_lib import Generator, run_generator, FileRender
+
+
+def get_git():
+    return 'git.bat' if sys.platform == 'win32' else 'git'
+
+
+def run_git(dawn_dir, *args):
+    # Returns the stripped output of the git command, or None if it failed, for example because
+    # |dawn_dir| isn't a git checkout.
+    try:
+        result = subprocess.run([get_git()] + list(args),
+                                stdout=subprocess.PIPE,
+                                stderr=subprocess.DEVNULL,
+                                cwd=dawn_dir)
+    except OSError:
+        return None
+    if result.returncode != 0:
+        return None
+    return result.stdout.decode('utf-8').strip()
+
+
+def get_git_hash(dawn_dir):
+    # Without a hash Dawn can't tell builds apart, so it disables the features that rely on it,
+    # like the persistent caching of compiled shaders.
+    return run_git(dawn_dir, 'rev-parse', 'HEAD') or ''
+
+
+def get_git_head_files(dawn_dir):
+    # Returns the files that change when HEAD moves: HEAD itself, and the branch it points to
+    # which is either a loose ref or part of packed-refs.
+    head = run_git(dawn_dir, 'rev-parse', '--git-path', 'HEAD')
+    if head is None:
+        return []
+    files = [os.path.join(dawn_dir, head)]
+
+    branch = run_git(dawn_dir, 'symbolic-ref', '-q', 'HEAD')
+    if branch is not None:
+        for ref_file in [branch, 'packed-refs']:
+            path = run_git(dawn_dir, 'rev-parse', '--git-path', ref_file)
+            if path is not None and os.path.exists(os.path.join(dawn_dir, path)):
+                files.append(os.path.join(dawn_dir, path))
+                break
+    return [os.path.abspath(f) for f in files]
+
+
+class DawnVersionGenerator(Generator):
+    def get_description(self):
+        return 'Generates the Dawn version header, based on the git HEAD of the Dawn checkout.'
+
+    def add_commandline_arguments(self, parser):
+        parser.add_argument('--dawn-dir',
+                            required=True,
+                            type=str,
+                            help='The Dawn root directory to get the git hash of.')
+
+    def get_file_renders(self, args):
+        params = {'git_hash': get_git_hash(os.path.abspath(args.dawn_dir))}
+        return [
+            FileRender('dawn/common/Version.h',
+                       'src/dawn/common/Version_autogen.h', [params]),
+        ]
+
+    def get_dependencies(self, args):
+        return get_git_head_files(os.path.abspath(args.dawn_dir))
+
+
+if __name__ == '__main__':
+    sys.exit(run_generator(DawnVersionGenerator()))
@@ -0,0 +1,27 @@
+//* Copyright 2022 The Dawn Authors
+//*
+//* Licensed under the Apache License, Version 2.0 (the "License");
+//* you may not use this file except in compliance with the License.
+//* You may obtain a copy of the License at
+//*
+//*     http://www.apache.org/licenses/LICENSE-2.0
+//*
+//* Unless required by applicable law or agreed to in writing, software
+//* distributed under the License is distributed on an "AS IS" BASIS,
+//* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//* See the License for the specific language governing permissions and
+//* limitations under the License.
+
+#ifndef COMMON_VERSION_AUTOGEN_H_
+#define COMMON_VERSION_AUTOGEN_H_
+
+#include <string_view>
+
+namespace dawn {
+
+    // The git hash of the Dawn checkout this was built from, empty if it isn't a git checkout.
+    static constexpr std::string_view kGitHash("{{git_hash}}");
+
+}  // namespace dawn
+
+#endif  // COMMON_VERSION_AUTOGEN_H_
@@ -22,6 +22,7 @@
 #include <algorithm>
 #include <cstring>
 #include <limits>
+#include <type_traits>
 
 #ifdef __GNUC__
 // error: 'offsetof' within non-standard-layout type 'wgpu::XXX' is conditionally-supported
@@ -98,6 +99,154 @@
     {%- endif -%}
 {% endmacro %}
 
+//* Outputs the code writing the value `in` of type `type` with the compact encoding.
+{% macro compact_write_value(type, in) %}
+    {%- set cType = as_cType(type.name) -%}
+    {%- if type.category == "enum" -%}
+        WIRE_TRY(writer.WriteUnsigned(static_cast<uint32_t>({{in}})));
+    {%- elif type.category == "bitmask" -%}
+        WIRE_TRY(writer.WriteUnsigned({{in}}));
+    {%- elif cType in ["float", "double"] -%}
+        WIRE_TRY(writer.WriteRaw({{in}}));
+    {%- elif cType == "bool" -%}
+        WIRE_TRY(writer.WriteUnsigned({{in}} ? 1u : 0u));
+    {%- elif cType in ["int8_t", "int16_t", "int32_t", "int64_t"] -%}
+        WIRE_TRY(writer.WriteSigned({{in}}));
+    {%- elif cType == "uint64_t" -%}
+        //* Offset by one so that both 0 and WGPU_WHOLE_SIZE take a single byte.
+        WIRE_TRY(writer.WriteUnsigned({{in}} + 1u));
+    {%- else -%}
+        {{ assert(cType in ["uint8_t", "uint16_t", "uint32_t"]) }}
+        WIRE_TRY(writer.WriteUnsigned({{in}}));
+    {%- endif -%}
+{% endmacro %}
+
+//* Outputs the code reading a value of type `type` with the compact encoding in `out`.
+{% macro compact_read_value(type, out) %}
+    {%- set cType = as_cType(type.name) -%}
+    {%- if type.category == "enum" -%}
+        {
+            uint32_t value;
+            WIRE_TRY(reader.ReadUnsigned(&value));
+            {{out}} = static_cast<{{cType}}>(value);
+        }
+    {%- elif type.category == "bitmask" -%}
+        WIRE_TRY(reader.ReadUnsigned(&{{out}}));
+    {%- elif cType in ["float", "double"] -%}
+        WIRE_TRY(reader.ReadRaw(&{{out}}));
+    {%- elif cType == "bool" -%}
+        {
+            uint8_t value;
+            WIRE_TRY(reader.ReadUnsigned(&value));
+            if (value > 1) {
+                return WireResult::FatalError;
+            }
+            {{out}} = value != 0;
+        }
+    {%- elif cType in ["int8_t", "int16_t", "int32_t", "int64_t"] -%}
+        WIRE_TRY(reader.ReadSigned(&{{out}}));
+    {%- elif cType == "uint64_t" -%}
+        {
+            uint64_t value;
+            WIRE_TRY(reader.ReadUnsigned(&value));
+            {{out}} = value - 1u;
+        }
+    {%- else -%}
+        WIRE_TRY(reader.ReadUnsigned(&{{out}}));
+    {%- endif -%}
+{% endmacro %}
+
+//* Outputs the code that writes the members of a command with the compact encoding. Values come
+//* first (so that array lengths are known), followed by the elements of the arrays.
+{% macro write_compact_command_serialization_methods(command) %}
+    {% set Cmd = command.name.CamelCase() + "Cmd" %}
+    WireResult {{Cmd}}::SerializeCompact(
+        char* compactBuffer,
+        size_t compactBufferSize,
+        size_t* written,
+        const ObjectIdProvider& provider,
+        CompactCommandState* state
+    ) const {
+        //* The parameters don't use the usual names because commands have members called
+        //* "buffer" and "size".
+        CompactCommandWriter writer(compactBuffer, compactBufferSize);
+        {% for member in command.members if member.annotation == "value" %}
+            {% set memberName = as_varName(member.name) %}
+            {% if member.type.category == "object" %}
+                {% set Optional = "Optional" if member.optional else "" %}
+                {% set lastId = "lastSelfId" if memberName == "self" else "lastObjectId" %}
+                {
+                    ObjectId id;
+                    WIRE_TRY(provider.Get{{Optional}}Id({{memberName}}, &id));
+                    WIRE_TRY(writer.WriteSigned(static_cast<int32_t>(id - state->{{lastId}})));
+                    state->{{lastId}} = id;
+                }
+            {% else %}
+                {{compact_write_value(member.type, memberName)}}
+            {% endif %}
+        {% endfor %}
+        {% for member in command.members if member.annotation != "value" %}
+            {% set memberName = as_varName(member.name) %}
+            for (decltype({{member_length(member, "")}}) i = 0; i < {{member_length(member, "")}}; ++i) {
+                {{compact_write_value(member.type, memberName + "[i]")}}
+            }
+        {% endfor %}
+
+        *written = writer.GetWrittenSize();
+        return WireResult::Success;
+    }
+
+    WireResult {{Cmd}}::DeserializeCompact(
+        DeserializeBuffer* deserializeBuffer,
+        DeserializeAllocator* allocator,
+        const ObjectIdResolver& resolver,
+        CompactCommandState* state
+    ) {
+        {% if command.members | selectattr("annotation", "ne", "value") | list | length == 0 %}
+            DAWN_UNUSED(allocator);
+        {% endif %}
+        CompactCommandReader reader(deserializeBuffer);
+        {% for member in command.members if member.annotation == "value" %}
+            {% set memberName = as_varName(member.name) %}
+            {% if member.type.category == "object" %}
+                {% set Optional = "Optional" if member.optional else "" %}
+                {% set lastId = "lastSelfId" if memberName == "self" else "lastObjectId" %}
+                {
+                    int32_t delta;
+                    WIRE_TRY(reader.ReadSigned(&delta));
+                    ObjectId id = state->{{lastId}} + static_cast<ObjectId>(delta);
+                    state->{{lastId}} = id;
+                    WIRE_TRY(resolver.Get{{Optional}}FromId(id, &{{memberName}}));
+                    {% if memberName == "self" %}
+                        selfId = id;
+                    {% endif %}
+                }
+            {% else %}
+                {{compact_read_value(member.type, memberName)}}
+            {% endif %}
+        {% endfor %}
+        {% for member in command.members if member.annotation != "value" %}
+            {% set memberName = as_varName(member.name) %}
+            {
+                auto memberLength = {{member_length(member, "")}};
+                //* Each element takes at least one byte, reject lengths that can't be valid
+                //* before allocating space for them.
+                if (memberLength > reader.AvailableSize()) {
+                    return WireResult::FatalError;
+                }
+                {{as_cType(member.type.name)}}* copiedMembers;
+                WIRE_TRY(GetSpace(allocator, memberLength, &copiedMembers));
+                for (decltype(memberLength) i = 0; i < memberLength; ++i) {
+                    {{compact_read_value(member.type, "copiedMembers[i]")}}
+                }
+                {{memberName}} = copiedMembers;
+            }
+        {% endfor %}
+
+        return reader.Finish();
+    }
+{% endmacro %}
+
 //* The main [de]serialization macro
 //* Methods are very similar to structures that have one member corresponding to each arguments.
 //* This macro takes advantage of the similarity to output [de]serialization code for a record
@@ -774,8 +923,158 @@ namespace dawn::wire {
                 {% endfor %}
         };
 
+        // Writer for the compact command encoding. Unsigned integers are written as LEB128
+        // varints, signed integers are zigzag-encoded first so that small negative values stay
+        // small, and floating point values are copied verbatim.
+        class CompactCommandWriter {
+          public:
+            CompactCommandWriter(char* buffer, size_t size) : mBuffer(buffer), mSize(size) {
+            }
+
+            WireResult WriteUnsigned(uint64_t value) {
+                // Most values in commands are small, so special case single byte varints.
+                if (DAWN_LIKELY(value < 0x80 && mWritten < mSize)) {
+                    mBuffer[mWritten++] = static_cast<char>(value);
+                    return WireResult::Success;
+                }
+                do {
+                    if (mWritten == mSize) {
+                        return WireResult::FatalError;
+                    }
+                    uint8_t byte = static_cast<uint8_t>(value & 0x7F);
+                    value >>= 7;
+                    if (value != 0) {
+                        byte |= 0x80;
+                    }
+                    mBuffer[mWritten++] = static_cast<char>(byte);
+                } while (value != 0);
+                return WireResult::Success;
+            }
+
+            WireResult WriteSigned(int64_t value) {
+                return WriteUnsigned((static_cast<uint64_t>(value) << 1) ^
+                                     static_cast<uint64_t>(value >> 63));
+            }
+
+            template <typename T>
+            WireResult WriteRaw(T value) {
+                if (mSize - mWritten < sizeof(T)) {
+                    return WireResult::FatalError;
+                }
+                memcpy(mBuffer + mWritten, &value, sizeof(T));
+                mWritten += sizeof(T);
+                return WireResult::Success;
+            }
+
+            size_t GetWrittenSize() const {
+                return mWritten;
+            }
+
+          private:
+            char* mBuffer;
+            size_t mSize;
+            size_t mWritten = 0;
+        };
+
+        // Reader for the compact command encoding, see CompactCommandWriter. Values that don't
+        // fit in the type they are read into are errors. The reader decodes from its own cursor
+        // and only consumes the bytes from the DeserializeBuffer in Finish().
+        class CompactCommandReader {
+          public:
+            explicit CompactCommandReader(DeserializeBuffer* buffer)
+                : mBuffer(buffer),
+                  mData(reinterpret_cast<const volatile uint8_t*>(buffer->Buffer())),
+                  mSize(buffer->AvailableSize()) {
+            }
+
+            template <typename T>
+            WireResult ReadUnsigned(T* out) {
+                static_assert(std::is_unsigned<T>::value, "ReadUnsigned requires an unsigned type");
+                uint64_t value;
+                WIRE_TRY(ReadVarint(&value));
+                if (value > std::numeric_limits<T>::max()) {
+                    return WireResult::FatalError;
+                }
+                *out = static_cast<T>(value);
+                return WireResult::Success;
+            }
+
+            template <typename T>
+            WireResult ReadSigned(T* out) {
+                static_assert(std::is_signed<T>::value, "ReadSigned requires a signed type");
+                uint64_t value;
+                WIRE_TRY(ReadVarint(&value));
+                int64_t decoded = static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+                if (decoded < std::numeric_limits<T>::min() ||
+                    decoded > std::numeric_limits<T>::max()) {
+                    return WireResult::FatalError;
+                }
+                *out = static_cast<T>(decoded);
+                return WireResult::Success;
+            }
+
+            template <typename T>
+            WireResult ReadRaw(T* out) {
+                if (mSize - mConsumed < sizeof(T)) {
+                    return WireResult::FatalError;
+                }
+                memcpy(out, const_cast<const uint8_t*>(mData + mConsumed), sizeof(T));
+                mConsumed += sizeof(T);
+                return WireResult::Success;
+            }
+
+            size_t AvailableSize() const {
+                return mSize - mConsumed;
+            }
+
+            WireResult Finish() {
+                const volatile char* data;
+                return mBuffer->ReadN(mConsumed, &data);
+            }
+
+          private:
+            WireResult ReadVarint(uint64_t* out) {
+                if (DAWN_UNLIKELY(mConsumed == mSize)) {
+                    return WireResult::FatalError;
+                }
+                // Most values in commands are small, so special case single byte varints.
+                uint8_t byte = mData[mConsumed++];
+                if (DAWN_LIKELY(byte < 0x80)) {
+                    *out = byte;
+                    return WireResult::Success;
+                }
+
+                uint64_t value = byte & 0x7F;
+                for (uint32_t shift = 7;; shift += 7) {
+                    if (mConsumed == mSize) {
+                        return WireResult::FatalError;
+                    }
+                    byte = mData[mConsumed++];
+                    // The tenth byte can only contain the last bit of a 64-bit value.
+                    if (shift == 63 && byte > 1) {
+                        return WireResult::FatalError;
+                    }
+                    value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+                    if ((byte & 0x80) == 0) {
+                        break;
+                    }
+                }
+                *out = value;
+                return WireResult::Success;
+            }
+
+            DeserializeBuffer* mBuffer;
+            const volatile uint8_t* mData;
+            size_t mSize;
+            size_t mConsumed = 0;
+        };
+
     }  // anonymous namespace
 
+    {% for command in compact_cmd_records %}
+        {{ write_compact_command_serialization_methods(command) }}
+    {% endfor %}
+
     {% for command in cmd_records["command"] %}
         {{ write_command_serialization_methods(command, False) }}
     {% endfor %}
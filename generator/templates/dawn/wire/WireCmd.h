@@ -89,6 +89,34 @@ namespace dawn::wire {
         uint64_t commandSize;
     };
 
+    //* With the compact command encoding, each command is prefixed with a one byte tag. Commands
+    //* listed in "compact_commands" use their own tag followed by a tightly packed encoding of
+    //* their members, all the other commands use kRegularCommandTag followed by their regular
+    //* encoding, starting with their CmdHeader.
+    constexpr uint8_t kRegularCommandTag = 0;
+
+    //* Maximum size of a compact command, tag included. Larger commands (for example SetBindGroup
+    //* with many dynamic offsets) fall back to the regular encoding.
+    constexpr size_t kMaxCompactCommandSize = 64;
+
+    //* Clients using the compact command encoding start their command stream with this marker,
+    //* laid out like a regular command with kCompactCommandsMarker in place of its WireCmd. Servers
+    //* that don't use the compact command encoding reject it as an unknown command, and servers that
+    //* do reject streams that don't start with it. This way a client and a server that disagree on
+    //* useCompactCommands fail on the first command instead of misinterpreting the commands.
+    constexpr uint32_t kCompactCommandsMarker = 0xFFFF'FFFF;
+    struct CompactCommandsMarkerCmd {
+        CmdHeader header;
+        uint32_t marker;
+    };
+
+    //* IDs in compact commands are encoded as the difference with the previous IDs of the stream,
+    //* which are tracked identically by the client and the server.
+    struct CompactCommandState {
+        ObjectId lastSelfId = 0;
+        ObjectId lastObjectId = 0;
+    };
+
 {% macro write_command_struct(command, is_return_command) %}
     {% set Return = "Return" if is_return_command else "" %}
     {% set Cmd = command.name.CamelCase() + "Cmd" %}
@@ -113,6 +141,21 @@ namespace dawn::wire {
         // Override which produces a FatalError if any object is used.
         WireResult Deserialize(DeserializeBuffer* deserializeBuffer, DeserializeAllocator* allocator);
 
+        //* Tag of the command in the compact command encoding, kRegularCommandTag if it doesn't
+        //* have a compact encoding.
+        static constexpr uint8_t kCompactTag = {{command.compact_tag}};
+
+        {% if command.compact_tag != 0 %}
+            //* Serializes the members of the command (without the tag) in the compact encoding.
+            //* Returns FatalError if they don't fit in the |compactBufferSize| bytes of
+            //* |compactBuffer|, otherwise the number of bytes used is returned in |written| and
+            //* |state| is updated.
+            WireResult SerializeCompact(char* compactBuffer, size_t compactBufferSize, size_t* written, const ObjectIdProvider& objectIdProvider, CompactCommandState* state) const;
+
+            //* Deserializes the members of the command (after the tag) from the compact encoding.
+            WireResult DeserializeCompact(DeserializeBuffer* deserializeBuffer, DeserializeAllocator* allocator, const ObjectIdResolver& resolver, CompactCommandState* state);
+        {% endif %}
+
         {% if command.derived_method %}
             //* Command handlers want to know the object ID in addition to the backing object.
             //* Doesn't need to be filled before Serialize, or GetRequiredSize.
@@ -51,6 +51,19 @@ namespace dawn::wire::client {
             ) {
                 auto self = reinterpret_cast<{{as_wireType(type)}}>(cSelf);
                 {% if Suffix not in client_handwritten_commands %}
+                    {% if Suffix in client_state_tracking_commands %}
+                        //* Let the object record the state set by the command and skip the command
+                        //* if it doesn't change anything.
+                        {{assert(method.return_type.name.canonical_case() == "void")}}
+                        if (self->client->ElidesRedundantStateCommands() &&
+                            !self->Track{{method.name.CamelCase()}}(
+                                {%- for arg in method.arguments -%}
+                                    {%if not loop.first %}, {% endif %}{{as_varName(arg.name)}}
+                                {%- endfor -%})) {
+                            return;
+                        }
+                    {% endif %}
+
                     {{Suffix}}Cmd cmd;
 
                     //* Create the structure going on the wire on the stack and fill it with the value
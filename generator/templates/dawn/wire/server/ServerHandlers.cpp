@@ -13,6 +13,7 @@
 //* limitations under the License.
 
 #include "dawn/common/Assert.h"
+#include "dawn/wire/BufferConsumer_impl.h"
 #include "dawn/wire/server/Server.h"
 
 namespace dawn::wire::server {
@@ -106,13 +107,78 @@ namespace dawn::wire::server {
         }
     {% endfor %}
 
+    //* Handlers of the compact encoding of commands. They don't have return values or pre-handlers.
+    {% for command in compact_cmd_records %}
+        {% set Suffix = command.name.CamelCase() %}
+        bool Server::HandleCompact{{Suffix}}(DeserializeBuffer* deserializeBuffer) {
+            {{Suffix}}Cmd cmd;
+            WireResult deserializeResult = cmd.DeserializeCompact(deserializeBuffer, &mAllocator,
+                                                                  *this, &mCompactCommandState);
+            if (deserializeResult == WireResult::FatalError) {
+                return false;
+            }
+
+            return Do{{Suffix}}(
+                {%- for member in command.members -%}
+                    cmd.{{as_varName(member.name)}}
+                    {%- if not loop.last -%}, {% endif %}
+                {%- endfor -%}
+            );
+        }
+    {% endfor %}
+
+    bool Server::HandleCompactCommand(DeserializeBuffer* deserializeBuffer) {
+        const volatile uint8_t* tag;
+        if (deserializeBuffer->Read(&tag) != WireResult::Success) {
+            return false;
+        }
+
+        switch (*tag) {
+            {% for command in compact_cmd_records %}
+                case {{command.name.CamelCase()}}Cmd::kCompactTag:
+                    return HandleCompact{{command.name.CamelCase()}}(deserializeBuffer);
+            {% endfor %}
+            default:
+                return false;
+        }
+    }
+
     const volatile char* Server::HandleCommandsImpl(const volatile char* commands, size_t size) {
         DeserializeBuffer deserializeBuffer(commands, size);
 
-        while (deserializeBuffer.AvailableSize() >= sizeof(CmdHeader) + sizeof(WireCmd)) {
+        if (mUseCompactCommands && !mReceivedCompactCommandsMarker) {
+            const volatile CompactCommandsMarkerCmd* markerCmd;
+            if (deserializeBuffer.Read(&markerCmd) != WireResult::Success ||
+                markerCmd->header.commandSize != sizeof(CompactCommandsMarkerCmd) ||
+                markerCmd->marker != kCompactCommandsMarker) {
+                return nullptr;
+            }
+            mReceivedCompactCommandsMarker = true;
+        }
+
+        while (deserializeBuffer.AvailableSize() > 0) {
+            // With the compact command encoding, each command starts with a tag that is either
+            // the tag of a compact command, or kRegularCommandTag followed by a regular command.
+            size_t tagSize = 0;
+            if (mUseCompactCommands) {
+                uint8_t tag = *reinterpret_cast<const volatile uint8_t*>(deserializeBuffer.Buffer());
+                if (tag != kRegularCommandTag) {
+                    if (!HandleCompactCommand(&deserializeBuffer)) {
+                        return nullptr;
+                    }
+                    mAllocator.Reset();
+                    continue;
+                }
+                tagSize = sizeof(uint8_t);
+            }
+
+            if (deserializeBuffer.AvailableSize() < tagSize + sizeof(CmdHeader) + sizeof(WireCmd)) {
+                return nullptr;
+            }
+
             // Start by chunked command handling, if it is done, then it means the whole buffer
             // was consumed by it, so we return a pointer to the end of the commands.
-            switch (HandleChunkedCommands(deserializeBuffer.Buffer(), deserializeBuffer.AvailableSize())) {
+            switch (HandleChunkedCommands(deserializeBuffer.Buffer(), deserializeBuffer.AvailableSize(), tagSize)) {
                 case ChunkedCommandsResult::Consumed:
                     return commands + size;
                 case ChunkedCommandsResult::Error:
@@ -121,6 +187,12 @@ namespace dawn::wire::server {
                     break;
             }
 
+            if (tagSize != 0) {
+                const volatile uint8_t* tag;
+                WireResult result = deserializeBuffer.Read(&tag);
+                ASSERT(result == WireResult::Success);
+            }
+
             WireCmd cmdId = *static_cast<const volatile WireCmd*>(static_cast<const volatile void*>(
                 deserializeBuffer.Buffer() + sizeof(CmdHeader)));
             bool success = false;
@@ -140,10 +212,6 @@ namespace dawn::wire::server {
             mAllocator.Reset();
         }
 
-        if (deserializeBuffer.AvailableSize() != 0) {
-            return nullptr;
-        }
-
         return commands;
     }
 
@@ -71,12 +71,22 @@ namespace dawn::platform {
 
     using PostWorkerTaskCallback = void (*)(void* userdata);
 
+    enum class WorkerTaskPriority : uint8_t {
+        High = 0,
+        Normal = 1,
+    };
+
     class DAWN_PLATFORM_EXPORT WorkerTaskPool {
       public:
         WorkerTaskPool() = default;
         virtual ~WorkerTaskPool() = default;
         virtual std::unique_ptr<WaitableEvent> PostWorkerTask(PostWorkerTaskCallback,
                                                               void* userdata) = 0;
+        // Pools that don't support priorities run the task with the normal priority.
+        virtual std::unique_ptr<WaitableEvent> PostWorkerTaskWithPriority(
+            PostWorkerTaskCallback callback,
+            void* userdata,
+            WorkerTaskPriority priority);
     };
 
     class DAWN_PLATFORM_EXPORT Platform {
@@ -61,6 +61,16 @@ namespace dawn::wire {
     struct DAWN_WIRE_EXPORT WireClientDescriptor {
         CommandSerializer* serializer;
         client::MemoryTransferService* memoryTransferService = nullptr;
+        // Serialize hot commands (draws, dispatches, pipeline and bind group changes...) with a
+        // tightly packed encoding of varints and delta-encoded object IDs. The wire protocol has
+        // no handshake so the server must be created with the same value. Otherwise the server
+        // fails to handle the first command it receives, like for any malformed command, and
+        // handles none of the following ones.
+        bool useCompactCommands = false;
+        // Skip render pass commands that set the pipeline, a bind group, a vertex buffer or the
+        // index buffer to the value that is already set in the pass. The errors reported by the
+        // server stay the same and, unlike useCompactCommands, the server needs no configuration.
+        bool elideRedundantStateCommands = false;
     };
 
     class DAWN_WIRE_EXPORT WireClient : public CommandHandler {
@@ -81,6 +91,13 @@ namespace dawn::wire {
         void ReclaimDeviceReservation(const ReservedDevice& reservation);
         void ReclaimInstanceReservation(const ReservedInstance& reservation);
 
+        // Declares that the application only wrote to [offset, offset + size) of the current
+        // write mapping of |buffer|, in addition to the ranges previously declared for it. Once
+        // a range is declared, Unmap only sends the declared ranges to the server instead of the
+        // whole mapped range, and writes outside of them are not sent. Returns false if |buffer|
+        // isn't mapped for writing or the range isn't inside the mapped range.
+        bool MarkMappedRangeWritten(WGPUBuffer buffer, size_t offset, size_t size);
+
         // Disconnects the client.
         // Commands allocated after this point will not be sent.
         void Disconnect();
@@ -159,7 +176,8 @@ namespace dawn::wire {
 
                 // Serialize a command to send the modified contents of
                 // the subrange (offset, offset + size) of the allocation at buffer unmap
-                // This subrange is always the whole mapped region for now
+                // This subrange is the whole mapped region, or one of the ranges declared with
+                // WireClient::MarkMappedRangeWritten, in which case it is called once per range
                 // There could be nothing to be serialized (if using shared memory)
                 virtual void SerializeDataUpdate(void* serializePointer,
                                                  size_t offset,
@@ -32,6 +32,9 @@ namespace dawn::wire {
         const DawnProcTable* procs;
         CommandSerializer* serializer;
         server::MemoryTransferService* memoryTransferService = nullptr;
+        // Must match WireClientDescriptor::useCompactCommands. Otherwise HandleCommands() fails
+        // on the first command, see WireClientDescriptor::useCompactCommands.
+        bool useCompactCommands = false;
     };
 
     class DAWN_WIRE_EXPORT WireServer : public CommandHandler {
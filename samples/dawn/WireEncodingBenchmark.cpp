@@ -0,0 +1,280 @@
+// Copyright 2022 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Compares the regular and the compact command encodings of the wire on a draw-call heavy frame
+// similar to DrawCallPerf's dynamic pipeline and dynamic bind group variants. The client and the
+// server run in the same process and the commands of each frame are recorded in memory, which
+// gives the number of bytes per frame, the CPU time the client spends encoding the frame and the
+// CPU time the server spends handling it. The server runs on the null backend, so its time also
+// includes Dawn's frontend validation which is the same for both encodings.
+
+#include "dawn/common/Log.h"
+#include "dawn/dawn_proc.h"
+#include "dawn/native/DawnNative.h"
+#include "dawn/utils/ComboRenderPipelineDescriptor.h"
+#include "dawn/utils/Timer.h"
+#include "dawn/utils/WGPUHelpers.h"
+#include "dawn/webgpu_cpp.h"
+#include "dawn/wire/WireClient.h"
+#include "dawn/wire/WireServer.h"
+
+#include <cstdio>
+#include <memory>
+
+namespace {
+
+    constexpr uint32_t kFrames = 200;
+    constexpr uint32_t kDrawsPerFrame = 10000;
+    constexpr uint32_t kPipelines = 2;
+    constexpr uint32_t kUniformOffsets = 64;
+    constexpr uint32_t kUniformAlignment = 256;
+    constexpr size_t kMaxFrameSize = 64 * 1024 * 1024;
+
+    constexpr char kVertexShader[] = R"(
+        @stage(vertex) fn main(
+            @location(0) pos : vec4<f32>
+        ) -> @builtin(position) vec4<f32> {
+            return pos;
+        })";
+
+    constexpr char kFragmentShader[] = R"(
+        struct Uniforms {
+            color : vec4<f32>;
+        };
+        @group(0) @binding(0) var<uniform> uniforms : Uniforms;
+        @stage(fragment) fn main() -> @location(0) vec4<f32> {
+            return uniforms.color;
+        })";
+
+    // Records the commands in memory until they are handed to the other side of the wire.
+    class RecordingCommandBuffer : public dawn::wire::CommandSerializer {
+      public:
+        RecordingCommandBuffer() : mBuffer(new char[kMaxFrameSize]) {
+        }
+
+        size_t GetMaximumAllocationSize() const override {
+            return kMaxFrameSize;
+        }
+
+        void* GetCmdSpace(size_t size) override {
+            if (size > kMaxFrameSize - mOffset) {
+                return nullptr;
+            }
+            char* result = &mBuffer[mOffset];
+            mOffset += size;
+            return result;
+        }
+
+        bool Flush() override {
+            return true;
+        }
+
+        size_t GetSize() const {
+            return mOffset;
+        }
+
+        // Passes the recorded commands to |handler| and starts recording again.
+        bool HandleWith(dawn::wire::CommandHandler* handler) {
+            bool success = handler->HandleCommands(mBuffer.get(), mOffset) != nullptr;
+            mOffset = 0;
+            return success;
+        }
+
+      private:
+        std::unique_ptr<char[]> mBuffer;
+        size_t mOffset = 0;
+    };
+
+    struct FrameStats {
+        double bytes = 0;
+        double encodeTime = 0;
+        double handleTime = 0;
+    };
+
+    class DrawCallFrame {
+      public:
+        explicit DrawCallFrame(const wgpu::Device& device) : mDevice(device) {
+            wgpu::ShaderModule vsModule = utils::CreateShaderModule(mDevice, kVertexShader);
+            wgpu::ShaderModule fsModule = utils::CreateShaderModule(mDevice, kFragmentShader);
+
+            wgpu::BindGroupLayout bindGroupLayout = utils::MakeBindGroupLayout(
+                mDevice,
+                {{0, wgpu::ShaderStage::Fragment, wgpu::BufferBindingType::Uniform, true}});
+            wgpu::PipelineLayout pipelineLayout =
+                utils::MakeBasicPipelineLayout(mDevice, &bindGroupLayout);
+
+            utils::ComboRenderPipelineDescriptor descriptor;
+            descriptor.layout = pipelineLayout;
+            descriptor.vertex.module = vsModule;
+            descriptor.vertex.bufferCount = 1;
+            descriptor.cBuffers[0].arrayStride = 4 * sizeof(float);
+            descriptor.cBuffers[0].attributeCount = 1;
+            descriptor.cAttributes[0].format = wgpu::VertexFormat::Float32x4;
+            descriptor.cFragment.module = fsModule;
+            descriptor.cTargets[0].format = wgpu::TextureFormat::RGBA8Unorm;
+            for (uint32_t i = 0; i < kPipelines; ++i) {
+                // Vary the pipelines so that they aren't deduplicated.
+                descriptor.primitive.frontFace =
+                    i % 2 == 0 ? wgpu::FrontFace::CCW : wgpu::FrontFace::CW;
+                mPipelines[i] = mDevice.CreateRenderPipeline(&descriptor);
+            }
+
+            wgpu::BufferDescriptor uniformDesc;
+            uniformDesc.size = kUniformOffsets * kUniformAlignment;
+            uniformDesc.usage = wgpu::BufferUsage::Uniform;
+            wgpu::Buffer uniformBuffer = mDevice.CreateBuffer(&uniformDesc);
+            mBindGroup = utils::MakeBindGroup(mDevice, bindGroupLayout,
+                                              {{0, uniformBuffer, 0, 4 * sizeof(float)}});
+
+            wgpu::BufferDescriptor vertexDesc;
+            vertexDesc.size = 3 * 4 * sizeof(float);
+            vertexDesc.usage = wgpu::BufferUsage::Vertex;
+            mVertexBuffer = mDevice.CreateBuffer(&vertexDesc);
+
+            wgpu::TextureDescriptor textureDesc;
+            textureDesc.size = {64, 64};
+            textureDesc.format = wgpu::TextureFormat::RGBA8Unorm;
+            textureDesc.usage = wgpu::TextureUsage::RenderAttachment;
+            mColorView = mDevice.CreateTexture(&textureDesc).CreateView();
+        }
+
+        // Switches the pipeline, the dynamic offset and the vertex buffer for every draw.
+        void Encode() {
+            wgpu::RenderPassColorAttachment colorAttachment;
+            colorAttachment.view = mColorView;
+            colorAttachment.loadOp = wgpu::LoadOp::Clear;
+            colorAttachment.storeOp = wgpu::StoreOp::Store;
+            wgpu::RenderPassDescriptor renderPassDesc;
+            renderPassDesc.colorAttachmentCount = 1;
+            renderPassDesc.colorAttachments = &colorAttachment;
+
+            wgpu::CommandEncoder encoder = mDevice.CreateCommandEncoder();
+            wgpu::RenderPassEncoder pass = encoder.BeginRenderPass(&renderPassDesc);
+            for (uint32_t i = 0; i < kDrawsPerFrame; ++i) {
+                uint32_t dynamicOffset = (i % kUniformOffsets) * kUniformAlignment;
+                pass.SetPipeline(mPipelines[i % kPipelines]);
+                pass.SetBindGroup(0, mBindGroup, 1, &dynamicOffset);
+                pass.SetVertexBuffer(0, mVertexBuffer);
+                pass.Draw(3);
+            }
+            pass.End();
+            wgpu::CommandBuffer commands = encoder.Finish();
+            mDevice.GetQueue().Submit(1, &commands);
+        }
+
+      private:
+        wgpu::Device mDevice;
+        wgpu::RenderPipeline mPipelines[kPipelines];
+        wgpu::BindGroup mBindGroup;
+        wgpu::Buffer mVertexBuffer;
+        wgpu::TextureView mColorView;
+    };
+
+    bool RunBenchmark(bool useCompactCommands, FrameStats* stats) {
+        dawn::native::Instance instance;
+        instance.DiscoverDefaultAdapters();
+
+        WGPUDevice backendDevice = nullptr;
+        for (dawn::native::Adapter& adapter : instance.GetAdapters()) {
+            wgpu::AdapterProperties properties;
+            adapter.GetProperties(&properties);
+            if (properties.backendType == wgpu::BackendType::Null) {
+                backendDevice = adapter.CreateDevice();
+                break;
+            }
+        }
+        if (backendDevice == nullptr) {
+            dawn::ErrorLog() << "The null backend is not available";
+            return false;
+        }
+        const DawnProcTable& procs = dawn::native::GetProcs();
+
+        RecordingCommandBuffer c2sBuf;
+        RecordingCommandBuffer s2cBuf;
+
+        dawn::wire::WireServerDescriptor serverDesc = {};
+        serverDesc.procs = &procs;
+        serverDesc.serializer = &s2cBuf;
+        serverDesc.useCompactCommands = useCompactCommands;
+        dawn::wire::WireServer wireServer(serverDesc);
+
+        dawn::wire::WireClientDescriptor clientDesc = {};
+        clientDesc.serializer = &c2sBuf;
+        clientDesc.useCompactCommands = useCompactCommands;
+        dawn::wire::WireClient wireClient(clientDesc);
+
+        dawn::wire::ReservedDevice reservation = wireClient.ReserveDevice();
+        wireServer.InjectDevice(backendDevice, reservation.id, reservation.generation);
+
+        dawnProcSetProcs(&dawn::wire::client::GetProcs());
+
+        bool success = true;
+        {
+            wgpu::Device device = wgpu::Device::Acquire(reservation.device);
+            device.SetUncapturedErrorCallback(
+                [](WGPUErrorType, const char* message, void* userdata) {
+                    dawn::ErrorLog() << message;
+                    *static_cast<bool*>(userdata) = false;
+                },
+                &success);
+
+            DrawCallFrame frame(device);
+            success = success && c2sBuf.HandleWith(&wireServer) && s2cBuf.HandleWith(&wireClient);
+
+            std::unique_ptr<utils::Timer> timer(utils::CreateTimer());
+            for (uint32_t i = 0; i < kFrames && success; ++i) {
+                double start = timer->GetAbsoluteTime();
+                frame.Encode();
+                double encoded = timer->GetAbsoluteTime();
+                stats->bytes += c2sBuf.GetSize();
+                success = c2sBuf.HandleWith(&wireServer);
+                double handled = timer->GetAbsoluteTime();
+
+                stats->encodeTime += encoded - start;
+                stats->handleTime += handled - encoded;
+
+                procs.deviceTick(backendDevice);
+                success = success && s2cBuf.HandleWith(&wireClient);
+            }
+        }
+        success = success && c2sBuf.HandleWith(&wireServer);
+
+        procs.deviceRelease(backendDevice);
+        dawnProcSetProcs(nullptr);
+        return success;
+    }
+
+}  // anonymous namespace
+
+int main(int argc, const char* argv[]) {
+    FrameStats stats[2];
+    for (bool useCompactCommands : {false, true}) {
+        if (!RunBenchmark(useCompactCommands, &stats[useCompactCommands])) {
+            dawn::ErrorLog() << "The benchmark failed";
+            return 1;
+        }
+    }
+
+    printf("%u frames of %u draws, each with SetPipeline, SetBindGroup and SetVertexBuffer\n",
+           kFrames, kDrawsPerFrame);
+    for (bool useCompactCommands : {false, true}) {
+        const FrameStats& s = stats[useCompactCommands];
+        printf("%s encoding: %.0f bytes/frame (%.1f bytes/draw), client encode %.1f us/frame, "
+               "server handle %.1f us/frame\n",
+               useCompactCommands ? "compact" : "regular", s.bytes / kFrames,
+               s.bytes / kFrames / kDrawsPerFrame, s.encodeTime / kFrames * 1e6,
+               s.handleTime / kFrames * 1e6);
+    }
+    return 0;
+}
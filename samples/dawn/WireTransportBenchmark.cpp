@@ -0,0 +1,438 @@
+// Copyright 2022 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Measures the throughput and latency of the wire when the client and the server are in different
+// processes and talk through a pair of utils::SharedMemoryCommandRing. The parent process runs the
+// wire client and the forked child runs the wire server on top of the null backend, so the numbers
+// are dominated by the transport and the wire itself.
+//
+// Buffer mapping round trips are measured both with the default inline memory transfer service and
+// with the one from utils/SharedMemoryTransferService.h. Sparse writes to a large write mapping are
+// measured with and without declaring the written ranges to the wire client.
+
+#include "dawn/common/Log.h"
+#include "dawn/dawn_proc.h"
+#include "dawn/native/DawnNative.h"
+#include "dawn/utils/SharedMemoryCommandRing.h"
+#include "dawn/utils/SharedMemoryTransferService.h"
+#include "dawn/utils/Timer.h"
+#include "dawn/webgpu_cpp.h"
+#include "dawn/wire/WireClient.h"
+#include "dawn/wire/WireServer.h"
+
+#include <sys/wait.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+namespace {
+
+    constexpr size_t kRingCapacity = 4 * 1024 * 1024;
+    constexpr uint64_t kPollTimeoutNs = 1'000'000;
+
+    constexpr uint32_t kRoundTrips = 2000;
+    constexpr uint32_t kSmallCommands = 200000;
+    constexpr size_t kSmallCommandSize = 64;
+    constexpr size_t kSmallestUploadSize = 1024;
+    constexpr size_t kLargestUploadSize = 256 * 1024 * 1024;
+    constexpr size_t kSmallestMapSize = 1024;
+    constexpr size_t kLargestMapSize = 256 * 1024 * 1024;
+    // Enough for one read and one write buffer of the largest size. The memory is only committed
+    // when it is touched.
+    constexpr size_t kTransferRegionSize = 640 * 1024 * 1024;
+    constexpr size_t kSparseWriteBufferSize = 64 * 1024 * 1024;
+    constexpr uint32_t kSparseWriteMaps = 50;
+
+    // Sent by the client to the server through a pipe so that it can inject its device.
+    struct DeviceReservation {
+        uint32_t id;
+        uint32_t generation;
+    };
+
+    int RunServer(utils::SharedMemoryCommandRing* c2s,
+                  utils::SharedMemoryCommandRing* s2c,
+                  dawn::wire::server::MemoryTransferService* memoryTransferService,
+                  int reservationPipe) {
+        DeviceReservation reservation;
+        if (read(reservationPipe, &reservation, sizeof(reservation)) != sizeof(reservation)) {
+            return 1;
+        }
+        close(reservationPipe);
+
+        dawn::native::Instance instance;
+        instance.DiscoverDefaultAdapters();
+
+        WGPUDevice backendDevice = nullptr;
+        for (dawn::native::Adapter& adapter : instance.GetAdapters()) {
+            wgpu::AdapterProperties properties;
+            adapter.GetProperties(&properties);
+            if (properties.backendType == wgpu::BackendType::Null) {
+                backendDevice = adapter.CreateDevice();
+                break;
+            }
+        }
+        if (backendDevice == nullptr) {
+            dawn::ErrorLog() << "The null backend is not available";
+            c2s->Close();
+            s2c->Close();
+            return 1;
+        }
+
+        const DawnProcTable& procs = dawn::native::GetProcs();
+        utils::SharedMemoryCommandSerializer serializer(s2c);
+
+        dawn::wire::WireServerDescriptor serverDesc = {};
+        serverDesc.procs = &procs;
+        serverDesc.serializer = &serializer;
+        serverDesc.memoryTransferService = memoryTransferService;
+        dawn::wire::WireServer server(serverDesc);
+        server.InjectDevice(backendDevice, reservation.id, reservation.generation);
+
+        // Handle commands until the client closes its ring, replying after every batch.
+        utils::SharedMemoryCommandReceiver receiver(c2s, &server);
+        while (receiver.ProcessCommands(kPollTimeoutNs)) {
+            procs.deviceTick(backendDevice);
+            serializer.Flush();
+        }
+
+        procs.deviceRelease(backendDevice);
+        s2c->Close();
+        return 0;
+    }
+
+    class BenchmarkClient {
+      public:
+        BenchmarkClient(utils::SharedMemoryCommandRing* c2s,
+                        utils::SharedMemoryCommandRing* s2c,
+                        dawn::wire::client::MemoryTransferService* memoryTransferService)
+            : mSerializer(c2s) {
+            dawn::wire::WireClientDescriptor clientDesc = {};
+            clientDesc.serializer = &mSerializer;
+            clientDesc.memoryTransferService = memoryTransferService;
+            mWireClient = std::make_unique<dawn::wire::WireClient>(clientDesc);
+            mReceiver = std::make_unique<utils::SharedMemoryCommandReceiver>(s2c,
+                                                                             mWireClient.get());
+            dawnProcSetProcs(&dawn::wire::client::GetProcs());
+        }
+
+        ~BenchmarkClient() {
+            mDevice = nullptr;
+            mSerializer.Flush();
+            dawnProcSetProcs(nullptr);
+        }
+
+        bool Connect(int reservationPipe) {
+            dawn::wire::ReservedDevice reservation = mWireClient->ReserveDevice();
+            DeviceReservation message = {reservation.id, reservation.generation};
+            bool sent = write(reservationPipe, &message, sizeof(message)) == sizeof(message);
+            close(reservationPipe);
+
+            mDevice = wgpu::Device::Acquire(reservation.device);
+            return sent && RoundTrip();
+        }
+
+        // Sends a command that needs a reply and waits for it, which also guarantees that all the
+        // previous commands were handled by the server.
+        bool RoundTrip() {
+            bool done = false;
+            mDevice.PushErrorScope(wgpu::ErrorFilter::Validation);
+            mDevice.PopErrorScope(
+                [](WGPUErrorType, const char*, void* userdata) {
+                    *static_cast<bool*>(userdata) = true;
+                },
+                &done);
+            return WaitFor(&done);
+        }
+
+        // Flushes the commands and handles the replies of the server until |done| is set.
+        bool WaitFor(const bool* done) {
+            if (!mSerializer.Flush()) {
+                return false;
+            }
+            while (!*done) {
+                if (!mReceiver->ProcessCommands(kPollTimeoutNs)) {
+                    return false;
+                }
+                if (!*done) {
+                    // Map requests only complete when the server's device ticks.
+                    mDevice.Tick();
+                    if (!mSerializer.Flush()) {
+                        return false;
+                    }
+                }
+            }
+            return true;
+        }
+
+        void MeasureLatency() {
+            std::vector<double> latencies;
+            latencies.reserve(kRoundTrips);
+            for (uint32_t i = 0; i < kRoundTrips; ++i) {
+                double start = mTimer->GetAbsoluteTime();
+                if (!RoundTrip()) {
+                    return;
+                }
+                latencies.push_back((mTimer->GetAbsoluteTime() - start) * 1e6);
+            }
+
+            std::sort(latencies.begin(), latencies.end());
+            printf("round trip latency: median %.1f us, p99 %.1f us, max %.1f us\n",
+                   latencies[latencies.size() / 2], latencies[latencies.size() * 99 / 100],
+                   latencies.back());
+        }
+
+        void MeasureSmallCommandThroughput() {
+            wgpu::Buffer buffer = CreateUploadBuffer(kSmallCommandSize);
+            std::vector<char> data(kSmallCommandSize, 1);
+            wgpu::Queue queue = mDevice.GetQueue();
+
+            double start = mTimer->GetAbsoluteTime();
+            for (uint32_t i = 0; i < kSmallCommands; ++i) {
+                queue.WriteBuffer(buffer, 0, data.data(), data.size());
+                if (i % 64 == 0 && !mSerializer.Flush()) {
+                    return;
+                }
+            }
+            if (!RoundTrip()) {
+                return;
+            }
+            double elapsed = mTimer->GetAbsoluteTime() - start;
+            printf("small commands: %.0f commands/s\n", kSmallCommands / elapsed);
+        }
+
+        void MeasureUploadThroughput() {
+            wgpu::Buffer buffer = CreateUploadBuffer(kLargestUploadSize);
+            std::vector<char> data(kLargestUploadSize, 1);
+            wgpu::Queue queue = mDevice.GetQueue();
+
+            // Uploads larger than the ring's maximum allocation size go through the wire's
+            // chunked serialization.
+            for (size_t size = kSmallestUploadSize; size <= kLargestUploadSize; size *= 4) {
+                uint32_t count =
+                    static_cast<uint32_t>(std::clamp<size_t>(kLargestUploadSize / size, 8, 4096));
+                double start = mTimer->GetAbsoluteTime();
+                for (uint32_t i = 0; i < count; ++i) {
+                    queue.WriteBuffer(buffer, 0, data.data(), size);
+                    if (!mSerializer.Flush()) {
+                        return;
+                    }
+                }
+                if (!RoundTrip()) {
+                    return;
+                }
+                double elapsed = mTimer->GetAbsoluteTime() - start;
+                printf("%9zu byte uploads: %.1f MB/s\n", size,
+                       count * size / elapsed / (1024 * 1024));
+            }
+        }
+
+        void MeasureMapThroughput(const char* transferName) {
+            for (size_t size = kSmallestMapSize; size <= kLargestMapSize; size *= 4) {
+                uint32_t count =
+                    static_cast<uint32_t>(std::clamp<size_t>(kLargestMapSize / size, 4, 1000));
+                wgpu::Buffer readBuffer =
+                    CreateBuffer(size, wgpu::BufferUsage::MapRead | wgpu::BufferUsage::CopyDst);
+                wgpu::Buffer writeBuffer =
+                    CreateBuffer(size, wgpu::BufferUsage::MapWrite | wgpu::BufferUsage::CopySrc);
+
+                double start = mTimer->GetAbsoluteTime();
+                for (uint32_t i = 0; i < count; ++i) {
+                    if (!MapAndWait(readBuffer, wgpu::MapMode::Read, size)) {
+                        return;
+                    }
+                    readBuffer.Unmap();
+                }
+                double readElapsed = mTimer->GetAbsoluteTime() - start;
+
+                start = mTimer->GetAbsoluteTime();
+                for (uint32_t i = 0; i < count; ++i) {
+                    if (!MapAndWait(writeBuffer, wgpu::MapMode::Write, size)) {
+                        return;
+                    }
+                    memset(writeBuffer.GetMappedRange(0, size), i, size);
+                    writeBuffer.Unmap();
+                }
+                if (!RoundTrip()) {
+                    return;
+                }
+                double writeElapsed = mTimer->GetAbsoluteTime() - start;
+
+                printf("%s %9zu byte map/unmap: read %.1f MB/s, write %.1f MB/s\n", transferName,
+                       size, count * size / readElapsed / (1024 * 1024),
+                       count * size / writeElapsed / (1024 * 1024));
+
+                // Make sure the server released the buffers' memory before the next size.
+                readBuffer.Destroy();
+                writeBuffer.Destroy();
+                if (!RoundTrip()) {
+                    return;
+                }
+            }
+        }
+
+        // Writes a few small ranges of a large buffer mapped for writing, with and without
+        // declaring them with WireClient::MarkMappedRangeWritten.
+        void MeasureSparseWriteThroughput() {
+            wgpu::Buffer buffer = CreateBuffer(
+                kSparseWriteBufferSize, wgpu::BufferUsage::MapWrite | wgpu::BufferUsage::CopySrc);
+
+            for (size_t rangeSize = 256; rangeSize <= 64 * 1024; rangeSize *= 16) {
+                constexpr size_t kRangeCount = 16;
+                constexpr size_t kStride = kSparseWriteBufferSize / kRangeCount;
+
+                for (bool markRanges : {false, true}) {
+                    double start = mTimer->GetAbsoluteTime();
+                    for (uint32_t i = 0; i < kSparseWriteMaps; ++i) {
+                        if (!MapAndWait(buffer, wgpu::MapMode::Write, kSparseWriteBufferSize)) {
+                            return;
+                        }
+                        char* data =
+                            static_cast<char*>(buffer.GetMappedRange(0, kSparseWriteBufferSize));
+                        for (size_t range = 0; range < kRangeCount; ++range) {
+                            size_t offset = range * kStride + i * rangeSize % kStride;
+                            memset(data + offset, i, rangeSize);
+                            if (markRanges) {
+                                mWireClient->MarkMappedRangeWritten(buffer.Get(), offset,
+                                                                    rangeSize);
+                            }
+                        }
+                        buffer.Unmap();
+                    }
+                    if (!RoundTrip()) {
+                        return;
+                    }
+                    double elapsed = mTimer->GetAbsoluteTime() - start;
+
+                    printf("%u x %6zu byte writes to a %zu byte mapping, %s: %.2f ms/map, "
+                           "%.1f MB/s written\n",
+                           static_cast<uint32_t>(kRangeCount), rangeSize, kSparseWriteBufferSize,
+                           markRanges ? "written ranges" : "whole range   ",
+                           elapsed / kSparseWriteMaps * 1000,
+                           kSparseWriteMaps * kRangeCount * rangeSize / elapsed / (1024 * 1024));
+                }
+            }
+        }
+
+      private:
+        wgpu::Buffer CreateUploadBuffer(uint64_t size) {
+            return CreateBuffer(size, wgpu::BufferUsage::CopyDst);
+        }
+
+        wgpu::Buffer CreateBuffer(uint64_t size, wgpu::BufferUsage usage) {
+            wgpu::BufferDescriptor descriptor;
+            descriptor.size = size;
+            descriptor.usage = usage;
+            return mDevice.CreateBuffer(&descriptor);
+        }
+
+        bool MapAndWait(const wgpu::Buffer& buffer, wgpu::MapMode mode, size_t size) {
+            struct MapResult {
+                bool done = false;
+                bool success = false;
+            } result;
+            buffer.MapAsync(
+                mode, 0, size,
+                [](WGPUBufferMapAsyncStatus status, void* userdata) {
+                    MapResult* result = static_cast<MapResult*>(userdata);
+                    result->done = true;
+                    result->success = status == WGPUBufferMapAsyncStatus_Success;
+                },
+                &result);
+            return WaitFor(&result.done) && result.success;
+        }
+
+        utils::SharedMemoryCommandSerializer mSerializer;
+        std::unique_ptr<dawn::wire::WireClient> mWireClient;
+        std::unique_ptr<utils::SharedMemoryCommandReceiver> mReceiver;
+        std::unique_ptr<utils::Timer> mTimer{utils::CreateTimer()};
+        wgpu::Device mDevice;
+    };
+
+    // Runs the benchmarks with a new server process, using the shared memory transfer service if
+    // |sharedMemoryTransfer| is true.
+    bool RunBenchmarks(bool sharedMemoryTransfer) {
+        std::unique_ptr<utils::SharedMemoryCommandRing> c2s =
+            utils::SharedMemoryCommandRing::Create(kRingCapacity);
+        std::unique_ptr<utils::SharedMemoryCommandRing> s2c =
+            utils::SharedMemoryCommandRing::Create(kRingCapacity);
+        std::unique_ptr<utils::SharedMemoryRegion> transferRegion;
+        if (sharedMemoryTransfer) {
+            transferRegion = utils::SharedMemoryRegion::Create(kTransferRegionSize);
+        }
+        int reservationPipe[2];
+        if (c2s == nullptr || s2c == nullptr || (sharedMemoryTransfer && !transferRegion) ||
+            pipe(reservationPipe) != 0) {
+            dawn::ErrorLog() << "Failed to create the shared memory";
+            return false;
+        }
+
+        // The mappings of the shared memory are inherited by the child.
+        pid_t server = fork();
+        if (server < 0) {
+            dawn::ErrorLog() << "Failed to start the server process";
+            return false;
+        }
+        if (server == 0) {
+            close(reservationPipe[1]);
+            std::unique_ptr<dawn::wire::server::MemoryTransferService> serverTransfer;
+            if (sharedMemoryTransfer) {
+                serverTransfer =
+                    utils::CreateSharedMemoryServerTransferService(std::move(transferRegion));
+            }
+            _exit(RunServer(c2s.get(), s2c.get(), serverTransfer.get(), reservationPipe[0]));
+        }
+        close(reservationPipe[0]);
+
+        std::unique_ptr<dawn::wire::client::MemoryTransferService> clientTransfer;
+        if (sharedMemoryTransfer) {
+            clientTransfer =
+                utils::CreateSharedMemoryClientTransferService(std::move(transferRegion));
+        }
+
+        bool success = false;
+        {
+            BenchmarkClient client(c2s.get(), s2c.get(), clientTransfer.get());
+            if (client.Connect(reservationPipe[1])) {
+                if (sharedMemoryTransfer) {
+                    client.MeasureMapThroughput("shared");
+                } else {
+                    client.MeasureLatency();
+                    client.MeasureSmallCommandThroughput();
+                    client.MeasureUploadThroughput();
+                    client.MeasureMapThroughput("inline");
+                    client.MeasureSparseWriteThroughput();
+                }
+                success = true;
+            } else {
+                dawn::ErrorLog() << "Failed to connect to the server process";
+            }
+        }
+
+        c2s->Close();
+        int status = 0;
+        waitpid(server, &status, 0);
+        return success;
+    }
+
+}  // anonymous namespace
+
+int main(int argc, const char* argv[]) {
+    if (!RunBenchmarks(false) || !RunBenchmarks(true)) {
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,146 @@
+#!/usr/bin/env python3
+#
+# Copyright 2022 The Dawn Authors
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# Compares the results of two runs of dawn_perf_tests, like Tint's benchdiff
+# tool does for the Tint benchmarks.
+#
+# Example usage:
+#   out/Release/dawn_perf_tests --gtest_filter=*Null* > before.txt
+#   <apply a change and rebuild>
+#   out/Release/dawn_perf_tests --gtest_filter=*Null* > after.txt
+#   scripts/perf_test_diff.py before.txt after.txt
+
+import argparse
+import re
+import sys
+
+# Matches the lines printed by DawnPerfTestBase::PrintResultImpl, for example:
+#   *RESULT DrawCallPerf.cpu_time: Run_Null= 123.45 ns
+result_pattern = re.compile(
+    r'\*?RESULT ([^.\s]+)\.(\S+): (\S+)= ([0-9.eE+-]+) (\S+)')
+
+# Time metrics are printed in different units depending on their magnitude.
+time_units = {'ns': 1.0, 'us': 1e3, 'ms': 1e6, 's': 1e9}
+
+
+def mean(data):
+    """Return the sample arithmetic mean of data."""
+    return float(sum(data)) / float(len(data))
+
+
+def parse_results(path, metric):
+    """Returns a dict of 'Suite.story' to the list of values of |metric| in
+    the log at |path|, converted to nanoseconds for time metrics."""
+    results = {}
+    units = {}
+    with open(path) as f:
+        for line in f:
+            m = result_pattern.search(line)
+            if not m or m.group(2) != metric:
+                continue
+
+            name = m.group(1) + '.' + m.group(3)
+            value = float(m.group(4))
+            unit = m.group(5)
+            if unit in time_units:
+                value *= time_units[unit]
+                unit = 'ns'
+
+            results.setdefault(name, []).append(value)
+            units[name] = unit
+    return results, units
+
+
+def format_value(value, unit):
+    if unit != 'ns':
+        return '%.2f %s' % (value, unit)
+    for name, scale in [('s', 1e9), ('ms', 1e6), ('us', 1e3)]:
+        if abs(value) >= scale:
+            return '%.2f %s' % (value / scale, name)
+    return '%.2f ns' % value
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Compares the results of two dawn_perf_tests runs.')
+    parser.add_argument('old', help='output of the baseline run')
+    parser.add_argument('new', help='output of the run to compare')
+    parser.add_argument('--metric',
+                        default='cpu_time',
+                        help='the metric to compare (default: cpu_time)')
+    parser.add_argument(
+        '--min-diff',
+        type=float,
+        default=0,
+        help='ignore differences smaller than this many nanoseconds')
+    parser.add_argument(
+        '--min-rel-diff',
+        type=float,
+        default=0.01,
+        help='ignore relative differences smaller than this (default: 0.01)')
+    parser.add_argument(
+        '--fail-on-regression',
+        type=float,
+        default=None,
+        metavar='REL_DIFF',
+        help='exit with an error if a result regressed by more than REL_DIFF')
+    args = parser.parse_args()
+
+    old_results, units = parse_results(args.old, args.metric)
+    new_results, _ = parse_results(args.new, args.metric)
+    if not old_results or not new_results:
+        print("Did not find the metric '%s' in the test outputs" %
+              args.metric)
+        return 1
+
+    diffs = []
+    for name in sorted(set(old_results) | set(new_results)):
+        if name not in old_results or name not in new_results:
+            print('%s: only in %s' %
+                  (name, args.old if name in old_results else args.new))
+            continue
+
+        old = mean(old_results[name])
+        new = mean(new_results[name])
+        diff = new - old
+        rel_diff = diff / old if old != 0 else 0
+        if abs(diff) < args.min_diff or abs(rel_diff) < args.min_rel_diff:
+            continue
+        diffs.append((rel_diff, name, old, new, diff))
+
+    if not diffs:
+        print('No differences in %s' % args.metric)
+        return 0
+
+    # Sort by relative difference, improvements first.
+    diffs.sort()
+    name_width = max(len(d[1]) for d in diffs)
+    regressed = False
+    for rel_diff, name, old, new, diff in diffs:
+        unit = units[name]
+        print('%s: %+7.2f%%  %s -> %s (%s)' %
+              (name.ljust(name_width), rel_diff * 100.0,
+               format_value(old, unit), format_value(new, unit),
+               ('+' if diff > 0 else '-') + format_value(abs(diff), unit)))
+        if (args.fail_on_regression is not None
+                and rel_diff > args.fail_on_regression):
+            regressed = True
+
+    return 1 if regressed else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -16,39 +16,69 @@
 #define COMMON_CONCURRENT_CACHE_H_
 
 #include "dawn/common/NonCopyable.h"
+#include "dawn/common/Platform.h"
 
+#include <array>
 #include <mutex>
 #include <unordered_set>
 #include <utility>
 
+// A thread-safe set of objects deduplicated with T::HashFunc and T::EqualityFunc. To avoid
+// serializing all the threads using the cache on a single lock, it is split into shards that
+// each have their own lock, and objects are dispatched to the shards based on their hash.
 template <typename T>
 class ConcurrentCache : public NonMovable {
   public:
     ConcurrentCache() = default;
 
     T* Find(T* object) {
-        std::lock_guard<std::mutex> lock(mMutex);
-        auto iter = mCache.find(object);
-        if (iter == mCache.end()) {
+        Shard& shard = GetShard(object);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto iter = shard.cache.find(object);
+        if (iter == shard.cache.end()) {
             return nullptr;
         }
         return *iter;
     }
 
     std::pair<T*, bool> Insert(T* object) {
-        std::lock_guard<std::mutex> lock(mMutex);
-        auto [value, inserted] = mCache.insert(object);
+        Shard& shard = GetShard(object);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto [value, inserted] = shard.cache.insert(object);
         return {*value, inserted};
     }
 
     size_t Erase(T* object) {
-        std::lock_guard<std::mutex> lock(mMutex);
-        return mCache.erase(object);
+        Shard& shard = GetShard(object);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        return shard.cache.erase(object);
     }
 
   private:
-    std::mutex mMutex;
-    std::unordered_set<T*, typename T::HashFunc, typename T::EqualityFunc> mCache;
+    static constexpr size_t kShardCountLog2 = 4;
+    static constexpr size_t kShardCount = size_t(1) << kShardCountLog2;
+
+    // Each shard is on its own cache line so that threads using different shards don't contend.
+    struct alignas(64) Shard {
+        std::mutex mutex;
+        std::unordered_set<T*, typename T::HashFunc, typename T::EqualityFunc> cache;
+    };
+
+    Shard& GetShard(const T* object) {
+        // Use the high bits of a multiplicative hash so that the shard selection is independent
+        // from the bucket selection in the shards' sets, even for weak hashes.
+#if defined(DAWN_PLATFORM_64_BIT)
+        constexpr size_t kMultiplier = 0x9e3779b97f4a7c15;
+#elif defined(DAWN_PLATFORM_32_BIT)
+        constexpr size_t kMultiplier = 0x9e3779b9;
+#else
+#    error "Unsupported platform"
+#endif
+        size_t hash = typename T::HashFunc()(object) * kMultiplier;
+        return mShards[hash >> (sizeof(size_t) * 8 - kShardCountLog2)];
+    }
+
+    std::array<Shard, kShardCount> mShards;
 };
 
 #endif
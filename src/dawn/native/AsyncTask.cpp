@@ -8,7 +8,8 @@ namespace dawn::native {
         : mWorkerTaskPool(workerTaskPool) {
     }
 
-    void AsyncTaskManager::PostTask(AsyncTask asyncTask) {
+    void AsyncTaskManager::PostTask(AsyncTask asyncTask,
+                                    dawn::platform::WorkerTaskPriority priority) {
         // If these allocations becomes expensive, we can slab-allocate tasks.
         Ref<WaitableTask> waitableTask = AcquireRef(new WaitableTask());
         waitableTask->taskManager = this;
@@ -26,8 +27,8 @@ namespace dawn::native {
         // Ref the task since it is accessed inside the worker function.
         // The worker function will acquire and release the task upon completion.
         waitableTask->Reference();
-        waitableTask->waitableEvent =
-            mWorkerTaskPool->PostWorkerTask(DoWaitableTask, waitableTask.Get());
+        waitableTask->waitableEvent = mWorkerTaskPool->PostWorkerTaskWithPriority(
+            DoWaitableTask, waitableTask.Get(), priority);
     }
 
     void AsyncTaskManager::HandleTaskCompletion(WaitableTask* task) {
@@ -21,11 +21,7 @@
 #include <unordered_map>
 
 #include "dawn/common/RefCounted.h"
-
-namespace dawn::platform {
-    class WaitableEvent;
-    class WorkerTaskPool;
-}  // namespace dawn::platform
+#include "dawn/platform/DawnPlatform.h"
 
 namespace dawn::native {
 
@@ -40,7 +36,9 @@ namespace dawn::native {
       public:
         explicit AsyncTaskManager(dawn::platform::WorkerTaskPool* workerTaskPool);
 
-        void PostTask(AsyncTask asyncTask);
+        void PostTask(AsyncTask asyncTask,
+                      dawn::platform::WorkerTaskPriority priority =
+                          dawn::platform::WorkerTaskPriority::Normal);
         void WaitAllPendingTasks();
         bool HasPendingTasks();
 
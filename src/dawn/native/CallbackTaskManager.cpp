@@ -16,22 +16,49 @@
 
 namespace dawn::native {
 
+    CallbackTaskManager::~CallbackTaskManager() {
+        // Delete the tasks that were never acquired.
+        AcquireCallbackTasks();
+    }
+
     bool CallbackTaskManager::IsEmpty() {
-        std::lock_guard<std::mutex> lock(mCallbackTaskQueueMutex);
-        return mCallbackTaskQueue.empty();
+        return mLastAddedTask.load(std::memory_order_acquire) == nullptr;
     }
 
     std::vector<std::unique_ptr<CallbackTask>> CallbackTaskManager::AcquireCallbackTasks() {
-        std::lock_guard<std::mutex> lock(mCallbackTaskQueueMutex);
+        // Take the whole stack at once. Producers only ever push, so there is no ABA problem.
+        CallbackTask* task = mLastAddedTask.exchange(nullptr, std::memory_order_acquire);
+
+        // The stack is in the reverse order of addition. Reverse it while counting the tasks so
+        // that the result can be allocated once.
+        CallbackTask* firstAddedTask = nullptr;
+        size_t taskCount = 0;
+        while (task != nullptr) {
+            CallbackTask* next = task->mNextInQueue;
+            task->mNextInQueue = firstAddedTask;
+            firstAddedTask = task;
+            task = next;
+            taskCount++;
+        }
 
         std::vector<std::unique_ptr<CallbackTask>> allTasks;
-        allTasks.swap(mCallbackTaskQueue);
+        allTasks.reserve(taskCount);
+        for (task = firstAddedTask; task != nullptr;) {
+            CallbackTask* next = task->mNextInQueue;
+            task->mNextInQueue = nullptr;
+            allTasks.emplace_back(task);
+            task = next;
+        }
         return allTasks;
     }
 
     void CallbackTaskManager::AddCallbackTask(std::unique_ptr<CallbackTask> callbackTask) {
-        std::lock_guard<std::mutex> lock(mCallbackTaskQueueMutex);
-        mCallbackTaskQueue.push_back(std::move(callbackTask));
+        CallbackTask* task = callbackTask.release();
+        task->mNextInQueue = mLastAddedTask.load(std::memory_order_relaxed);
+        while (!mLastAddedTask.compare_exchange_weak(task->mNextInQueue, task,
+                                                     std::memory_order_release,
+                                                     std::memory_order_relaxed)) {
+        }
     }
 
 }  // namespace dawn::native
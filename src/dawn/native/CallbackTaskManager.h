@@ -15,8 +15,8 @@
 #ifndef DAWNNATIVE_CALLBACK_TASK_MANAGER_H_
 #define DAWNNATIVE_CALLBACK_TASK_MANAGER_H_
 
+#include <atomic>
 #include <memory>
-#include <mutex>
 #include <vector>
 
 namespace dawn::native {
@@ -27,17 +27,31 @@ namespace dawn::native {
         virtual void Finish() = 0;
         virtual void HandleShutDown() = 0;
         virtual void HandleDeviceLoss() = 0;
+
+      private:
+        friend class CallbackTaskManager;
+
+        // Intrusive link used by CallbackTaskManager so that queuing a task doesn't allocate.
+        CallbackTask* mNextInQueue = nullptr;
     };
 
+    // Queues the callback tasks added by any thread until the device acquires them to call them.
+    // Tasks are pushed on a lock-free stack so that worker threads finishing Create*PipelineAsync()
+    // never block each other or the device, and the device acquires all the queued tasks at once
+    // with a single atomic exchange.
     class CallbackTaskManager {
       public:
+        CallbackTaskManager() = default;
+        ~CallbackTaskManager();
+
         void AddCallbackTask(std::unique_ptr<CallbackTask> callbackTask);
         bool IsEmpty();
+        // Returns all the queued tasks, in the order they were added.
         std::vector<std::unique_ptr<CallbackTask>> AcquireCallbackTasks();
 
       private:
-        std::mutex mCallbackTaskQueueMutex;
-        std::vector<std::unique_ptr<CallbackTask>> mCallbackTaskQueue;
+        // The most recently added task, linked to the previous ones through mNextInQueue.
+        std::atomic<CallbackTask*> mLastAddedTask{nullptr};
     };
 
 }  // namespace dawn::native
@@ -68,12 +68,12 @@ namespace dawn::native {
         uint64_t length = 0;
 
         if (lineNum && linePos && diagnostic.source.file) {
-            const auto& lines = diagnostic.source.file->content.lines;
+            const auto& content = diagnostic.source.file->content;
             size_t i = 0;
             // To find the offset of the message position, loop through each of the first lineNum-1
             // lines and add it's length (+1 to account for the line break) to the offset.
             for (; i < lineNum - 1; ++i) {
-                offset += lines[i].length() + 1;
+                offset += content.Line(i).length() + 1;
             }
 
             // If the end line is on a different line from the beginning line, add the length of the
@@ -92,7 +92,7 @@ namespace dawn::native {
 
             uint64_t endOffset = offset;
             for (; i < endLineNum - 1; ++i) {
-                endOffset += lines[i].length() + 1;
+                endOffset += content.Line(i).length() + 1;
             }
 
             // Add the line positions to the offset and endOffset to get their final positions
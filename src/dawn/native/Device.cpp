@@ -843,30 +843,34 @@ namespace dawn::native {
 
     ResultOrError<Ref<ShaderModuleBase>> DeviceBase::GetOrCreateShaderModule(
         const ShaderModuleDescriptor* descriptor,
-        ShaderModuleParseResult* parseResult,
         OwnedCompilationMessages* compilationMessages) {
-        ASSERT(parseResult != nullptr);
-
         ShaderModuleBase blueprint(this, descriptor, ApiObjectBase::kUntrackedByDevice);
 
         const size_t blueprintHash = blueprint.ComputeContentHash();
         blueprint.SetContentHash(blueprintHash);
 
+        // Look up the cache before parsing the shader: cached modules are only inserted after
+        // being successfully parsed and validated, and the compilation messages they hold are the
+        // ones a new parse of the same code would produce. The only case where a parse is still
+        // needed on a hit is when the cached module was created internally without compilation
+        // messages, and the caller needs them.
         Ref<ShaderModuleBase> result;
         auto iter = mCaches->shaderModules.find(&blueprint);
         if (iter != mCaches->shaderModules.end()) {
             result = *iter;
-        } else {
-            if (!parseResult->HasParsedShader()) {
-                // We skip the parse on creation if validation isn't enabled which let's us quickly
-                // lookup in the cache without validating and parsing. We need the parsed module
-                // now, so call validate. Most of |ValidateShaderModuleDescriptor| is parsing, but
-                // we can consider splitting it if additional validation is added.
-                ASSERT(!IsValidationEnabled());
-                DAWN_TRY(ValidateShaderModuleDescriptor(this, descriptor, parseResult,
-                                                        compilationMessages));
+            if (compilationMessages == nullptr || result->GetCompilationMessages() != nullptr) {
+                return std::move(result);
             }
-            DAWN_TRY_ASSIGN(result, CreateShaderModuleImpl(descriptor, parseResult));
+        }
+
+        ++mShaderModuleParseCountForTesting;
+        ShaderModuleParseResult parseResult;
+        DAWN_TRY_CONTEXT(
+            ValidateShaderModuleDescriptor(this, descriptor, &parseResult, compilationMessages),
+            "validating %s", descriptor);
+
+        if (result == nullptr) {
+            DAWN_TRY_ASSIGN(result, CreateShaderModuleImpl(descriptor, &parseResult));
             result->SetIsCachedReference();
             result->SetContentHash(blueprintHash);
             mCaches->shaderModules.insert(result.Get());
@@ -1190,6 +1194,10 @@ namespace dawn::native {
         ++mLazyClearCountForTesting;
     }
 
+    size_t DeviceBase::GetShaderModuleParseCountForTesting() const {
+        return mShaderModuleParseCountForTesting;
+    }
+
     size_t DeviceBase::GetDeprecationWarningCountForTesting() {
         return mDeprecationWarnings->count;
     }
@@ -1529,15 +1537,15 @@ namespace dawn::native {
         // CreateShaderModule can be called from inside dawn_native. If that's the case handle the
         // error directly in Dawn and no compilationMessages held in the shader module. It is ok as
         // long as dawn_native don't use the compilationMessages of these internal shader modules.
-        ShaderModuleParseResult parseResult;
 
+        // Only validate the chained descriptors here. The rest of the validation is parsing and
+        // is only done by GetOrCreateShaderModule on a cache miss.
         if (IsValidationEnabled()) {
-            DAWN_TRY_CONTEXT(
-                ValidateShaderModuleDescriptor(this, descriptor, &parseResult, compilationMessages),
-                "validating %s", descriptor);
+            DAWN_TRY_CONTEXT(ValidateShaderModuleDescriptorChain(descriptor), "validating %s",
+                             descriptor);
         }
 
-        return GetOrCreateShaderModule(descriptor, &parseResult, compilationMessages);
+        return GetOrCreateShaderModule(descriptor, compilationMessages);
     }
 
     ResultOrError<Ref<SwapChainBase>> DeviceBase::CreateSwapChain(
@@ -181,7 +181,6 @@ namespace dawn::native {
 
         ResultOrError<Ref<ShaderModuleBase>> GetOrCreateShaderModule(
             const ShaderModuleDescriptor* descriptor,
-            ShaderModuleParseResult* parseResult,
             OwnedCompilationMessages* compilationMessages);
         void UncacheShaderModule(ShaderModuleBase* obj);
 
@@ -319,6 +318,9 @@ namespace dawn::native {
         bool IsRobustnessEnabled() const;
         size_t GetLazyClearCountForTesting();
         void IncrementLazyClearCountForTesting();
+        // Returns the number of times a shader module descriptor was parsed, which only happens
+        // when no equivalent shader module is found in the cache.
+        size_t GetShaderModuleParseCountForTesting() const;
         size_t GetDeprecationWarningCountForTesting();
         void EmitDeprecationWarning(const char* warning);
         void EmitLog(const char* message);
@@ -528,6 +530,7 @@ namespace dawn::native {
         TogglesSet mEnabledToggles;
         TogglesSet mOverridenToggles;
         size_t mLazyClearCountForTesting = 0;
+        size_t mShaderModuleParseCountForTesting = 0;
         std::atomic_uint64_t mNextPipelineCompatibilityToken;
 
         CombinedLimits mLimits;
@@ -24,6 +24,10 @@ namespace dawn::native {
         : mDevice(device), mCache(GetPlatformCache()) {
     }
 
+    bool PersistentCache::IsEnabled() const {
+        return mCache != nullptr;
+    }
+
     ScopedCachedBlob PersistentCache::LoadData(const PersistentCacheKey& key) {
         ScopedCachedBlob blob = {};
         if (mCache == nullptr) {
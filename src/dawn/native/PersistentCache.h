@@ -35,7 +35,7 @@ namespace dawn::native {
 
     class DeviceBase;
 
-    enum class PersistentKeyType { Shader };
+    enum class PersistentKeyType { Shader, PipelineCache, ShaderProgram };
 
     // This class should always be thread-safe as it is used in Create*PipelineAsync() where it is
     // called asynchronously.
@@ -75,11 +75,17 @@ namespace dawn::native {
             return std::move(blob);
         }
 
-      private:
-        // PersistentCache impl
+        // Returns true if the platform provides a caching interface. When it doesn't, every
+        // lookup misses and callers can skip building the cache key.
+        bool IsEnabled() const;
+
+        // Returns the blob stored for |key|, or an empty blob if there is none. Prefer
+        // GetOrCreate() for blobs that never change once created.
         ScopedCachedBlob LoadData(const PersistentCacheKey& key);
+        // Stores |value| as the blob for |key|.
         void StoreData(const PersistentCacheKey& key, const void* value, size_t size);
 
+      private:
         dawn::platform::CachingInterface* GetPlatformCache();
 
         DeviceBase* mDevice = nullptr;
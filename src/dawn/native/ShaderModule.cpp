@@ -18,11 +18,13 @@
 #include "dawn/common/BitSetIterator.h"
 #include "dawn/common/Constants.h"
 #include "dawn/common/HashUtils.h"
+#include "dawn/common/Version_autogen.h"
 #include "dawn/native/BindGroupLayout.h"
 #include "dawn/native/ChainUtils_autogen.h"
 #include "dawn/native/CompilationMessages.h"
 #include "dawn/native/Device.h"
 #include "dawn/native/ObjectContentHasher.h"
+#include "dawn/native/PersistentCache.h"
 #include "dawn/native/Pipeline.h"
 #include "dawn/native/PipelineLayout.h"
 #include "dawn/native/RenderPipeline.h"
@@ -30,6 +32,7 @@
 
 #include <tint/tint.h>
 
+#include <chrono>
 #include <sstream>
 
 namespace dawn::native {
@@ -394,6 +397,67 @@ namespace dawn::native {
             return std::move(program);
         }
 
+        PersistentCacheKey CreateWGSLProgramCacheKey(const tint::Source::File* file) {
+            std::stringstream stream;
+
+            // Prefix the key with the type to avoid collisions from another type that could
+            // have the same key.
+            stream << static_cast<uint32_t>(PersistentKeyType::ShaderProgram);
+            stream << "\n";
+
+            // The program parsed from the same WGSL changes with the version of Tint.
+            stream << kGitHash;
+            stream << "\n";
+
+            stream << tint::kProgramSerializationVersion;
+            stream << "\n";
+
+            stream << file->content.data.length();
+            stream << "\n";
+
+            stream << file->content.data;
+            stream << "\n";
+
+            return PersistentCacheKey(std::istreambuf_iterator<char>{stream},
+                                      std::istreambuf_iterator<char>{});
+        }
+
+        // Same as ParseWGSL(), but loads the program from the persistent cache when it holds
+        // the serialized program for the same WGSL. This skips the WGSL parser, the program is
+        // still resolved when it is loaded. Only programs that parsed without any message are
+        // stored, so that a cache hit reports the same messages as parsing would. Like for the
+        // SPIR-V, the cache is skipped when Dawn isn't built from a git checkout.
+        ResultOrError<tint::Program> ParseWGSLWithCache(DeviceBase* device,
+                                                        const tint::Source::File* file,
+                                                        OwnedCompilationMessages* outMessages) {
+            PersistentCache* persistentCache = device->GetPersistentCache();
+            if (persistentCache == nullptr || !persistentCache->IsEnabled() || kGitHash.empty()) {
+                return ParseWGSL(file, outMessages);
+            }
+
+            PersistentCacheKey key = CreateWGSLProgramCacheKey(file);
+            ScopedCachedBlob blob = persistentCache->LoadData(key);
+            if (blob.bufferSize > 0) {
+                tint::Program program =
+                    tint::DeserializeProgram(blob.buffer.get(), blob.bufferSize);
+                // An entry that can't be loaded is replaced by parsing the WGSL again below.
+                if (program.IsValid()) {
+                    return std::move(program);
+                }
+            }
+
+            tint::Program program;
+            DAWN_TRY_ASSIGN(program, ParseWGSL(file, outMessages));
+            if (program.Diagnostics().count() == 0) {
+                tint::SerializedProgram serialized = tint::SerializeProgram(&program);
+                if (serialized.success) {
+                    persistentCache->StoreData(key, serialized.data.data(),
+                                               serialized.data.size());
+                }
+            }
+            return std::move(program);
+        }
+
         ResultOrError<tint::Program> ParseSPIRV(const std::vector<uint32_t>& spirv,
                                                 OwnedCompilationMessages* outMessages) {
             tint::Program program = tint::reader::spirv::Parse(spirv);
@@ -611,14 +675,17 @@ namespace dawn::native {
             EntryPointMetadataTable result;
 
             tint::inspector::Inspector inspector(program);
-            auto entryPoints = inspector.GetEntryPoints();
+            // Reflect all the entry points in a single walk of the program rather than querying
+            // the inspector once per entry point for each kind of data.
+            const auto& reflections = inspector.GetReflection();
             DAWN_INVALID_IF(inspector.has_error(), "Tint Reflection failure: Inspector: %s\n",
                             inspector.error());
 
             // TODO(dawn:563): use DAWN_TRY_CONTEXT to output the name of the entry point we're
             // reflecting.
             constexpr uint32_t kMaxInterStageShaderLocation = kMaxInterStageShaderVariables - 1;
-            for (auto& entryPoint : entryPoints) {
+            for (const tint::inspector::EntryPointReflection& reflection : reflections) {
+                const tint::inspector::EntryPoint& entryPoint = reflection.entry_point;
                 ASSERT(result.count(entryPoint.name) == 0);
 
                 auto metadata = std::make_unique<EntryPointMetadata>();
@@ -695,8 +762,7 @@ namespace dawn::native {
                                     "maximum allowed (%u).",
                                     numInvocations, limits.v1.maxComputeInvocationsPerWorkgroup);
 
-                    const size_t workgroupStorageSize =
-                        inspector.GetWorkgroupStorageSize(entryPoint.name);
+                    const size_t workgroupStorageSize = reflection.workgroup_storage_size;
                     DAWN_INVALID_IF(workgroupStorageSize > limits.v1.maxComputeWorkgroupStorageSize,
                                     "The total use of workgroup storage (%u bytes) is larger than "
                                     "the maximum allowed (%u bytes).",
@@ -851,7 +917,7 @@ namespace dawn::native {
                 }
 
                 for (const tint::inspector::ResourceBinding& resource :
-                     inspector.GetResourceBindings(entryPoint.name)) {
+                     reflection.resource_bindings) {
                     DAWN_INVALID_IF(resource.bind_group >= kMaxBindGroups,
                                     "The entry-point uses a binding with a group decoration (%u) "
                                     "that exceeds the maximum (%u).",
@@ -931,8 +997,8 @@ namespace dawn::native {
                     }
                 }
 
-                std::vector<tint::inspector::SamplerTexturePair> samplerTextureUses =
-                    inspector.GetSamplerTextureUses(entryPoint.name);
+                const std::vector<tint::inspector::SamplerTexturePair>& samplerTextureUses =
+                    reflection.sampler_texture_uses;
                 metadata->samplerTexturePairs.reserve(samplerTextureUses.size());
                 std::transform(
                     samplerTextureUses.begin(), samplerTextureUses.end(),
@@ -950,6 +1016,26 @@ namespace dawn::native {
             }
             return std::move(result);
         }
+        void DumpTransformTimingEntries(
+            std::ostringstream& dumpedMsg,
+            const std::vector<tint::transform::Manager::Timings::Entry>& entries,
+            size_t depth) {
+            for (const auto& entry : entries) {
+                dumpedMsg << "// " << std::string(2 * depth, ' ') << entry.transform->name;
+                if (entry.ran) {
+                    dumpedMsg << ": "
+                              << std::chrono::duration_cast<std::chrono::microseconds>(
+                                     entry.duration)
+                                     .count()
+                              << "us";
+                } else {
+                    dumpedMsg << ": skipped";
+                }
+                dumpedMsg << std::endl;
+                DumpTransformTimingEntries(dumpedMsg, entry.inner, depth + 1);
+            }
+        }
+
     }  // anonymous namespace
 
     ShaderModuleParseResult::ShaderModuleParseResult() = default;
@@ -975,12 +1061,7 @@ namespace dawn::native {
         tint::Source::File file;
     };
 
-    MaybeError ValidateShaderModuleDescriptor(DeviceBase* device,
-                                              const ShaderModuleDescriptor* descriptor,
-                                              ShaderModuleParseResult* parseResult,
-                                              OwnedCompilationMessages* outMessages) {
-        ASSERT(parseResult != nullptr);
-
+    MaybeError ValidateShaderModuleDescriptorChain(const ShaderModuleDescriptor* descriptor) {
         const ChainedStruct* chainedDescriptor = descriptor->nextInChain;
         DAWN_INVALID_IF(chainedDescriptor == nullptr,
                         "Shader module descriptor missing chained descriptor");
@@ -989,6 +1070,18 @@ namespace dawn::native {
         DAWN_TRY(ValidateSingleSType(chainedDescriptor, wgpu::SType::ShaderModuleSPIRVDescriptor,
                                      wgpu::SType::ShaderModuleWGSLDescriptor));
 
+        return {};
+    }
+
+    MaybeError ValidateShaderModuleDescriptor(DeviceBase* device,
+                                              const ShaderModuleDescriptor* descriptor,
+                                              ShaderModuleParseResult* parseResult,
+                                              OwnedCompilationMessages* outMessages) {
+        ASSERT(parseResult != nullptr);
+
+        DAWN_TRY(ValidateShaderModuleDescriptorChain(descriptor));
+        const ChainedStruct* chainedDescriptor = descriptor->nextInChain;
+
         ScopedTintICEHandler scopedICEHandler(device);
 
         const ShaderModuleSPIRVDescriptor* spirvDesc = nullptr;
@@ -1034,7 +1127,7 @@ namespace dawn::native {
             }
 
             tint::Program program;
-            DAWN_TRY_ASSIGN(program, ParseWGSL(&tintSource->file, outMessages));
+            DAWN_TRY_ASSIGN(program, ParseWGSLWithCache(device, &tintSource->file, outMessages));
             parseResult->tintProgram = std::make_unique<tint::Program>(std::move(program));
             parseResult->tintSource = std::move(tintSource);
         }
@@ -1070,6 +1163,24 @@ namespace dawn::native {
         return std::move(output.program);
     }
 
+    void RequestTransformTimings(DeviceBase* device, tint::transform::DataMap* transformInputs) {
+        if (device->IsToggleEnabled(Toggle::DumpShaders)) {
+            transformInputs->Add<tint::transform::Manager::Config>(/* report_timings */ true);
+        }
+    }
+
+    void DumpTransformTimings(DeviceBase* device,
+                              const tint::transform::DataMap& transformOutputs) {
+        const auto* timings = transformOutputs.Get<tint::transform::Manager::Timings>();
+        if (timings == nullptr) {
+            return;
+        }
+        std::ostringstream dumpedMsg;
+        dumpedMsg << "// Dumped transform timings:" << std::endl;
+        DumpTransformTimingEntries(dumpedMsg, timings->entries, 0);
+        device->EmitLog(WGPULoggingType_Info, dumpedMsg.str().c_str());
+    }
+
     void AddVertexPullingTransformConfig(const RenderPipelineBase& renderPipeline,
                                          const std::string& entryPoint,
                                          BindGroupIndex pullingBufferBindingSet,
@@ -1258,13 +1369,11 @@ namespace dawn::native {
 
     void ShaderModuleBase::InjectCompilationMessages(
         std::unique_ptr<OwnedCompilationMessages> compilationMessages) {
-        // TODO(dawn:944): ensure the InjectCompilationMessages is properly handled for shader
-        // module returned from cache.
-        // InjectCompilationMessages should be called only once for a shader module, after it is
-        // created. However currently InjectCompilationMessages may be called on a shader module
-        // returned from cache rather than newly created, and violate the rule. We just skip the
-        // injection in this case for now, but a proper solution including ensure the cache goes
-        // before the validation is required.
+        // InjectCompilationMessages is called after each CreateShaderModule, including when the
+        // shader module is returned from the cache. Cached shader modules already hold the
+        // messages of their creation, which are the same as the ones of a new parse of the same
+        // code, so skip the injection for them. (In that case the device doesn't parse the code
+        // again and |compilationMessages| is empty anyway.)
         if (mCompilationMessages != nullptr) {
             return;
         }
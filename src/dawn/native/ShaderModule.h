@@ -96,6 +96,8 @@ namespace dawn::native {
         std::unique_ptr<TintSource> tintSource;
     };
 
+    // Validates only the chained descriptors, without parsing the shader code.
+    MaybeError ValidateShaderModuleDescriptorChain(const ShaderModuleDescriptor* descriptor);
     MaybeError ValidateShaderModuleDescriptor(DeviceBase* device,
                                               const ShaderModuleDescriptor* descriptor,
                                               ShaderModuleParseResult* parseResult,
@@ -112,6 +114,12 @@ namespace dawn::native {
                                                tint::transform::DataMap* outputs,
                                                OwnedCompilationMessages* messages);
 
+    // With the DumpShaders toggle, asks the tint::transform::Manager run by RunTransforms to
+    // report the time spent in each transform, and logs these timings.
+    void RequestTransformTimings(DeviceBase* device, tint::transform::DataMap* transformInputs);
+    void DumpTransformTimings(DeviceBase* device,
+                              const tint::transform::DataMap& transformOutputs);
+
     /// Creates and adds the tint::transform::VertexPulling::Config to transformInputs.
     void AddVertexPullingTransformConfig(const RenderPipelineBase& renderPipeline,
                                          const std::string& entryPoint,
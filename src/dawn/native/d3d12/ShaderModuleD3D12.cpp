@@ -607,15 +607,17 @@ namespace dawn::native::d3d12 {
             tint::transform::Manager transformManager;
             tint::transform::DataMap transformInputs;
 
+            // Strip the other entry points first so that the later transforms and the HLSL writer
+            // only process the code reachable from this one.
+            transformManager.Add<tint::transform::SingleEntryPoint>();
+            transformInputs.Add<tint::transform::SingleEntryPoint::Config>(request.entryPointName);
+
             if (request.isRobustnessEnabled) {
                 transformManager.Add<tint::transform::Robustness>();
             }
 
             transformManager.Add<tint::transform::BindingRemapper>();
 
-            transformManager.Add<tint::transform::SingleEntryPoint>();
-            transformInputs.Add<tint::transform::SingleEntryPoint::Config>(request.entryPointName);
-
             transformManager.Add<tint::transform::Renamer>();
 
             if (request.disableSymbolRenaming) {
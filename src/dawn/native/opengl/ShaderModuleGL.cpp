@@ -88,10 +88,13 @@ namespace dawn::native::opengl {
         tint::transform::DataMap transformInputs;
 
         AddExternalTextureTransform(layout, &transformManager, &transformInputs);
+        RequestTransformTimings(GetDevice(), &transformInputs);
 
         tint::Program program;
+        tint::transform::DataMap transformOutputs;
         DAWN_TRY_ASSIGN(program, RunTransforms(&transformManager, GetTintProgram(), transformInputs,
-                                               nullptr, nullptr));
+                                               &transformOutputs, nullptr));
+        DumpTransformTimings(GetDevice(), transformOutputs);
         const OpenGLVersion& version = ToBackend(GetDevice())->gl.GetVersion();
 
         tint::writer::glsl::Options tintOptions;
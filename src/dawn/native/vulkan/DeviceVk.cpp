@@ -28,6 +28,7 @@
 #include "dawn/native/vulkan/CommandBufferVk.h"
 #include "dawn/native/vulkan/ComputePipelineVk.h"
 #include "dawn/native/vulkan/FencedDeleter.h"
+#include "dawn/native/vulkan/PipelineCache.h"
 #include "dawn/native/vulkan/PipelineLayoutVk.h"
 #include "dawn/native/vulkan/QuerySetVk.h"
 #include "dawn/native/vulkan/QueueVk.h"
@@ -97,7 +98,13 @@ namespace dawn::native::vulkan {
         // the decision if it is not applicable.
         ApplyDepth24PlusS8Toggle();
 
-        return DeviceBase::Initialize(Queue::Create(this));
+        DAWN_TRY(DeviceBase::Initialize(Queue::Create(this)));
+
+        // The pipeline cache loads its initial data from the persistent cache, which is only
+        // available once the DeviceBase is initialized.
+        DAWN_TRY_ASSIGN(mPipelineCache, PipelineCache::Create(this));
+
+        return {};
     }
 
     Device::~Device() {
@@ -192,6 +199,11 @@ namespace dawn::native::vulkan {
             DAWN_TRY(SubmitPendingCommands());
         }
 
+        // Failing to store the cache data only loses work for the next runs.
+        if (mPipelineCache != nullptr) {
+            IgnoreErrors(mPipelineCache->Tick());
+        }
+
         return {};
     }
 
@@ -222,6 +234,10 @@ namespace dawn::native::vulkan {
         return mDeleter.get();
     }
 
+    PipelineCache* Device::GetPipelineCache() const {
+        return mPipelineCache.get();
+    }
+
     RenderPassCache* Device::GetRenderPassCache() const {
         return mRenderPassCache.get();
     }
@@ -848,6 +864,13 @@ namespace dawn::native::vulkan {
     }
 
     MaybeError Device::WaitForIdleForDestruction() {
+        // Store the pipeline cache data now because the persistent cache is released before
+        // DestroyImpl() is called. Skip it when the device was lost since the driver might be in a
+        // bad state.
+        if (GetState() == State::Alive && mPipelineCache != nullptr) {
+            IgnoreErrors(mPipelineCache->StoreData());
+        }
+
         // Immediately tag the recording context as unused so we don't try to submit it in Tick.
         // Move the mRecordingContext.used to mUnusedCommands so it can be cleaned up in
         // ShutDownImpl
@@ -986,6 +1009,7 @@ namespace dawn::native::vulkan {
         // The VkRenderPasses in the cache can be destroyed immediately since all commands referring
         // to them are guaranteed to be finished executing.
         mRenderPassCache = nullptr;
+        mPipelineCache = nullptr;
 
         // We need handle deleting all child objects by calling Tick() again with a large serial to
         // force all operations to look as if they were completed, and delete all objects before
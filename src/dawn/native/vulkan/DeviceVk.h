@@ -38,6 +38,7 @@ namespace dawn::native::vulkan {
     class BindGroupLayout;
     class BufferUploader;
     class FencedDeleter;
+    class PipelineCache;
     class RenderPassCache;
     class ResourceMemoryAllocator;
 
@@ -60,6 +61,7 @@ namespace dawn::native::vulkan {
         VkQueue GetQueue() const;
 
         FencedDeleter* GetFencedDeleter() const;
+        PipelineCache* GetPipelineCache() const;
         RenderPassCache* GetRenderPassCache() const;
         ResourceMemoryAllocator* GetResourceMemoryAllocator() const;
 
@@ -170,6 +172,7 @@ namespace dawn::native::vulkan {
             mDescriptorAllocatorsPendingDeallocation;
         std::unique_ptr<FencedDeleter> mDeleter;
         std::unique_ptr<ResourceMemoryAllocator> mResourceMemoryAllocator;
+        std::unique_ptr<PipelineCache> mPipelineCache;
         std::unique_ptr<RenderPassCache> mRenderPassCache;
 
         std::unique_ptr<external_memory::Service> mExternalMemoryService;
@@ -0,0 +1,168 @@
+// Copyright 2022 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/native/vulkan/PipelineCache.h"
+
+#include "dawn/native/vulkan/DeviceVk.h"
+#include "dawn/native/vulkan/VulkanError.h"
+
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+#include <vector>
+
+namespace dawn::native::vulkan {
+
+    namespace {
+
+        // The minimum time between two stores of the cache data done by PipelineCache::Tick().
+        constexpr std::chrono::seconds kTickStoreInterval{5};
+
+    }  // anonymous namespace
+
+    PersistentCacheKey CreatePipelineCacheKey(const VkPhysicalDeviceProperties& properties) {
+        std::stringstream stream;
+
+        // Prefix the key with the type to avoid collisions from another type that could have the
+        // same key.
+        stream << static_cast<uint32_t>(PersistentKeyType::PipelineCache);
+        stream << "\n";
+
+        stream << "(PipelineCache";
+        stream << " vendorID=" << properties.vendorID;
+        stream << " deviceID=" << properties.deviceID;
+        stream << " driverVersion=" << properties.driverVersion;
+        stream << " pipelineCacheUUID=" << std::hex << std::setfill('0');
+        for (uint8_t byte : properties.pipelineCacheUUID) {
+            stream << std::setw(2) << static_cast<uint32_t>(byte);
+        }
+        stream << ")";
+
+        return PersistentCacheKey(std::istreambuf_iterator<char>{stream},
+                                  std::istreambuf_iterator<char>{});
+    }
+
+    bool IsPipelineCacheDataCompatible(const VkPhysicalDeviceProperties& properties,
+                                       const uint8_t* data,
+                                       size_t size) {
+        VkPipelineCacheHeaderVersionOne header;
+        if (data == nullptr || size < sizeof(header)) {
+            return false;
+        }
+
+        // The data comes from the platform and has no alignment guarantee.
+        memcpy(&header, data, sizeof(header));
+
+        return header.headerSize >= sizeof(header) && header.headerSize <= size &&
+               header.headerVersion == VK_PIPELINE_CACHE_HEADER_VERSION_ONE &&
+               header.vendorID == properties.vendorID && header.deviceID == properties.deviceID &&
+               memcmp(header.pipelineCacheUUID, properties.pipelineCacheUUID, VK_UUID_SIZE) == 0;
+    }
+
+    // static
+    ResultOrError<std::unique_ptr<PipelineCache>> PipelineCache::Create(Device* device) {
+        std::unique_ptr<PipelineCache> cache(new PipelineCache(device));
+        DAWN_TRY(cache->Initialize());
+        return std::move(cache);
+    }
+
+    PipelineCache::PipelineCache(Device* device)
+        : mDevice(device), mLastTickStoreTime(std::chrono::steady_clock::now()) {
+    }
+
+    PipelineCache::~PipelineCache() {
+        // VkPipelineCaches aren't used by GPU work so they can be destroyed immediately.
+        if (mHandle != VK_NULL_HANDLE) {
+            mDevice->fn.DestroyPipelineCache(mDevice->GetVkDevice(), mHandle, nullptr);
+            mHandle = VK_NULL_HANDLE;
+        }
+    }
+
+    MaybeError PipelineCache::Initialize() {
+        const VkPhysicalDeviceProperties& properties = mDevice->GetDeviceInfo().properties;
+
+        // Only build the key when there is a caching interface to load the data from. An empty
+        // key means the data is never stored either.
+        ScopedCachedBlob initialData;
+        PersistentCache* persistentCache = mDevice->GetPersistentCache();
+        if (persistentCache->IsEnabled()) {
+            mKey = CreatePipelineCacheKey(properties);
+            initialData = persistentCache->LoadData(mKey);
+            if (!IsPipelineCacheDataCompatible(properties, initialData.buffer.get(),
+                                               initialData.bufferSize)) {
+                initialData = {};
+            }
+        }
+
+        VkPipelineCacheCreateInfo createInfo;
+        createInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+        createInfo.pNext = nullptr;
+        createInfo.flags = 0;
+        createInfo.initialDataSize = initialData.bufferSize;
+        createInfo.pInitialData = initialData.buffer.get();
+
+        return CheckVkSuccess(mDevice->fn.CreatePipelineCache(mDevice->GetVkDevice(), &createInfo,
+                                                              nullptr, &*mHandle),
+                              "CreatePipelineCache");
+    }
+
+    VkPipelineCache PipelineCache::GetHandle() {
+        mIsDirty = true;
+        return mHandle;
+    }
+
+    MaybeError PipelineCache::StoreData() {
+        std::lock_guard<std::mutex> lock(mStoreMutex);
+        if (mKey.empty() || !mIsDirty.exchange(false)) {
+            return {};
+        }
+
+        size_t dataSize = 0;
+        DAWN_TRY(CheckVkSuccess(
+            mDevice->fn.GetPipelineCacheData(mDevice->GetVkDevice(), mHandle, &dataSize, nullptr),
+            "GetPipelineCacheData"));
+        if (dataSize == 0) {
+            return {};
+        }
+
+        std::vector<uint8_t> data(dataSize);
+        VkResult result = VkResult::WrapUnsafe(mDevice->fn.GetPipelineCacheData(
+            mDevice->GetVkDevice(), mHandle, &dataSize, data.data()));
+        // VK_INCOMPLETE means pipelines added data to the cache between the two calls. The partial
+        // data isn't guaranteed to be usable, so keep the cache dirty and store it next time.
+        if (result == VK_INCOMPLETE) {
+            mIsDirty = true;
+            return {};
+        }
+        DAWN_TRY(CheckVkSuccess(result, "GetPipelineCacheData"));
+
+        mDevice->GetPersistentCache()->StoreData(mKey, data.data(), dataSize);
+        return {};
+    }
+
+    MaybeError PipelineCache::Tick() {
+        if (mKey.empty() || !mIsDirty) {
+            return {};
+        }
+
+        std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+        if (now - mLastTickStoreTime < kTickStoreInterval) {
+            return {};
+        }
+        mLastTickStoreTime = now;
+
+        return StoreData();
+    }
+
+}  // namespace dawn::native::vulkan
@@ -0,0 +1,83 @@
+// Copyright 2022 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DAWNNATIVE_VULKAN_PIPELINECACHE_H_
+#define DAWNNATIVE_VULKAN_PIPELINECACHE_H_
+
+#include "dawn/common/vulkan_platform.h"
+#include "dawn/native/Error.h"
+#include "dawn/native/PersistentCache.h"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+
+namespace dawn::native::vulkan {
+
+    class Device;
+
+    // Returns the key under which the VkPipelineCache data of a physical device is stored in the
+    // persistent cache. Drivers only accept data created by the same device and driver version,
+    // so both are part of the key.
+    PersistentCacheKey CreatePipelineCacheKey(const VkPhysicalDeviceProperties& properties);
+
+    // Returns true if |data| starts with a pipeline cache header matching the device described by
+    // |properties|. Drivers are supposed to ignore incompatible data but some crash instead, so
+    // only compatible data is given to vkCreatePipelineCache.
+    bool IsPipelineCacheDataCompatible(const VkPhysicalDeviceProperties& properties,
+                                       const uint8_t* data,
+                                       size_t size);
+
+    // Wraps the VkPipelineCache used for all the pipelines of a device, so that the driver can
+    // reuse compilation work between pipelines. When the platform provides a caching interface,
+    // the cache data is loaded from it when the device is created and stored back to it
+    // periodically and when the device is destroyed, so that the work is also reused across runs.
+    // All the operations on PipelineCache are thread-safe: the driver synchronizes the accesses to
+    // the VkPipelineCache done by vkCreate*Pipelines, so it can be used from Create*PipelineAsync().
+    class PipelineCache {
+      public:
+        static ResultOrError<std::unique_ptr<PipelineCache>> Create(Device* device);
+        ~PipelineCache();
+
+        // Returns the VkPipelineCache to pass to vkCreate*Pipelines. Creating a pipeline can add
+        // data to the cache, so the data will be stored again on the next call to StoreData().
+        VkPipelineCache GetHandle();
+
+        // Stores the cache data in the persistent cache, if pipelines were created since the data
+        // was loaded or last stored.
+        MaybeError StoreData();
+
+        // Called on each device tick. Stores the cache data if pipelines were created and the
+        // data wasn't stored for a while, so that it isn't lost if the process exits without
+        // destroying the device, without reading back the cache after every pipeline creation.
+        MaybeError Tick();
+
+      private:
+        PipelineCache(Device* device);
+        MaybeError Initialize();
+
+        Device* mDevice = nullptr;
+        PersistentCacheKey mKey;
+        VkPipelineCache mHandle = VK_NULL_HANDLE;
+
+        std::atomic<bool> mIsDirty{false};
+        // Only used by Tick() on the device thread.
+        std::chrono::steady_clock::time_point mLastTickStoreTime;
+        std::mutex mStoreMutex;
+    };
+
+}  // namespace dawn::native::vulkan
+
+#endif  // DAWNNATIVE_VULKAN_PIPELINECACHE_H_
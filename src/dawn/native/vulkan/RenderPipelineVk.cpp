@@ -17,6 +17,7 @@
 #include "dawn/native/CreatePipelineAsyncTask.h"
 #include "dawn/native/vulkan/DeviceVk.h"
 #include "dawn/native/vulkan/FencedDeleter.h"
+#include "dawn/native/vulkan/PipelineCache.h"
 #include "dawn/native/vulkan/PipelineLayoutVk.h"
 #include "dawn/native/vulkan/RenderPassCache.h"
 #include "dawn/native/vulkan/ShaderModuleVk.h"
@@ -541,7 +542,8 @@ namespace dawn::native::vulkan {
         createInfo.basePipelineIndex = -1;
 
         DAWN_TRY(CheckVkSuccess(
-            device->fn.CreateGraphicsPipelines(device->GetVkDevice(), VkPipelineCache{}, 1,
+            device->fn.CreateGraphicsPipelines(device->GetVkDevice(),
+                                               device->GetPipelineCache()->GetHandle(), 1,
                                                &createInfo, nullptr, &*mHandle),
             "CreateGraphicsPipeline"));
 
@@ -14,19 +14,20 @@
 
 #include "dawn/native/vulkan/ShaderModuleVk.h"
 
-#include "dawn/native/SpirvValidation.h"
 #include "dawn/native/TintUtils.h"
 #include "dawn/native/vulkan/BindGroupLayoutVk.h"
 #include "dawn/native/vulkan/DeviceVk.h"
 #include "dawn/native/vulkan/FencedDeleter.h"
 #include "dawn/native/vulkan/PipelineLayoutVk.h"
+#include "dawn/native/vulkan/SpirvCompilation.h"
 #include "dawn/native/vulkan/UtilsVulkan.h"
 #include "dawn/native/vulkan/VulkanError.h"
 #include "dawn/platform/DawnPlatform.h"
 #include "dawn/platform/tracing/TraceEvent.h"
 
 #include <tint/tint.h>
-#include <spirv-tools/libspirv.hpp>
+
+#include <map>
 
 namespace dawn::native::vulkan {
 
@@ -85,19 +86,7 @@ namespace dawn::native::vulkan {
     }
 
     MaybeError ShaderModule::Initialize(ShaderModuleParseResult* parseResult) {
-        if (GetDevice()->IsRobustnessEnabled()) {
-            ScopedTintICEHandler scopedICEHandler(GetDevice());
-
-            tint::transform::Robustness robustness;
-            tint::transform::DataMap transformInputs;
-
-            tint::Program program;
-            DAWN_TRY_ASSIGN(program, RunTransforms(&robustness, parseResult->tintProgram.get(),
-                                                   transformInputs, nullptr, nullptr));
-            // Rather than use a new ParseResult object, we just reuse the original parseResult
-            parseResult->tintProgram = std::make_unique<tint::Program>(std::move(program));
-        }
-
+        ScopedTintICEHandler scopedICEHandler(GetDevice());
         return InitializeBase(parseResult);
     }
 
@@ -154,17 +143,6 @@ namespace dawn::native::vulkan {
             }
         }
 
-        tint::transform::Manager transformManager;
-        transformManager.append(std::make_unique<tint::transform::BindingRemapper>());
-        // Many Vulkan drivers can't handle multi-entrypoint shader modules.
-        transformManager.append(std::make_unique<tint::transform::SingleEntryPoint>());
-
-        tint::transform::DataMap transformInputs;
-        transformInputs.Add<BindingRemapper::Remappings>(std::move(bindingPoints),
-                                                         std::move(accessControls),
-                                                         /* mayCollide */ false);
-        transformInputs.Add<tint::transform::SingleEntryPoint::Config>(entryPointName);
-
         // Transform external textures into the binding locations specified in the bgl
         // TODO(dawn:1082): Replace this block with ShaderModuleBase::AddExternalTextureTransform.
         tint::transform::MultiplanarExternalTexture::BindingsMap newBindingsMap;
@@ -188,42 +166,24 @@ namespace dawn::native::vulkan {
             }
         }
 
-        if (!newBindingsMap.empty()) {
-            transformManager.Add<tint::transform::MultiplanarExternalTexture>();
-            transformInputs.Add<tint::transform::MultiplanarExternalTexture::NewBindingPoints>(
-                newBindingsMap);
-        }
-
-        tint::Program program;
-        {
-            TRACE_EVENT0(GetDevice()->GetPlatform(), General, "RunTransforms");
-            DAWN_TRY_ASSIGN(program, RunTransforms(&transformManager, GetTintProgram(),
-                                                   transformInputs, nullptr, nullptr));
-        }
-
-        tint::writer::spirv::Options options;
-        options.emit_vertex_point_size = true;
-        options.disable_workgroup_init = GetDevice()->IsToggleEnabled(Toggle::DisableWorkgroupInit);
-
-        std::vector<uint32_t> spirv;
-        {
-            TRACE_EVENT0(GetDevice()->GetPlatform(), General, "tint::writer::spirv::Generate()");
-            auto result = tint::writer::spirv::Generate(&program, options);
-            DAWN_INVALID_IF(!result.success, "An error occured while generating SPIR-V: %s.",
-                            result.error);
-
-            spirv = std::move(result.spirv);
-        }
+        SpirvCompilationRequest request;
+        request.program = GetTintProgram();
+        request.entryPointName = entryPointName;
+        request.bindingPoints = std::move(bindingPoints);
+        request.accessControls = std::move(accessControls);
+        request.newBindingsMap = std::move(newBindingsMap);
+        request.disableWorkgroupInit = GetDevice()->IsToggleEnabled(Toggle::DisableWorkgroupInit);
+        request.isRobustnessEnabled = GetDevice()->IsRobustnessEnabled();
 
-        DAWN_TRY(
-            ValidateSpirv(GetDevice(), spirv, GetDevice()->IsToggleEnabled(Toggle::DumpShaders)));
+        CompiledSpirv compiledSpirv;
+        DAWN_TRY_ASSIGN(compiledSpirv, LoadOrGenerateSpirv(GetDevice(), request));
 
         VkShaderModuleCreateInfo createInfo;
         createInfo.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
         createInfo.pNext = nullptr;
         createInfo.flags = 0;
-        createInfo.codeSize = spirv.size() * sizeof(uint32_t);
-        createInfo.pCode = spirv.data();
+        createInfo.codeSize = compiledSpirv.GetCodeSize();
+        createInfo.pCode = compiledSpirv.GetCode();
 
         Device* device = ToBackend(GetDevice());
 
@@ -0,0 +1,225 @@
+// Copyright 2022 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/native/vulkan/SpirvCompilation.h"
+
+#include "dawn/common/Version_autogen.h"
+#include "dawn/native/Device.h"
+#include "dawn/native/SpirvValidation.h"
+#include "dawn/native/TintUtils.h"
+#include "dawn/platform/DawnPlatform.h"
+#include "dawn/platform/tracing/TraceEvent.h"
+
+#include <map>
+#include <sstream>
+
+namespace dawn::native::vulkan {
+
+    namespace {
+
+        struct CompareBindingPoint {
+            constexpr bool operator()(const tint::transform::BindingPoint& lhs,
+                                      const tint::transform::BindingPoint& rhs) const {
+                if (lhs.group != rhs.group) {
+                    return lhs.group < rhs.group;
+                } else {
+                    return lhs.binding < rhs.binding;
+                }
+            }
+        };
+
+        void Serialize(std::stringstream& output, const tint::ast::Access& access) {
+            output << access;
+        }
+
+        void Serialize(std::stringstream& output,
+                       const tint::transform::BindingPoint& bindingPoint) {
+            output << "(BindingPoint";
+            output << " group=" << bindingPoint.group;
+            output << " binding=" << bindingPoint.binding;
+            output << ")";
+        }
+
+        void Serialize(std::stringstream& output,
+                       const tint::transform::BindingPoints& bindingPoints) {
+            output << "(BindingPoints";
+            output << " plane_1=";
+            Serialize(output, bindingPoints.plane_1);
+            output << " params=";
+            Serialize(output, bindingPoints.params);
+            output << ")";
+        }
+
+        template <typename T>
+        void Serialize(std::stringstream& output,
+                       const std::unordered_map<tint::transform::BindingPoint, T>& map) {
+            output << "(map";
+
+            std::map<tint::transform::BindingPoint, T, CompareBindingPoint> sorted(map.begin(),
+                                                                                   map.end());
+            for (auto& [bindingPoint, value] : sorted) {
+                output << " ";
+                Serialize(output, bindingPoint);
+                output << "=";
+                Serialize(output, value);
+            }
+            output << ")";
+        }
+
+        ResultOrError<std::vector<uint32_t>> GenerateSpirv(DeviceBase* device,
+                                                           const SpirvCompilationRequest& request) {
+            tint::transform::Manager transformManager;
+            tint::transform::DataMap transformInputs;
+
+            // Many Vulkan drivers can't handle multi-entrypoint shader modules. Strip the other
+            // entry points first so that the later transforms and the SPIR-V writer only process
+            // the code reachable from this one.
+            transformManager.Add<tint::transform::SingleEntryPoint>();
+            transformInputs.Add<tint::transform::SingleEntryPoint::Config>(request.entryPointName);
+
+            if (request.isRobustnessEnabled) {
+                transformManager.Add<tint::transform::Robustness>();
+            }
+
+            transformManager.Add<tint::transform::BindingRemapper>();
+            transformInputs.Add<tint::transform::BindingRemapper::Remappings>(
+                request.bindingPoints, request.accessControls,
+                /* mayCollide */ false);
+
+            if (!request.newBindingsMap.empty()) {
+                transformManager.Add<tint::transform::MultiplanarExternalTexture>();
+                transformInputs
+                    .Add<tint::transform::MultiplanarExternalTexture::NewBindingPoints>(
+                        request.newBindingsMap);
+            }
+
+            RequestTransformTimings(device, &transformInputs);
+
+            tint::Program program;
+            tint::transform::DataMap transformOutputs;
+            {
+                TRACE_EVENT0(device->GetPlatform(), General, "RunTransforms");
+                DAWN_TRY_ASSIGN(program,
+                                RunTransforms(&transformManager, request.program, transformInputs,
+                                              &transformOutputs, nullptr));
+            }
+            DumpTransformTimings(device, transformOutputs);
+
+            tint::writer::spirv::Options options;
+            options.emit_vertex_point_size = true;
+            options.disable_workgroup_init = request.disableWorkgroupInit;
+
+            std::vector<uint32_t> spirv;
+            {
+                TRACE_EVENT0(device->GetPlatform(), General, "tint::writer::spirv::Generate()");
+                auto result = tint::writer::spirv::Generate(&program, options);
+                DAWN_INVALID_IF(!result.success, "An error occured while generating SPIR-V: %s.",
+                                result.error);
+
+                spirv = std::move(result.spirv);
+            }
+
+            DAWN_TRY(
+                ValidateSpirv(device, spirv, device->IsToggleEnabled(Toggle::DumpShaders)));
+
+            return std::move(spirv);
+        }
+
+    }  // anonymous namespace
+
+    ResultOrError<PersistentCacheKey> SpirvCompilationRequest::CreateCacheKey() const {
+        // Generate the WGSL from the Tint program so it's normalized.
+        auto result = tint::writer::wgsl::Generate(program, tint::writer::wgsl::Options{});
+        DAWN_INVALID_IF(!result.success, "An error occured while generating WGSL: %s.",
+                        result.error);
+
+        std::stringstream stream;
+
+        // Prefix the key with the type to avoid collisions from another type that could
+        // have the same key.
+        stream << static_cast<uint32_t>(PersistentKeyType::Shader);
+        stream << "\n";
+
+        // The SPIR-V generated for the same inputs changes with the version of Dawn and Tint, so
+        // the key contains the git hash of the checkout they were built from.
+        stream << kGitHash;
+        stream << "\n";
+
+        stream << result.wgsl.length();
+        stream << "\n";
+
+        stream << result.wgsl;
+        stream << "\n";
+
+        stream << "(SpirvCompilationRequest";
+        stream << " entryPointName=" << entryPointName;
+
+        stream << " bindingPoints=";
+        Serialize(stream, bindingPoints);
+
+        stream << " accessControls=";
+        Serialize(stream, accessControls);
+
+        stream << " newBindingsMap=";
+        Serialize(stream, newBindingsMap);
+
+        stream << " disableWorkgroupInit=" << disableWorkgroupInit;
+        stream << " isRobustnessEnabled=" << isRobustnessEnabled;
+        stream << ")";
+        stream << "\n";
+
+        return PersistentCacheKey(std::istreambuf_iterator<char>{stream},
+                                  std::istreambuf_iterator<char>{});
+    }
+
+    const uint32_t* CompiledSpirv::GetCode() const {
+        if (cachedSpirv.buffer != nullptr) {
+            return reinterpret_cast<const uint32_t*>(cachedSpirv.buffer.get());
+        }
+        return spirv.data();
+    }
+
+    size_t CompiledSpirv::GetCodeSize() const {
+        if (cachedSpirv.buffer != nullptr) {
+            return cachedSpirv.bufferSize;
+        }
+        return spirv.size() * sizeof(uint32_t);
+    }
+
+    ResultOrError<CompiledSpirv> LoadOrGenerateSpirv(DeviceBase* device,
+                                                     const SpirvCompilationRequest& request) {
+        CompiledSpirv compiled;
+
+        // Look up the SPIR-V in the persistent cache before running the transforms and the
+        // SPIR-V writer, as they are the most expensive part of the pipeline creation.
+        PersistentCache* persistentCache = device->GetPersistentCache();
+        if (persistentCache->IsEnabled() && !kGitHash.empty()) {
+            PersistentCacheKey spirvCacheKey;
+            DAWN_TRY_ASSIGN(spirvCacheKey, request.CreateCacheKey());
+            DAWN_TRY_ASSIGN(compiled.cachedSpirv,
+                            persistentCache->GetOrCreate(
+                                spirvCacheKey, [&](auto doCache) -> MaybeError {
+                                    DAWN_TRY_ASSIGN(compiled.spirv, GenerateSpirv(device, request));
+                                    doCache(compiled.spirv.data(),
+                                            compiled.spirv.size() * sizeof(uint32_t));
+                                    return {};
+                                }));
+        } else {
+            DAWN_TRY_ASSIGN(compiled.spirv, GenerateSpirv(device, request));
+        }
+
+        return std::move(compiled);
+    }
+
+}  // namespace dawn::native::vulkan
@@ -0,0 +1,64 @@
+// Copyright 2022 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DAWNNATIVE_VULKAN_SPIRVCOMPILATION_H_
+#define DAWNNATIVE_VULKAN_SPIRVCOMPILATION_H_
+
+#include "dawn/native/Error.h"
+#include "dawn/native/PersistentCache.h"
+
+#include <tint/tint.h>
+
+#include <vector>
+
+namespace dawn::native {
+    class DeviceBase;
+}  // namespace dawn::native
+
+namespace dawn::native::vulkan {
+
+    // The inputs of the SPIR-V generation for one entry point of a shader module. Everything
+    // that can change the generated SPIR-V must be part of the persistent cache key.
+    struct SpirvCompilationRequest {
+        const tint::Program* program;
+        const char* entryPointName;
+        tint::transform::BindingRemapper::BindingPoints bindingPoints;
+        tint::transform::BindingRemapper::AccessControls accessControls;
+        tint::transform::MultiplanarExternalTexture::BindingsMap newBindingsMap;
+        bool disableWorkgroupInit;
+        bool isRobustnessEnabled;
+
+        ResultOrError<PersistentCacheKey> CreateCacheKey() const;
+    };
+
+    // The SPIR-V generated for a SpirvCompilationRequest, either loaded from the persistent cache
+    // or generated by Tint.
+    struct CompiledSpirv {
+        const uint32_t* GetCode() const;
+        // The size of the code in bytes, as expected by VkShaderModuleCreateInfo::codeSize.
+        size_t GetCodeSize() const;
+
+        ScopedCachedBlob cachedSpirv;
+        std::vector<uint32_t> spirv;
+    };
+
+    // Returns the SPIR-V stored in the persistent cache for |request|, or generates it and stores
+    // it in the persistent cache. The persistent cache is skipped when Dawn isn't built from a git
+    // checkout, as the SPIR-V of different builds couldn't be told apart.
+    ResultOrError<CompiledSpirv> LoadOrGenerateSpirv(DeviceBase* device,
+                                                     const SpirvCompilationRequest& request);
+
+}  // namespace dawn::native::vulkan
+
+#endif  // DAWNNATIVE_VULKAN_SPIRVCOMPILATION_H_
@@ -56,6 +56,13 @@ namespace dawn::platform {
         return nullptr;
     }
 
+    std::unique_ptr<WaitableEvent> WorkerTaskPool::PostWorkerTaskWithPriority(
+        PostWorkerTaskCallback callback,
+        void* userdata,
+        WorkerTaskPriority) {
+        return PostWorkerTask(callback, userdata);
+    }
+
     std::unique_ptr<dawn::platform::WorkerTaskPool> Platform::CreateWorkerTaskPool() {
         return std::make_unique<AsyncWorkerThreadPool>();
     }
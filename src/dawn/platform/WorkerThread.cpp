@@ -14,14 +14,18 @@
 
 #include "dawn/platform/WorkerThread.h"
 
+#include <algorithm>
+#include <array>
 #include <condition_variable>
-#include <functional>
-#include <thread>
 
 #include "dawn/common/Assert.h"
 
 namespace {
 
+    constexpr uint32_t kMinDefaultWorkerCount = 2;
+    constexpr uint32_t kMaxDefaultWorkerCount = 16;
+    constexpr size_t kPriorityCount = 2;
+
     class AsyncWaitableEventImpl {
       public:
         AsyncWaitableEventImpl() : mIsComplete(false) {
@@ -77,21 +81,155 @@ namespace {
 
 namespace dawn::platform {
 
+    struct AsyncWorkerThreadPool::Task {
+        dawn::platform::PostWorkerTaskCallback callback;
+        void* userdata;
+        std::shared_ptr<AsyncWaitableEventImpl> waitableEventImpl;
+    };
+
+    struct AsyncWorkerThreadPool::WorkerQueue {
+        std::mutex mutex;
+        std::array<std::deque<Task>, kPriorityCount> tasks;
+    };
+
+    AsyncWorkerThreadPool::AsyncWorkerThreadPool(uint32_t workerCount)
+        : mMaxWorkerCount(workerCount != 0 ? workerCount : GetDefaultWorkerCount()) {
+        mQueues.reserve(mMaxWorkerCount);
+        for (uint32_t i = 0; i < mMaxWorkerCount; ++i) {
+            mQueues.push_back(std::make_unique<WorkerQueue>());
+        }
+    }
+
+    AsyncWorkerThreadPool::~AsyncWorkerThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mIsShuttingDown = true;
+        }
+        mCondition.notify_all();
+
+        // The workers drain all the tasks still in the queues before exiting so that every
+        // WaitableEvent returned by PostWorkerTask() gets completed. No worker is started once
+        // mIsShuttingDown is set, so mWorkers doesn't change anymore.
+        for (std::thread& worker : mWorkers) {
+            worker.join();
+        }
+    }
+
+    // static
+    uint32_t AsyncWorkerThreadPool::GetDefaultWorkerCount() {
+        return std::clamp(std::thread::hardware_concurrency(), kMinDefaultWorkerCount,
+                          kMaxDefaultWorkerCount);
+    }
+
+    uint32_t AsyncWorkerThreadPool::GetMaxWorkerCount() const {
+        return mMaxWorkerCount;
+    }
+
+    uint32_t AsyncWorkerThreadPool::GetWorkerCount() {
+        return mStartedWorkerCount.load();
+    }
+
     std::unique_ptr<dawn::platform::WaitableEvent> AsyncWorkerThreadPool::PostWorkerTask(
         dawn::platform::PostWorkerTaskCallback callback,
         void* userdata) {
-        std::unique_ptr<AsyncWaitableEvent> waitableEvent = std::make_unique<AsyncWaitableEvent>();
+        return PostWorkerTaskWithPriority(callback, userdata, WorkerTaskPriority::Normal);
+    }
 
-        std::function<void()> doTask =
-            [callback, userdata, waitableEventImpl = waitableEvent->GetWaitableEventImpl()]() {
-                callback(userdata);
-                waitableEventImpl->MarkAsComplete();
-            };
+    std::unique_ptr<dawn::platform::WaitableEvent>
+    AsyncWorkerThreadPool::PostWorkerTaskWithPriority(
+        dawn::platform::PostWorkerTaskCallback callback,
+        void* userdata,
+        WorkerTaskPriority priority) {
+        std::unique_ptr<AsyncWaitableEvent> waitableEvent = std::make_unique<AsyncWaitableEvent>();
+        Task task = {callback, userdata, waitableEvent->GetWaitableEventImpl()};
+
+        StartWorkerIfNeeded();
+
+        // Only the queues of the started workers are used so that tasks don't wait for a worker
+        // to steal them. There is at least one started worker after StartWorkerIfNeeded().
+        uint32_t queueIndex =
+            mNextQueue.fetch_add(1, std::memory_order_relaxed) % mStartedWorkerCount.load();
+        WorkerQueue* queue = mQueues[queueIndex].get();
+        {
+            std::lock_guard<std::mutex> lock(queue->mutex);
+            queue->tasks[static_cast<size_t>(priority)].push_back(std::move(task));
+        }
 
-        std::thread thread(doTask);
-        thread.detach();
+        // A worker going to sleep increments mIdleWorkerCount before it checks mQueuedTaskCount,
+        // and this is done in the reverse order here. Both are sequentially consistent, so either
+        // the worker sees the new task or a sleeping worker is seen and woken up. Taking mMutex
+        // makes sure that a worker that has checked mQueuedTaskCount is waiting on mCondition
+        // before it is notified.
+        mQueuedTaskCount++;
+        if (mIdleWorkerCount.load() > 0) {
+            { std::lock_guard<std::mutex> lock(mMutex); }
+            mCondition.notify_one();
+        }
 
         return waitableEvent;
     }
 
+    void AsyncWorkerThreadPool::StartWorkerIfNeeded() {
+        // Start a new worker only if all the idle ones will already be woken up by the tasks
+        // that are still queued.
+        if (mStartedWorkerCount.load() == mMaxWorkerCount ||
+            mIdleWorkerCount.load() > mQueuedTaskCount.load()) {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(mMutex);
+        // Tasks posted by tasks that run during the destruction of the pool are run by the
+        // workers that are still draining the queues.
+        if (mIsShuttingDown || mWorkers.size() == mMaxWorkerCount) {
+            return;
+        }
+        uint32_t workerIndex = static_cast<uint32_t>(mWorkers.size());
+        mWorkers.emplace_back([this, workerIndex] { WorkerLoop(workerIndex); });
+        mStartedWorkerCount.store(workerIndex + 1);
+    }
+
+    void AsyncWorkerThreadPool::WorkerLoop(uint32_t workerIndex) {
+        while (true) {
+            Task task;
+            if (PopTask(workerIndex, &task)) {
+                task.callback(task.userdata);
+                task.waitableEventImpl->MarkAsComplete();
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(mMutex);
+            mIdleWorkerCount++;
+            mCondition.wait(lock,
+                            [this] { return mQueuedTaskCount.load() > 0 || mIsShuttingDown; });
+            mIdleWorkerCount--;
+
+            if (mQueuedTaskCount.load() <= 0) {
+                ASSERT(mIsShuttingDown);
+                return;
+            }
+        }
+    }
+
+    bool AsyncWorkerThreadPool::PopTask(uint32_t workerIndex, Task* task) {
+        // Look in the higher priority queues first, starting with this worker's own queue before
+        // stealing from the others. Queues are only locked one at a time. This returns false if
+        // another worker took the task first, or if its push isn't done yet. The worker then
+        // waits until mQueuedTaskCount is positive again.
+        uint32_t queueCount = mStartedWorkerCount.load();
+        for (size_t priority = 0; priority < kPriorityCount; ++priority) {
+            for (uint32_t i = 0; i < queueCount; ++i) {
+                WorkerQueue* queue = mQueues[(workerIndex + i) % queueCount].get();
+                std::lock_guard<std::mutex> lock(queue->mutex);
+                std::deque<Task>& tasks = queue->tasks[priority];
+                if (!tasks.empty()) {
+                    *task = std::move(tasks.front());
+                    tasks.pop_front();
+                    mQueuedTaskCount--;
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
 }  // namespace dawn::platform
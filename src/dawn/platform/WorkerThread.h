@@ -18,13 +18,69 @@
 #include "dawn/common/NonCopyable.h"
 #include "dawn/platform/DawnPlatform.h"
 
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
 namespace dawn::platform {
 
+    // A bounded pool of persistent worker threads. Each worker owns one task queue per priority,
+    // guarded by a lock of its own. Tasks are posted round-robin to the workers' queues and a
+    // worker steals from the other workers' queues when its own are empty, so a burst of tasks is
+    // spread over all the workers without paying the cost of a thread creation per task, and
+    // posting or running a task only contends on the lock of one queue. Worker threads are started
+    // lazily, only when all the existing ones are busy, up to |workerCount|.
     class AsyncWorkerThreadPool : public dawn::platform::WorkerTaskPool, public NonCopyable {
       public:
+        // A |workerCount| of 0 selects GetDefaultWorkerCount(). Exported for the tests.
+        DAWN_PLATFORM_EXPORT explicit AsyncWorkerThreadPool(uint32_t workerCount = 0);
+        DAWN_PLATFORM_EXPORT ~AsyncWorkerThreadPool() override;
+
+        static uint32_t GetDefaultWorkerCount();
+
         std::unique_ptr<dawn::platform::WaitableEvent> PostWorkerTask(
             dawn::platform::PostWorkerTaskCallback callback,
             void* userdata) override;
+        std::unique_ptr<dawn::platform::WaitableEvent> PostWorkerTaskWithPriority(
+            dawn::platform::PostWorkerTaskCallback callback,
+            void* userdata,
+            WorkerTaskPriority priority) override;
+
+        uint32_t GetMaxWorkerCount() const;
+        // Returns the number of worker threads started so far.
+        uint32_t GetWorkerCount();
+
+      private:
+        struct Task;
+        struct WorkerQueue;
+
+        void StartWorkerIfNeeded();
+        void WorkerLoop(uint32_t workerIndex);
+        bool PopTask(uint32_t workerIndex, Task* task);
+
+        const uint32_t mMaxWorkerCount;
+
+        // Sized to mMaxWorkerCount on creation and never resized. Each queue has its own lock.
+        std::vector<std::unique_ptr<WorkerQueue>> mQueues;
+        std::atomic<uint32_t> mNextQueue = {0};
+        // The number of tasks in the queues. It is incremented after a task is pushed, so it is
+        // briefly negative when a worker pops a task before its push is counted.
+        std::atomic<int64_t> mQueuedTaskCount = {0};
+        std::atomic<uint32_t> mIdleWorkerCount = {0};
+        // The size of mWorkers, readable without taking mMutex.
+        std::atomic<uint32_t> mStartedWorkerCount = {0};
+
+        // Protects the members below. Only idle workers going to sleep, the wake-ups of idle
+        // workers and the start of new workers take it.
+        std::mutex mMutex;
+        std::condition_variable mCondition;
+        std::vector<std::thread> mWorkers;
+        bool mIsShuttingDown = false;
     };
 
 }  // namespace dawn::platform
@@ -61,6 +61,9 @@ void DawnNativeTest::SetUp() {
 
     ASSERT(foundNullAdapter);
 
+    platform = CreateTestPlatform();
+    instance->SetPlatform(platform.get());
+
     device = wgpu::Device(CreateTestDevice());
     device.SetUncapturedErrorCallback(DawnNativeTest::OnDeviceError, nullptr);
 }
@@ -81,6 +84,10 @@ WGPUDevice DawnNativeTest::CreateTestDevice() {
     return adapter.CreateDevice(&deviceDescriptor);
 }
 
+std::unique_ptr<dawn::platform::Platform> DawnNativeTest::CreateTestPlatform() {
+    return nullptr;
+}
+
 // static
 void DawnNativeTest::OnDeviceError(WGPUErrorType type, const char* message, void* userdata) {
     ASSERT(type != WGPUErrorType_NoError);
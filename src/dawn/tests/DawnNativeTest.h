@@ -19,8 +19,11 @@
 
 #include "dawn/native/DawnNative.h"
 #include "dawn/native/ErrorData.h"
+#include "dawn/platform/DawnPlatform.h"
 #include "dawn/webgpu_cpp.h"
 
+#include <memory>
+
 namespace dawn::native {
 
     // This is similar to DAWN_TRY_ASSIGN but produces a fatal GTest error if EXPR is an error.
@@ -40,8 +43,12 @@ class DawnNativeTest : public ::testing::Test {
     void TearDown() override;
 
     virtual WGPUDevice CreateTestDevice();
+    // Tests can provide a platform that is set on the instance before the device is created.
+    virtual std::unique_ptr<dawn::platform::Platform> CreateTestPlatform();
 
   protected:
+    // Declared before the instance so that it outlives the device.
+    std::unique_ptr<dawn::platform::Platform> platform;
     std::unique_ptr<dawn::native::Instance> instance;
     dawn::native::Adapter adapter;
     wgpu::Device device;
@@ -139,7 +139,7 @@ TEST_P(D3D12CachingTests, SameShaderNoCache) {
 
 // Test creating a pipeline from two entrypoints in multiple stages will cache the correct number
 // of HLSL shaders. WGSL shader should result into caching 2 HLSL shaders (stage x
-// entrypoints)
+// entrypoints), in addition to the parsed WGSL program.
 TEST_P(D3D12CachingTests, ReuseShaderWithMultipleEntryPointsPerStage) {
     wgpu::ShaderModule module = utils::CreateShaderModule(device, R"(
         @stage(vertex) fn vertex_main() -> @builtin(position) vec4<f32> {
@@ -162,7 +162,7 @@ TEST_P(D3D12CachingTests, ReuseShaderWithMultipleEntryPointsPerStage) {
         EXPECT_CACHE_HIT(0u, device.CreateRenderPipeline(&desc));
     }
 
-    EXPECT_EQ(mPersistentCache.mCache.size(), 2u);
+    EXPECT_EQ(mPersistentCache.mCache.size(), 3u);
 
     // Load the same WGSL shader from the cache.
     {
@@ -177,7 +177,7 @@ TEST_P(D3D12CachingTests, ReuseShaderWithMultipleEntryPointsPerStage) {
         EXPECT_CACHE_HIT(4u, device.CreateRenderPipeline(&desc));
     }
 
-    EXPECT_EQ(mPersistentCache.mCache.size(), 2u);
+    EXPECT_EQ(mPersistentCache.mCache.size(), 3u);
 
     // Modify the WGSL shader functions and make sure it doesn't hit.
     wgpu::ShaderModule newModule = utils::CreateShaderModule(device, R"(
@@ -201,11 +201,12 @@ TEST_P(D3D12CachingTests, ReuseShaderWithMultipleEntryPointsPerStage) {
 
     // Cached HLSL shader calls LoadData twice (once to peek, again to get), so check 2 x
     // kNumOfShaders hits.
-    EXPECT_EQ(mPersistentCache.mCache.size(), 4u);
+    EXPECT_EQ(mPersistentCache.mCache.size(), 6u);
 }
 
 // Test creating a WGSL shader with two entrypoints in the same stage will cache the correct number
-// of HLSL shaders. WGSL shader should result into caching 1 HLSL shader (stage x entrypoints)
+// of HLSL shaders. WGSL shader should result into caching 1 HLSL shader (stage x entrypoints), in
+// addition to the parsed WGSL program.
 TEST_P(D3D12CachingTests, ReuseShaderWithMultipleEntryPoints) {
     wgpu::ShaderModule module = utils::CreateShaderModule(device, R"(
         struct Data {
@@ -234,7 +235,7 @@ TEST_P(D3D12CachingTests, ReuseShaderWithMultipleEntryPoints) {
         EXPECT_CACHE_HIT(0u, device.CreateComputePipeline(&desc));
     }
 
-    EXPECT_EQ(mPersistentCache.mCache.size(), 2u);
+    EXPECT_EQ(mPersistentCache.mCache.size(), 3u);
 
     // Load the same WGSL shader from the cache.
     {
@@ -253,7 +254,7 @@ TEST_P(D3D12CachingTests, ReuseShaderWithMultipleEntryPoints) {
         EXPECT_CACHE_HIT(2u, device.CreateComputePipeline(&desc));
     }
 
-    EXPECT_EQ(mPersistentCache.mCache.size(), 2u);
+    EXPECT_EQ(mPersistentCache.mCache.size(), 3u);
 }
 
 DAWN_INSTANTIATE_TEST(D3D12CachingTests, D3D12Backend());
@@ -0,0 +1,201 @@
+// Copyright 2022 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/tests/DawnTest.h"
+
+#include "dawn/utils/WGPUHelpers.h"
+
+#define EXPECT_CACHE_STATS(hits, misses, statement)                    \
+    do {                                                               \
+        size_t hitsBefore = mPersistentCache->mHitCount;                \
+        size_t missesBefore = mPersistentCache->mMissCount;             \
+        statement;                                                     \
+        FlushWire();                                                   \
+        EXPECT_EQ(hits, mPersistentCache->mHitCount - hitsBefore);      \
+        EXPECT_EQ(misses, mPersistentCache->mMissCount - missesBefore); \
+    } while (0)
+
+// CountingPersistentCache implements an in-memory persistent cache that counts the number of
+// lookups that found (hits) or didn't find (misses) their key.
+class CountingPersistentCache : public dawn::platform::CachingInterface {
+  public:
+    void StoreData(const WGPUDevice device,
+                   const void* key,
+                   size_t keySize,
+                   const void* value,
+                   size_t valueSize) override {
+        if (mIsDisabled) {
+            return;
+        }
+        const std::string keyStr(reinterpret_cast<const char*>(key), keySize);
+
+        const uint8_t* valueStart = reinterpret_cast<const uint8_t*>(value);
+        std::vector<uint8_t> entryValue(valueStart, valueStart + valueSize);
+
+        EXPECT_TRUE(mCache.insert({keyStr, std::move(entryValue)}).second);
+    }
+
+    size_t LoadData(const WGPUDevice device,
+                    const void* key,
+                    size_t keySize,
+                    void* value,
+                    size_t valueSize) override {
+        const std::string keyStr(reinterpret_cast<const char*>(key), keySize);
+        auto entry = mCache.find(keyStr);
+        if (entry == mCache.end()) {
+            mMissCount++;
+            return 0;
+        }
+        // PersistentCache calls LoadData twice per hit: once with no buffer to query the size,
+        // then again to get the data. Only count the second call.
+        if (value != nullptr && valueSize >= entry->second.size()) {
+            memcpy(value, entry->second.data(), entry->second.size());
+            mHitCount++;
+        }
+        return entry->second.size();
+    }
+
+    using Blob = std::vector<uint8_t>;
+    std::unordered_map<std::string, Blob> mCache;
+
+    size_t mHitCount = 0;
+    size_t mMissCount = 0;
+    bool mIsDisabled = false;
+};
+
+// Test platform that only supports caching. It owns the cache because the device stores its
+// pipeline cache data on destruction, after the members of the test fixture are destroyed.
+class CachingTestPlatform : public dawn::platform::Platform {
+  public:
+    ~CachingTestPlatform() override = default;
+
+    dawn::platform::CachingInterface* GetCachingInterface(const void* fingerprint,
+                                                          size_t fingerprintSize) override {
+        return &mPersistentCache;
+    }
+
+    CountingPersistentCache mPersistentCache;
+};
+
+class VulkanCachingTests : public DawnTest {
+  protected:
+    std::unique_ptr<dawn::platform::Platform> CreateTestPlatform() override {
+        auto platform = std::make_unique<CachingTestPlatform>();
+        mPersistentCache = &platform->mPersistentCache;
+        return platform;
+    }
+
+    // Creates a compute pipeline for `entryPoint`, releasing the shader module and the pipeline
+    // before returning so that the next call can't reuse any in-memory cached object.
+    void CreateComputePipeline(const char* shader, const char* entryPoint) {
+        wgpu::ComputePipelineDescriptor desc;
+        desc.compute.module = utils::CreateShaderModule(device, shader);
+        desc.compute.entryPoint = entryPoint;
+        device.CreateComputePipeline(&desc);
+    }
+
+    CountingPersistentCache* mPersistentCache = nullptr;
+};
+
+constexpr char kShader[] = R"(
+    struct Data {
+        data : u32;
+    };
+    @binding(0) @group(0) var<storage, read_write> data : Data;
+
+    @stage(compute) @workgroup_size(1) fn write1() {
+        data.data = 1u;
+    }
+
+    @stage(compute) @workgroup_size(1) fn write42() {
+        data.data = 42u;
+    }
+)";
+
+constexpr char kModifiedShader[] = R"(
+    struct Data {
+        data : u32;
+    };
+    @binding(0) @group(0) var<storage, read_write> data : Data;
+
+    @stage(compute) @workgroup_size(1) fn write1() {
+        data.data = 2u;
+    }
+)";
+
+// Test that the SPIR-V is generated and stored on the first use of an entry point, then loaded
+// from the cache by later shader modules with the same content. Creating the shader module also
+// looks up, then stores, the parsed WGSL program.
+TEST_P(VulkanCachingTests, SpirvIsLoadedFromCache) {
+    EXPECT_CACHE_STATS(0u, 2u, CreateComputePipeline(kShader, "write1"));
+    EXPECT_EQ(mPersistentCache->mCache.size(), 2u);
+
+    EXPECT_CACHE_STATS(2u, 0u, CreateComputePipeline(kShader, "write1"));
+    EXPECT_EQ(mPersistentCache->mCache.size(), 2u);
+}
+
+// Test that each entry point of a shader module is cached separately.
+TEST_P(VulkanCachingTests, EntryPointsAreCachedSeparately) {
+    EXPECT_CACHE_STATS(0u, 2u, CreateComputePipeline(kShader, "write1"));
+    EXPECT_CACHE_STATS(1u, 1u, CreateComputePipeline(kShader, "write42"));
+    EXPECT_EQ(mPersistentCache->mCache.size(), 3u);
+
+    EXPECT_CACHE_STATS(2u, 0u, CreateComputePipeline(kShader, "write1"));
+    EXPECT_CACHE_STATS(2u, 0u, CreateComputePipeline(kShader, "write42"));
+    EXPECT_EQ(mPersistentCache->mCache.size(), 3u);
+}
+
+// Test that a modified shader doesn't hit the entry of the original one.
+TEST_P(VulkanCachingTests, ModifiedShaderMisses) {
+    EXPECT_CACHE_STATS(0u, 2u, CreateComputePipeline(kShader, "write1"));
+
+    EXPECT_CACHE_STATS(0u, 2u, CreateComputePipeline(kModifiedShader, "write1"));
+    EXPECT_EQ(mPersistentCache->mCache.size(), 4u);
+}
+
+// Test that the in-memory cache of the shader module is used before the persistent cache.
+TEST_P(VulkanCachingTests, SameShaderModuleDoesNotLookUpCache) {
+    wgpu::ShaderModule module = utils::CreateShaderModule(device, kShader);
+
+    wgpu::ComputePipelineDescriptor desc;
+    desc.compute.module = module;
+    desc.compute.entryPoint = "write1";
+
+    EXPECT_CACHE_STATS(0u, 1u, device.CreateComputePipeline(&desc));
+    EXPECT_CACHE_STATS(0u, 0u, device.CreateComputePipeline(&desc));
+}
+
+// Test that the SPIR-V is still generated when the cache doesn't store anything.
+TEST_P(VulkanCachingTests, DisabledCache) {
+    mPersistentCache->mIsDisabled = true;
+
+    EXPECT_CACHE_STATS(0u, 2u, CreateComputePipeline(kShader, "write1"));
+    EXPECT_CACHE_STATS(0u, 2u, CreateComputePipeline(kShader, "write1"));
+    EXPECT_EQ(mPersistentCache->mCache.size(), 0u);
+}
+
+// Test that the VkPipelineCache data is stored when the device is destroyed after creating
+// pipelines.
+TEST_P(VulkanCachingTests, PipelineCacheIsStoredOnDestruction) {
+    CreateComputePipeline(kShader, "write1");
+    FlushWire();
+    size_t entryCount = mPersistentCache->mCache.size();
+
+    ExpectDeviceDestruction();
+    device.Destroy();
+    FlushWire();
+    EXPECT_EQ(mPersistentCache->mCache.size(), entryCount + 1);
+}
+
+DAWN_INSTANTIATE_TEST(VulkanCachingTests, VulkanBackend());
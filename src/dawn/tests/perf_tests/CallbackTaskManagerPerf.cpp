@@ -0,0 +1,240 @@
+// Copyright 2022 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/tests/perf_tests/DawnPerfTest.h"
+
+#include "dawn/common/Assert.h"
+#include "dawn/native/CallbackTaskManager.h"
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace {
+
+    constexpr uint32_t kTasksPerStep = 16000;
+
+    enum class QueueType {
+        // The lock-free dawn::native::CallbackTaskManager.
+        LockFree,
+        // A mutex-protected std::vector. This was the implementation of CallbackTaskManager
+        // before it became lock-free.
+        Mutex,
+    };
+
+    enum class ProducerCount {
+        Producers_1 = 1,
+        Producers_4 = 4,
+        Producers_16 = 16,
+    };
+
+    struct CallbackTaskManagerParams : AdapterTestParam {
+        CallbackTaskManagerParams(const AdapterTestParam& param,
+                                  QueueType queueType,
+                                  ProducerCount producerCount)
+            : AdapterTestParam(param), queueType(queueType), producerCount(producerCount) {
+        }
+
+        QueueType queueType;
+        ProducerCount producerCount;
+    };
+
+    std::ostream& operator<<(std::ostream& ostream, const CallbackTaskManagerParams& param) {
+        ostream << static_cast<const AdapterTestParam&>(param);
+
+        switch (param.queueType) {
+            case QueueType::LockFree:
+                ostream << "_LockFree";
+                break;
+            case QueueType::Mutex:
+                ostream << "_Mutex";
+                break;
+        }
+
+        ostream << "_Producers_" << static_cast<uint32_t>(param.producerCount);
+        return ostream;
+    }
+
+    struct NoopCallbackTask : dawn::native::CallbackTask {
+        void Finish() override {
+        }
+        void HandleShutDown() override {
+        }
+        void HandleDeviceLoss() override {
+        }
+    };
+
+    class MutexCallbackTaskQueue {
+      public:
+        void AddCallbackTask(std::unique_ptr<dawn::native::CallbackTask> callbackTask) {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mTasks.push_back(std::move(callbackTask));
+        }
+
+        std::vector<std::unique_ptr<dawn::native::CallbackTask>> AcquireCallbackTasks() {
+            std::lock_guard<std::mutex> lock(mMutex);
+            std::vector<std::unique_ptr<dawn::native::CallbackTask>> allTasks;
+            allTasks.swap(mTasks);
+            return allTasks;
+        }
+
+      private:
+        std::mutex mMutex;
+        std::vector<std::unique_ptr<dawn::native::CallbackTask>> mTasks;
+    };
+
+}  // anonymous namespace
+
+// Test the cost of adding callback tasks from many threads while the device drains them, as is
+// done when many Create*PipelineAsync calls complete on the worker threads at the same time.
+class CallbackTaskManagerPerf : public DawnPerfTestWithParams<CallbackTaskManagerParams> {
+  public:
+    CallbackTaskManagerPerf() : DawnPerfTestWithParams(kTasksPerStep, 1) {
+    }
+    ~CallbackTaskManagerPerf() override;
+
+    void SetUp() override;
+
+  protected:
+    void PrintBatchSize();
+
+  private:
+    void Step() override;
+
+    void RunProducer(uint32_t taskCount);
+    void AddCallbackTask();
+    std::vector<std::unique_ptr<dawn::native::CallbackTask>> AcquireCallbackTasks();
+
+    dawn::native::CallbackTaskManager mCallbackTaskManager;
+    MutexCallbackTaskQueue mMutexQueue;
+
+    // Producers add their tasks once each time mStepSerial is incremented.
+    std::mutex mMutex;
+    std::condition_variable mCondition;
+    uint64_t mStepSerial = 0;
+    bool mIsStopping = false;
+    std::vector<std::thread> mProducers;
+
+    uint64_t mAcquiredTaskCount = 0;
+    uint64_t mBatchCount = 0;
+};
+
+CallbackTaskManagerPerf::~CallbackTaskManagerPerf() {
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mIsStopping = true;
+    }
+    mCondition.notify_all();
+    for (std::thread& producer : mProducers) {
+        producer.join();
+    }
+}
+
+void CallbackTaskManagerPerf::SetUp() {
+    DawnPerfTestWithParams<CallbackTaskManagerParams>::SetUp();
+
+    uint32_t producerCount = static_cast<uint32_t>(GetParam().producerCount);
+    for (uint32_t i = 0; i < producerCount; ++i) {
+        mProducers.emplace_back([this, producerCount] {
+            RunProducer(kTasksPerStep / producerCount);
+        });
+    }
+}
+
+void CallbackTaskManagerPerf::RunProducer(uint32_t taskCount) {
+    uint64_t lastStepSerial = 0;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+            mCondition.wait(lock,
+                            [&] { return mIsStopping || mStepSerial != lastStepSerial; });
+            if (mIsStopping) {
+                return;
+            }
+            lastStepSerial = mStepSerial;
+        }
+
+        for (uint32_t i = 0; i < taskCount; ++i) {
+            AddCallbackTask();
+        }
+    }
+}
+
+void CallbackTaskManagerPerf::AddCallbackTask() {
+    switch (GetParam().queueType) {
+        case QueueType::LockFree:
+            mCallbackTaskManager.AddCallbackTask(std::make_unique<NoopCallbackTask>());
+            break;
+        case QueueType::Mutex:
+            mMutexQueue.AddCallbackTask(std::make_unique<NoopCallbackTask>());
+            break;
+    }
+}
+
+std::vector<std::unique_ptr<dawn::native::CallbackTask>>
+CallbackTaskManagerPerf::AcquireCallbackTasks() {
+    switch (GetParam().queueType) {
+        case QueueType::LockFree:
+            return mCallbackTaskManager.AcquireCallbackTasks();
+        case QueueType::Mutex:
+            return mMutexQueue.AcquireCallbackTasks();
+    }
+    UNREACHABLE();
+}
+
+void CallbackTaskManagerPerf::Step() {
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mStepSerial++;
+    }
+    mCondition.notify_all();
+
+    // Drain the tasks while they are being added, like the device does in APITick.
+    uint32_t acquiredTaskCount = 0;
+    while (acquiredTaskCount < kTasksPerStep) {
+        std::vector<std::unique_ptr<dawn::native::CallbackTask>> callbackTasks =
+            AcquireCallbackTasks();
+        if (callbackTasks.empty()) {
+            std::this_thread::yield();
+            continue;
+        }
+
+        for (std::unique_ptr<dawn::native::CallbackTask>& callbackTask : callbackTasks) {
+            callbackTask->Finish();
+        }
+        acquiredTaskCount += callbackTasks.size();
+        mBatchCount++;
+    }
+    mAcquiredTaskCount += acquiredTaskCount;
+}
+
+void CallbackTaskManagerPerf::PrintBatchSize() {
+    if (mBatchCount == 0) {
+        return;
+    }
+    double averageBatchSize =
+        static_cast<double>(mAcquiredTaskCount) / static_cast<double>(mBatchCount);
+    PrintResult("average_batch_size", averageBatchSize, "tasks", false);
+}
+
+TEST_P(CallbackTaskManagerPerf, Run) {
+    RunTest();
+    PrintBatchSize();
+}
+
+DAWN_INSTANTIATE_TEST_P(CallbackTaskManagerPerf,
+                        {NullBackend()},
+                        {QueueType::LockFree, QueueType::Mutex},
+                        {ProducerCount::Producers_1, ProducerCount::Producers_4,
+                         ProducerCount::Producers_16});
@@ -246,7 +246,7 @@ void DawnPerfTestBase::DoRunLoop(double maxRunTime) {
     while (mRunning) {
         // Wait if there are too many steps in flight on the GPU.
         while (submittedIterations - finishedIterations >= mMaxStepsInFlight) {
-            mTest->WaitABit();
+            WaitForGPU();
         }
 
         TRACE_EVENT0(platform, General, "Step");
@@ -278,12 +278,23 @@ void DawnPerfTestBase::DoRunLoop(double maxRunTime) {
     // which waits for all threads to stop doing work. When we output results, there should
     // be no additional incoming trace events.
     while (submittedIterations != finishedIterations) {
-        mTest->WaitABit();
+        WaitForGPU();
     }
 
     mTimer->Stop();
 }
 
+void DawnPerfTestBase::WaitForGPU() {
+    // The null backend completes work as soon as the device ticks. Don't sleep so that the
+    // wall_time only contains the CPU cost of Dawn instead of the polling interval.
+    if (mTest->IsNull()) {
+        mTest->device.Tick();
+        mTest->FlushWire();
+        return;
+    }
+    mTest->WaitABit();
+}
+
 void DawnPerfTestBase::OutputResults() {
     // TODO(enga): When Dawn has multiple backgrounds threads, add a Device::WaitForIdleForTesting()
     // which waits for all threads to stop doing work. When we output results, there should
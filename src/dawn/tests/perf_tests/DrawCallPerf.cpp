@@ -609,8 +609,8 @@ TEST_P(DrawCallPerf, Run) {
 
 DAWN_INSTANTIATE_TEST_P(
     DrawCallPerf,
-    {D3D12Backend(), MetalBackend(), OpenGLBackend(), VulkanBackend(),
-     VulkanBackend({"skip_validation"})},
+    {D3D12Backend(), MetalBackend(), NullBackend(), NullBackend({"skip_validation"}),
+     OpenGLBackend(), VulkanBackend(), VulkanBackend({"skip_validation"})},
     {
         // Baseline
         MakeParam(),
@@ -0,0 +1,134 @@
+// Copyright 2022 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/tests/perf_tests/DawnPerfTest.h"
+
+#include "dawn/utils/WGPUHelpers.h"
+
+#include <sstream>
+
+namespace {
+
+    constexpr unsigned int kNumIterations = 50;
+
+    constexpr char kShaderSource[] = R"(
+        struct Uniforms {
+            count : u32;
+            scale : f32;
+        };
+        struct Data {
+            values : array<vec4<f32>>;
+        };
+
+        @group(0) @binding(0) var<uniform> uniforms : Uniforms;
+        @group(0) @binding(1) var<storage, read> src : Data;
+        @group(0) @binding(2) var<storage, read_write> dst : Data;
+
+        fn transform(v : vec4<f32>, i : u32) -> vec4<f32> {
+            var result = v * uniforms.scale;
+            for (var j = 0u; j < 4u; j = j + 1u) {
+                result = result + vec4<f32>(f32(i + j));
+            }
+            return normalize(result);
+        }
+
+        @stage(compute) @workgroup_size(64)
+        fn main(@builtin(global_invocation_id) id : vec3<u32>) {
+            if (id.x >= uniforms.count) {
+                return;
+            }
+            dst.values[id.x] = transform(src.values[id.x], id.x);
+        }
+    )";
+
+    enum class CacheMode {
+        // The same WGSL code is used for every shader module, which is found in the device cache.
+        Hit,
+        // Each shader module has different WGSL code, which has to be parsed.
+        Miss,
+    };
+
+    struct ShaderModuleCreationParams : AdapterTestParam {
+        ShaderModuleCreationParams(const AdapterTestParam& param, CacheMode cacheMode)
+            : AdapterTestParam(param), cacheMode(cacheMode) {
+        }
+
+        CacheMode cacheMode;
+    };
+
+    std::ostream& operator<<(std::ostream& ostream, const ShaderModuleCreationParams& param) {
+        ostream << static_cast<const AdapterTestParam&>(param);
+
+        switch (param.cacheMode) {
+            case CacheMode::Hit:
+                ostream << "_CacheHit";
+                break;
+            case CacheMode::Miss:
+                ostream << "_CacheMiss";
+                break;
+        }
+        return ostream;
+    }
+
+}  // namespace
+
+// Test the CPU cost of creating |kNumIterations| WGSL shader modules, either with code that is
+// already in the device's cache or with new code.
+class ShaderModuleCreationPerf : public DawnPerfTestWithParams<ShaderModuleCreationParams> {
+  public:
+    ShaderModuleCreationPerf() : DawnPerfTestWithParams(kNumIterations, 1) {
+    }
+    ~ShaderModuleCreationPerf() override = default;
+
+    void SetUp() override;
+
+  private:
+    void Step() override;
+
+    // Keeps the shader module alive so that it stays in the device cache.
+    wgpu::ShaderModule mCachedModule;
+    uint64_t mUniqueId = 0;
+};
+
+void ShaderModuleCreationPerf::SetUp() {
+    DawnPerfTestWithParams<ShaderModuleCreationParams>::SetUp();
+    mCachedModule = utils::CreateShaderModule(device, kShaderSource);
+}
+
+void ShaderModuleCreationPerf::Step() {
+    for (unsigned int i = 0; i < kNumIterations; ++i) {
+        switch (GetParam().cacheMode) {
+            case CacheMode::Hit: {
+                wgpu::ShaderModule module = utils::CreateShaderModule(device, kShaderSource);
+                break;
+            }
+            case CacheMode::Miss: {
+                // Make the code unique with a comment so that it has a different content hash.
+                std::ostringstream source;
+                source << "// " << mUniqueId++ << kShaderSource;
+                wgpu::ShaderModule module = utils::CreateShaderModule(device, source.str().c_str());
+                break;
+            }
+        }
+    }
+}
+
+TEST_P(ShaderModuleCreationPerf, Run) {
+    RunTest();
+}
+
+DAWN_INSTANTIATE_TEST_P(ShaderModuleCreationPerf,
+                        {D3D12Backend(), MetalBackend(), NullBackend(), OpenGLBackend(),
+                         VulkanBackend()},
+                        {CacheMode::Hit, CacheMode::Miss});
@@ -500,7 +500,8 @@ TEST_P(ShaderRobustnessPerf, Run) {
 
 DAWN_INSTANTIATE_TEST_P(ShaderRobustnessPerf,
                         {D3D12Backend(), D3D12Backend({"disable_robustness"}, {}), MetalBackend(),
-                         MetalBackend({"disable_robustness"}, {}), OpenGLBackend(),
+                         MetalBackend({"disable_robustness"}, {}), NullBackend(),
+                         NullBackend({"disable_robustness"}, {}), OpenGLBackend(),
                          OpenGLBackend({"disable_robustness"}, {}), VulkanBackend(),
                          VulkanBackend({"disable_robustness"}, {})},
                         {MatMulMethod::MatMulFloatOneDimSharedArray,
@@ -0,0 +1,217 @@
+// Copyright 2022 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/tests/perf_tests/DawnPerfTest.h"
+
+#include "dawn/platform/DawnPlatform.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace {
+
+    enum class PoolType {
+        // The WorkerTaskPool created by the default dawn::platform::Platform.
+        Default,
+        // Spawns and detaches a thread per posted task. This was the implementation of the
+        // default pool before it became a bounded pool of persistent workers.
+        ThreadPerTask,
+    };
+
+    enum class TaskCount {
+        Tasks_1000 = 1000,
+        Tasks_10000 = 10000,
+    };
+
+    struct WorkerThreadPoolParams : AdapterTestParam {
+        WorkerThreadPoolParams(const AdapterTestParam& param,
+                               PoolType poolType,
+                               TaskCount taskCount)
+            : AdapterTestParam(param), poolType(poolType), taskCount(taskCount) {
+        }
+
+        PoolType poolType;
+        TaskCount taskCount;
+    };
+
+    std::ostream& operator<<(std::ostream& ostream, const WorkerThreadPoolParams& param) {
+        ostream << static_cast<const AdapterTestParam&>(param);
+
+        switch (param.poolType) {
+            case PoolType::Default:
+                ostream << "_Default";
+                break;
+            case PoolType::ThreadPerTask:
+                ostream << "_ThreadPerTask";
+                break;
+        }
+
+        ostream << "_Tasks_" << static_cast<uint32_t>(param.taskCount);
+        return ostream;
+    }
+
+    class ThreadPerTaskWaitableEvent : public dawn::platform::WaitableEvent {
+      public:
+        struct State {
+            std::mutex mutex;
+            std::condition_variable condition;
+            bool isComplete = false;
+        };
+
+        ThreadPerTaskWaitableEvent() : mState(std::make_shared<State>()) {
+        }
+
+        void Wait() override {
+            std::unique_lock<std::mutex> lock(mState->mutex);
+            mState->condition.wait(lock, [this] { return mState->isComplete; });
+        }
+
+        bool IsComplete() override {
+            std::lock_guard<std::mutex> lock(mState->mutex);
+            return mState->isComplete;
+        }
+
+        std::shared_ptr<State> GetState() const {
+            return mState;
+        }
+
+      private:
+        std::shared_ptr<State> mState;
+    };
+
+    class ThreadPerTaskPool : public dawn::platform::WorkerTaskPool {
+      public:
+        std::unique_ptr<dawn::platform::WaitableEvent> PostWorkerTask(
+            dawn::platform::PostWorkerTaskCallback callback,
+            void* userdata) override {
+            std::unique_ptr<ThreadPerTaskWaitableEvent> event =
+                std::make_unique<ThreadPerTaskWaitableEvent>();
+            std::thread thread([callback, userdata, state = event->GetState()] {
+                callback(userdata);
+                {
+                    std::lock_guard<std::mutex> lock(state->mutex);
+                    state->isComplete = true;
+                }
+                state->condition.notify_all();
+            });
+            thread.detach();
+            return event;
+        }
+    };
+
+    using Clock = std::chrono::steady_clock;
+
+    struct TaskData {
+        Clock::time_point postTime;
+        std::atomic<uint64_t>* totalLatencyNs;
+        std::atomic<uint64_t>* checksum;
+    };
+
+    // A small task that records the time elapsed between its posting and the start of its
+    // execution, and does a little bit of work.
+    void RunTask(void* userdata) {
+        TaskData* data = static_cast<TaskData*>(userdata);
+        Clock::duration latency = Clock::now() - data->postTime;
+        data->totalLatencyNs->fetch_add(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(latency).count());
+
+        uint64_t value = reinterpret_cast<uintptr_t>(data);
+        for (uint32_t i = 0; i < 64; ++i) {
+            value = value * 6364136223846793005ull + 1442695040888963407ull;
+        }
+        data->checksum->fetch_xor(value);
+    }
+
+}  // anonymous namespace
+
+// Test the throughput and latency of posting a burst of small tasks to a WorkerTaskPool and
+// waiting for all of them to complete, as is done by a burst of Create*PipelineAsync calls.
+class WorkerThreadPoolPerf : public DawnPerfTestWithParams<WorkerThreadPoolParams> {
+  public:
+    WorkerThreadPoolPerf()
+        : DawnPerfTestWithParams(static_cast<unsigned int>(GetParam().taskCount), 1),
+          mTaskData(static_cast<size_t>(GetParam().taskCount)) {
+    }
+    ~WorkerThreadPoolPerf() override = default;
+
+    void SetUp() override;
+
+  protected:
+    void PrintLatency();
+
+  private:
+    void Step() override;
+
+    dawn::platform::Platform mPlatform;
+    std::unique_ptr<dawn::platform::WorkerTaskPool> mPool;
+    std::vector<TaskData> mTaskData;
+    std::vector<std::unique_ptr<dawn::platform::WaitableEvent>> mEvents;
+    std::atomic<uint64_t> mTotalLatencyNs{0};
+    std::atomic<uint64_t> mChecksum{0};
+    uint64_t mTaskRunCount = 0;
+};
+
+void WorkerThreadPoolPerf::SetUp() {
+    DawnPerfTestWithParams<WorkerThreadPoolParams>::SetUp();
+
+    switch (GetParam().poolType) {
+        case PoolType::Default:
+            mPool = mPlatform.CreateWorkerTaskPool();
+            break;
+        case PoolType::ThreadPerTask:
+            mPool = std::make_unique<ThreadPerTaskPool>();
+            break;
+    }
+
+    for (TaskData& data : mTaskData) {
+        data.totalLatencyNs = &mTotalLatencyNs;
+        data.checksum = &mChecksum;
+    }
+    mEvents.reserve(mTaskData.size());
+}
+
+void WorkerThreadPoolPerf::Step() {
+    for (TaskData& data : mTaskData) {
+        data.postTime = Clock::now();
+        mEvents.push_back(mPool->PostWorkerTask(RunTask, &data));
+    }
+    for (std::unique_ptr<dawn::platform::WaitableEvent>& event : mEvents) {
+        event->Wait();
+    }
+    mEvents.clear();
+    mTaskRunCount += mTaskData.size();
+}
+
+void WorkerThreadPoolPerf::PrintLatency() {
+    if (mTaskRunCount == 0) {
+        return;
+    }
+    double averageLatencyUs =
+        static_cast<double>(mTotalLatencyNs.load()) / static_cast<double>(mTaskRunCount) / 1000.0;
+    PrintResult("average_task_latency", averageLatencyUs, "us", false);
+}
+
+TEST_P(WorkerThreadPoolPerf, Run) {
+    RunTest();
+    PrintLatency();
+}
+
+DAWN_INSTANTIATE_TEST_P(WorkerThreadPoolPerf,
+                        {D3D12Backend(), MetalBackend(), NullBackend(), OpenGLBackend(),
+                         VulkanBackend()},
+                        {PoolType::Default, PoolType::ThreadPerTask},
+                        {TaskCount::Tasks_1000, TaskCount::Tasks_10000});
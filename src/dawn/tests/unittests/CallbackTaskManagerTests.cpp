@@ -0,0 +1,132 @@
+// Copyright 2022 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include "dawn/native/CallbackTaskManager.h"
+
+#include <thread>
+#include <vector>
+
+namespace {
+
+    // A task that records its creation index and counts how many instances are alive.
+    struct IndexedTask : dawn::native::CallbackTask {
+        IndexedTask(uint32_t producer, uint32_t index, int* aliveCount = nullptr)
+            : producer(producer), index(index), aliveCount(aliveCount) {
+            if (aliveCount != nullptr) {
+                (*aliveCount)++;
+            }
+        }
+        ~IndexedTask() override {
+            if (aliveCount != nullptr) {
+                (*aliveCount)--;
+            }
+        }
+
+        void Finish() override {
+        }
+        void HandleShutDown() override {
+        }
+        void HandleDeviceLoss() override {
+        }
+
+        uint32_t producer;
+        uint32_t index;
+        int* aliveCount;
+    };
+
+    uint32_t GetIndex(const std::unique_ptr<dawn::native::CallbackTask>& task) {
+        return static_cast<IndexedTask*>(task.get())->index;
+    }
+
+}  // anonymous namespace
+
+// Test that tasks are acquired in the order they were added, and only once.
+TEST(CallbackTaskManagerTests, AcquireInOrder) {
+    dawn::native::CallbackTaskManager manager;
+    EXPECT_TRUE(manager.IsEmpty());
+    EXPECT_TRUE(manager.AcquireCallbackTasks().empty());
+
+    for (uint32_t i = 0; i < 5; ++i) {
+        manager.AddCallbackTask(std::make_unique<IndexedTask>(0, i));
+    }
+    EXPECT_FALSE(manager.IsEmpty());
+
+    std::vector<std::unique_ptr<dawn::native::CallbackTask>> tasks =
+        manager.AcquireCallbackTasks();
+    ASSERT_EQ(tasks.size(), 5u);
+    for (uint32_t i = 0; i < 5; ++i) {
+        EXPECT_EQ(GetIndex(tasks[i]), i);
+    }
+    EXPECT_TRUE(manager.IsEmpty());
+    EXPECT_TRUE(manager.AcquireCallbackTasks().empty());
+
+    // Tasks added after an acquisition are in the next batch only.
+    manager.AddCallbackTask(std::make_unique<IndexedTask>(0, 5));
+    tasks = manager.AcquireCallbackTasks();
+    ASSERT_EQ(tasks.size(), 1u);
+    EXPECT_EQ(GetIndex(tasks[0]), 5u);
+}
+
+// Test that tasks that are never acquired are deleted with the manager.
+TEST(CallbackTaskManagerTests, UnacquiredTasksAreDeleted) {
+    int aliveCount = 0;
+    {
+        dawn::native::CallbackTaskManager manager;
+        manager.AddCallbackTask(std::make_unique<IndexedTask>(0, 0, &aliveCount));
+        manager.AddCallbackTask(std::make_unique<IndexedTask>(0, 1, &aliveCount));
+        EXPECT_EQ(aliveCount, 2);
+    }
+    EXPECT_EQ(aliveCount, 0);
+}
+
+// Test that tasks added concurrently by many threads while the manager is being drained are all
+// acquired exactly once, and in order for each thread.
+TEST(CallbackTaskManagerTests, ConcurrentProducers) {
+    constexpr uint32_t kProducerCount = 8;
+    constexpr uint32_t kTasksPerProducer = 2000;
+
+    dawn::native::CallbackTaskManager manager;
+    std::vector<std::thread> producers;
+    for (uint32_t producer = 0; producer < kProducerCount; ++producer) {
+        producers.emplace_back([&manager, producer] {
+            for (uint32_t i = 0; i < kTasksPerProducer; ++i) {
+                manager.AddCallbackTask(std::make_unique<IndexedTask>(producer, i));
+            }
+        });
+    }
+
+    std::vector<uint32_t> nextIndex(kProducerCount, 0);
+    uint32_t acquiredCount = 0;
+    auto Drain = [&] {
+        for (std::unique_ptr<dawn::native::CallbackTask>& task : manager.AcquireCallbackTasks()) {
+            IndexedTask* indexedTask = static_cast<IndexedTask*>(task.get());
+            EXPECT_EQ(indexedTask->index, nextIndex[indexedTask->producer]);
+            nextIndex[indexedTask->producer] = indexedTask->index + 1;
+            acquiredCount++;
+        }
+    };
+
+    while (acquiredCount < kProducerCount * kTasksPerProducer) {
+        Drain();
+        std::this_thread::yield();
+    }
+    for (std::thread& producer : producers) {
+        producer.join();
+    }
+
+    EXPECT_TRUE(manager.IsEmpty());
+    EXPECT_EQ(acquiredCount, kProducerCount * kTasksPerProducer);
+}
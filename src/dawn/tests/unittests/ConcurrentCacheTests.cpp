@@ -14,6 +14,13 @@
 
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
 #include "dawn/common/ConcurrentCache.h"
 #include "dawn/native/AsyncTask.h"
 #include "dawn/platform/DawnPlatform.h"
@@ -45,6 +52,73 @@ namespace {
         size_t mValue;
     };
 
+    // The previous implementation of ConcurrentCache, with a single lock, used as a baseline in
+    // the scaling benchmark.
+    class SingleLockCache : public NonMovable {
+      public:
+        SimpleCachedObject* Find(SimpleCachedObject* object) {
+            std::lock_guard<std::mutex> lock(mMutex);
+            auto iter = mCache.find(object);
+            return iter == mCache.end() ? nullptr : *iter;
+        }
+
+        std::pair<SimpleCachedObject*, bool> Insert(SimpleCachedObject* object) {
+            std::lock_guard<std::mutex> lock(mMutex);
+            auto [value, inserted] = mCache.insert(object);
+            return {*value, inserted};
+        }
+
+        size_t Erase(SimpleCachedObject* object) {
+            std::lock_guard<std::mutex> lock(mMutex);
+            return mCache.erase(object);
+        }
+
+      private:
+        std::mutex mMutex;
+        std::unordered_set<SimpleCachedObject*,
+                           SimpleCachedObject::HashFunc,
+                           SimpleCachedObject::EqualityFunc>
+            mCache;
+    };
+
+    // Runs |operationsPerThread| read-mostly operations on |cache| from each of |threadCount|
+    // threads at the same time and returns the elapsed time in seconds.
+    template <typename Cache>
+    double RunConcurrentOperations(Cache* cache,
+                                   std::vector<SimpleCachedObject>* objects,
+                                   uint32_t threadCount,
+                                   uint32_t operationsPerThread) {
+        auto start = std::chrono::steady_clock::now();
+
+        std::vector<std::thread> threads;
+        for (uint32_t t = 0; t < threadCount; ++t) {
+            threads.emplace_back([=] {
+                uint32_t random = t + 1;
+                for (uint32_t i = 0; i < operationsPerThread; ++i) {
+                    random = random * 1664525u + 1013904223u;
+                    SimpleCachedObject* object = &(*objects)[(random >> 8) % objects->size()];
+                    switch (random % 16) {
+                        case 0:
+                            cache->Insert(object);
+                            break;
+                        case 1:
+                            cache->Erase(object);
+                            break;
+                        default:
+                            cache->Find(object);
+                            break;
+                    }
+                }
+            });
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        return elapsed.count();
+    }
+
 }  // anonymous namespace
 
 class ConcurrentCacheTest : public testing::Test {
@@ -112,3 +186,79 @@ TEST_F(ConcurrentCacheTest, EraseAfterInsertion) {
     ASSERT_TRUE(insertOutput.second);
     ASSERT_EQ(1u, erasedObjectCount);
 }
+
+// Test inserting, finding and erasing many objects from many threads at the same time.
+TEST_F(ConcurrentCacheTest, ManyThreads) {
+    constexpr uint32_t kThreadCount = 8;
+    constexpr uint32_t kObjectsPerThread = 1000;
+
+    // Each thread inserts its own objects, and every other thread inserts an equal object which
+    // must be deduplicated.
+    std::vector<std::vector<SimpleCachedObject>> objects(kThreadCount);
+    for (std::vector<SimpleCachedObject>& threadObjects : objects) {
+        for (uint32_t i = 0; i < kObjectsPerThread; ++i) {
+            threadObjects.emplace_back(i);
+        }
+    }
+
+    std::vector<uint32_t> insertedCounts(kThreadCount, 0);
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0; t < kThreadCount; ++t) {
+        threads.emplace_back([&, t] {
+            for (SimpleCachedObject& object : objects[t]) {
+                auto [cachedObject, inserted] = mCache.Insert(&object);
+                EXPECT_EQ(object.GetValue(), cachedObject->GetValue());
+                EXPECT_EQ(cachedObject, mCache.Find(&object));
+                if (inserted) {
+                    insertedCounts[t]++;
+                }
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    uint32_t totalInsertedCount = 0;
+    for (uint32_t count : insertedCounts) {
+        totalInsertedCount += count;
+    }
+    EXPECT_EQ(kObjectsPerThread, totalInsertedCount);
+
+    for (uint32_t i = 0; i < kObjectsPerThread; ++i) {
+        SimpleCachedObject blueprint(i);
+        SimpleCachedObject* cachedObject = mCache.Find(&blueprint);
+        ASSERT_NE(nullptr, cachedObject);
+        EXPECT_EQ(1u, mCache.Erase(cachedObject));
+        EXPECT_EQ(nullptr, mCache.Find(&blueprint));
+    }
+}
+
+// Benchmark of the scaling of ConcurrentCache with the number of threads using it at the same
+// time, compared to a cache protected by a single lock. It prints the throughput for 1 to 32
+// threads and is disabled by default, run it with --gtest_also_run_disabled_tests.
+TEST_F(ConcurrentCacheTest, DISABLED_ThreadScalingBenchmark) {
+    constexpr uint32_t kObjectCount = 4096;
+    constexpr uint32_t kOperationsPerThread = 200000;
+
+    std::vector<SimpleCachedObject> objects;
+    for (uint32_t i = 0; i < kObjectCount; ++i) {
+        objects.emplace_back(i);
+    }
+
+    printf("%8s %24s %24s\n", "threads", "ConcurrentCache (Mop/s)", "SingleLockCache (Mop/s)");
+    for (uint32_t threadCount = 1; threadCount <= 32; threadCount *= 2) {
+        double operationCount = double(threadCount) * kOperationsPerThread / 1e6;
+
+        ConcurrentCache<SimpleCachedObject> shardedCache;
+        double shardedTime =
+            RunConcurrentOperations(&shardedCache, &objects, threadCount, kOperationsPerThread);
+
+        SingleLockCache singleLockCache;
+        double singleLockTime =
+            RunConcurrentOperations(&singleLockCache, &objects, threadCount, kOperationsPerThread);
+
+        printf("%8u %24.2f %24.2f\n", threadCount, operationCount / shardedTime,
+               operationCount / singleLockTime);
+    }
+}
@@ -0,0 +1,233 @@
+// Copyright 2022 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include "dawn/utils/SharedMemoryCommandRing.h"
+
+#include <unistd.h>
+#include <thread>
+#include <vector>
+
+namespace {
+
+    constexpr uint64_t kLongWaitNs = 10'000'000'000;
+
+    // Records all the commands it receives.
+    class RecordingHandler : public dawn::wire::CommandHandler {
+      public:
+        const volatile char* HandleCommands(const volatile char* commands,
+                                            size_t size) override {
+            mCalls++;
+            if (mFail) {
+                return nullptr;
+            }
+            for (size_t i = 0; i < size; ++i) {
+                mReceived.push_back(static_cast<char>(commands[i]));
+            }
+            return commands + size;
+        }
+
+        std::vector<char> mReceived;
+        size_t mCalls = 0;
+        bool mFail = false;
+    };
+
+    // Serializes a command of |size| bytes filled with consecutive values starting at |seed|.
+    bool WriteCommand(utils::SharedMemoryCommandSerializer* serializer,
+                      size_t size,
+                      uint8_t seed,
+                      std::vector<char>* expected) {
+        char* space = static_cast<char*>(serializer->GetCmdSpace(size));
+        if (space == nullptr) {
+            return false;
+        }
+        for (size_t i = 0; i < size; ++i) {
+            space[i] = static_cast<char>(seed + i);
+            if (expected != nullptr) {
+                expected->push_back(space[i]);
+            }
+        }
+        return true;
+    }
+
+}  // anonymous namespace
+
+// Test that only power of two capacities that are large enough are accepted.
+TEST(SharedMemoryCommandRingTests, CreateValidatesCapacity) {
+    EXPECT_EQ(utils::SharedMemoryCommandRing::Create(0), nullptr);
+    EXPECT_EQ(utils::SharedMemoryCommandRing::Create(1024), nullptr);
+    EXPECT_EQ(utils::SharedMemoryCommandRing::Create(4096 + 8), nullptr);
+
+    auto ring = utils::SharedMemoryCommandRing::Create(4096);
+    ASSERT_NE(ring, nullptr);
+    EXPECT_EQ(ring->GetCapacity(), 4096u);
+    EXPECT_GE(ring->GetFileDescriptor(), 0);
+
+    utils::SharedMemoryCommandSerializer serializer(ring.get());
+    EXPECT_LT(serializer.GetMaximumAllocationSize(), ring->GetCapacity());
+    EXPECT_EQ(serializer.GetCmdSpace(serializer.GetMaximumAllocationSize() + 1), nullptr);
+}
+
+// Test that commands are only visible after a flush and are received in a single batch.
+TEST(SharedMemoryCommandRingTests, FlushPublishesBatch) {
+    auto ring = utils::SharedMemoryCommandRing::Create(4096);
+    ASSERT_NE(ring, nullptr);
+    utils::SharedMemoryCommandSerializer serializer(ring.get());
+    RecordingHandler handler;
+    utils::SharedMemoryCommandReceiver receiver(ring.get(), &handler);
+
+    std::vector<char> expected;
+    ASSERT_TRUE(WriteCommand(&serializer, 16, 0, &expected));
+    ASSERT_TRUE(WriteCommand(&serializer, 24, 100, &expected));
+    ASSERT_TRUE(WriteCommand(&serializer, 8, 200, &expected));
+
+    EXPECT_TRUE(receiver.ProcessCommands());
+    EXPECT_EQ(handler.mCalls, 0u);
+
+    EXPECT_TRUE(serializer.Flush());
+    EXPECT_TRUE(receiver.ProcessCommands());
+    EXPECT_EQ(handler.mCalls, 1u);
+    EXPECT_EQ(handler.mReceived, expected);
+}
+
+// Test that commands keep their order and content when the ring wraps around many times.
+TEST(SharedMemoryCommandRingTests, WrapsAround) {
+    auto ring = utils::SharedMemoryCommandRing::Create(4096);
+    ASSERT_NE(ring, nullptr);
+    utils::SharedMemoryCommandSerializer serializer(ring.get());
+    RecordingHandler handler;
+    utils::SharedMemoryCommandReceiver receiver(ring.get(), &handler);
+
+    std::vector<char> expected;
+    for (uint32_t i = 0; i < 500; ++i) {
+        size_t size = 8 * (1 + (i * 37) % 150);
+        ASSERT_TRUE(WriteCommand(&serializer, size, i, &expected));
+        if (i % 3 == 0) {
+            ASSERT_TRUE(serializer.Flush());
+            ASSERT_TRUE(receiver.ProcessCommands());
+        }
+    }
+    ASSERT_TRUE(serializer.Flush());
+    ASSERT_TRUE(receiver.ProcessCommands());
+    EXPECT_EQ(handler.mReceived, expected);
+}
+
+// Test that a producer writing more than the capacity of the ring blocks until the consumer on
+// another thread makes room, and that no command is lost or corrupted.
+TEST(SharedMemoryCommandRingTests, BackpressureAcrossThreads) {
+    auto ring = utils::SharedMemoryCommandRing::Create(4096);
+    ASSERT_NE(ring, nullptr);
+    utils::SharedMemoryCommandSerializer serializer(ring.get());
+    RecordingHandler handler;
+    utils::SharedMemoryCommandReceiver receiver(ring.get(), &handler);
+
+    std::vector<char> expected;
+    std::thread producer([&] {
+        for (uint32_t i = 0; i < 20000; ++i) {
+            size_t size = 8 * (1 + (i * 13) % 200);
+            ASSERT_TRUE(WriteCommand(&serializer, size, i, &expected));
+            if (i % 16 == 0) {
+                ASSERT_TRUE(serializer.Flush());
+            }
+        }
+        serializer.Flush();
+        ring->Close();
+    });
+
+    while (receiver.ProcessCommands(kLongWaitNs)) {
+    }
+    producer.join();
+
+    EXPECT_EQ(handler.mReceived, expected);
+}
+
+// Test that a ring opened from the file descriptor of another one shares its memory.
+TEST(SharedMemoryCommandRingTests, OpenSharesMemory) {
+    auto ring = utils::SharedMemoryCommandRing::Create(8192);
+    ASSERT_NE(ring, nullptr);
+    auto peer = utils::SharedMemoryCommandRing::Open(dup(ring->GetFileDescriptor()));
+    ASSERT_NE(peer, nullptr);
+    EXPECT_EQ(peer->GetCapacity(), 8192u);
+
+    utils::SharedMemoryCommandSerializer serializer(ring.get());
+    RecordingHandler handler;
+    utils::SharedMemoryCommandReceiver receiver(peer.get(), &handler);
+
+    std::vector<char> expected;
+    ASSERT_TRUE(WriteCommand(&serializer, 64, 7, &expected));
+    ASSERT_TRUE(serializer.Flush());
+    EXPECT_TRUE(receiver.ProcessCommands());
+    EXPECT_EQ(handler.mReceived, expected);
+
+    peer->Close();
+    EXPECT_TRUE(ring->IsClosed());
+}
+
+// Test that a file descriptor that isn't a ring is rejected.
+TEST(SharedMemoryCommandRingTests, OpenValidatesMemory) {
+    int fds[2];
+    ASSERT_EQ(pipe(fds), 0);
+    close(fds[1]);
+    EXPECT_EQ(utils::SharedMemoryCommandRing::Open(fds[0]), nullptr);
+}
+
+// Test that an error in the handler closes the ring and fails the producer.
+TEST(SharedMemoryCommandRingTests, HandlerErrorClosesRing) {
+    auto ring = utils::SharedMemoryCommandRing::Create(4096);
+    ASSERT_NE(ring, nullptr);
+    utils::SharedMemoryCommandSerializer serializer(ring.get());
+    RecordingHandler handler;
+    handler.mFail = true;
+    utils::SharedMemoryCommandReceiver receiver(ring.get(), &handler);
+
+    ASSERT_TRUE(WriteCommand(&serializer, 16, 0, nullptr));
+    ASSERT_TRUE(serializer.Flush());
+    EXPECT_FALSE(receiver.ProcessCommands());
+    EXPECT_TRUE(ring->IsClosed());
+
+    EXPECT_EQ(serializer.GetCmdSpace(16), nullptr);
+    EXPECT_FALSE(serializer.Flush());
+}
+
+// Test that closing the ring wakes up a consumer waiting for commands.
+TEST(SharedMemoryCommandRingTests, CloseWakesConsumer) {
+    auto ring = utils::SharedMemoryCommandRing::Create(4096);
+    ASSERT_NE(ring, nullptr);
+    RecordingHandler handler;
+    utils::SharedMemoryCommandReceiver receiver(ring.get(), &handler);
+
+    std::thread closer([&] { ring->Close(); });
+    while (receiver.ProcessCommands(kLongWaitNs)) {
+    }
+    closer.join();
+    EXPECT_EQ(handler.mCalls, 0u);
+}
+
+// Test that a producer waiting for space gives up and closes the ring when the consumer doesn't
+// release any, like when it died without closing the ring.
+TEST(SharedMemoryCommandRingTests, ProducerTimesOutWithoutConsumer) {
+    auto ring = utils::SharedMemoryCommandRing::Create(4096);
+    ASSERT_NE(ring, nullptr);
+    constexpr uint64_t kSpaceTimeoutNs = 50'000'000;
+    utils::SharedMemoryCommandSerializer serializer(ring.get(), kSpaceTimeoutNs);
+
+    bool wrote = true;
+    for (uint32_t i = 0; wrote && i < 100; ++i) {
+        wrote = WriteCommand(&serializer, 512, i, nullptr);
+    }
+    EXPECT_FALSE(wrote);
+    EXPECT_TRUE(ring->IsClosed());
+    EXPECT_FALSE(serializer.Flush());
+}
@@ -0,0 +1,201 @@
+// Copyright 2022 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include "dawn/utils/SharedMemoryTransferService.h"
+
+#include <unistd.h>
+#include <cstring>
+#include <vector>
+
+namespace {
+
+    using ClientService = dawn::wire::client::MemoryTransferService;
+    using ServerService = dawn::wire::server::MemoryTransferService;
+
+    class SharedMemoryTransferServiceTests : public testing::Test {
+      protected:
+        void CreateServices(size_t regionSize) {
+            std::unique_ptr<utils::SharedMemoryRegion> region =
+                utils::SharedMemoryRegion::Create(regionSize);
+            ASSERT_NE(region, nullptr);
+            std::unique_ptr<utils::SharedMemoryRegion> serverRegion =
+                utils::SharedMemoryRegion::Open(dup(region->GetFileDescriptor()));
+            ASSERT_NE(serverRegion, nullptr);
+
+            mClientService = utils::CreateSharedMemoryClientTransferService(std::move(region));
+            mServerService =
+                utils::CreateSharedMemoryServerTransferService(std::move(serverRegion));
+        }
+
+        // Creates the server handle matching |clientHandle| like the wire does.
+        template <typename ClientHandle>
+        std::vector<char> SerializeCreate(ClientHandle* clientHandle) {
+            std::vector<char> createInfo(clientHandle->SerializeCreateSize());
+            clientHandle->SerializeCreate(createInfo.data());
+            return createInfo;
+        }
+
+        std::unique_ptr<ClientService> mClientService;
+        std::unique_ptr<ServerService> mServerService;
+    };
+
+}  // anonymous namespace
+
+// Test that data read back by the server is visible to the client without being serialized.
+TEST_F(SharedMemoryTransferServiceTests, ReadHandle) {
+    CreateServices(1 << 20);
+
+    std::unique_ptr<ClientService::ReadHandle> clientHandle(mClientService->CreateReadHandle(256));
+    ASSERT_NE(clientHandle, nullptr);
+    std::vector<char> createInfo = SerializeCreate(clientHandle.get());
+
+    ServerService::ReadHandle* serverHandlePtr = nullptr;
+    ASSERT_TRUE(mServerService->DeserializeReadHandle(createInfo.data(), createInfo.size(),
+                                                      &serverHandlePtr));
+    std::unique_ptr<ServerService::ReadHandle> serverHandle(serverHandlePtr);
+
+    std::vector<char> bufferData(128, 42);
+    EXPECT_EQ(serverHandle->SizeOfSerializeDataUpdate(64, 128), 0u);
+    serverHandle->SerializeDataUpdate(bufferData.data(), 64, 128, nullptr);
+
+    EXPECT_TRUE(clientHandle->DeserializeDataUpdate(nullptr, 0, 64, 128));
+    const char* data = static_cast<const char*>(clientHandle->GetData());
+    EXPECT_EQ(memcmp(data + 64, bufferData.data(), 128), 0);
+
+    EXPECT_FALSE(clientHandle->DeserializeDataUpdate(nullptr, 0, 200, 128));
+}
+
+// Test that data written by the client reaches the server's target without being serialized.
+TEST_F(SharedMemoryTransferServiceTests, WriteHandle) {
+    CreateServices(1 << 20);
+
+    std::unique_ptr<ClientService::WriteHandle> clientHandle(
+        mClientService->CreateWriteHandle(256));
+    ASSERT_NE(clientHandle, nullptr);
+    char* data = static_cast<char*>(clientHandle->GetData());
+    EXPECT_EQ(std::vector<char>(data, data + 256), std::vector<char>(256, 0));
+    std::vector<char> createInfo = SerializeCreate(clientHandle.get());
+
+    ServerService::WriteHandle* serverHandlePtr = nullptr;
+    ASSERT_TRUE(mServerService->DeserializeWriteHandle(createInfo.data(), createInfo.size(),
+                                                       &serverHandlePtr));
+    std::unique_ptr<ServerService::WriteHandle> serverHandle(serverHandlePtr);
+    std::vector<char> bufferData(256, 0);
+    serverHandle->SetTarget(bufferData.data());
+    serverHandle->SetDataLength(bufferData.size());
+
+    memset(data + 16, 7, 32);
+    EXPECT_EQ(clientHandle->SizeOfSerializeDataUpdate(16, 32), 0u);
+    clientHandle->SerializeDataUpdate(nullptr, 16, 32);
+
+    EXPECT_TRUE(serverHandle->DeserializeDataUpdate(nullptr, 0, 16, 32));
+    EXPECT_EQ(bufferData[15], 0);
+    EXPECT_EQ(bufferData[16], 7);
+    EXPECT_EQ(bufferData[47], 7);
+    EXPECT_EQ(bufferData[48], 0);
+
+    EXPECT_FALSE(serverHandle->DeserializeDataUpdate(nullptr, 0, 250, 32));
+}
+
+// Test that the memory of a handle is only reused once the server destroyed its handle.
+TEST_F(SharedMemoryTransferServiceTests, MemoryReusedAfterServerRelease) {
+    // Only room for a single handle.
+    CreateServices(4096);
+
+    std::unique_ptr<ClientService::ReadHandle> clientHandle(mClientService->CreateReadHandle(2048));
+    ASSERT_NE(clientHandle, nullptr);
+    const void* sharedData = clientHandle->GetData();
+    std::vector<char> createInfo = SerializeCreate(clientHandle.get());
+    ServerService::ReadHandle* serverHandle = nullptr;
+    ASSERT_TRUE(mServerService->DeserializeReadHandle(createInfo.data(), createInfo.size(),
+                                                      &serverHandle));
+
+    // The server still uses the memory so the next handle is transferred inline.
+    clientHandle.reset();
+    clientHandle.reset(mClientService->CreateReadHandle(2048));
+    EXPECT_NE(clientHandle->GetData(), sharedData);
+    EXPECT_FALSE(clientHandle->DeserializeDataUpdate(nullptr, 0, 0, 2048));
+    clientHandle.reset();
+
+    delete serverHandle;
+    clientHandle.reset(mClientService->CreateReadHandle(2048));
+    EXPECT_EQ(clientHandle->GetData(), sharedData);
+}
+
+// Test that handles that were never sent to the server release their memory right away.
+TEST_F(SharedMemoryTransferServiceTests, UnserializedHandleReleasedImmediately) {
+    CreateServices(4096);
+
+    std::unique_ptr<ClientService::WriteHandle> clientHandle(
+        mClientService->CreateWriteHandle(2048));
+    void* sharedData = clientHandle->GetData();
+    clientHandle.reset();
+
+    clientHandle.reset(mClientService->CreateWriteHandle(2048));
+    EXPECT_EQ(clientHandle->GetData(), sharedData);
+}
+
+// Test that handles larger than the region transfer their data inline.
+TEST_F(SharedMemoryTransferServiceTests, InlineFallback) {
+    CreateServices(4096);
+
+    std::unique_ptr<ClientService::WriteHandle> clientHandle(
+        mClientService->CreateWriteHandle(8192));
+    ASSERT_NE(clientHandle, nullptr);
+    std::vector<char> createInfo = SerializeCreate(clientHandle.get());
+    ServerService::WriteHandle* serverHandlePtr = nullptr;
+    ASSERT_TRUE(mServerService->DeserializeWriteHandle(createInfo.data(), createInfo.size(),
+                                                       &serverHandlePtr));
+    std::unique_ptr<ServerService::WriteHandle> serverHandle(serverHandlePtr);
+    std::vector<char> bufferData(8192, 0);
+    serverHandle->SetTarget(bufferData.data());
+    serverHandle->SetDataLength(bufferData.size());
+
+    memset(clientHandle->GetData(), 3, 8192);
+    ASSERT_EQ(clientHandle->SizeOfSerializeDataUpdate(0, 8192), 8192u);
+    std::vector<char> update(8192);
+    clientHandle->SerializeDataUpdate(update.data(), 0, 8192);
+
+    EXPECT_FALSE(serverHandle->DeserializeDataUpdate(nullptr, 0, 0, 8192));
+    EXPECT_TRUE(serverHandle->DeserializeDataUpdate(update.data(), update.size(), 0, 8192));
+    EXPECT_EQ(bufferData, std::vector<char>(8192, 3));
+}
+
+// Test that the server rejects descriptors that point outside of the region.
+TEST_F(SharedMemoryTransferServiceTests, ServerValidatesDescriptors) {
+    CreateServices(4096);
+
+    struct {
+        uint64_t allocationOffset;
+        uint64_t size;
+    } descriptors[] = {
+        {4096, 0},
+        {64, 4096},
+        {32, 16},
+        {~uint64_t(0) - 63, 16},
+    };
+    for (const auto& descriptor : descriptors) {
+        ServerService::ReadHandle* readHandle = nullptr;
+        EXPECT_FALSE(
+            mServerService->DeserializeReadHandle(&descriptor, sizeof(descriptor), &readHandle));
+        ServerService::WriteHandle* writeHandle = nullptr;
+        EXPECT_FALSE(
+            mServerService->DeserializeWriteHandle(&descriptor, sizeof(descriptor), &writeHandle));
+    }
+
+    ServerService::ReadHandle* readHandle = nullptr;
+    EXPECT_FALSE(mServerService->DeserializeReadHandle(descriptors, 4, &readHandle));
+}
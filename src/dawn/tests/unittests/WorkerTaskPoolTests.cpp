@@ -0,0 +1,184 @@
+// Copyright 2022 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// WorkerTaskPoolTests:
+//     Tests for the WorkerTaskPool created by the default dawn::platform::Platform.
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "dawn/platform/DawnPlatform.h"
+#include "dawn/platform/WorkerThread.h"
+
+namespace {
+
+    void IncrementCounter(void* userdata) {
+        static_cast<std::atomic<uint32_t>*>(userdata)->fetch_add(1);
+    }
+
+}  // anonymous namespace
+
+class WorkerTaskPoolTest : public testing::Test {
+  protected:
+    dawn::platform::Platform mPlatform;
+};
+
+// Test that all the tasks of a burst much larger than the number of workers are run and that
+// their events are completed.
+TEST_F(WorkerTaskPoolTest, ManyTasks) {
+    std::unique_ptr<dawn::platform::WorkerTaskPool> pool = mPlatform.CreateWorkerTaskPool();
+
+    constexpr uint32_t kTaskCount = 2000u;
+    std::atomic<uint32_t> counter(0);
+    std::vector<std::unique_ptr<dawn::platform::WaitableEvent>> events;
+    for (uint32_t i = 0; i < kTaskCount; ++i) {
+        events.push_back(pool->PostWorkerTask(IncrementCounter, &counter));
+    }
+
+    for (std::unique_ptr<dawn::platform::WaitableEvent>& event : events) {
+        event->Wait();
+        EXPECT_TRUE(event->IsComplete());
+    }
+    EXPECT_EQ(kTaskCount, counter.load());
+}
+
+// Test that the queued tasks with the high priority run before the ones with the normal priority.
+TEST_F(WorkerTaskPoolTest, Priorities) {
+    using dawn::platform::WorkerTaskPriority;
+
+    // With a single worker the tasks run one at a time, in the order they are popped.
+    dawn::platform::AsyncWorkerThreadPool asyncPool(1);
+    dawn::platform::WorkerTaskPool* pool = &asyncPool;
+
+    struct Gate {
+        std::mutex mutex;
+        std::condition_variable condition;
+        bool isOpen = false;
+    };
+    struct RecordedTask {
+        std::vector<WorkerTaskPriority>* order;
+        WorkerTaskPriority priority;
+    };
+
+    // Keep the worker busy until all the tasks are queued.
+    Gate gate;
+    std::unique_ptr<dawn::platform::WaitableEvent> gateEvent = pool->PostWorkerTask(
+        [](void* userdata) {
+            Gate* gate = static_cast<Gate*>(userdata);
+            std::unique_lock<std::mutex> lock(gate->mutex);
+            gate->condition.wait(lock, [gate] { return gate->isOpen; });
+        },
+        &gate);
+
+    constexpr uint32_t kTaskCount = 100u;
+    std::vector<WorkerTaskPriority> order;
+    std::vector<RecordedTask> tasks(kTaskCount);
+    std::vector<std::unique_ptr<dawn::platform::WaitableEvent>> events;
+    for (uint32_t i = 0; i < kTaskCount; ++i) {
+        tasks[i] = {&order, i % 2 == 0 ? WorkerTaskPriority::Normal : WorkerTaskPriority::High};
+        events.push_back(pool->PostWorkerTaskWithPriority(
+            [](void* userdata) {
+                RecordedTask* task = static_cast<RecordedTask*>(userdata);
+                task->order->push_back(task->priority);
+            },
+            &tasks[i], tasks[i].priority));
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(gate.mutex);
+        gate.isOpen = true;
+    }
+    gate.condition.notify_all();
+
+    gateEvent->Wait();
+    for (std::unique_ptr<dawn::platform::WaitableEvent>& event : events) {
+        event->Wait();
+    }
+
+    ASSERT_EQ(kTaskCount, order.size());
+    for (uint32_t i = 0; i < kTaskCount; ++i) {
+        EXPECT_EQ(i < kTaskCount / 2 ? WorkerTaskPriority::High : WorkerTaskPriority::Normal,
+                  order[i]);
+    }
+}
+
+// Test that the default pool runs all the tasks posted with a priority.
+TEST_F(WorkerTaskPoolTest, PrioritiesWithDefaultPool) {
+    std::unique_ptr<dawn::platform::WorkerTaskPool> pool = mPlatform.CreateWorkerTaskPool();
+
+    constexpr uint32_t kTaskCount = 1000u;
+    std::atomic<uint32_t> counter(0);
+    std::vector<std::unique_ptr<dawn::platform::WaitableEvent>> events;
+    for (uint32_t i = 0; i < kTaskCount; ++i) {
+        using dawn::platform::WorkerTaskPriority;
+        WorkerTaskPriority priority =
+            i % 2 == 0 ? WorkerTaskPriority::High : WorkerTaskPriority::Normal;
+        events.push_back(pool->PostWorkerTaskWithPriority(IncrementCounter, &counter, priority));
+    }
+
+    for (std::unique_ptr<dawn::platform::WaitableEvent>& event : events) {
+        event->Wait();
+    }
+    EXPECT_EQ(kTaskCount, counter.load());
+}
+
+// Test that tasks can be posted from inside a worker task.
+TEST_F(WorkerTaskPoolTest, PostFromTask) {
+    std::unique_ptr<dawn::platform::WorkerTaskPool> pool = mPlatform.CreateWorkerTaskPool();
+
+    struct Context {
+        dawn::platform::WorkerTaskPool* pool;
+        std::atomic<uint32_t> counter;
+        std::unique_ptr<dawn::platform::WaitableEvent> innerEvent;
+    };
+    Context context;
+    context.pool = pool.get();
+    context.counter = 0;
+
+    std::unique_ptr<dawn::platform::WaitableEvent> outerEvent = pool->PostWorkerTask(
+        [](void* userdata) {
+            Context* context = static_cast<Context*>(userdata);
+            context->innerEvent =
+                context->pool->PostWorkerTask(IncrementCounter, &context->counter);
+        },
+        &context);
+
+    outerEvent->Wait();
+    context.innerEvent->Wait();
+    EXPECT_EQ(1u, context.counter.load());
+}
+
+// Test that destroying the pool runs the tasks that are still queued so that no event is left
+// uncompleted.
+TEST_F(WorkerTaskPoolTest, DestroyWithPendingTasks) {
+    std::unique_ptr<dawn::platform::WorkerTaskPool> pool = mPlatform.CreateWorkerTaskPool();
+
+    constexpr uint32_t kTaskCount = 500u;
+    std::atomic<uint32_t> counter(0);
+    std::vector<std::unique_ptr<dawn::platform::WaitableEvent>> events;
+    for (uint32_t i = 0; i < kTaskCount; ++i) {
+        events.push_back(pool->PostWorkerTask(IncrementCounter, &counter));
+    }
+    pool = nullptr;
+
+    EXPECT_EQ(kTaskCount, counter.load());
+    for (std::unique_ptr<dawn::platform::WaitableEvent>& event : events) {
+        EXPECT_TRUE(event->IsComplete());
+    }
+}
@@ -0,0 +1,124 @@
+// Copyright 2022 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+
+#include "dawn/common/Version_autogen.h"
+#include "dawn/native/ShaderModule.h"
+#include "dawn/tests/DawnNativeTest.h"
+#include "dawn/tests/unittests/native/mocks/PlatformMock.h"
+#include "dawn/utils/WGPUHelpers.h"
+
+#include <cstring>
+#include <vector>
+
+using namespace dawn::native;
+using testing::_;
+using testing::Invoke;
+using testing::NotNull;
+using testing::Return;
+using testing::StrictMock;
+
+namespace {
+
+    constexpr char kShader[] = R"(
+        @stage(compute) @workgroup_size(1) fn main() {
+        }
+    )";
+
+    class ShaderModuleCachingTests : public DawnNativeTest {
+      protected:
+        void SetUp() override {
+            // Without a git hash the persistent cache is skipped, see ParseWGSLWithCache.
+            if (dawn::kGitHash.empty()) {
+                GTEST_SKIP();
+            }
+            DawnNativeTest::SetUp();
+        }
+
+        std::unique_ptr<dawn::platform::Platform> CreateTestPlatform() override {
+            auto cachingInterface =
+                std::make_unique<StrictMock<dawn::platform::CachingInterfaceMock>>();
+            mCachingInterface = cachingInterface.get();
+            return std::make_unique<dawn::platform::CachingPlatformMock>(
+                std::move(cachingInterface));
+        }
+
+        // Expects the program to be looked up in the persistent cache, and found as |blob| if it
+        // isn't empty.
+        void ExpectLoad(const std::vector<uint8_t>& blob) {
+            EXPECT_CALL(*mCachingInterface, LoadData(_, _, _, nullptr, 0))
+                .WillOnce(Return(blob.size()));
+            if (!blob.empty()) {
+                EXPECT_CALL(*mCachingInterface, LoadData(_, _, _, NotNull(), blob.size()))
+                    .WillOnce(Invoke([&blob](const WGPUDevice, const void*, size_t,
+                                             void* valueOut, size_t) {
+                        memcpy(valueOut, blob.data(), blob.size());
+                        return blob.size();
+                    }));
+            }
+        }
+
+        // Expects the program to be stored in the persistent cache, and records it in |blob|.
+        void ExpectStore(std::vector<uint8_t>* blob) {
+            EXPECT_CALL(*mCachingInterface, StoreData(_, _, _, _, _))
+                .WillOnce(Invoke([blob](const WGPUDevice, const void*, size_t, const void* value,
+                                        size_t valueSize) {
+                    blob->assign(static_cast<const uint8_t*>(value),
+                                 static_cast<const uint8_t*>(value) + valueSize);
+                }));
+        }
+
+        StrictMock<dawn::platform::CachingInterfaceMock>* mCachingInterface = nullptr;
+    };
+
+}  // anonymous namespace
+
+// Test that on a cache miss the WGSL is parsed and the program is stored.
+TEST_F(ShaderModuleCachingTests, MissStoresProgram) {
+    std::vector<uint8_t> stored;
+    ExpectLoad({});
+    ExpectStore(&stored);
+
+    wgpu::ShaderModule module = utils::CreateShaderModule(device, kShader);
+
+    EXPECT_TRUE(FromAPI(module.Get())->HasEntryPoint("main"));
+    EXPECT_FALSE(stored.empty());
+}
+
+// Test that on a cache hit the program is loaded without storing it again.
+TEST_F(ShaderModuleCachingTests, HitLoadsProgram) {
+    std::vector<uint8_t> stored;
+    ExpectLoad({});
+    ExpectStore(&stored);
+    utils::CreateShaderModule(device, kShader);
+
+    ExpectLoad(stored);
+    EXPECT_CALL(*mCachingInterface, StoreData(_, _, _, _, _)).Times(0);
+    wgpu::ShaderModule module = utils::CreateShaderModule(device, kShader);
+
+    EXPECT_TRUE(FromAPI(module.Get())->HasEntryPoint("main"));
+}
+
+// Test that an entry that can't be loaded is replaced by parsing the WGSL again.
+TEST_F(ShaderModuleCachingTests, InvalidEntryIsReplaced) {
+    std::vector<uint8_t> stored;
+    ExpectLoad({0xDE, 0xAD, 0xBE, 0xEF});
+    ExpectStore(&stored);
+
+    wgpu::ShaderModule module = utils::CreateShaderModule(device, kShader);
+
+    EXPECT_TRUE(FromAPI(module.Get())->HasEntryPoint("main"));
+    EXPECT_FALSE(stored.empty());
+}
@@ -0,0 +1,56 @@
+// Copyright 2022 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TESTS_UNITTESTS_NATIVE_MOCKS_PLATFORM_MOCK_H_
+#define TESTS_UNITTESTS_NATIVE_MOCKS_PLATFORM_MOCK_H_
+
+#include "dawn/platform/DawnPlatform.h"
+
+#include <gmock/gmock.h>
+
+#include <memory>
+
+namespace dawn::platform {
+
+    class CachingInterfaceMock : public CachingInterface {
+      public:
+        MOCK_METHOD(size_t,
+                    LoadData,
+                    (const WGPUDevice, const void*, size_t, void*, size_t),
+                    (override));
+        MOCK_METHOD(void,
+                    StoreData,
+                    (const WGPUDevice, const void*, size_t, const void*, size_t),
+                    (override));
+    };
+
+    // A platform that gives devices the caching interface it owns.
+    class CachingPlatformMock : public Platform {
+      public:
+        CachingPlatformMock(std::unique_ptr<CachingInterface> cachingInterface)
+            : mCachingInterface(std::move(cachingInterface)) {
+        }
+
+        CachingInterface* GetCachingInterface(const void* fingerprint,
+                                              size_t fingerprintSize) override {
+            return mCachingInterface.get();
+        }
+
+      private:
+        std::unique_ptr<CachingInterface> mCachingInterface;
+    };
+
+}  // namespace dawn::platform
+
+#endif  // TESTS_UNITTESTS_NATIVE_MOCKS_PLATFORM_MOCK_H_
@@ -79,19 +79,19 @@ TEST_F(SetViewportTest, ViewportLargerThanFramebuffer) {
 
     // Width is larger than the rendertarget's width
     TestViewportCall(false, 0.0, 0.0, kWidth + 1.0, kHeight, 0.0, 1.0);
-    TestViewportCall(false, 0.0, 0.0, nextafter(float(kWidth), 1000.0f), kHeight, 0.0, 1.0);
+    TestViewportCall(false, 0.0, 0.0, std::nextafter(float(kWidth), 1000.0f), kHeight, 0.0, 1.0);
 
     // Height is larger than the rendertarget's height
     TestViewportCall(false, 0.0, 0.0, kWidth, kHeight + 1.0, 0.0, 1.0);
-    TestViewportCall(false, 0.0, 0.0, kWidth, nextafter(float(kHeight), 1000.0f), 0.0, 1.0);
+    TestViewportCall(false, 0.0, 0.0, kWidth, std::nextafter(float(kHeight), 1000.0f), 0.0, 1.0);
 
     // x + width is larger than the rendertarget's width
     TestViewportCall(false, 2.0, 0.0, kWidth - 1.0, kHeight, 0.0, 1.0);
-    TestViewportCall(false, 1.0, 0.0, nextafter(float(kWidth - 1.0), 1000.0f), kHeight, 0.0, 1.0);
+    TestViewportCall(false, 1.0, 0.0, std::nextafter(float(kWidth - 1.0), 1000.0f), kHeight, 0.0, 1.0);
 
     // Height is larger than the rendertarget's height
     TestViewportCall(false, 0.0, 2.0, kWidth, kHeight - 1.0, 0.0, 1.0);
-    TestViewportCall(false, 0.0, 1.0, kWidth, nextafter(float(kHeight - 1.0), 1000.0f), 0.0, 1.0);
+    TestViewportCall(false, 0.0, 1.0, kWidth, std::nextafter(float(kHeight - 1.0), 1000.0f), 0.0, 1.0);
 }
 
 // Test to check that negative x in viewport is disallowed
@@ -114,7 +114,7 @@ TEST_F(SetViewportTest, MinDepthOutOfRange) {
 
     // MinDepth is 2 or 1 + epsilon
     TestViewportCall(false, 0.0, 0.0, 1.0, 1.0, 2.0, 1.0);
-    TestViewportCall(false, 0.0, 0.0, 1.0, 1.0, nextafter(1.0f, 1000.0f), 1.0);
+    TestViewportCall(false, 0.0, 0.0, 1.0, 1.0, std::nextafter(1.0f, 1000.0f), 1.0);
 }
 
 // Test to check that minDepth out of range [0, 1] is disallowed
@@ -124,7 +124,7 @@ TEST_F(SetViewportTest, MaxDepthOutOfRange) {
 
     // MaxDepth is 2 or 1 + epsilon
     TestViewportCall(false, 0.0, 0.0, 1.0, 1.0, 1.0, 2.0);
-    TestViewportCall(false, 0.0, 0.0, 1.0, 1.0, 1.0, nextafter(1.0f, 1000.0f));
+    TestViewportCall(false, 0.0, 0.0, 1.0, 1.0, 1.0, std::nextafter(1.0f, 1000.0f));
 }
 
 // Test to check that minDepth equal or greater than maxDepth is disallowed
@@ -14,6 +14,7 @@
 
 #include "dawn/common/Constants.h"
 
+#include "dawn/native/Device.h"
 #include "dawn/native/ShaderModule.h"
 
 #include "dawn/tests/unittests/validation/ValidationTest.h"
@@ -535,3 +536,61 @@ TEST_F(ShaderModuleValidationTest, MaxBindingNumber) {
         }
     )"));
 }
+
+// Test that the WGSL code is only parsed when no shader module with the same code is in the
+// device's cache.
+TEST_F(ShaderModuleValidationTest, ParseOnlyOnCacheMiss) {
+    // This test works assuming ShaderModule is backed by a dawn::native::ShaderModuleBase, which
+    // is not the case on the wire.
+    DAWN_SKIP_TEST_IF(UsesWire());
+
+    const char* kSource = R"(
+        @stage(fragment) fn main() -> @location(0) vec4<f32> {
+            return vec4<f32>(0.0, 1.0, 0.0, 1.0);
+        })";
+    const char* kOtherSource = R"(
+        @stage(fragment) fn main() -> @location(0) vec4<f32> {
+            return vec4<f32>(1.0, 0.0, 0.0, 1.0);
+        })";
+
+    dawn::native::DeviceBase* nativeDevice = dawn::native::FromAPI(device.Get());
+    size_t parseCount = nativeDevice->GetShaderModuleParseCountForTesting();
+
+    wgpu::ShaderModule module = utils::CreateShaderModule(device, kSource);
+    EXPECT_EQ(parseCount + 1, nativeDevice->GetShaderModuleParseCountForTesting());
+
+    // Creating a shader module with the same code returns the cached one without parsing, and
+    // it keeps the compilation messages of its creation.
+    wgpu::ShaderModule sameModule = utils::CreateShaderModule(device, kSource);
+    EXPECT_EQ(parseCount + 1, nativeDevice->GetShaderModuleParseCountForTesting());
+    EXPECT_EQ(module.Get(), sameModule.Get());
+    EXPECT_NE(nullptr, dawn::native::FromAPI(sameModule.Get())->GetCompilationMessages());
+
+    wgpu::ShaderModule otherModule = utils::CreateShaderModule(device, kOtherSource);
+    EXPECT_EQ(parseCount + 2, nativeDevice->GetShaderModuleParseCountForTesting());
+    EXPECT_NE(module.Get(), otherModule.Get());
+
+    // Once the shader module is destroyed, it is removed from the cache and the code is parsed
+    // again.
+    module = nullptr;
+    sameModule = nullptr;
+    module = utils::CreateShaderModule(device, kSource);
+    EXPECT_EQ(parseCount + 3, nativeDevice->GetShaderModuleParseCountForTesting());
+}
+
+// Test that invalid WGSL code is not cached and produces an error every time.
+TEST_F(ShaderModuleValidationTest, InvalidCodeIsNotCached) {
+    DAWN_SKIP_TEST_IF(UsesWire());
+
+    const char* kInvalidSource = R"(
+        @stage(fragment) fn main() -> @location(0) vec4<f32> {
+            return 1.0;
+        })";
+
+    dawn::native::DeviceBase* nativeDevice = dawn::native::FromAPI(device.Get());
+    size_t parseCount = nativeDevice->GetShaderModuleParseCountForTesting();
+
+    ASSERT_DEVICE_ERROR(utils::CreateShaderModule(device, kInvalidSource));
+    ASSERT_DEVICE_ERROR(utils::CreateShaderModule(device, kInvalidSource));
+    EXPECT_EQ(parseCount + 2, nativeDevice->GetShaderModuleParseCountForTesting());
+}
@@ -0,0 +1,166 @@
+// Copyright 2022 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include "dawn/native/vulkan/PipelineCache.h"
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace dawn::native::vulkan;
+
+namespace {
+
+    VkPhysicalDeviceProperties MakeProperties() {
+        VkPhysicalDeviceProperties properties = {};
+        properties.vendorID = 0x10DE;
+        properties.deviceID = 0x1234;
+        properties.driverVersion = 42;
+        for (uint32_t i = 0; i < VK_UUID_SIZE; ++i) {
+            properties.pipelineCacheUUID[i] = static_cast<uint8_t>(i);
+        }
+        return properties;
+    }
+
+    // Returns pipeline cache data made of a valid header for |properties| followed by |payloadSize|
+    // bytes of driver-specific data.
+    std::vector<uint8_t> MakeCacheData(const VkPhysicalDeviceProperties& properties,
+                                       size_t payloadSize = 16) {
+        VkPipelineCacheHeaderVersionOne header;
+        header.headerSize = sizeof(header);
+        header.headerVersion = VK_PIPELINE_CACHE_HEADER_VERSION_ONE;
+        header.vendorID = properties.vendorID;
+        header.deviceID = properties.deviceID;
+        memcpy(header.pipelineCacheUUID, properties.pipelineCacheUUID, VK_UUID_SIZE);
+
+        std::vector<uint8_t> data(sizeof(header) + payloadSize, 0xAB);
+        memcpy(data.data(), &header, sizeof(header));
+        return data;
+    }
+
+}  // anonymous namespace
+
+// Test that the same device and driver always produce the same key.
+TEST(PipelineCacheTests, KeyIsDeterministic) {
+    VkPhysicalDeviceProperties properties = MakeProperties();
+    EXPECT_EQ(CreatePipelineCacheKey(properties), CreatePipelineCacheKey(properties));
+}
+
+// Test that anything that makes drivers reject the cache data changes the key.
+TEST(PipelineCacheTests, KeyDependsOnDeviceAndDriver) {
+    const VkPhysicalDeviceProperties properties = MakeProperties();
+    const dawn::native::PersistentCacheKey key = CreatePipelineCacheKey(properties);
+
+    {
+        VkPhysicalDeviceProperties other = properties;
+        other.vendorID++;
+        EXPECT_NE(key, CreatePipelineCacheKey(other));
+    }
+    {
+        VkPhysicalDeviceProperties other = properties;
+        other.deviceID++;
+        EXPECT_NE(key, CreatePipelineCacheKey(other));
+    }
+    {
+        VkPhysicalDeviceProperties other = properties;
+        other.driverVersion++;
+        EXPECT_NE(key, CreatePipelineCacheKey(other));
+    }
+    for (uint32_t i = 0; i < VK_UUID_SIZE; ++i) {
+        VkPhysicalDeviceProperties other = properties;
+        other.pipelineCacheUUID[i] ^= 0xFF;
+        EXPECT_NE(key, CreatePipelineCacheKey(other));
+    }
+}
+
+// Test that the key doesn't collide with the keys of other persistent cache entries.
+TEST(PipelineCacheTests, KeyIsPrefixedWithType) {
+    const dawn::native::PersistentCacheKey key = CreatePipelineCacheKey(MakeProperties());
+
+    std::string prefix =
+        std::to_string(static_cast<uint32_t>(dawn::native::PersistentKeyType::PipelineCache)) +
+        "\n";
+    ASSERT_GE(key.size(), prefix.size());
+    EXPECT_EQ(0, memcmp(key.data(), prefix.data(), prefix.size()));
+}
+
+// Test that data created by the same device and driver is accepted.
+TEST(PipelineCacheTests, CompatibleData) {
+    VkPhysicalDeviceProperties properties = MakeProperties();
+
+    std::vector<uint8_t> data = MakeCacheData(properties);
+    EXPECT_TRUE(IsPipelineCacheDataCompatible(properties, data.data(), data.size()));
+
+    // A cache with no pipelines is only a header.
+    data = MakeCacheData(properties, 0);
+    EXPECT_TRUE(IsPipelineCacheDataCompatible(properties, data.data(), data.size()));
+}
+
+// Test that missing or truncated data is rejected.
+TEST(PipelineCacheTests, TruncatedData) {
+    VkPhysicalDeviceProperties properties = MakeProperties();
+    EXPECT_FALSE(IsPipelineCacheDataCompatible(properties, nullptr, 0));
+
+    std::vector<uint8_t> data = MakeCacheData(properties, 0);
+    EXPECT_FALSE(IsPipelineCacheDataCompatible(properties, data.data(), data.size() - 1));
+}
+
+// Test that data with a corrupted header is rejected.
+TEST(PipelineCacheTests, InvalidHeader) {
+    VkPhysicalDeviceProperties properties = MakeProperties();
+    VkPipelineCacheHeaderVersionOne header;
+
+    std::vector<uint8_t> data = MakeCacheData(properties);
+    memcpy(&header, data.data(), sizeof(header));
+    header.headerSize = sizeof(header) - 1;
+    memcpy(data.data(), &header, sizeof(header));
+    EXPECT_FALSE(IsPipelineCacheDataCompatible(properties, data.data(), data.size()));
+
+    // The header can't be larger than the data.
+    header.headerSize = static_cast<uint32_t>(data.size() + 1);
+    memcpy(data.data(), &header, sizeof(header));
+    EXPECT_FALSE(IsPipelineCacheDataCompatible(properties, data.data(), data.size()));
+
+    data = MakeCacheData(properties);
+    memcpy(&header, data.data(), sizeof(header));
+    header.headerVersion = static_cast<VkPipelineCacheHeaderVersion>(2);
+    memcpy(data.data(), &header, sizeof(header));
+    EXPECT_FALSE(IsPipelineCacheDataCompatible(properties, data.data(), data.size()));
+}
+
+// Test that data created by another device or driver is rejected.
+TEST(PipelineCacheTests, DataFromOtherDevice) {
+    VkPhysicalDeviceProperties properties = MakeProperties();
+
+    {
+        VkPhysicalDeviceProperties other = properties;
+        other.vendorID++;
+        std::vector<uint8_t> data = MakeCacheData(other);
+        EXPECT_FALSE(IsPipelineCacheDataCompatible(properties, data.data(), data.size()));
+    }
+    {
+        VkPhysicalDeviceProperties other = properties;
+        other.deviceID++;
+        std::vector<uint8_t> data = MakeCacheData(other);
+        EXPECT_FALSE(IsPipelineCacheDataCompatible(properties, data.data(), data.size()));
+    }
+    {
+        VkPhysicalDeviceProperties other = properties;
+        other.pipelineCacheUUID[VK_UUID_SIZE - 1] ^= 0xFF;
+        std::vector<uint8_t> data = MakeCacheData(other);
+        EXPECT_FALSE(IsPipelineCacheDataCompatible(properties, data.data(), data.size()));
+    }
+}
@@ -0,0 +1,220 @@
+// Copyright 2022 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+
+#include "dawn/common/Version_autogen.h"
+#include "dawn/native/Device.h"
+#include "dawn/native/ShaderModule.h"
+#include "dawn/native/vulkan/SpirvCompilation.h"
+#include "dawn/tests/DawnNativeTest.h"
+#include "dawn/tests/unittests/native/mocks/PlatformMock.h"
+#include "dawn/utils/WGPUHelpers.h"
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace dawn::native;
+using namespace dawn::native::vulkan;
+using testing::_;
+using testing::Invoke;
+using testing::Return;
+using testing::StrictMock;
+
+namespace {
+
+    constexpr uint32_t kSpirvMagicNumber = 0x07230203;
+
+    class SpirvCompilationTests : public DawnNativeTest {
+      protected:
+        void SetUp() override {
+            // Without a git hash the persistent cache is skipped, see LoadOrGenerateSpirv.
+            if (dawn::kGitHash.empty()) {
+                GTEST_SKIP();
+            }
+            DawnNativeTest::SetUp();
+
+            // Creating the shader module parses the WGSL, which is cached as well.
+            EXPECT_CALL(*mCachingInterface, LoadData(_, _, _, nullptr, 0)).WillOnce(Return(0));
+            EXPECT_CALL(*mCachingInterface, StoreData(_, _, _, _, _));
+            mModule = utils::CreateShaderModule(device, R"(
+                @stage(compute) @workgroup_size(1) fn main1() {
+                }
+
+                @stage(compute) @workgroup_size(1) fn main2() {
+                }
+            )");
+        }
+
+        std::unique_ptr<dawn::platform::Platform> CreateTestPlatform() override {
+            auto cachingInterface =
+                std::make_unique<StrictMock<dawn::platform::CachingInterfaceMock>>();
+            mCachingInterface = cachingInterface.get();
+            return std::make_unique<dawn::platform::CachingPlatformMock>(
+                std::move(cachingInterface));
+        }
+
+        SpirvCompilationRequest MakeRequest(const char* entryPointName) {
+            SpirvCompilationRequest request;
+            request.program = FromAPI(mModule.Get())->GetTintProgram();
+            request.entryPointName = entryPointName;
+            request.disableWorkgroupInit = false;
+            request.isRobustnessEnabled = true;
+            return request;
+        }
+
+        void LoadOrGenerate(const SpirvCompilationRequest& request,
+                            CompiledSpirv* compiled = nullptr) {
+            CompiledSpirv result;
+            DAWN_ASSERT_AND_ASSIGN(result, LoadOrGenerateSpirv(FromAPI(device.Get()), request));
+            if (compiled != nullptr) {
+                *compiled = std::move(result);
+            }
+        }
+
+        // Expects a cache miss and records the key that is looked up in |key|.
+        void ExpectMiss(std::string* key) {
+            EXPECT_CALL(*mCachingInterface, LoadData(_, _, _, nullptr, 0))
+                .WillOnce(Invoke([key](const WGPUDevice, const void* keyData, size_t keySize,
+                                       void*, size_t) -> size_t {
+                    key->assign(static_cast<const char*>(keyData), keySize);
+                    return 0;
+                }));
+        }
+
+        StrictMock<dawn::platform::CachingInterfaceMock>* mCachingInterface = nullptr;
+        wgpu::ShaderModule mModule;
+    };
+
+}  // anonymous namespace
+
+// Test that on a cache miss the SPIR-V is generated and stored under the key it was looked up with.
+TEST_F(SpirvCompilationTests, MissStoresGeneratedSpirv) {
+    std::string loadKey;
+    ExpectMiss(&loadKey);
+
+    std::string storeKey;
+    std::vector<uint8_t> stored;
+    EXPECT_CALL(*mCachingInterface, StoreData(_, _, _, _, _))
+        .WillOnce(Invoke([&](const WGPUDevice, const void* key, size_t keySize, const void* value,
+                             size_t valueSize) {
+            storeKey.assign(static_cast<const char*>(key), keySize);
+            stored.assign(static_cast<const uint8_t*>(value),
+                          static_cast<const uint8_t*>(value) + valueSize);
+        }));
+
+    CompiledSpirv compiled;
+    LoadOrGenerate(MakeRequest("main1"), &compiled);
+
+    ASSERT_GT(compiled.GetCodeSize(), 0u);
+    EXPECT_EQ(compiled.GetCode()[0], kSpirvMagicNumber);
+    EXPECT_EQ(storeKey, loadKey);
+    ASSERT_EQ(stored.size(), compiled.GetCodeSize());
+    EXPECT_EQ(memcmp(stored.data(), compiled.GetCode(), stored.size()), 0);
+}
+
+// Test that on a cache hit the cached SPIR-V is returned without generating or storing anything.
+TEST_F(SpirvCompilationTests, HitReturnsCachedSpirv) {
+    const std::vector<uint32_t> cached = {kSpirvMagicNumber, 1, 2, 3};
+    const size_t cachedSize = cached.size() * sizeof(uint32_t);
+
+    EXPECT_CALL(*mCachingInterface, LoadData(_, _, _, nullptr, 0)).WillOnce(Return(cachedSize));
+    EXPECT_CALL(*mCachingInterface, LoadData(_, _, _, testing::NotNull(), cachedSize))
+        .WillOnce(Invoke([&](const WGPUDevice, const void*, size_t, void* valueOut, size_t) {
+            memcpy(valueOut, cached.data(), cachedSize);
+            return cachedSize;
+        }));
+    EXPECT_CALL(*mCachingInterface, StoreData(_, _, _, _, _)).Times(0);
+
+    CompiledSpirv compiled;
+    LoadOrGenerate(MakeRequest("main1"), &compiled);
+
+    ASSERT_EQ(compiled.GetCodeSize(), cachedSize);
+    EXPECT_EQ(memcmp(compiled.GetCode(), cached.data(), cachedSize), 0);
+    EXPECT_TRUE(compiled.spirv.empty());
+}
+
+// Test that the key contains the git hash so that SPIR-V cached by another version of Dawn or Tint
+// is never used.
+TEST_F(SpirvCompilationTests, KeyContainsGitHash) {
+    std::string key;
+    ExpectMiss(&key);
+    EXPECT_CALL(*mCachingInterface, StoreData(_, _, _, _, _));
+
+    LoadOrGenerate(MakeRequest("main1"));
+
+    EXPECT_NE(key.find(std::string(dawn::kGitHash)), std::string::npos);
+}
+
+// Test that the key depends on the inputs of the compilation.
+TEST_F(SpirvCompilationTests, KeyDependsOnRequest) {
+    std::string key1;
+    ExpectMiss(&key1);
+    EXPECT_CALL(*mCachingInterface, StoreData(_, _, _, _, _)).Times(3);
+    LoadOrGenerate(MakeRequest("main1"));
+
+    // A different entry point.
+    std::string key2;
+    ExpectMiss(&key2);
+    LoadOrGenerate(MakeRequest("main2"));
+    EXPECT_NE(key1, key2);
+
+    // A different toggle.
+    std::string key3;
+    ExpectMiss(&key3);
+    SpirvCompilationRequest request = MakeRequest("main1");
+    request.isRobustnessEnabled = false;
+    LoadOrGenerate(request);
+    EXPECT_NE(key1, key3);
+}
+
+// Test that the DumpShaders toggle logs the time spent in each transform.
+TEST_F(SpirvCompilationTests, DumpShadersLogsTransformTimings) {
+    wgpu::DeviceDescriptor deviceDescriptor = {};
+    wgpu::DawnTogglesDeviceDescriptor togglesDesc = {};
+    deviceDescriptor.nextInChain = &togglesDesc;
+    const char* toggle = "dump_shaders";
+    togglesDesc.forceEnabledToggles = &toggle;
+    togglesDesc.forceEnabledTogglesCount = 1;
+    wgpu::Device dumpingDevice = wgpu::Device::Acquire(adapter.CreateDevice(&deviceDescriptor));
+
+    std::vector<std::string> messages;
+    dumpingDevice.SetLoggingCallback(
+        [](WGPULoggingType, const char* message, void* userdata) {
+            static_cast<std::vector<std::string>*>(userdata)->push_back(message);
+        },
+        &messages);
+
+    std::string key;
+    ExpectMiss(&key);
+    EXPECT_CALL(*mCachingInterface, StoreData(_, _, _, _, _));
+
+    CompiledSpirv compiled;
+    DAWN_ASSERT_AND_ASSIGN(compiled,
+                           LoadOrGenerateSpirv(FromAPI(dumpingDevice.Get()), MakeRequest("main1")));
+
+    // Logging callbacks are called on the next tick.
+    dumpingDevice.Tick();
+
+    bool foundTimings = false;
+    for (const std::string& message : messages) {
+        if (message.rfind("// Dumped transform timings:", 0) == 0) {
+            foundTimings = true;
+            EXPECT_NE(message.find("SingleEntryPoint: "), std::string::npos) << message;
+            EXPECT_NE(message.find("Robustness: "), std::string::npos) << message;
+        }
+    }
+    EXPECT_TRUE(foundTimings);
+}
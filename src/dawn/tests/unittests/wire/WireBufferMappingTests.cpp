@@ -16,6 +16,8 @@
 
 #include "dawn/wire/WireClient.h"
 
+#include <array>
+
 using namespace testing;
 using namespace dawn::wire;
 
@@ -810,3 +812,124 @@ TEST_F(WireBufferMappingWriteTests, MapInsideCallbackBeforeDestruction) {
         .Times(1 + testData.numRequests);
     wgpuBufferRelease(buffer);
 }
+
+// Test that only the ranges declared with MarkMappedRangeWritten are sent to the server on unmap,
+// and that the next mapping sends the whole mapped range again.
+TEST_F(WireBufferMappingTests, MapWriteOnlySendsWrittenRanges) {
+    constexpr size_t kElementCount = 16;
+    constexpr size_t kSize = kElementCount * sizeof(uint32_t);
+    constexpr size_t kMapOffset = 4 * sizeof(uint32_t);
+    constexpr size_t kMapSize = kSize - kMapOffset;
+
+    WGPUBufferDescriptor descriptor = {};
+    descriptor.size = kSize;
+    descriptor.usage = WGPUBufferUsage_MapWrite;
+
+    WGPUBuffer apiBuffer = api.GetNewBuffer();
+    WGPUBuffer buffer = wgpuDeviceCreateBuffer(device, &descriptor);
+    EXPECT_CALL(api, DeviceCreateBuffer(apiDevice, _)).WillOnce(Return(apiBuffer));
+    FlushClient();
+
+    // It is invalid to declare written ranges of a buffer that isn't mapped.
+    EXPECT_FALSE(GetWireClient()->MarkMappedRangeWritten(buffer, kMapOffset, 4));
+
+    std::array<uint32_t, kElementCount> serverBufferContent;
+    serverBufferContent.fill(0xFFFFFFFF);
+
+    wgpuBufferMapAsync(buffer, WGPUMapMode_Write, kMapOffset, kMapSize, ToMockBufferMapCallback,
+                       nullptr);
+    EXPECT_CALL(api, OnBufferMapAsync(apiBuffer, WGPUMapMode_Write, kMapOffset, kMapSize, _, _))
+        .WillOnce(InvokeWithoutArgs([&]() {
+            api.CallBufferMapAsyncCallback(apiBuffer, WGPUBufferMapAsyncStatus_Success);
+        }));
+    EXPECT_CALL(api, BufferGetMappedRange(apiBuffer, kMapOffset, kMapSize))
+        .WillOnce(Return(&serverBufferContent[kMapOffset / sizeof(uint32_t)]));
+    FlushClient();
+    EXPECT_CALL(*mockBufferMapCallback, Call(WGPUBufferMapAsyncStatus_Success, _)).Times(1);
+    FlushServer();
+
+    // Write every mapped element but only declare some of them as written.
+    uint32_t* mapped = static_cast<uint32_t*>(wgpuBufferGetMappedRange(buffer, kMapOffset, kMapSize));
+    for (size_t i = 0; i < kMapSize / sizeof(uint32_t); ++i) {
+        mapped[i] = static_cast<uint32_t>(i);
+    }
+
+    // Ranges must be inside the mapped range.
+    EXPECT_FALSE(GetWireClient()->MarkMappedRangeWritten(buffer, 0, 4));
+    EXPECT_FALSE(GetWireClient()->MarkMappedRangeWritten(buffer, kSize - 4, 8));
+
+    // Elements 5 and 7, and elements 10 to 12 with overlapping and touching declarations.
+    EXPECT_TRUE(GetWireClient()->MarkMappedRangeWritten(buffer, 5 * sizeof(uint32_t), 4));
+    EXPECT_TRUE(GetWireClient()->MarkMappedRangeWritten(buffer, 7 * sizeof(uint32_t), 4));
+    EXPECT_TRUE(GetWireClient()->MarkMappedRangeWritten(buffer, 11 * sizeof(uint32_t), 8));
+    EXPECT_TRUE(GetWireClient()->MarkMappedRangeWritten(buffer, 10 * sizeof(uint32_t), 8));
+    EXPECT_TRUE(GetWireClient()->MarkMappedRangeWritten(buffer, 5 * sizeof(uint32_t), 4));
+    EXPECT_TRUE(GetWireClient()->MarkMappedRangeWritten(buffer, 14 * sizeof(uint32_t), 0));
+
+    wgpuBufferUnmap(buffer);
+    EXPECT_CALL(api, BufferUnmap(apiBuffer)).Times(1);
+    FlushClient();
+
+    std::array<uint32_t, kElementCount> expected;
+    expected.fill(0xFFFFFFFF);
+    expected[5] = 1;
+    expected[7] = 3;
+    expected[10] = 6;
+    expected[11] = 7;
+    expected[12] = 8;
+    EXPECT_EQ(serverBufferContent, expected);
+
+    // The declared ranges only apply to the mapping they were declared for.
+    wgpuBufferMapAsync(buffer, WGPUMapMode_Write, kMapOffset, kMapSize, ToMockBufferMapCallback,
+                       nullptr);
+    EXPECT_CALL(api, OnBufferMapAsync(apiBuffer, WGPUMapMode_Write, kMapOffset, kMapSize, _, _))
+        .WillOnce(InvokeWithoutArgs([&]() {
+            api.CallBufferMapAsyncCallback(apiBuffer, WGPUBufferMapAsyncStatus_Success);
+        }));
+    EXPECT_CALL(api, BufferGetMappedRange(apiBuffer, kMapOffset, kMapSize))
+        .WillOnce(Return(&serverBufferContent[kMapOffset / sizeof(uint32_t)]));
+    FlushClient();
+    EXPECT_CALL(*mockBufferMapCallback, Call(WGPUBufferMapAsyncStatus_Success, _)).Times(1);
+    FlushServer();
+
+    wgpuBufferUnmap(buffer);
+    EXPECT_CALL(api, BufferUnmap(apiBuffer)).Times(1);
+    FlushClient();
+
+    for (size_t i = 0; i < kElementCount; ++i) {
+        uint32_t expectedValue =
+            i < kMapOffset / sizeof(uint32_t) ? 0xFFFFFFFF : i - kMapOffset / sizeof(uint32_t);
+        EXPECT_EQ(serverBufferContent[i], expectedValue);
+    }
+}
+
+// Test that MarkMappedRangeWritten also applies to buffers mapped at creation.
+TEST_F(WireBufferMappingTests, MappedAtCreationOnlySendsWrittenRanges) {
+    WGPUBufferDescriptor descriptor = {};
+    descriptor.size = 4 * sizeof(uint32_t);
+    descriptor.mappedAtCreation = true;
+
+    WGPUBuffer apiBuffer = api.GetNewBuffer();
+    std::array<uint32_t, 4> apiBufferData = {0, 0, 0, 0};
+
+    WGPUBuffer buffer = wgpuDeviceCreateBuffer(device, &descriptor);
+
+    EXPECT_CALL(api, DeviceCreateBuffer(apiDevice, _)).WillOnce(Return(apiBuffer));
+    EXPECT_CALL(api, BufferGetMappedRange(apiBuffer, 0, descriptor.size))
+        .WillOnce(Return(apiBufferData.data()));
+
+    FlushClient();
+
+    uint32_t* mapped =
+        static_cast<uint32_t*>(wgpuBufferGetMappedRange(buffer, 0, descriptor.size));
+    mapped[1] = 1234;
+    mapped[2] = 5678;
+    EXPECT_TRUE(GetWireClient()->MarkMappedRangeWritten(buffer, sizeof(uint32_t), 4));
+
+    wgpuBufferUnmap(buffer);
+    EXPECT_CALL(api, BufferUnmap(apiBuffer)).Times(1);
+
+    FlushClient();
+
+    EXPECT_EQ(apiBufferData, (std::array<uint32_t, 4>{0, 1234, 0, 0}));
+}
@@ -0,0 +1,293 @@
+// Copyright 2022 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/tests/unittests/wire/WireTest.h"
+
+#include "dawn/dawn_proc.h"
+#include "dawn/utils/TerribleCommandBuffer.h"
+#include "dawn/wire/WireClient.h"
+#include "dawn/wire/WireCmd_autogen.h"
+#include "dawn/wire/WireServer.h"
+
+#include <array>
+#include <limits>
+#include <tuple>
+#include <vector>
+
+using namespace testing;
+using namespace dawn::wire;
+
+// Tests for the compact command encoding, which is used for hot commands like draws and state
+// changes inside passes and interleaved with the regular encoding of all the other commands.
+class WireCompactCommandTests : public WireTest {
+  public:
+    WireCompactCommandTests() {
+    }
+    ~WireCompactCommandTests() override = default;
+
+    void SetUp() override {
+        WireTest::SetUp();
+
+        encoder = wgpuDeviceCreateCommandEncoder(device, nullptr);
+        apiEncoder = api.GetNewCommandEncoder();
+        EXPECT_CALL(api, DeviceCreateCommandEncoder(apiDevice, nullptr))
+            .WillOnce(Return(apiEncoder));
+
+        FlushClient();
+    }
+
+  protected:
+    WGPUBindGroup CreateBindGroup(WGPUBindGroup* apiBindGroup) {
+        WGPUBindGroupLayoutDescriptor bglDescriptor = {};
+        WGPUBindGroupLayout bgl = wgpuDeviceCreateBindGroupLayout(device, &bglDescriptor);
+        WGPUBindGroupLayout apiBgl = api.GetNewBindGroupLayout();
+        EXPECT_CALL(api, DeviceCreateBindGroupLayout(apiDevice, _))
+            .WillOnce(Return(apiBgl))
+            .RetiresOnSaturation();
+
+        WGPUBindGroupDescriptor bindGroupDescriptor = {};
+        bindGroupDescriptor.layout = bgl;
+        WGPUBindGroup bindGroup = wgpuDeviceCreateBindGroup(device, &bindGroupDescriptor);
+        *apiBindGroup = api.GetNewBindGroup();
+        EXPECT_CALL(api, DeviceCreateBindGroup(apiDevice, _))
+            .WillOnce(Return(*apiBindGroup))
+            .RetiresOnSaturation();
+        return bindGroup;
+    }
+
+    WGPURenderPassEncoder BeginRenderPass(WGPURenderPassEncoder* apiPass) {
+        WGPURenderPassDescriptor descriptor = {};
+        WGPURenderPassEncoder pass = wgpuCommandEncoderBeginRenderPass(encoder, &descriptor);
+        *apiPass = api.GetNewRenderPassEncoder();
+        EXPECT_CALL(api, CommandEncoderBeginRenderPass(apiEncoder, _)).WillOnce(Return(*apiPass));
+        return pass;
+    }
+
+    WGPUCommandEncoder encoder;
+    WGPUCommandEncoder apiEncoder;
+
+  private:
+    bool UseCompactCommands() override {
+        return true;
+    }
+};
+
+// Test that all the values of the compact commands go through the wire, including the ones that
+// are specially encoded.
+TEST_F(WireCompactCommandTests, RenderPassValues) {
+    WGPUBufferDescriptor bufferDescriptor = {};
+    bufferDescriptor.size = 256;
+    bufferDescriptor.usage =
+        static_cast<WGPUBufferUsage>(WGPUBufferUsage_Vertex | WGPUBufferUsage_Index);
+    WGPUBuffer buffer = wgpuDeviceCreateBuffer(device, &bufferDescriptor);
+    WGPUBuffer apiBuffer = api.GetNewBuffer();
+    EXPECT_CALL(api, DeviceCreateBuffer(apiDevice, _)).WillOnce(Return(apiBuffer));
+
+    WGPUBindGroup apiBindGroup;
+    WGPUBindGroup bindGroup = CreateBindGroup(&apiBindGroup);
+
+    WGPURenderPassEncoder apiPass;
+    WGPURenderPassEncoder pass = BeginRenderPass(&apiPass);
+
+    std::array<uint32_t, 4> testOffsets = {0, 42, 0xDEAD'BEEFu, 0xFFFF'FFFFu};
+    wgpuRenderPassEncoderSetBindGroup(pass, 3, bindGroup, testOffsets.size(),
+                                      testOffsets.data());
+    wgpuRenderPassEncoderSetVertexBuffer(pass, 1, buffer, 16, WGPU_WHOLE_SIZE);
+    wgpuRenderPassEncoderSetIndexBuffer(pass, buffer, WGPUIndexFormat_Uint32,
+                                        std::numeric_limits<uint64_t>::max() - 1, 0);
+    wgpuRenderPassEncoderSetViewport(pass, -0.5f, 1.5f, 1e30f, 3.0f, 0.0f, 1.0f);
+    wgpuRenderPassEncoderSetStencilReference(pass, 0xFFFF'FFFFu);
+    wgpuRenderPassEncoderDrawIndexed(pass, 6, 1, 2, std::numeric_limits<int32_t>::min(), 0);
+    wgpuRenderPassEncoderDrawIndexed(pass, 6, 1, 2, -1, 0);
+    wgpuRenderPassEncoderDraw(pass, 0xFFFF'FFFFu, 0, 127, 128);
+
+    InSequence s;
+    EXPECT_CALL(api, RenderPassEncoderSetBindGroup(
+                         apiPass, 3, apiBindGroup, testOffsets.size(),
+                         MatchesLambda([testOffsets](const uint32_t* offsets) -> bool {
+                             for (size_t i = 0; i < testOffsets.size(); i++) {
+                                 if (offsets[i] != testOffsets[i]) {
+                                     return false;
+                                 }
+                             }
+                             return true;
+                         })));
+    EXPECT_CALL(api, RenderPassEncoderSetVertexBuffer(apiPass, 1, apiBuffer, 16, WGPU_WHOLE_SIZE));
+    EXPECT_CALL(api, RenderPassEncoderSetIndexBuffer(apiPass, apiBuffer, WGPUIndexFormat_Uint32,
+                                                     std::numeric_limits<uint64_t>::max() - 1, 0));
+    EXPECT_CALL(api, RenderPassEncoderSetViewport(apiPass, -0.5f, 1.5f, 1e30f, 3.0f, 0.0f, 1.0f));
+    EXPECT_CALL(api, RenderPassEncoderSetStencilReference(apiPass, 0xFFFF'FFFFu));
+    EXPECT_CALL(api, RenderPassEncoderDrawIndexed(apiPass, 6, 1, 2,
+                                                  std::numeric_limits<int32_t>::min(), 0));
+    EXPECT_CALL(api, RenderPassEncoderDrawIndexed(apiPass, 6, 1, 2, -1, 0));
+    EXPECT_CALL(api, RenderPassEncoderDraw(apiPass, 0xFFFF'FFFFu, 0, 127, 128));
+
+    FlushClient();
+}
+
+// Test that compact commands interleaved with regular commands are handled in order, and that the
+// delta encoding of the object IDs survives switching between passes and objects.
+TEST_F(WireCompactCommandTests, InterleavedWithRegularCommands) {
+    std::array<WGPUBindGroup, 3> bindGroups;
+    std::array<WGPUBindGroup, 3> apiBindGroups;
+    std::array<WGPURenderPassEncoder, 2> passes;
+    std::array<WGPURenderPassEncoder, 2> apiPasses;
+    {
+        InSequence s;
+        for (size_t i = 0; i < bindGroups.size(); ++i) {
+            bindGroups[i] = CreateBindGroup(&apiBindGroups[i]);
+        }
+        for (size_t i = 0; i < passes.size(); ++i) {
+            passes[i] = BeginRenderPass(&apiPasses[i]);
+        }
+    }
+
+    InSequence s;
+    for (uint32_t i = 0; i < 8; ++i) {
+        WGPURenderPassEncoder pass = passes[i % passes.size()];
+        WGPURenderPassEncoder apiPass = apiPasses[i % passes.size()];
+        size_t group = (i * 2) % bindGroups.size();
+
+        wgpuRenderPassEncoderSetBindGroup(pass, 0, bindGroups[group], 0, nullptr);
+        wgpuRenderPassEncoderPushDebugGroup(pass, "group");
+        wgpuRenderPassEncoderDraw(pass, i, 1, 0, 0);
+        wgpuRenderPassEncoderPopDebugGroup(pass);
+
+        EXPECT_CALL(api, RenderPassEncoderSetBindGroup(apiPass, 0, apiBindGroups[group], 0, _));
+        EXPECT_CALL(api, RenderPassEncoderPushDebugGroup(apiPass, StrEq("group")));
+        EXPECT_CALL(api, RenderPassEncoderDraw(apiPass, i, 1, 0, 0));
+        EXPECT_CALL(api, RenderPassEncoderPopDebugGroup(apiPass));
+    }
+
+    FlushClient();
+}
+
+// Test that commands too large for the compact encoding fall back to the regular encoding.
+TEST_F(WireCompactCommandTests, LargeCommandUsesRegularEncoding) {
+    WGPUBindGroup apiBindGroup;
+    WGPUBindGroup bindGroup = CreateBindGroup(&apiBindGroup);
+
+    WGPUComputePassEncoder pass = wgpuCommandEncoderBeginComputePass(encoder, nullptr);
+    WGPUComputePassEncoder apiPass = api.GetNewComputePassEncoder();
+    EXPECT_CALL(api, CommandEncoderBeginComputePass(apiEncoder, nullptr)).WillOnce(Return(apiPass));
+
+    // Each of these offsets takes five bytes in the compact encoding.
+    std::vector<uint32_t> testOffsets(kMaxCompactCommandSize / 4, 0xFFFF'FFFFu);
+    wgpuComputePassEncoderSetBindGroup(pass, 0, bindGroup, testOffsets.size(),
+                                       testOffsets.data());
+    wgpuComputePassEncoderDispatch(pass, 1, 2, 3);
+
+    InSequence s;
+    EXPECT_CALL(api, ComputePassEncoderSetBindGroup(
+                         apiPass, 0, apiBindGroup, testOffsets.size(),
+                         MatchesLambda([testOffsets](const uint32_t* offsets) -> bool {
+                             for (size_t i = 0; i < testOffsets.size(); i++) {
+                                 if (offsets[i] != testOffsets[i]) {
+                                     return false;
+                                 }
+                             }
+                             return true;
+                         })));
+    EXPECT_CALL(api, ComputePassEncoderDispatch(apiPass, 1, 2, 3));
+
+    FlushClient();
+}
+
+// Test that malformed compact commands are fatal errors for the server.
+TEST_F(WireCompactCommandTests, MalformedCommands) {
+    WGPURenderPassEncoder apiPass;
+    WGPURenderPassEncoder pass = BeginRenderPass(&apiPass);
+
+    // Draw once so that a delta of 0 designates the render pass encoder in the commands below.
+    wgpuRenderPassEncoderDraw(pass, 3, 1, 0, 0);
+    EXPECT_CALL(api, RenderPassEncoderDraw(apiPass, 3, 1, 0, 0));
+    FlushClient();
+
+    auto HandleCommands = [&](std::vector<uint8_t> commands) {
+        return GetWireServer()->HandleCommands(reinterpret_cast<const char*>(commands.data()),
+                                               commands.size()) != nullptr;
+    };
+    constexpr uint8_t kDrawTag = RenderPassEncoderDrawCmd::kCompactTag;
+
+    // Sanity check that the command is valid when it isn't malformed.
+    EXPECT_CALL(api, RenderPassEncoderDraw(apiPass, 3, 1, 0, 0));
+    EXPECT_TRUE(HandleCommands({kDrawTag, 0x00, 3, 1, 0, 0}));
+
+    // Tags that don't correspond to any command.
+    EXPECT_FALSE(HandleCommands({0xFF}));
+
+    // The command is truncated.
+    EXPECT_FALSE(HandleCommands({kDrawTag, 0x00, 3, 1}));
+
+    // The varint is longer than 64 bits.
+    EXPECT_FALSE(HandleCommands(
+        {kDrawTag, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 1, 0, 0}));
+
+    // The vertex count doesn't fit in 32 bits.
+    EXPECT_FALSE(HandleCommands({kDrawTag, 0x00, 0x80, 0x80, 0x80, 0x80, 0x10, 1, 0, 0}));
+
+    // The render pass encoder ID (offset by a delta of 100, zigzag-encoded) is unknown.
+    EXPECT_FALSE(HandleCommands({kDrawTag, 0xC8, 0x01, 3, 1, 0, 0}));
+}
+
+// Tests a client and a server created with all the combinations of useCompactCommands. The
+// parameters are the values for the client and for the server.
+class WireCompactCommandMismatchTests : public testing::TestWithParam<std::tuple<bool, bool>> {};
+
+// Test that the server fails on the first command when it doesn't use the same encoding as the
+// client, before calling into the API.
+TEST_P(WireCompactCommandMismatchTests, FirstCommand) {
+    auto [clientUsesCompactCommands, serverUsesCompactCommands] = GetParam();
+    bool expectSuccess = clientUsesCompactCommands == serverUsesCompactCommands;
+
+    NiceMock<MockProcTable> api;
+    DawnProcTable mockProcs;
+    api.GetProcTable(&mockProcs);
+    WGPUDevice apiDevice = api.GetNewDevice();
+    WGPUQueue apiQueue = api.GetNewQueue();
+
+    utils::TerribleCommandBuffer s2cBuf;
+    utils::TerribleCommandBuffer c2sBuf;
+
+    WireServerDescriptor serverDesc = {};
+    serverDesc.procs = &mockProcs;
+    serverDesc.serializer = &s2cBuf;
+    serverDesc.useCompactCommands = serverUsesCompactCommands;
+    WireServer server(serverDesc);
+    c2sBuf.SetHandler(&server);
+
+    WireClientDescriptor clientDesc = {};
+    clientDesc.serializer = &c2sBuf;
+    clientDesc.useCompactCommands = clientUsesCompactCommands;
+    WireClient client(clientDesc);
+    s2cBuf.SetHandler(&client);
+
+    dawnProcSetProcs(&dawn::wire::client::GetProcs());
+
+    auto deviceReservation = client.ReserveDevice();
+    server.InjectDevice(apiDevice, deviceReservation.id, deviceReservation.generation);
+
+    WGPUQueue queue = wgpuDeviceGetQueue(deviceReservation.device);
+    if (expectSuccess) {
+        EXPECT_CALL(api, DeviceGetQueue(apiDevice)).WillOnce(Return(apiQueue));
+    } else {
+        EXPECT_CALL(api, DeviceGetQueue(apiDevice)).Times(0);
+    }
+    EXPECT_EQ(c2sBuf.Flush(), expectSuccess);
+
+    wgpuQueueRelease(queue);
+    dawnProcSetProcs(nullptr);
+}
+
+INSTANTIATE_TEST_SUITE_P(, WireCompactCommandMismatchTests, Combine(Bool(), Bool()));
@@ -0,0 +1,468 @@
+// Copyright 2022 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/tests/unittests/wire/WireTest.h"
+
+#include "dawn/common/Constants.h"
+#include "dawn/wire/WireClient.h"
+
+#include <array>
+#include <string>
+#include <vector>
+
+using namespace testing;
+using namespace dawn::wire;
+
+namespace {
+
+    // Counts the commands and bytes produced by a client without handling them.
+    class CountingCommandSerializer : public CommandSerializer {
+      public:
+        CountingCommandSerializer() : mBuffer(kMaxAllocationSize) {
+        }
+
+        size_t GetMaximumAllocationSize() const override {
+            return kMaxAllocationSize;
+        }
+
+        void* GetCmdSpace(size_t size) override {
+            if (size > kMaxAllocationSize) {
+                return nullptr;
+            }
+            mCommandCount++;
+            mByteCount += size;
+            return mBuffer.data();
+        }
+
+        bool Flush() override {
+            return true;
+        }
+
+        size_t GetCommandCount() const {
+            return mCommandCount;
+        }
+
+        size_t GetByteCount() const {
+            return mByteCount;
+        }
+
+        void Reset() {
+            mCommandCount = 0;
+            mByteCount = 0;
+        }
+
+      private:
+        static constexpr size_t kMaxAllocationSize = 64 * 1024;
+
+        std::vector<char> mBuffer;
+        size_t mCommandCount = 0;
+        size_t mByteCount = 0;
+    };
+
+    constexpr uint32_t kDrawCount = 1000;
+    constexpr uint32_t kUniformAlignment = 256;
+
+    // The variants of DrawCallPerf that change the pipeline and the dynamic offset of the bind
+    // group for every draw, or keep them the same for the whole pass.
+    struct DrawCallPerfParams {
+        bool dynamicPipeline;
+        bool dynamicOffsets;
+    };
+
+    struct CommandStats {
+        size_t commandCount;
+        size_t byteCount;
+    };
+
+    // Encodes a pass similar to the ones of DrawCallPerf with a client that doesn't talk to any
+    // server, and returns the number of commands and bytes used for the frame.
+    CommandStats EncodeDrawCallPerfFrame(const DrawCallPerfParams& params,
+                                         bool elideRedundantStateCommands) {
+        CountingCommandSerializer serializer;
+        WireClientDescriptor clientDesc = {};
+        clientDesc.serializer = &serializer;
+        clientDesc.elideRedundantStateCommands = elideRedundantStateCommands;
+        WireClient client(clientDesc);
+        WGPUDevice device = client.ReserveDevice().device;
+
+        WGPUShaderModuleDescriptor shaderModuleDescriptor = {};
+        WGPUShaderModule module = wgpuDeviceCreateShaderModule(device, &shaderModuleDescriptor);
+
+        std::array<WGPURenderPipeline, 2> pipelines;
+        for (WGPURenderPipeline& pipeline : pipelines) {
+            WGPURenderPipelineDescriptor pipelineDescriptor = {};
+            pipelineDescriptor.vertex.module = module;
+            pipelineDescriptor.vertex.entryPoint = "main";
+            pipeline = wgpuDeviceCreateRenderPipeline(device, &pipelineDescriptor);
+        }
+
+        WGPUBindGroupLayoutDescriptor bglDescriptor = {};
+        WGPUBindGroupDescriptor bindGroupDescriptor = {};
+        bindGroupDescriptor.layout = wgpuDeviceCreateBindGroupLayout(device, &bglDescriptor);
+        WGPUBindGroup bindGroup = wgpuDeviceCreateBindGroup(device, &bindGroupDescriptor);
+
+        WGPUBufferDescriptor bufferDescriptor = {};
+        bufferDescriptor.size = 4096;
+        bufferDescriptor.usage = WGPUBufferUsage_Vertex;
+        WGPUBuffer vertexBuffer = wgpuDeviceCreateBuffer(device, &bufferDescriptor);
+
+        serializer.Reset();
+
+        WGPUCommandEncoder encoder = wgpuDeviceCreateCommandEncoder(device, nullptr);
+        WGPURenderPassDescriptor renderPassDescriptor = {};
+        WGPURenderPassEncoder pass =
+            wgpuCommandEncoderBeginRenderPass(encoder, &renderPassDescriptor);
+        for (uint32_t i = 0; i < kDrawCount; ++i) {
+            uint32_t dynamicOffset = params.dynamicOffsets ? (i % 64) * kUniformAlignment : 0;
+            wgpuRenderPassEncoderSetPipeline(pass,
+                                             pipelines[params.dynamicPipeline ? i % 2 : 0]);
+            wgpuRenderPassEncoderSetBindGroup(pass, 0, bindGroup, 1, &dynamicOffset);
+            wgpuRenderPassEncoderSetVertexBuffer(pass, 0, vertexBuffer, 0, WGPU_WHOLE_SIZE);
+            wgpuRenderPassEncoderDraw(pass, 3, 1, 0, 0);
+        }
+        wgpuRenderPassEncoderEnd(pass);
+        wgpuCommandEncoderFinish(encoder, nullptr);
+
+        return {serializer.GetCommandCount(), serializer.GetByteCount()};
+    }
+
+}  // anonymous namespace
+
+// Tests for the client-side elision of render pass commands that set the state that is already
+// set in the pass.
+class WireRedundantStateTests : public WireTest {
+  public:
+    WireRedundantStateTests() {
+    }
+    ~WireRedundantStateTests() override = default;
+
+    void SetUp() override {
+        WireTest::SetUp();
+
+        encoder = wgpuDeviceCreateCommandEncoder(device, nullptr);
+        apiEncoder = api.GetNewCommandEncoder();
+        EXPECT_CALL(api, DeviceCreateCommandEncoder(apiDevice, nullptr))
+            .WillOnce(Return(apiEncoder));
+
+        FlushClient();
+    }
+
+  protected:
+    // The helpers flush the client so that the client and server objects are matched in order.
+    WGPUBuffer CreateBuffer(WGPUBuffer* apiBuffer) {
+        WGPUBufferDescriptor descriptor = {};
+        descriptor.size = 256;
+        descriptor.usage =
+            static_cast<WGPUBufferUsage>(WGPUBufferUsage_Vertex | WGPUBufferUsage_Index);
+        WGPUBuffer buffer = wgpuDeviceCreateBuffer(device, &descriptor);
+        *apiBuffer = api.GetNewBuffer();
+        EXPECT_CALL(api, DeviceCreateBuffer(apiDevice, _))
+            .WillOnce(Return(*apiBuffer))
+            .RetiresOnSaturation();
+        FlushClient();
+        return buffer;
+    }
+
+    WGPUBindGroup CreateBindGroup(WGPUBindGroup* apiBindGroup) {
+        WGPUBindGroupLayoutDescriptor bglDescriptor = {};
+        WGPUBindGroupLayout bgl = wgpuDeviceCreateBindGroupLayout(device, &bglDescriptor);
+        WGPUBindGroupLayout apiBgl = api.GetNewBindGroupLayout();
+        EXPECT_CALL(api, DeviceCreateBindGroupLayout(apiDevice, _))
+            .WillOnce(Return(apiBgl))
+            .RetiresOnSaturation();
+
+        WGPUBindGroupDescriptor bindGroupDescriptor = {};
+        bindGroupDescriptor.layout = bgl;
+        WGPUBindGroup bindGroup = wgpuDeviceCreateBindGroup(device, &bindGroupDescriptor);
+        *apiBindGroup = api.GetNewBindGroup();
+        EXPECT_CALL(api, DeviceCreateBindGroup(apiDevice, _))
+            .WillOnce(Return(*apiBindGroup))
+            .RetiresOnSaturation();
+        FlushClient();
+        return bindGroup;
+    }
+
+    WGPURenderPipeline CreateRenderPipeline(WGPURenderPipeline* apiPipeline) {
+        WGPUShaderModuleDescriptor shaderModuleDescriptor = {};
+        WGPUShaderModule module = wgpuDeviceCreateShaderModule(device, &shaderModuleDescriptor);
+        EXPECT_CALL(api, DeviceCreateShaderModule(apiDevice, _))
+            .WillOnce(Return(api.GetNewShaderModule()))
+            .RetiresOnSaturation();
+
+        WGPURenderPipelineDescriptor pipelineDescriptor = {};
+        pipelineDescriptor.vertex.module = module;
+        pipelineDescriptor.vertex.entryPoint = "main";
+        WGPURenderPipeline pipeline = wgpuDeviceCreateRenderPipeline(device, &pipelineDescriptor);
+        *apiPipeline = api.GetNewRenderPipeline();
+        EXPECT_CALL(api, DeviceCreateRenderPipeline(apiDevice, _))
+            .WillOnce(Return(*apiPipeline))
+            .RetiresOnSaturation();
+        FlushClient();
+        return pipeline;
+    }
+
+    WGPURenderPassEncoder BeginRenderPass(WGPURenderPassEncoder* apiPass) {
+        WGPURenderPassDescriptor descriptor = {};
+        WGPURenderPassEncoder pass = wgpuCommandEncoderBeginRenderPass(encoder, &descriptor);
+        *apiPass = api.GetNewRenderPassEncoder();
+        EXPECT_CALL(api, CommandEncoderBeginRenderPass(apiEncoder, _))
+            .WillOnce(Return(*apiPass))
+            .RetiresOnSaturation();
+        FlushClient();
+        return pass;
+    }
+
+    WGPUCommandEncoder encoder;
+    WGPUCommandEncoder apiEncoder;
+
+  private:
+    bool ElideRedundantStateCommands() override {
+        return true;
+    }
+};
+
+// Test that setting the same state again doesn't send any command.
+TEST_F(WireRedundantStateTests, RedundantCommandsAreSkipped) {
+    WGPURenderPipeline apiPipeline;
+    WGPURenderPipeline pipeline = CreateRenderPipeline(&apiPipeline);
+    WGPUBindGroup apiBindGroup;
+    WGPUBindGroup bindGroup = CreateBindGroup(&apiBindGroup);
+    WGPUBuffer apiBuffer;
+    WGPUBuffer buffer = CreateBuffer(&apiBuffer);
+
+    WGPURenderPassEncoder apiPass;
+    WGPURenderPassEncoder pass = BeginRenderPass(&apiPass);
+
+    std::array<uint32_t, 2> offsets = {0, 256};
+    for (uint32_t i = 0; i < 3; ++i) {
+        wgpuRenderPassEncoderSetPipeline(pass, pipeline);
+        wgpuRenderPassEncoderSetBindGroup(pass, 1, bindGroup, offsets.size(), offsets.data());
+        wgpuRenderPassEncoderSetVertexBuffer(pass, 2, buffer, 16, WGPU_WHOLE_SIZE);
+        wgpuRenderPassEncoderSetIndexBuffer(pass, buffer, WGPUIndexFormat_Uint16, 0, 64);
+        wgpuRenderPassEncoderDraw(pass, 3, 1, 0, 0);
+    }
+
+    EXPECT_CALL(api, RenderPassEncoderSetPipeline(apiPass, apiPipeline)).Times(1);
+    EXPECT_CALL(api, RenderPassEncoderSetBindGroup(apiPass, 1, apiBindGroup, offsets.size(), _))
+        .Times(1);
+    EXPECT_CALL(api, RenderPassEncoderSetVertexBuffer(apiPass, 2, apiBuffer, 16, WGPU_WHOLE_SIZE))
+        .Times(1);
+    EXPECT_CALL(api,
+                RenderPassEncoderSetIndexBuffer(apiPass, apiBuffer, WGPUIndexFormat_Uint16, 0, 64))
+        .Times(1);
+    EXPECT_CALL(api, RenderPassEncoderDraw(apiPass, 3, 1, 0, 0)).Times(3);
+
+    FlushClient();
+}
+
+// Test that commands changing any of the arguments of the state are sent.
+TEST_F(WireRedundantStateTests, ChangedStateIsSent) {
+    std::array<WGPURenderPipeline, 2> apiPipelines;
+    std::array<WGPURenderPipeline, 2> pipelines;
+    std::array<WGPUBuffer, 2> apiBuffers;
+    std::array<WGPUBuffer, 2> buffers;
+    for (size_t i = 0; i < 2; ++i) {
+        pipelines[i] = CreateRenderPipeline(&apiPipelines[i]);
+        buffers[i] = CreateBuffer(&apiBuffers[i]);
+    }
+    WGPUBindGroup apiBindGroup;
+    WGPUBindGroup bindGroup = CreateBindGroup(&apiBindGroup);
+
+    WGPURenderPassEncoder apiPass;
+    WGPURenderPassEncoder pass = BeginRenderPass(&apiPass);
+
+    wgpuRenderPassEncoderSetPipeline(pass, pipelines[0]);
+    wgpuRenderPassEncoderSetPipeline(pass, pipelines[1]);
+    wgpuRenderPassEncoderSetPipeline(pass, pipelines[0]);
+
+    uint32_t offset = 0;
+    wgpuRenderPassEncoderSetBindGroup(pass, 0, bindGroup, 1, &offset);
+    wgpuRenderPassEncoderSetBindGroup(pass, 1, bindGroup, 1, &offset);
+    offset = 256;
+    wgpuRenderPassEncoderSetBindGroup(pass, 1, bindGroup, 1, &offset);
+    wgpuRenderPassEncoderSetBindGroup(pass, 1, bindGroup, 0, nullptr);
+
+    wgpuRenderPassEncoderSetVertexBuffer(pass, 0, buffers[0], 0, WGPU_WHOLE_SIZE);
+    wgpuRenderPassEncoderSetVertexBuffer(pass, 1, buffers[0], 0, WGPU_WHOLE_SIZE);
+    wgpuRenderPassEncoderSetVertexBuffer(pass, 1, buffers[1], 0, WGPU_WHOLE_SIZE);
+    wgpuRenderPassEncoderSetVertexBuffer(pass, 1, buffers[1], 4, WGPU_WHOLE_SIZE);
+    wgpuRenderPassEncoderSetVertexBuffer(pass, 1, buffers[1], 4, 8);
+
+    wgpuRenderPassEncoderSetIndexBuffer(pass, buffers[0], WGPUIndexFormat_Uint16, 0, 64);
+    wgpuRenderPassEncoderSetIndexBuffer(pass, buffers[0], WGPUIndexFormat_Uint32, 0, 64);
+    wgpuRenderPassEncoderSetIndexBuffer(pass, buffers[1], WGPUIndexFormat_Uint32, 0, 64);
+    wgpuRenderPassEncoderSetIndexBuffer(pass, buffers[1], WGPUIndexFormat_Uint32, 4, 64);
+    wgpuRenderPassEncoderSetIndexBuffer(pass, buffers[1], WGPUIndexFormat_Uint32, 4, 60);
+
+    InSequence s;
+    EXPECT_CALL(api, RenderPassEncoderSetPipeline(apiPass, apiPipelines[0]));
+    EXPECT_CALL(api, RenderPassEncoderSetPipeline(apiPass, apiPipelines[1]));
+    EXPECT_CALL(api, RenderPassEncoderSetPipeline(apiPass, apiPipelines[0]));
+    EXPECT_CALL(api, RenderPassEncoderSetBindGroup(apiPass, 0, apiBindGroup, 1, _));
+    EXPECT_CALL(api, RenderPassEncoderSetBindGroup(apiPass, 1, apiBindGroup, 1, _));
+    EXPECT_CALL(api, RenderPassEncoderSetBindGroup(apiPass, 1, apiBindGroup, 1, _));
+    EXPECT_CALL(api, RenderPassEncoderSetBindGroup(apiPass, 1, apiBindGroup, 0, _));
+    EXPECT_CALL(api, RenderPassEncoderSetVertexBuffer(apiPass, 0, apiBuffers[0], 0, _));
+    EXPECT_CALL(api, RenderPassEncoderSetVertexBuffer(apiPass, 1, apiBuffers[0], 0, _));
+    EXPECT_CALL(api, RenderPassEncoderSetVertexBuffer(apiPass, 1, apiBuffers[1], 0, _));
+    EXPECT_CALL(api, RenderPassEncoderSetVertexBuffer(apiPass, 1, apiBuffers[1], 4, _));
+    EXPECT_CALL(api, RenderPassEncoderSetVertexBuffer(apiPass, 1, apiBuffers[1], 4, 8));
+    EXPECT_CALL(api, RenderPassEncoderSetIndexBuffer(apiPass, apiBuffers[0],
+                                                     WGPUIndexFormat_Uint16, 0, 64));
+    EXPECT_CALL(api, RenderPassEncoderSetIndexBuffer(apiPass, apiBuffers[0],
+                                                     WGPUIndexFormat_Uint32, 0, 64));
+    EXPECT_CALL(api, RenderPassEncoderSetIndexBuffer(apiPass, apiBuffers[1],
+                                                     WGPUIndexFormat_Uint32, 0, 64));
+    EXPECT_CALL(api, RenderPassEncoderSetIndexBuffer(apiPass, apiBuffers[1],
+                                                     WGPUIndexFormat_Uint32, 4, 64));
+    EXPECT_CALL(api, RenderPassEncoderSetIndexBuffer(apiPass, apiBuffers[1],
+                                                     WGPUIndexFormat_Uint32, 4, 60));
+
+    FlushClient();
+}
+
+// Test that the state isn't shared between passes and is reset by ExecuteBundles.
+TEST_F(WireRedundantStateTests, StateIsPerPassAndResetByExecuteBundles) {
+    WGPURenderPipeline apiPipeline;
+    WGPURenderPipeline pipeline = CreateRenderPipeline(&apiPipeline);
+
+    WGPURenderPassEncoder apiPass1;
+    WGPURenderPassEncoder pass1 = BeginRenderPass(&apiPass1);
+    WGPURenderPassEncoder apiPass2;
+    WGPURenderPassEncoder pass2 = BeginRenderPass(&apiPass2);
+
+    wgpuRenderPassEncoderSetPipeline(pass1, pipeline);
+    wgpuRenderPassEncoderSetPipeline(pass2, pipeline);
+    wgpuRenderPassEncoderExecuteBundles(pass1, 0, nullptr);
+    wgpuRenderPassEncoderSetPipeline(pass1, pipeline);
+    wgpuRenderPassEncoderSetPipeline(pass2, pipeline);
+
+    InSequence s;
+    EXPECT_CALL(api, RenderPassEncoderSetPipeline(apiPass1, apiPipeline));
+    EXPECT_CALL(api, RenderPassEncoderSetPipeline(apiPass2, apiPipeline));
+    EXPECT_CALL(api, RenderPassEncoderExecuteBundles(apiPass1, 0, _));
+    EXPECT_CALL(api, RenderPassEncoderSetPipeline(apiPass1, apiPipeline));
+
+    FlushClient();
+}
+
+// Test that commands after the end of the pass are always sent so that the server produces the
+// validation error for them.
+TEST_F(WireRedundantStateTests, CommandsAfterEndAreSent) {
+    WGPURenderPipeline apiPipeline;
+    WGPURenderPipeline pipeline = CreateRenderPipeline(&apiPipeline);
+
+    WGPURenderPassEncoder apiPass;
+    WGPURenderPassEncoder pass = BeginRenderPass(&apiPass);
+
+    wgpuRenderPassEncoderSetPipeline(pass, pipeline);
+    wgpuRenderPassEncoderEnd(pass);
+    wgpuRenderPassEncoderSetPipeline(pass, pipeline);
+    wgpuRenderPassEncoderSetPipeline(pass, pipeline);
+
+    InSequence s;
+    EXPECT_CALL(api, RenderPassEncoderSetPipeline(apiPass, apiPipeline));
+    EXPECT_CALL(api, RenderPassEncoderEnd(apiPass));
+    EXPECT_CALL(api, RenderPassEncoderSetPipeline(apiPass, apiPipeline)).Times(2);
+
+    FlushClient();
+}
+
+// Test that commands for out of range slots or with too many dynamic offsets are always sent so
+// that the server produces the validation error for them.
+TEST_F(WireRedundantStateTests, InvalidCommandsAreSent) {
+    WGPUBuffer apiBuffer;
+    WGPUBuffer buffer = CreateBuffer(&apiBuffer);
+    WGPUBindGroup apiBindGroup;
+    WGPUBindGroup bindGroup = CreateBindGroup(&apiBindGroup);
+
+    WGPURenderPassEncoder apiPass;
+    WGPURenderPassEncoder pass = BeginRenderPass(&apiPass);
+
+    std::array<uint32_t, kMaxDynamicUniformBuffersPerPipelineLayout +
+                             kMaxDynamicStorageBuffersPerPipelineLayout + 1>
+        offsets = {};
+    for (uint32_t i = 0; i < 2; ++i) {
+        wgpuRenderPassEncoderSetBindGroup(pass, kMaxBindGroups, bindGroup, 0, nullptr);
+        wgpuRenderPassEncoderSetBindGroup(pass, 0, bindGroup, offsets.size(), offsets.data());
+        wgpuRenderPassEncoderSetVertexBuffer(pass, kMaxVertexBuffers, buffer, 0, WGPU_WHOLE_SIZE);
+    }
+
+    EXPECT_CALL(api, RenderPassEncoderSetBindGroup(apiPass, kMaxBindGroups, apiBindGroup, 0, _))
+        .Times(2);
+    EXPECT_CALL(api, RenderPassEncoderSetBindGroup(apiPass, 0, apiBindGroup, offsets.size(), _))
+        .Times(2);
+    EXPECT_CALL(api, RenderPassEncoderSetVertexBuffer(apiPass, kMaxVertexBuffers, apiBuffer, 0, _))
+        .Times(2);
+
+    FlushClient();
+}
+
+// Test that an object reusing the ID of a released object isn't mistaken for it.
+TEST_F(WireRedundantStateTests, ReusedObjectIdIsSent) {
+    WGPURenderPassEncoder apiPass;
+    WGPURenderPassEncoder pass = BeginRenderPass(&apiPass);
+
+    WGPUBuffer apiBuffer1;
+    WGPUBuffer buffer1 = CreateBuffer(&apiBuffer1);
+    wgpuRenderPassEncoderSetVertexBuffer(pass, 0, buffer1, 0, WGPU_WHOLE_SIZE);
+    wgpuBufferRelease(buffer1);
+
+    EXPECT_CALL(api, RenderPassEncoderSetVertexBuffer(apiPass, 0, apiBuffer1, 0, _));
+    EXPECT_CALL(api, BufferRelease(apiBuffer1));
+    FlushClient();
+
+    // The client reuses the ID of the first buffer for the second one.
+    WGPUBuffer apiBuffer2;
+    WGPUBuffer buffer2 = CreateBuffer(&apiBuffer2);
+    wgpuRenderPassEncoderSetVertexBuffer(pass, 0, buffer2, 0, WGPU_WHOLE_SIZE);
+
+    EXPECT_CALL(api, RenderPassEncoderSetVertexBuffer(apiPass, 0, apiBuffer2, 0, _));
+    FlushClient();
+}
+
+// Test the number of commands and bytes saved on passes similar to the ones of DrawCallPerf.
+TEST_F(WireRedundantStateTests, DrawCallPerfSavings) {
+    // CreateCommandEncoder, BeginRenderPass, End and Finish.
+    constexpr size_t kFrameCommandCount = 4;
+
+    // Each draw sets the pipeline, the bind group and the vertex buffer.
+    constexpr size_t kStateCommandsPerDraw = 3;
+
+    struct Variant {
+        const char* name;
+        DrawCallPerfParams params;
+        size_t expectedStateCommands;
+    };
+    std::array<Variant, 4> variants = {{
+        {"Static", {false, false}, 3},
+        {"DynamicPipeline", {true, false}, kDrawCount + 2},
+        {"DynamicOffsets", {false, true}, kDrawCount + 2},
+        {"DynamicPipelineAndOffsets", {true, true}, 2 * kDrawCount + 1},
+    }};
+
+    for (const Variant& variant : variants) {
+        CommandStats regular = EncodeDrawCallPerfFrame(variant.params, false);
+        CommandStats elided = EncodeDrawCallPerfFrame(variant.params, true);
+
+        EXPECT_EQ(regular.commandCount,
+                  kFrameCommandCount + kDrawCount * (kStateCommandsPerDraw + 1));
+        EXPECT_EQ(elided.commandCount,
+                  kFrameCommandCount + kDrawCount + variant.expectedStateCommands);
+        EXPECT_LT(elided.byteCount, regular.byteCount);
+
+        RecordProperty(std::string(variant.name) + "BytesSaved",
+                       static_cast<int>(regular.byteCount - elided.byteCount));
+    }
+}
@@ -36,6 +36,14 @@ server::MemoryTransferService* WireTest::GetServerMemoryTransferService() {
     return nullptr;
 }
 
+bool WireTest::UseCompactCommands() {
+    return false;
+}
+
+bool WireTest::ElideRedundantStateCommands() {
+    return false;
+}
+
 void WireTest::SetUp() {
     DawnProcTable mockProcs;
     api.GetProcTable(&mockProcs);
@@ -54,6 +62,7 @@ void WireTest::SetUp() {
     serverDesc.procs = &mockProcs;
     serverDesc.serializer = mS2cBuf.get();
     serverDesc.memoryTransferService = GetServerMemoryTransferService();
+    serverDesc.useCompactCommands = UseCompactCommands();
 
     mWireServer.reset(new WireServer(serverDesc));
     mC2sBuf->SetHandler(mWireServer.get());
@@ -61,6 +70,8 @@ void WireTest::SetUp() {
     WireClientDescriptor clientDesc = {};
     clientDesc.serializer = mC2sBuf.get();
     clientDesc.memoryTransferService = GetClientMemoryTransferService();
+    clientDesc.useCompactCommands = UseCompactCommands();
+    clientDesc.elideRedundantStateCommands = ElideRedundantStateCommands();
 
     mWireClient.reset(new WireClient(clientDesc));
     mS2cBuf->SetHandler(mWireClient.get());
@@ -15,6 +15,7 @@
 #include "dawn/mock_webgpu.h"
 #include "gtest/gtest.h"
 
+#include <cstring>
 #include <memory>
 
 // Definition of a "Lambda predicate matcher" for GMock to allow checking deep structures
@@ -142,6 +143,8 @@ class WireTest : public testing::Test {
 
     virtual dawn::wire::client::MemoryTransferService* GetClientMemoryTransferService();
     virtual dawn::wire::server::MemoryTransferService* GetServerMemoryTransferService();
+    virtual bool UseCompactCommands();
+    virtual bool ElideRedundantStateCommands();
 
     std::unique_ptr<dawn::wire::WireServer> mWireServer;
     std::unique_ptr<dawn::wire::WireClient> mWireClient;
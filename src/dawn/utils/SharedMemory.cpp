@@ -0,0 +1,106 @@
+// Copyright 2022 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/utils/SharedMemory.h"
+
+#include "dawn/common/Platform.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#if !defined(DAWN_PLATFORM_LINUX)
+#    include <atomic>
+#    include <string>
+#endif
+
+namespace utils {
+
+    namespace {
+
+        int CreateSharedMemoryFile() {
+#if defined(DAWN_PLATFORM_LINUX)
+            return memfd_create("dawn-shared-memory", MFD_CLOEXEC);
+#else
+            static std::atomic<uint32_t> sCounter{0};
+            std::string name = "/dawn-shared-memory-" + std::to_string(getpid()) + "-" +
+                               std::to_string(sCounter.fetch_add(1));
+            int fd = shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+            if (fd >= 0) {
+                // Only the file descriptor is needed to share the memory.
+                shm_unlink(name.c_str());
+            }
+            return fd;
+#endif
+        }
+
+    }  // anonymous namespace
+
+    // static
+    std::unique_ptr<SharedMemoryRegion> SharedMemoryRegion::Create(size_t size) {
+        if (size == 0) {
+            return nullptr;
+        }
+
+        int fd = CreateSharedMemoryFile();
+        if (fd < 0) {
+            return nullptr;
+        }
+        if (ftruncate(fd, size) != 0) {
+            close(fd);
+            return nullptr;
+        }
+        return Open(fd);
+    }
+
+    // static
+    std::unique_ptr<SharedMemoryRegion> SharedMemoryRegion::Open(int fd) {
+        struct stat info;
+        if (fstat(fd, &info) != 0 || info.st_size <= 0) {
+            close(fd);
+            return nullptr;
+        }
+
+        size_t size = static_cast<size_t>(info.st_size);
+        void* data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (data == MAP_FAILED) {
+            close(fd);
+            return nullptr;
+        }
+        return std::unique_ptr<SharedMemoryRegion>(new SharedMemoryRegion(fd, data, size));
+    }
+
+    SharedMemoryRegion::SharedMemoryRegion(int fd, void* data, size_t size)
+        : mFd(fd), mData(data), mSize(size) {
+    }
+
+    SharedMemoryRegion::~SharedMemoryRegion() {
+        munmap(mData, mSize);
+        close(mFd);
+    }
+
+    int SharedMemoryRegion::GetFileDescriptor() const {
+        return mFd;
+    }
+
+    void* SharedMemoryRegion::GetData() const {
+        return mData;
+    }
+
+    size_t SharedMemoryRegion::GetSize() const {
+        return mSize;
+    }
+
+}  // namespace utils
@@ -0,0 +1,55 @@
+// Copyright 2022 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef UTILS_SHARED_MEMORY_H_
+#define UTILS_SHARED_MEMORY_H_
+
+#include <cstddef>
+#include <memory>
+
+namespace utils {
+
+    // A mapping of memory that other processes can map as well, backed by a memfd on Linux and by
+    // an unlinked POSIX shared memory object on other POSIX systems.
+    class SharedMemoryRegion {
+      public:
+        // Creates and maps a new zero-initialized region of |size| bytes. Returns nullptr on
+        // failure.
+        static std::unique_ptr<SharedMemoryRegion> Create(size_t size);
+
+        // Maps the whole region backed by |fd|, for example one created by another process. Takes
+        // ownership of |fd|. Returns nullptr on failure.
+        static std::unique_ptr<SharedMemoryRegion> Open(int fd);
+
+        ~SharedMemoryRegion();
+
+        SharedMemoryRegion(const SharedMemoryRegion&) = delete;
+        SharedMemoryRegion& operator=(const SharedMemoryRegion&) = delete;
+
+        // The file descriptor backing the region, to be passed to the peer process.
+        int GetFileDescriptor() const;
+        void* GetData() const;
+        size_t GetSize() const;
+
+      private:
+        SharedMemoryRegion(int fd, void* data, size_t size);
+
+        int mFd;
+        void* mData;
+        size_t mSize;
+    };
+
+}  // namespace utils
+
+#endif  // UTILS_SHARED_MEMORY_H_
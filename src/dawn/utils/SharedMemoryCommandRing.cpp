@@ -0,0 +1,411 @@
+// Copyright 2022 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/utils/SharedMemoryCommandRing.h"
+
+#include "dawn/common/Math.h"
+#include "dawn/common/Platform.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <new>
+
+#include <time.h>
+
+#if defined(DAWN_PLATFORM_LINUX)
+#    include <linux/futex.h>
+#    include <sys/syscall.h>
+#    include <unistd.h>
+#    include <climits>
+#endif
+
+namespace utils {
+
+    namespace {
+
+        constexpr uint32_t kRingMagic = 0x52495744;  // "DWIR"
+        constexpr uint32_t kRingVersion = 1;
+
+        constexpr size_t kCacheLineSize = 64;
+        constexpr size_t kHeaderSize = 4 * kCacheLineSize;
+        constexpr size_t kMinCapacity = 4096;
+
+        // Each segment starts with its size so the consumer can hand it to the handler in one call.
+        // kWrapMarker means the rest of the ring is unused and the next segment is at its start.
+        constexpr size_t kSegmentHeaderSize = sizeof(uint64_t);
+        constexpr uint64_t kWrapMarker = ~uint64_t(0);
+
+        // Sleeps without a deadline are split in slices so that a peer that went away without
+        // closing the ring cannot hang us forever in the kernel.
+        constexpr uint64_t kWaitSliceNs = 100'000'000;
+
+#if defined(DAWN_PLATFORM_LINUX)
+        void WaitOnAddress(std::atomic<uint32_t>* address, uint32_t expected, uint64_t timeoutNs) {
+            struct timespec timeout;
+            timeout.tv_sec = timeoutNs / 1'000'000'000;
+            timeout.tv_nsec = timeoutNs % 1'000'000'000;
+            // Not FUTEX_PRIVATE_FLAG: the word may be shared with another process.
+            syscall(SYS_futex, reinterpret_cast<uint32_t*>(address), FUTEX_WAIT, expected,
+                    &timeout, nullptr, 0);
+        }
+
+        void WakeByAddress(std::atomic<uint32_t>* address) {
+            syscall(SYS_futex, reinterpret_cast<uint32_t*>(address), FUTEX_WAKE, INT_MAX, nullptr,
+                    nullptr, 0);
+        }
+#else
+        // Without a portable cross-process futex, poll the address with short sleeps.
+        void WaitOnAddress(std::atomic<uint32_t>* address, uint32_t expected, uint64_t timeoutNs) {
+            constexpr uint64_t kPollIntervalNs = 50'000;
+            for (uint64_t waited = 0; waited < timeoutNs; waited += kPollIntervalNs) {
+                if (address->load(std::memory_order_acquire) != expected) {
+                    return;
+                }
+                struct timespec interval = {0, static_cast<long>(kPollIntervalNs)};
+                nanosleep(&interval, nullptr);
+            }
+        }
+
+        void WakeByAddress(std::atomic<uint32_t>*) {
+        }
+#endif
+
+    }  // anonymous namespace
+
+    // The control block at the start of the shared memory. Each side's offset and sleep state are
+    // on their own cache line so that the producer and the consumer don't false-share.
+    struct SharedMemoryCommandRingHeader {
+        uint32_t magic;
+        uint32_t version;
+        uint64_t capacity;
+
+        // Written by the producer.
+        alignas(kCacheLineSize) std::atomic<uint64_t> writeOffset;
+        std::atomic<uint32_t> dataDoorbell;
+        std::atomic<uint32_t> producerWaiting;
+
+        // Written by the consumer.
+        alignas(kCacheLineSize) std::atomic<uint64_t> readOffset;
+        std::atomic<uint32_t> spaceDoorbell;
+        std::atomic<uint32_t> consumerWaiting;
+
+        alignas(kCacheLineSize) std::atomic<uint32_t> closed;
+    };
+    static_assert(sizeof(SharedMemoryCommandRingHeader) <= kHeaderSize, "");
+    static_assert(std::atomic<uint64_t>::is_always_lock_free,
+                  "Atomics in shared memory must be lock-free");
+    static_assert(std::atomic<uint32_t>::is_always_lock_free,
+                  "Atomics in shared memory must be lock-free");
+
+    // SharedMemoryCommandRing
+
+    // static
+    std::unique_ptr<SharedMemoryCommandRing> SharedMemoryCommandRing::Create(size_t capacity) {
+        if (capacity < kMinCapacity || !IsPowerOfTwo(capacity)) {
+            return nullptr;
+        }
+
+        std::unique_ptr<SharedMemoryRegion> memory =
+            SharedMemoryRegion::Create(kHeaderSize + capacity);
+        if (memory == nullptr) {
+            return nullptr;
+        }
+
+        SharedMemoryCommandRingHeader* header =
+            new (memory->GetData()) SharedMemoryCommandRingHeader();
+        header->magic = kRingMagic;
+        header->version = kRingVersion;
+        header->capacity = capacity;
+
+        return std::unique_ptr<SharedMemoryCommandRing>(
+            new SharedMemoryCommandRing(std::move(memory)));
+    }
+
+    // static
+    std::unique_ptr<SharedMemoryCommandRing> SharedMemoryCommandRing::Open(int fd) {
+        std::unique_ptr<SharedMemoryRegion> memory = SharedMemoryRegion::Open(fd);
+        if (memory == nullptr || memory->GetSize() < kHeaderSize + kMinCapacity ||
+            !IsPowerOfTwo(memory->GetSize() - kHeaderSize)) {
+            return nullptr;
+        }
+
+        const SharedMemoryCommandRingHeader* header =
+            static_cast<const SharedMemoryCommandRingHeader*>(memory->GetData());
+        if (header->magic != kRingMagic || header->version != kRingVersion ||
+            header->capacity != memory->GetSize() - kHeaderSize) {
+            return nullptr;
+        }
+
+        return std::unique_ptr<SharedMemoryCommandRing>(
+            new SharedMemoryCommandRing(std::move(memory)));
+    }
+
+    SharedMemoryCommandRing::SharedMemoryCommandRing(std::unique_ptr<SharedMemoryRegion> memory)
+        : mMemory(std::move(memory)),
+          mHeader(static_cast<SharedMemoryCommandRingHeader*>(mMemory->GetData())),
+          mData(static_cast<char*>(mMemory->GetData()) + kHeaderSize),
+          mCapacity(mMemory->GetSize() - kHeaderSize) {
+    }
+
+    SharedMemoryCommandRing::~SharedMemoryCommandRing() = default;
+
+    int SharedMemoryCommandRing::GetFileDescriptor() const {
+        return mMemory->GetFileDescriptor();
+    }
+
+    size_t SharedMemoryCommandRing::GetCapacity() const {
+        return mCapacity;
+    }
+
+    void SharedMemoryCommandRing::Close() {
+        mHeader->closed.store(1, std::memory_order_seq_cst);
+        mHeader->dataDoorbell.fetch_add(1, std::memory_order_release);
+        WakeByAddress(&mHeader->dataDoorbell);
+        mHeader->spaceDoorbell.fetch_add(1, std::memory_order_release);
+        WakeByAddress(&mHeader->spaceDoorbell);
+    }
+
+    bool SharedMemoryCommandRing::IsClosed() const {
+        return mHeader->closed.load(std::memory_order_acquire) != 0;
+    }
+
+    // SharedMemoryCommandSerializer
+
+    SharedMemoryCommandSerializer::SharedMemoryCommandSerializer(SharedMemoryCommandRing* ring,
+                                                                 uint64_t spaceTimeoutNs)
+        : mRing(ring), mSpaceTimeoutNs(spaceTimeoutNs) {
+    }
+
+    SharedMemoryCommandSerializer::~SharedMemoryCommandSerializer() = default;
+
+    size_t SharedMemoryCommandSerializer::GetMaximumAllocationSize() const {
+        // Any allocation of this size fits contiguously either at the current position or after
+        // wrapping to the start of the ring.
+        return mRing->GetCapacity() / 2 - kSegmentHeaderSize;
+    }
+
+    void* SharedMemoryCommandSerializer::GetCmdSpace(size_t size) {
+        if (size > GetMaximumAllocationSize()) {
+            return nullptr;
+        }
+
+        const uint64_t capacity = mRing->GetCapacity();
+        while (true) {
+            if (mRing->IsClosed()) {
+                return nullptr;
+            }
+
+            uint64_t position = mWriteOffset & (capacity - 1);
+            if (!mSegmentOpen) {
+                if (position + kSegmentHeaderSize + size > capacity) {
+                    // There is not enough contiguous space before the end of the ring: mark the
+                    // tail as unused and start the segment at the beginning of the ring. The
+                    // whole tail must have been consumed since it is skipped by the consumer.
+                    if (!WaitForSpace(mWriteOffset + (capacity - position))) {
+                        return nullptr;
+                    }
+                    *reinterpret_cast<uint64_t*>(mRing->mData + position) = kWrapMarker;
+                    mWriteOffset += capacity - position;
+                    continue;
+                }
+                mSegmentOpen = true;
+                mSegmentSize = 0;
+            }
+
+            uint64_t segmentSize = Align(mSegmentSize + size, kSegmentHeaderSize);
+            if (position + kSegmentHeaderSize + segmentSize > capacity) {
+                CloseSegment();
+                continue;
+            }
+            if (mWriteOffset + kSegmentHeaderSize + segmentSize > mCachedReadOffset + capacity) {
+                // Let the consumer see the commands written so far so that it can make room.
+                CloseSegment();
+                if (!WaitForSpace(mWriteOffset + kSegmentHeaderSize +
+                                  Align(size, kSegmentHeaderSize))) {
+                    return nullptr;
+                }
+                continue;
+            }
+
+            char* result = mRing->mData + position + kSegmentHeaderSize + mSegmentSize;
+            mSegmentSize += size;
+            return result;
+        }
+    }
+
+    bool SharedMemoryCommandSerializer::Flush() {
+        CloseSegment();
+        Publish();
+        return !mRing->IsClosed();
+    }
+
+    void SharedMemoryCommandSerializer::CloseSegment() {
+        if (mSegmentSize > 0) {
+            uint64_t position = mWriteOffset & (mRing->GetCapacity() - 1);
+            *reinterpret_cast<uint64_t*>(mRing->mData + position) = mSegmentSize;
+            mWriteOffset += kSegmentHeaderSize + Align(mSegmentSize, kSegmentHeaderSize);
+        }
+        mSegmentOpen = false;
+        mSegmentSize = 0;
+    }
+
+    void SharedMemoryCommandSerializer::Publish() {
+        SharedMemoryCommandRingHeader* header = mRing->mHeader;
+        // Sequentially consistent so that either the consumer sees the new offset before going to
+        // sleep, or we see that it is waiting and ring the doorbell.
+        header->writeOffset.store(mWriteOffset, std::memory_order_seq_cst);
+        if (header->consumerWaiting.load(std::memory_order_seq_cst) != 0) {
+            header->dataDoorbell.fetch_add(1, std::memory_order_release);
+            WakeByAddress(&header->dataDoorbell);
+        }
+    }
+
+    bool SharedMemoryCommandSerializer::WaitForSpace(uint64_t end) {
+        const uint64_t capacity = mRing->GetCapacity();
+        if (end <= mCachedReadOffset + capacity) {
+            return true;
+        }
+
+        SharedMemoryCommandRingHeader* header = mRing->mHeader;
+        Publish();
+        // The timeout restarts each time the consumer releases space, so a slow consumer that
+        // makes progress is waited for.
+        using Clock = std::chrono::steady_clock;
+        Clock::time_point lastProgress = Clock::now();
+        while (true) {
+            uint64_t readOffset = header->readOffset.load(std::memory_order_acquire);
+            if (readOffset < mCachedReadOffset || readOffset > mWriteOffset) {
+                // The consumer is misbehaving.
+                mRing->Close();
+                return false;
+            }
+            if (readOffset != mCachedReadOffset) {
+                mCachedReadOffset = readOffset;
+                lastProgress = Clock::now();
+            }
+            if (end <= mCachedReadOffset + capacity) {
+                return true;
+            }
+            if (mRing->IsClosed()) {
+                return false;
+            }
+
+            uint64_t waitedNs = static_cast<uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - lastProgress)
+                    .count());
+            if (waitedNs >= mSpaceTimeoutNs) {
+                // The consumer is gone or stuck. Close the ring so that it doesn't get used again.
+                mRing->Close();
+                return false;
+            }
+
+            uint32_t doorbell = header->spaceDoorbell.load(std::memory_order_acquire);
+            header->producerWaiting.store(1, std::memory_order_seq_cst);
+            if (header->readOffset.load(std::memory_order_seq_cst) == mCachedReadOffset) {
+                WaitOnAddress(&header->spaceDoorbell, doorbell,
+                              std::min(kWaitSliceNs, mSpaceTimeoutNs - waitedNs));
+            }
+            header->producerWaiting.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    // SharedMemoryCommandReceiver
+
+    SharedMemoryCommandReceiver::SharedMemoryCommandReceiver(SharedMemoryCommandRing* ring,
+                                                             dawn::wire::CommandHandler* handler)
+        : mRing(ring), mHandler(handler) {
+    }
+
+    bool SharedMemoryCommandReceiver::ProcessCommands(uint64_t waitTimeoutNs) {
+        SharedMemoryCommandRingHeader* header = mRing->mHeader;
+        const uint64_t capacity = mRing->GetCapacity();
+
+        // Check for closing first so that commands published right before closing are handled.
+        bool closed = mRing->IsClosed();
+        uint64_t writeOffset = header->writeOffset.load(std::memory_order_acquire);
+        if (writeOffset == mReadOffset && waitTimeoutNs != 0 && !closed) {
+            WaitForCommands(waitTimeoutNs);
+            closed = mRing->IsClosed();
+            writeOffset = header->writeOffset.load(std::memory_order_acquire);
+        }
+        if (writeOffset == mReadOffset) {
+            return !closed;
+        }
+
+        // The producer may be in another, untrusted, process: validate everything read from the
+        // shared memory before using it.
+        if (writeOffset < mReadOffset || writeOffset - mReadOffset > capacity) {
+            mRing->Close();
+            return false;
+        }
+
+        while (mReadOffset != writeOffset) {
+            uint64_t available = writeOffset - mReadOffset;
+            uint64_t position = mReadOffset & (capacity - 1);
+            if (available < kSegmentHeaderSize) {
+                mRing->Close();
+                return false;
+            }
+
+            uint64_t size = *reinterpret_cast<const volatile uint64_t*>(mRing->mData + position);
+            if (size == kWrapMarker) {
+                if (capacity - position > available) {
+                    mRing->Close();
+                    return false;
+                }
+                mReadOffset += capacity - position;
+                continue;
+            }
+
+            if (size > capacity - position - kSegmentHeaderSize ||
+                kSegmentHeaderSize + Align(size, kSegmentHeaderSize) > available) {
+                mRing->Close();
+                return false;
+            }
+            const volatile char* commands = mRing->mData + position + kSegmentHeaderSize;
+            if (mHandler->HandleCommands(commands, size) == nullptr) {
+                mRing->Close();
+                return false;
+            }
+
+            mReadOffset += kSegmentHeaderSize + Align(size, kSegmentHeaderSize);
+            // Give the space back right away so that a producer blocked on a full ring can make
+            // progress while the next segments are handled.
+            ReleaseSpace();
+        }
+        return true;
+    }
+
+    void SharedMemoryCommandReceiver::WaitForCommands(uint64_t waitTimeoutNs) {
+        SharedMemoryCommandRingHeader* header = mRing->mHeader;
+        uint32_t doorbell = header->dataDoorbell.load(std::memory_order_acquire);
+        header->consumerWaiting.store(1, std::memory_order_seq_cst);
+        if (header->writeOffset.load(std::memory_order_seq_cst) == mReadOffset &&
+            !mRing->IsClosed()) {
+            WaitOnAddress(&header->dataDoorbell, doorbell, waitTimeoutNs);
+        }
+        header->consumerWaiting.store(0, std::memory_order_relaxed);
+    }
+
+    void SharedMemoryCommandReceiver::ReleaseSpace() {
+        SharedMemoryCommandRingHeader* header = mRing->mHeader;
+        header->readOffset.store(mReadOffset, std::memory_order_seq_cst);
+        if (header->producerWaiting.load(std::memory_order_seq_cst) != 0) {
+            header->spaceDoorbell.fetch_add(1, std::memory_order_release);
+            WakeByAddress(&header->spaceDoorbell);
+        }
+    }
+
+}  // namespace utils
@@ -0,0 +1,133 @@
+// Copyright 2022 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef UTILS_SHARED_MEMORY_COMMAND_RING_H_
+#define UTILS_SHARED_MEMORY_COMMAND_RING_H_
+
+#include "dawn/utils/SharedMemory.h"
+#include "dawn/wire/Wire.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace utils {
+
+    struct SharedMemoryCommandRingHeader;
+
+    // A single-producer / single-consumer ring of wire commands that lives in shared memory so
+    // that the wire client and server can run on different threads or in different processes.
+    //
+    // The producer appends commands to an open segment and only publishes it (and rings the
+    // consumer's doorbell, if it is asleep) on Flush(), so a batch of commands costs a single
+    // release store and at most one wakeup. When the ring is full the producer publishes what it
+    // has and blocks until the consumer frees enough space. Commands larger than
+    // GetMaximumAllocationSize() are split by the wire's chunked serialization.
+    //
+    // On Linux sleeping uses futexes; other POSIX systems poll while waiting.
+    class SharedMemoryCommandRing {
+      public:
+        // Creates a new ring with room for |capacity| bytes of commands. |capacity| must be a
+        // power of two of at least 4096. Returns nullptr if the memory could not be allocated.
+        static std::unique_ptr<SharedMemoryCommandRing> Create(size_t capacity);
+
+        // Maps a ring created by another process. Takes ownership of |fd|. Returns nullptr if
+        // |fd| does not describe a valid ring.
+        static std::unique_ptr<SharedMemoryCommandRing> Open(int fd);
+
+        ~SharedMemoryCommandRing();
+
+        SharedMemoryCommandRing(const SharedMemoryCommandRing&) = delete;
+        SharedMemoryCommandRing& operator=(const SharedMemoryCommandRing&) = delete;
+
+        // The file descriptor backing the ring, to be passed to the peer process.
+        int GetFileDescriptor() const;
+        size_t GetCapacity() const;
+
+        // Marks the ring as closed and wakes up both sides. Pending commands can still be
+        // received, but the producer fails to serialize new ones.
+        void Close();
+        bool IsClosed() const;
+
+      private:
+        friend class SharedMemoryCommandSerializer;
+        friend class SharedMemoryCommandReceiver;
+
+        explicit SharedMemoryCommandRing(std::unique_ptr<SharedMemoryRegion> memory);
+
+        std::unique_ptr<SharedMemoryRegion> mMemory;
+        SharedMemoryCommandRingHeader* mHeader;
+        char* mData;
+        size_t mCapacity;
+    };
+
+    // The producer side of a SharedMemoryCommandRing.
+    class SharedMemoryCommandSerializer : public dawn::wire::CommandSerializer {
+      public:
+        static constexpr uint64_t kDefaultSpaceTimeoutNs = 10'000'000'000;
+
+        // When the ring is full, the serializer waits for the consumer to free space. If the
+        // consumer doesn't release any space for |spaceTimeoutNs|, for example because it died
+        // without closing the ring, the ring is closed and GetCmdSpace() returns nullptr.
+        explicit SharedMemoryCommandSerializer(SharedMemoryCommandRing* ring,
+                                               uint64_t spaceTimeoutNs = kDefaultSpaceTimeoutNs);
+        ~SharedMemoryCommandSerializer() override;
+
+        size_t GetMaximumAllocationSize() const override;
+
+        void* GetCmdSpace(size_t size) override;
+        bool Flush() override;
+
+      private:
+        void CloseSegment();
+        void Publish();
+        bool WaitForSpace(uint64_t end);
+
+        SharedMemoryCommandRing* mRing;
+        uint64_t mSpaceTimeoutNs;
+
+        // The logical (unwrapped) offset at which the next segment starts.
+        uint64_t mWriteOffset = 0;
+        // The size of the segment starting at mWriteOffset that is being written to.
+        size_t mSegmentSize = 0;
+        bool mSegmentOpen = false;
+        // The last value of the consumer's read offset that was observed.
+        uint64_t mCachedReadOffset = 0;
+    };
+
+    // The consumer side of a SharedMemoryCommandRing. Commands are handed to the handler directly
+    // from shared memory, which is why CommandHandler takes volatile pointers.
+    class SharedMemoryCommandReceiver {
+      public:
+        SharedMemoryCommandReceiver(SharedMemoryCommandRing* ring,
+                                    dawn::wire::CommandHandler* handler);
+
+        // Handles all the commands published so far. If |waitTimeoutNs| is non-zero and no commands
+        // are available, sleeps for at most that long waiting for the producer to flush some.
+        // Returns false if the handler failed, the ring is corrupted, or the ring is closed and
+        // empty. On failure the ring is closed.
+        bool ProcessCommands(uint64_t waitTimeoutNs = 0);
+
+      private:
+        void WaitForCommands(uint64_t waitTimeoutNs);
+        void ReleaseSpace();
+
+        SharedMemoryCommandRing* mRing;
+        dawn::wire::CommandHandler* mHandler;
+        uint64_t mReadOffset = 0;
+    };
+
+}  // namespace utils
+
+#endif  // UTILS_SHARED_MEMORY_COMMAND_RING_H_
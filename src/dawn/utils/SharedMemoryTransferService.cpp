@@ -0,0 +1,490 @@
+// Copyright 2022 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/utils/SharedMemoryTransferService.h"
+
+#include "dawn/common/Alloc.h"
+#include "dawn/common/Assert.h"
+#include "dawn/common/Math.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <iterator>
+#include <map>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace utils {
+
+    namespace {
+
+        constexpr size_t kAllocationAlignment = 64;
+
+        // Each allocation starts with a block in which the server records that it destroyed its
+        // handle, after which the client can reuse the memory.
+        struct AllocationHeader {
+            std::atomic<uint32_t> serverReleased;
+        };
+        constexpr size_t kAllocationHeaderSize = kAllocationAlignment;
+        static_assert(sizeof(AllocationHeader) <= kAllocationHeaderSize, "");
+        static_assert(std::atomic<uint32_t>::is_always_lock_free,
+                      "Atomics in shared memory must be lock-free");
+
+        // What the client serializes when creating a handle.
+        struct HandleDescriptor {
+            uint64_t allocationOffset;
+            uint64_t size;
+        };
+        constexpr uint64_t kInlineTransfer = ~uint64_t(0);
+
+        // Client
+
+        class ClientAllocator {
+          public:
+            explicit ClientAllocator(std::unique_ptr<SharedMemoryRegion> region)
+                : mRegion(std::move(region)) {
+                uint64_t size = mRegion->GetSize() & ~uint64_t(kAllocationAlignment - 1);
+                if (size > 0) {
+                    mFreeRanges[0] = size;
+                }
+            }
+
+            // Returns the offset of a zero-initialized allocation for |size| bytes of data, or
+            // kInlineTransfer if there is no room for it.
+            uint64_t Allocate(size_t size) {
+                if (size > mRegion->GetSize()) {
+                    return kInlineTransfer;
+                }
+                uint64_t allocationSize = kAllocationHeaderSize + Align(size, kAllocationAlignment);
+
+                if (!mPendingFrees.empty()) {
+                    ReclaimReleasedAllocations();
+                }
+                for (auto it = mFreeRanges.begin(); it != mFreeRanges.end(); ++it) {
+                    if (it->second < allocationSize) {
+                        continue;
+                    }
+                    uint64_t offset = it->first;
+                    uint64_t remaining = it->second - allocationSize;
+                    mFreeRanges.erase(it);
+                    if (remaining > 0) {
+                        mFreeRanges[offset + allocationSize] = remaining;
+                    }
+
+                    new (GetHeader(offset)) AllocationHeader();
+                    memset(GetData(offset), 0, size);
+                    return offset;
+                }
+                return kInlineTransfer;
+            }
+
+            // Memory that was announced to the server stays in use until the server destroyed its
+            // handle for it.
+            void Free(uint64_t offset, size_t size, bool sharedWithServer) {
+                uint64_t allocationSize = kAllocationHeaderSize + Align(size, kAllocationAlignment);
+                if (sharedWithServer) {
+                    mPendingFrees.emplace_back(offset, allocationSize);
+                } else {
+                    AddFreeRange(offset, allocationSize);
+                }
+            }
+
+            char* GetData(uint64_t offset) const {
+                return static_cast<char*>(mRegion->GetData()) + offset + kAllocationHeaderSize;
+            }
+
+          private:
+            AllocationHeader* GetHeader(uint64_t offset) const {
+                return reinterpret_cast<AllocationHeader*>(static_cast<char*>(mRegion->GetData()) +
+                                                           offset);
+            }
+
+            void ReclaimReleasedAllocations() {
+                auto released = [&](const std::pair<uint64_t, uint64_t>& allocation) {
+                    if (GetHeader(allocation.first)
+                            ->serverReleased.load(std::memory_order_acquire) == 0) {
+                        return false;
+                    }
+                    AddFreeRange(allocation.first, allocation.second);
+                    return true;
+                };
+                mPendingFrees.erase(
+                    std::remove_if(mPendingFrees.begin(), mPendingFrees.end(), released),
+                    mPendingFrees.end());
+            }
+
+            void AddFreeRange(uint64_t offset, uint64_t size) {
+                auto next = mFreeRanges.lower_bound(offset);
+                if (next != mFreeRanges.end() && offset + size == next->first) {
+                    size += next->second;
+                    next = mFreeRanges.erase(next);
+                }
+                if (next != mFreeRanges.begin()) {
+                    auto previous = std::prev(next);
+                    if (previous->first + previous->second == offset) {
+                        previous->second += size;
+                        return;
+                    }
+                }
+                mFreeRanges.emplace_hint(next, offset, size);
+            }
+
+            std::unique_ptr<SharedMemoryRegion> mRegion;
+            // Maps the offset of free ranges of the region to their size.
+            std::map<uint64_t, uint64_t> mFreeRanges;
+            // Allocations of destroyed handles that the server may still be using.
+            std::vector<std::pair<uint64_t, uint64_t>> mPendingFrees;
+        };
+
+        // The memory of a client handle: either an allocation in the region, or staging memory
+        // when the data is transferred inline.
+        class ClientHandleMemory {
+          public:
+            ClientHandleMemory(ClientAllocator* allocator, uint64_t allocation, size_t size)
+                : mAllocator(allocator), mAllocation(allocation), mSize(size) {
+            }
+
+            ClientHandleMemory(std::unique_ptr<uint8_t[]> stagingData, size_t size)
+                : mAllocation(kInlineTransfer), mStagingData(std::move(stagingData)), mSize(size) {
+            }
+
+            ~ClientHandleMemory() {
+                if (!IsInline()) {
+                    mAllocator->Free(mAllocation, mSize, mSerialized);
+                }
+            }
+
+            bool IsInline() const {
+                return mAllocation == kInlineTransfer;
+            }
+
+            void* GetData() const {
+                return IsInline() ? static_cast<void*>(mStagingData.get())
+                                  : mAllocator->GetData(mAllocation);
+            }
+
+            bool IsInBounds(size_t offset, size_t size) const {
+                return offset <= mSize && size <= mSize - offset;
+            }
+
+            void SerializeCreate(void* serializePointer) {
+                HandleDescriptor descriptor = {mAllocation, mSize};
+                memcpy(serializePointer, &descriptor, sizeof(descriptor));
+                mSerialized = true;
+            }
+
+          private:
+            ClientAllocator* mAllocator = nullptr;
+            uint64_t mAllocation;
+            std::unique_ptr<uint8_t[]> mStagingData;
+            size_t mSize;
+            bool mSerialized = false;
+        };
+
+        class ClientReadHandle : public dawn::wire::client::MemoryTransferService::ReadHandle {
+          public:
+            explicit ClientReadHandle(std::unique_ptr<ClientHandleMemory> memory)
+                : mMemory(std::move(memory)) {
+            }
+
+            size_t SerializeCreateSize() override {
+                return sizeof(HandleDescriptor);
+            }
+
+            void SerializeCreate(void* serializePointer) override {
+                mMemory->SerializeCreate(serializePointer);
+            }
+
+            const void* GetData() override {
+                return mMemory->GetData();
+            }
+
+            bool DeserializeDataUpdate(const void* deserializePointer,
+                                       size_t deserializeSize,
+                                       size_t offset,
+                                       size_t size) override {
+                if (!mMemory->IsInBounds(offset, size)) {
+                    return false;
+                }
+                if (!mMemory->IsInline()) {
+                    // The server already wrote the data in the shared memory.
+                    return deserializeSize == 0;
+                }
+
+                if (deserializeSize != size || deserializePointer == nullptr) {
+                    return false;
+                }
+                memcpy(static_cast<uint8_t*>(mMemory->GetData()) + offset, deserializePointer,
+                       size);
+                return true;
+            }
+
+          private:
+            std::unique_ptr<ClientHandleMemory> mMemory;
+        };
+
+        class ClientWriteHandle : public dawn::wire::client::MemoryTransferService::WriteHandle {
+          public:
+            explicit ClientWriteHandle(std::unique_ptr<ClientHandleMemory> memory)
+                : mMemory(std::move(memory)) {
+            }
+
+            size_t SerializeCreateSize() override {
+                return sizeof(HandleDescriptor);
+            }
+
+            void SerializeCreate(void* serializePointer) override {
+                mMemory->SerializeCreate(serializePointer);
+            }
+
+            void* GetData() override {
+                return mMemory->GetData();
+            }
+
+            size_t SizeOfSerializeDataUpdate(size_t offset, size_t size) override {
+                ASSERT(mMemory->IsInBounds(offset, size));
+                return mMemory->IsInline() ? size : 0;
+            }
+
+            void SerializeDataUpdate(void* serializePointer, size_t offset, size_t size) override {
+                ASSERT(mMemory->IsInBounds(offset, size));
+                if (mMemory->IsInline()) {
+                    memcpy(serializePointer, static_cast<uint8_t*>(mMemory->GetData()) + offset,
+                           size);
+                }
+            }
+
+          private:
+            std::unique_ptr<ClientHandleMemory> mMemory;
+        };
+
+        class ClientTransferService : public dawn::wire::client::MemoryTransferService {
+          public:
+            explicit ClientTransferService(std::unique_ptr<SharedMemoryRegion> region)
+                : mAllocator(std::move(region)) {
+            }
+
+            ReadHandle* CreateReadHandle(size_t size) override {
+                std::unique_ptr<ClientHandleMemory> memory = CreateMemory(size);
+                return memory != nullptr ? new ClientReadHandle(std::move(memory)) : nullptr;
+            }
+
+            WriteHandle* CreateWriteHandle(size_t size) override {
+                std::unique_ptr<ClientHandleMemory> memory = CreateMemory(size);
+                return memory != nullptr ? new ClientWriteHandle(std::move(memory)) : nullptr;
+            }
+
+          private:
+            std::unique_ptr<ClientHandleMemory> CreateMemory(size_t size) {
+                uint64_t allocation = mAllocator.Allocate(size);
+                if (allocation != kInlineTransfer) {
+                    return std::make_unique<ClientHandleMemory>(&mAllocator, allocation, size);
+                }
+
+                auto stagingData = std::unique_ptr<uint8_t[]>(AllocNoThrow<uint8_t>(size));
+                if (stagingData == nullptr) {
+                    return nullptr;
+                }
+                memset(stagingData.get(), 0, size);
+                return std::make_unique<ClientHandleMemory>(std::move(stagingData), size);
+            }
+
+            ClientAllocator mAllocator;
+        };
+
+        // Server
+
+        // The shared memory of a server handle, or nothing when the data is transferred inline.
+        class ServerHandleMemory {
+          public:
+            ServerHandleMemory() = default;
+            ServerHandleMemory(AllocationHeader* header, uint8_t* data, size_t size)
+                : mHeader(header), mData(data), mSize(size) {
+            }
+
+            ~ServerHandleMemory() {
+                if (mHeader != nullptr) {
+                    mHeader->serverReleased.store(1, std::memory_order_release);
+                }
+            }
+
+            bool IsInline() const {
+                return mHeader == nullptr;
+            }
+
+            uint8_t* GetData(size_t offset, size_t size) const {
+                if (offset > mSize || size > mSize - offset) {
+                    return nullptr;
+                }
+                return mData + offset;
+            }
+
+          private:
+            AllocationHeader* mHeader = nullptr;
+            uint8_t* mData = nullptr;
+            size_t mSize = 0;
+        };
+
+        class ServerReadHandle : public dawn::wire::server::MemoryTransferService::ReadHandle {
+          public:
+            explicit ServerReadHandle(std::unique_ptr<ServerHandleMemory> memory)
+                : mMemory(std::move(memory)) {
+            }
+
+            size_t SizeOfSerializeDataUpdate(size_t offset, size_t size) override {
+                return mMemory->IsInline() ? size : 0;
+            }
+
+            void SerializeDataUpdate(const void* data,
+                                     size_t offset,
+                                     size_t size,
+                                     void* serializePointer) override {
+                if (size == 0) {
+                    return;
+                }
+                ASSERT(data != nullptr);
+                if (mMemory->IsInline()) {
+                    ASSERT(serializePointer != nullptr);
+                    memcpy(serializePointer, data, size);
+                    return;
+                }
+
+                // The client chose the size of the shared memory: if it is too small, don't
+                // write out of bounds and let the client see garbage instead.
+                uint8_t* target = mMemory->GetData(offset, size);
+                if (target != nullptr) {
+                    memcpy(target, data, size);
+                }
+            }
+
+          private:
+            std::unique_ptr<ServerHandleMemory> mMemory;
+        };
+
+        class ServerWriteHandle : public dawn::wire::server::MemoryTransferService::WriteHandle {
+          public:
+            explicit ServerWriteHandle(std::unique_ptr<ServerHandleMemory> memory)
+                : mMemory(std::move(memory)) {
+            }
+
+            bool DeserializeDataUpdate(const void* deserializePointer,
+                                       size_t deserializeSize,
+                                       size_t offset,
+                                       size_t size) override {
+                if (mTargetData == nullptr) {
+                    return false;
+                }
+                if ((offset >= mDataLength && offset > 0) || size > mDataLength - offset) {
+                    return false;
+                }
+
+                const void* source = deserializePointer;
+                if (mMemory->IsInline()) {
+                    if (deserializeSize != size || deserializePointer == nullptr) {
+                        return false;
+                    }
+                } else {
+                    source = mMemory->GetData(offset, size);
+                    if (deserializeSize != 0 || source == nullptr) {
+                        return false;
+                    }
+                }
+                memcpy(static_cast<uint8_t*>(mTargetData) + offset, source, size);
+                return true;
+            }
+
+          private:
+            std::unique_ptr<ServerHandleMemory> mMemory;
+        };
+
+        class ServerTransferService : public dawn::wire::server::MemoryTransferService {
+          public:
+            explicit ServerTransferService(std::unique_ptr<SharedMemoryRegion> region)
+                : mRegion(std::move(region)) {
+            }
+
+            bool DeserializeReadHandle(const void* deserializePointer,
+                                       size_t deserializeSize,
+                                       ReadHandle** readHandle) override {
+                ASSERT(readHandle != nullptr);
+                std::unique_ptr<ServerHandleMemory> memory =
+                    DeserializeMemory(deserializePointer, deserializeSize);
+                if (memory == nullptr) {
+                    return false;
+                }
+                *readHandle = new ServerReadHandle(std::move(memory));
+                return true;
+            }
+
+            bool DeserializeWriteHandle(const void* deserializePointer,
+                                        size_t deserializeSize,
+                                        WriteHandle** writeHandle) override {
+                ASSERT(writeHandle != nullptr);
+                std::unique_ptr<ServerHandleMemory> memory =
+                    DeserializeMemory(deserializePointer, deserializeSize);
+                if (memory == nullptr) {
+                    return false;
+                }
+                *writeHandle = new ServerWriteHandle(std::move(memory));
+                return true;
+            }
+
+          private:
+            std::unique_ptr<ServerHandleMemory> DeserializeMemory(const void* deserializePointer,
+                                                                  size_t deserializeSize) {
+                HandleDescriptor descriptor;
+                if (deserializePointer == nullptr || deserializeSize != sizeof(descriptor)) {
+                    return nullptr;
+                }
+                memcpy(&descriptor, deserializePointer, sizeof(descriptor));
+                if (descriptor.allocationOffset == kInlineTransfer) {
+                    return std::make_unique<ServerHandleMemory>();
+                }
+
+                // The descriptor comes from the client: make sure it describes memory inside the
+                // region.
+                uint64_t regionSize = mRegion->GetSize();
+                if (descriptor.allocationOffset % kAllocationAlignment != 0 ||
+                    descriptor.allocationOffset > regionSize ||
+                    kAllocationHeaderSize > regionSize - descriptor.allocationOffset ||
+                    descriptor.size >
+                        regionSize - descriptor.allocationOffset - kAllocationHeaderSize) {
+                    return nullptr;
+                }
+
+                uint8_t* allocation =
+                    static_cast<uint8_t*>(mRegion->GetData()) + descriptor.allocationOffset;
+                return std::make_unique<ServerHandleMemory>(
+                    reinterpret_cast<AllocationHeader*>(allocation),
+                    allocation + kAllocationHeaderSize, static_cast<size_t>(descriptor.size));
+            }
+
+            std::unique_ptr<SharedMemoryRegion> mRegion;
+        };
+
+    }  // anonymous namespace
+
+    std::unique_ptr<dawn::wire::client::MemoryTransferService>
+    CreateSharedMemoryClientTransferService(std::unique_ptr<SharedMemoryRegion> region) {
+        return std::make_unique<ClientTransferService>(std::move(region));
+    }
+
+    std::unique_ptr<dawn::wire::server::MemoryTransferService>
+    CreateSharedMemoryServerTransferService(std::unique_ptr<SharedMemoryRegion> region) {
+        return std::make_unique<ServerTransferService>(std::move(region));
+    }
+
+}  // namespace utils
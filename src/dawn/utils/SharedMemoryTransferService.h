@@ -0,0 +1,43 @@
+// Copyright 2022 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef UTILS_SHARED_MEMORY_TRANSFER_SERVICE_H_
+#define UTILS_SHARED_MEMORY_TRANSFER_SERVICE_H_
+
+#include "dawn/utils/SharedMemory.h"
+#include "dawn/wire/WireClient.h"
+#include "dawn/wire/WireServer.h"
+
+#include <memory>
+
+namespace utils {
+
+    // Memory transfer services that keep the mapped data of buffers in a SharedMemoryRegion mapped
+    // by both the wire client and the wire server, instead of copying it inside the command
+    // stream. Handles only serialize the location of their memory, and data written there is made
+    // visible to the other side by the command that follows it (the map callback or the unmap).
+    //
+    // The client service sub-allocates the region for its handles and only reuses memory once the
+    // server has destroyed the matching handle, which the server records in the region. Handles
+    // that don't fit in the region fall back to transferring their data inline.
+    std::unique_ptr<dawn::wire::client::MemoryTransferService>
+    CreateSharedMemoryClientTransferService(std::unique_ptr<SharedMemoryRegion> region);
+
+    // |region| must map the same memory as the one of the client service.
+    std::unique_ptr<dawn::wire::server::MemoryTransferService>
+    CreateSharedMemoryServerTransferService(std::unique_ptr<SharedMemoryRegion> region);
+
+}  // namespace utils
+
+#endif  // UTILS_SHARED_MEMORY_TRANSFER_SERVICE_H_
@@ -39,14 +39,18 @@ namespace dawn::wire {
         // Returns |true| if the commands were entirely consumed into the chunked command vector
         // and should be handled later once we receive all the command data.
         // Returns |false| if commands should be handled now immediately.
-        ChunkedCommandsResult HandleChunkedCommands(const volatile char* commands, size_t size) {
+        // |prefixSize| is the number of bytes preceding the CmdHeader that are part of the command,
+        // like the tag of the compact command encoding.
+        ChunkedCommandsResult HandleChunkedCommands(const volatile char* commands,
+                                                    size_t size,
+                                                    size_t prefixSize = 0) {
             uint64_t commandSize64 =
-                reinterpret_cast<const volatile CmdHeader*>(commands)->commandSize;
+                reinterpret_cast<const volatile CmdHeader*>(commands + prefixSize)->commandSize;
 
-            if (commandSize64 > std::numeric_limits<size_t>::max()) {
+            if (commandSize64 > std::numeric_limits<size_t>::max() - prefixSize) {
                 return ChunkedCommandsResult::Error;
             }
-            size_t commandSize = static_cast<size_t>(commandSize64);
+            size_t commandSize = static_cast<size_t>(commandSize64) + prefixSize;
             if (size < commandSize) {
                 return BeginChunkedCommandData(commands, commandSize, size);
             }
@@ -16,8 +16,18 @@
 
 namespace dawn::wire {
 
-    ChunkedCommandSerializer::ChunkedCommandSerializer(CommandSerializer* serializer)
-        : mSerializer(serializer), mMaxAllocationSize(serializer->GetMaximumAllocationSize()) {
+    ChunkedCommandSerializer::ChunkedCommandSerializer(CommandSerializer* serializer,
+                                                       bool useCompactCommands)
+        : mSerializer(serializer),
+          mMaxAllocationSize(serializer->GetMaximumAllocationSize()),
+          mUseCompactCommands(useCompactCommands) {
+        // Let the server check that it uses the compact command encoding too.
+        if (mUseCompactCommands) {
+            CompactCommandsMarkerCmd markerCmd = {};
+            markerCmd.header.commandSize = sizeof(markerCmd);
+            markerCmd.marker = kCompactCommandsMarker;
+            SerializeChunkedCommand(reinterpret_cast<const char*>(&markerCmd), sizeof(markerCmd));
+        }
     }
 
     void ChunkedCommandSerializer::SerializeChunkedCommand(const char* allocatedBuffer,
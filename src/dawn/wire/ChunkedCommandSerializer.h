@@ -28,7 +28,9 @@ namespace dawn::wire {
 
     class ChunkedCommandSerializer {
       public:
-        ChunkedCommandSerializer(CommandSerializer* serializer);
+        // When |useCompactCommands| is true, the stream starts with kCompactCommandsMarker and
+        // commands are serialized with the compact command encoding, see kRegularCommandTag.
+        ChunkedCommandSerializer(CommandSerializer* serializer, bool useCompactCommands = false);
 
         template <typename Cmd>
         void SerializeCommand(const Cmd& cmd) {
@@ -49,6 +51,11 @@ namespace dawn::wire {
 
         template <typename Cmd>
         void SerializeCommand(const Cmd& cmd, const ObjectIdProvider& objectIdProvider) {
+            if constexpr (Cmd::kCompactTag != kRegularCommandTag) {
+                if (mUseCompactCommands && SerializeCompactCommand(cmd, objectIdProvider)) {
+                    return;
+                }
+            }
             SerializeCommand(cmd, objectIdProvider, 0,
                              [](SerializeBuffer*) { return WireResult::Success; });
         }
@@ -68,6 +75,33 @@ namespace dawn::wire {
         }
 
       private:
+        // Serializes |cmd| with its compact encoding. Returns false if the compact encoding
+        // couldn't be used, in which case the regular encoding must be used instead.
+        template <typename Cmd>
+        bool SerializeCompactCommand(const Cmd& cmd, const ObjectIdProvider& objectIdProvider) {
+            char compactCommand[kMaxCompactCommandSize];
+            compactCommand[0] = static_cast<char>(Cmd::kCompactTag);
+
+            // Only commit the updated ID state once the command is actually serialized.
+            CompactCommandState state = mCompactCommandState;
+            size_t size = 0;
+            if (cmd.SerializeCompact(compactCommand + 1, sizeof(compactCommand) - 1, &size,
+                                     objectIdProvider, &state) != WireResult::Success) {
+                return false;
+            }
+            size += 1;
+            if (size > mMaxAllocationSize) {
+                return false;
+            }
+
+            char* allocatedBuffer = static_cast<char*>(mSerializer->GetCmdSpace(size));
+            if (allocatedBuffer != nullptr) {
+                memcpy(allocatedBuffer, compactCommand, size);
+                mCompactCommandState = state;
+            }
+            return true;
+        }
+
         template <typename Cmd, typename SerializeCmdFn, typename ExtraSizeSerializeFn>
         void SerializeCommandImpl(const Cmd& cmd,
                                   SerializeCmdFn&& SerializeCmd,
@@ -75,11 +109,17 @@ namespace dawn::wire {
                                   ExtraSizeSerializeFn&& SerializeExtraSize) {
             size_t commandSize = cmd.GetRequiredSize();
             size_t requiredSize = commandSize + extraSize;
+            // With the compact command encoding, regular commands are prefixed with their tag.
+            size_t tagSize = mUseCompactCommands ? sizeof(uint8_t) : 0;
 
-            if (requiredSize <= mMaxAllocationSize) {
-                char* allocatedBuffer = static_cast<char*>(mSerializer->GetCmdSpace(requiredSize));
+            if (tagSize + requiredSize <= mMaxAllocationSize) {
+                char* allocatedBuffer =
+                    static_cast<char*>(mSerializer->GetCmdSpace(tagSize + requiredSize));
                 if (allocatedBuffer != nullptr) {
-                    SerializeBuffer serializeBuffer(allocatedBuffer, requiredSize);
+                    if (tagSize != 0) {
+                        allocatedBuffer[0] = static_cast<char>(kRegularCommandTag);
+                    }
+                    SerializeBuffer serializeBuffer(allocatedBuffer + tagSize, requiredSize);
                     WireResult r1 = SerializeCmd(cmd, requiredSize, &serializeBuffer);
                     WireResult r2 = SerializeExtraSize(&serializeBuffer);
                     if (DAWN_UNLIKELY(r1 != WireResult::Success || r2 != WireResult::Success)) {
@@ -89,24 +129,29 @@ namespace dawn::wire {
                 return;
             }
 
-            auto cmdSpace = std::unique_ptr<char[]>(AllocNoThrow<char>(requiredSize));
+            auto cmdSpace = std::unique_ptr<char[]>(AllocNoThrow<char>(tagSize + requiredSize));
             if (!cmdSpace) {
                 return;
             }
-            SerializeBuffer serializeBuffer(cmdSpace.get(), requiredSize);
+            if (tagSize != 0) {
+                cmdSpace[0] = static_cast<char>(kRegularCommandTag);
+            }
+            SerializeBuffer serializeBuffer(cmdSpace.get() + tagSize, requiredSize);
             WireResult r1 = SerializeCmd(cmd, requiredSize, &serializeBuffer);
             WireResult r2 = SerializeExtraSize(&serializeBuffer);
             if (DAWN_UNLIKELY(r1 != WireResult::Success || r2 != WireResult::Success)) {
                 mSerializer->OnSerializeError();
                 return;
             }
-            SerializeChunkedCommand(cmdSpace.get(), requiredSize);
+            SerializeChunkedCommand(cmdSpace.get(), tagSize + requiredSize);
         }
 
         void SerializeChunkedCommand(const char* allocatedBuffer, size_t remainingSize);
 
         CommandSerializer* mSerializer;
         size_t mMaxAllocationSize;
+        bool mUseCompactCommands;
+        CompactCommandState mCompactCommandState;
     };
 
 }  // namespace dawn::wire
@@ -18,7 +18,10 @@
 namespace dawn::wire {
 
     WireClient::WireClient(const WireClientDescriptor& descriptor)
-        : mImpl(new client::Client(descriptor.serializer, descriptor.memoryTransferService)) {
+        : mImpl(new client::Client(descriptor.serializer,
+                                   descriptor.memoryTransferService,
+                                   descriptor.useCompactCommands,
+                                   descriptor.elideRedundantStateCommands)) {
     }
 
     WireClient::~WireClient() {
@@ -61,6 +64,10 @@ namespace dawn::wire {
         mImpl->ReclaimInstanceReservation(reservation);
     }
 
+    bool WireClient::MarkMappedRangeWritten(WGPUBuffer buffer, size_t offset, size_t size) {
+        return mImpl->MarkMappedRangeWritten(buffer, offset, size);
+    }
+
     void WireClient::Disconnect() {
         mImpl->Disconnect();
     }
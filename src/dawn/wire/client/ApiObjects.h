@@ -22,6 +22,7 @@
 #include "dawn/wire/client/Device.h"
 #include "dawn/wire/client/Instance.h"
 #include "dawn/wire/client/Queue.h"
+#include "dawn/wire/client/RenderPassEncoder.h"
 #include "dawn/wire/client/ShaderModule.h"
 
 #include "dawn/wire/client/ApiObjects_autogen.h"
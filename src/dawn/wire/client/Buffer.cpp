@@ -19,6 +19,8 @@
 #include "dawn/wire/client/Client.h"
 #include "dawn/wire/client/Device.h"
 
+#include <algorithm>
+
 namespace dawn::wire::client {
 
     // static
@@ -294,29 +296,17 @@ namespace dawn::wire::client {
             mWriteHandle != nullptr) {
             // Writes need to be flushed before Unmap is sent. Unmap calls all associated
             // in-flight callbacks which may read the updated data.
-
-            // Get the serialization size of data update writes.
-            size_t writeDataUpdateInfoLength =
-                mWriteHandle->SizeOfSerializeDataUpdate(mMapOffset, mMapSize);
-
-            BufferUpdateMappedDataCmd cmd;
-            cmd.bufferId = id;
-            cmd.writeDataUpdateInfoLength = writeDataUpdateInfoLength;
-            cmd.writeDataUpdateInfo = nullptr;
-            cmd.offset = mMapOffset;
-            cmd.size = mMapSize;
-
-            client->SerializeCommand(
-                cmd, writeDataUpdateInfoLength, [&](SerializeBuffer* serializeBuffer) {
-                    char* writeHandleBuffer;
-                    WIRE_TRY(serializeBuffer->NextN(writeDataUpdateInfoLength, &writeHandleBuffer));
-
-                    // Serialize flush metadata into the space after the command.
-                    // This closes the handle for writing.
-                    mWriteHandle->SerializeDataUpdate(writeHandleBuffer, cmd.offset, cmd.size);
-
-                    return WireResult::Success;
-                });
+            if (mWrittenRanges.empty()) {
+                SerializeMappedDataUpdate(mMapOffset, mMapSize);
+            } else {
+                // Only the ranges declared as written are sent. The rest of the server's buffer
+                // keeps the contents it had when it was mapped.
+                for (const auto& [begin, end] : mWrittenRanges) {
+                    if (end > begin) {
+                        SerializeMappedDataUpdate(begin, end - begin);
+                    }
+                }
+            }
 
             // If mDestructWriteHandleOnUnmap is true, that means the write handle is merely
             // for mappedAtCreation usage. It is destroyed on unmap after flush to server
@@ -336,6 +326,7 @@ namespace dawn::wire::client {
         mMapState = MapState::Unmapped;
         mMapOffset = 0;
         mMapSize = 0;
+        mWrittenRanges.clear();
 
         // Tag all mapping requests still in flight as unmapped before callback.
         mRequests.ForAll([](MapRequestData* request) {
@@ -349,6 +340,32 @@ namespace dawn::wire::client {
         client->SerializeCommand(cmd);
     }
 
+    bool Buffer::MarkMappedRangeWritten(size_t offset, size_t size) {
+        if (!IsMappedForWriting() || offset < mMapOffset || size > mMapSize ||
+            offset - mMapOffset > mMapSize - size) {
+            return false;
+        }
+
+        // Merge the new range with the ranges it overlaps or touches so that each byte is sent
+        // at most once, and repeated declarations of the same range don't grow the map.
+        size_t end = offset + size;
+        auto it = mWrittenRanges.upper_bound(offset);
+        if (it != mWrittenRanges.begin()) {
+            auto previous = std::prev(it);
+            if (previous->second >= offset) {
+                offset = previous->first;
+                end = std::max(end, previous->second);
+                mWrittenRanges.erase(previous);
+            }
+        }
+        while (it != mWrittenRanges.end() && it->first <= end) {
+            end = std::max(end, it->second);
+            it = mWrittenRanges.erase(it);
+        }
+        mWrittenRanges.emplace(offset, end);
+        return true;
+    }
+
     void Buffer::Destroy() {
         // Remove the current mapping and destroy Read/WriteHandles.
         FreeMappedData();
@@ -386,6 +403,29 @@ namespace dawn::wire::client {
         return offsetInMappedRange <= mMapSize - size;
     }
 
+    void Buffer::SerializeMappedDataUpdate(size_t offset, size_t size) {
+        // Get the serialization size of data update writes.
+        size_t writeDataUpdateInfoLength = mWriteHandle->SizeOfSerializeDataUpdate(offset, size);
+
+        BufferUpdateMappedDataCmd cmd;
+        cmd.bufferId = id;
+        cmd.writeDataUpdateInfoLength = writeDataUpdateInfoLength;
+        cmd.writeDataUpdateInfo = nullptr;
+        cmd.offset = offset;
+        cmd.size = size;
+
+        client->SerializeCommand(
+            cmd, writeDataUpdateInfoLength, [&](SerializeBuffer* serializeBuffer) {
+                char* writeHandleBuffer;
+                WIRE_TRY(serializeBuffer->NextN(writeDataUpdateInfoLength, &writeHandleBuffer));
+
+                // Serialize flush metadata into the space after the command.
+                mWriteHandle->SerializeDataUpdate(writeHandleBuffer, cmd.offset, cmd.size);
+
+                return WireResult::Success;
+            });
+    }
+
     void Buffer::FreeMappedData() {
 #if defined(DAWN_ENABLE_ASSERTS)
         // When in "debug" mode, 0xCA-out the mapped data when we free it so that in we can detect
@@ -398,6 +438,7 @@ namespace dawn::wire::client {
 
         mMapOffset = 0;
         mMapSize = 0;
+        mWrittenRanges.clear();
         mReadHandle = nullptr;
         mWriteHandle = nullptr;
         mMappedData = nullptr;
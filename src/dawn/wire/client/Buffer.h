@@ -21,6 +21,8 @@
 #include "dawn/wire/client/ObjectBase.h"
 #include "dawn/wire/client/RequestTracker.h"
 
+#include <map>
+
 namespace dawn::wire::client {
 
     class Device;
@@ -45,6 +47,7 @@ namespace dawn::wire::client {
                       void* userdata);
         void* GetMappedRange(size_t offset, size_t size);
         const void* GetConstMappedRange(size_t offset, size_t size);
+        bool MarkMappedRangeWritten(size_t offset, size_t size);
         void Unmap();
 
         void Destroy();
@@ -57,6 +60,7 @@ namespace dawn::wire::client {
         bool IsMappedForWriting() const;
         bool CheckGetMappedRangeOffsetSize(size_t offset, size_t size) const;
 
+        void SerializeMappedDataUpdate(size_t offset, size_t size);
         void FreeMappedData();
 
         Device* mDevice;
@@ -101,6 +105,11 @@ namespace dawn::wire::client {
         size_t mMapOffset = 0;
         size_t mMapSize = 0;
 
+        // The ranges of the current write mapping declared with MarkMappedRangeWritten, as a map
+        // from the start of each range to its end. Ranges that overlap or touch are merged. Unmap
+        // sends the whole mapped range when it is empty.
+        std::map<size_t, size_t> mWrittenRanges;
+
         std::weak_ptr<bool> mDeviceIsAlive;
     };
 
@@ -43,8 +43,14 @@ namespace dawn::wire::client {
 
     }  // anonymous namespace
 
-    Client::Client(CommandSerializer* serializer, MemoryTransferService* memoryTransferService)
-        : ClientBase(), mSerializer(serializer), mMemoryTransferService(memoryTransferService) {
+    Client::Client(CommandSerializer* serializer,
+                   MemoryTransferService* memoryTransferService,
+                   bool useCompactCommands,
+                   bool elideRedundantStateCommands)
+        : ClientBase(),
+          mSerializer(serializer, useCompactCommands),
+          mMemoryTransferService(memoryTransferService),
+          mElideRedundantStateCommands(elideRedundantStateCommands) {
         if (mMemoryTransferService == nullptr) {
             // If a MemoryTransferService is not provided, fall back to inline memory.
             mOwnedMemoryTransferService = CreateInlineMemoryTransferService();
@@ -144,6 +150,10 @@ namespace dawn::wire::client {
         InstanceAllocator().Free(FromAPI(reservation.instance));
     }
 
+    bool Client::MarkMappedRangeWritten(WGPUBuffer buffer, size_t offset, size_t size) {
+        return FromAPI(buffer)->MarkMappedRangeWritten(offset, size);
+    }
+
     void Client::Disconnect() {
         mDisconnected = true;
         mSerializer = ChunkedCommandSerializer(NoopCommandSerializer::GetInstance());
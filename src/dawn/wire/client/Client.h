@@ -33,7 +33,10 @@ namespace dawn::wire::client {
 
     class Client : public ClientBase {
       public:
-        Client(CommandSerializer* serializer, MemoryTransferService* memoryTransferService);
+        Client(CommandSerializer* serializer,
+               MemoryTransferService* memoryTransferService,
+               bool useCompactCommands,
+               bool elideRedundantStateCommands);
         ~Client() override;
 
         // ChunkedCommandHandler implementation
@@ -54,6 +57,12 @@ namespace dawn::wire::client {
         void ReclaimDeviceReservation(const ReservedDevice& reservation);
         void ReclaimInstanceReservation(const ReservedInstance& reservation);
 
+        bool ElidesRedundantStateCommands() const {
+            return mElideRedundantStateCommands;
+        }
+
+        bool MarkMappedRangeWritten(WGPUBuffer buffer, size_t offset, size_t size);
+
         template <typename Cmd>
         void SerializeCommand(const Cmd& cmd) {
             mSerializer.SerializeCommand(cmd, *this);
@@ -86,6 +95,7 @@ namespace dawn::wire::client {
 
         PerObjectType<LinkedList<ObjectBase>> mObjects;
         bool mDisconnected = false;
+        bool mElideRedundantStateCommands = false;
     };
 
     std::unique_ptr<MemoryTransferService> CreateInlineMemoryTransferService();
@@ -0,0 +1,159 @@
+// Copyright 2022 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn/wire/client/RenderPassEncoder.h"
+
+#include "dawn/wire/client/Client.h"
+
+#include <algorithm>
+
+namespace dawn::wire::client {
+
+    bool RenderPassEncoder::TrackSetPipeline(WGPURenderPipeline pipeline) {
+        if (mEnded) {
+            return true;
+        }
+
+        TrackedObject tracked = GetTrackedObject(pipeline);
+        if (tracked.id != 0 && tracked == mPipeline) {
+            return false;
+        }
+        mPipeline = tracked;
+        return true;
+    }
+
+    bool RenderPassEncoder::TrackSetBindGroup(uint32_t groupIndex,
+                                              WGPUBindGroup group,
+                                              uint32_t dynamicOffsetCount,
+                                              const uint32_t* dynamicOffsets) {
+        if (mEnded || groupIndex >= kMaxBindGroups) {
+            return true;
+        }
+
+        BindGroupState& state = mBindGroups[groupIndex];
+        TrackedObject tracked = GetTrackedObject(group);
+        if (tracked.id == 0 || dynamicOffsetCount > state.dynamicOffsets.size()) {
+            // The command is an error or sets state we don't track. Forget what the slot contains
+            // so that the next command for it is always sent.
+            state = {};
+            return true;
+        }
+
+        if (tracked == state.group && dynamicOffsetCount == state.dynamicOffsetCount &&
+            std::equal(dynamicOffsets, dynamicOffsets + dynamicOffsetCount,
+                       state.dynamicOffsets.begin())) {
+            return false;
+        }
+
+        state.group = tracked;
+        state.dynamicOffsetCount = dynamicOffsetCount;
+        std::copy(dynamicOffsets, dynamicOffsets + dynamicOffsetCount,
+                  state.dynamicOffsets.begin());
+        return true;
+    }
+
+    bool RenderPassEncoder::TrackSetVertexBuffer(uint32_t slot,
+                                                 WGPUBuffer buffer,
+                                                 uint64_t offset,
+                                                 uint64_t size) {
+        if (mEnded || slot >= kMaxVertexBuffers) {
+            return true;
+        }
+
+        BufferBindingState& state = mVertexBuffers[slot];
+        TrackedObject tracked = GetTrackedObject(buffer);
+        if (tracked.id != 0 && tracked == state.buffer && offset == state.offset &&
+            size == state.size) {
+            return false;
+        }
+
+        state.buffer = tracked;
+        state.offset = offset;
+        state.size = size;
+        return true;
+    }
+
+    bool RenderPassEncoder::TrackSetIndexBuffer(WGPUBuffer buffer,
+                                                WGPUIndexFormat format,
+                                                uint64_t offset,
+                                                uint64_t size) {
+        if (mEnded) {
+            return true;
+        }
+
+        TrackedObject tracked = GetTrackedObject(buffer);
+        if (tracked.id != 0 && tracked == mIndexBuffer.buffer && format == mIndexFormat &&
+            offset == mIndexBuffer.offset && size == mIndexBuffer.size) {
+            return false;
+        }
+
+        mIndexBuffer.buffer = tracked;
+        mIndexBuffer.offset = offset;
+        mIndexBuffer.size = size;
+        mIndexFormat = format;
+        return true;
+    }
+
+    bool RenderPassEncoder::TrackExecuteBundles(uint32_t bundlesCount,
+                                                const WGPURenderBundle* bundles) {
+        // Executing bundles resets the state of the pass.
+        ResetState();
+        return true;
+    }
+
+    bool RenderPassEncoder::TrackEnd() {
+        mEnded = true;
+        return true;
+    }
+
+    bool RenderPassEncoder::TrackEndPass() {
+        mEnded = true;
+        return true;
+    }
+
+    RenderPassEncoder::TrackedObject RenderPassEncoder::GetTrackedObject(
+        WGPURenderPipeline pipeline) const {
+        if (pipeline == nullptr) {
+            return {};
+        }
+        uint32_t id = FromAPI(pipeline)->id;
+        return {id, client->RenderPipelineAllocator().GetGeneration(id)};
+    }
+
+    RenderPassEncoder::TrackedObject RenderPassEncoder::GetTrackedObject(
+        WGPUBindGroup group) const {
+        if (group == nullptr) {
+            return {};
+        }
+        uint32_t id = FromAPI(group)->id;
+        return {id, client->BindGroupAllocator().GetGeneration(id)};
+    }
+
+    RenderPassEncoder::TrackedObject RenderPassEncoder::GetTrackedObject(WGPUBuffer buffer) const {
+        if (buffer == nullptr) {
+            return {};
+        }
+        uint32_t id = FromAPI(buffer)->id;
+        return {id, client->BufferAllocator().GetGeneration(id)};
+    }
+
+    void RenderPassEncoder::ResetState() {
+        mPipeline = {};
+        mBindGroups.fill({});
+        mVertexBuffers.fill({});
+        mIndexBuffer = {};
+        mIndexFormat = WGPUIndexFormat_Undefined;
+    }
+
+}  // namespace dawn::wire::client
@@ -0,0 +1,97 @@
+// Copyright 2022 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DAWNWIRE_CLIENT_RENDERPASSENCODER_H_
+#define DAWNWIRE_CLIENT_RENDERPASSENCODER_H_
+
+#include <dawn/webgpu.h>
+
+#include "dawn/common/Constants.h"
+#include "dawn/wire/client/ObjectBase.h"
+
+#include <array>
+
+namespace dawn::wire::client {
+
+    // Keeps a shadow of the state set in the render pass so that commands setting the state that
+    // is already set can be skipped, see WireClientDescriptor::elideRedundantStateCommands.
+    // A command that is skipped would have produced the same validation result as the identical
+    // command that was sent before it, so skipping it doesn't change the errors that are reported.
+    class RenderPassEncoder final : public ObjectBase {
+      public:
+        using ObjectBase::ObjectBase;
+
+        // Each method records the state set by the command of the same name and returns whether
+        // the command must be sent to the server.
+        bool TrackSetPipeline(WGPURenderPipeline pipeline);
+        bool TrackSetBindGroup(uint32_t groupIndex,
+                               WGPUBindGroup group,
+                               uint32_t dynamicOffsetCount,
+                               const uint32_t* dynamicOffsets);
+        bool TrackSetVertexBuffer(uint32_t slot, WGPUBuffer buffer, uint64_t offset, uint64_t size);
+        bool TrackSetIndexBuffer(WGPUBuffer buffer,
+                                 WGPUIndexFormat format,
+                                 uint64_t offset,
+                                 uint64_t size);
+        bool TrackExecuteBundles(uint32_t bundlesCount, const WGPURenderBundle* bundles);
+        bool TrackEnd();
+        bool TrackEndPass();
+
+      private:
+        // Identifies an object without keeping it alive. The generation tells apart objects that
+        // reuse the ID of a released object. ID 0 is never used by objects, so a default
+        // constructed TrackedObject doesn't match any of them.
+        struct TrackedObject {
+            uint32_t id = 0;
+            uint32_t generation = 0;
+
+            bool operator==(const TrackedObject& other) const {
+                return id == other.id && generation == other.generation;
+            }
+        };
+
+        struct BindGroupState {
+            TrackedObject group;
+            uint32_t dynamicOffsetCount = 0;
+            std::array<uint32_t,
+                       kMaxDynamicUniformBuffersPerPipelineLayout +
+                           kMaxDynamicStorageBuffersPerPipelineLayout>
+                dynamicOffsets = {};
+        };
+
+        struct BufferBindingState {
+            TrackedObject buffer;
+            uint64_t offset = 0;
+            uint64_t size = 0;
+        };
+
+        TrackedObject GetTrackedObject(WGPURenderPipeline pipeline) const;
+        TrackedObject GetTrackedObject(WGPUBindGroup group) const;
+        TrackedObject GetTrackedObject(WGPUBuffer buffer) const;
+
+        void ResetState();
+
+        TrackedObject mPipeline;
+        std::array<BindGroupState, kMaxBindGroups> mBindGroups;
+        std::array<BufferBindingState, kMaxVertexBuffers> mVertexBuffers;
+        BufferBindingState mIndexBuffer;
+        WGPUIndexFormat mIndexFormat = WGPUIndexFormat_Undefined;
+
+        // After the end of the pass, commands are errors that must reach the server.
+        bool mEnded = false;
+    };
+
+}  // namespace dawn::wire::client
+
+#endif  // DAWNWIRE_CLIENT_RENDERPASSENCODER_H_
@@ -62,6 +62,9 @@ namespace dawn::wire::server {
         std::unique_ptr<MemoryTransferService::ReadHandle> readHandle;
         std::unique_ptr<MemoryTransferService::WriteHandle> writeHandle;
         BufferMapWriteState mapWriteState = BufferMapWriteState::Unmapped;
+        // The range mapped for writing, which data updates from the client must stay inside of.
+        uint64_t mapWriteOffset = 0;
+        uint64_t mapWriteSize = 0;
         WGPUBufferUsageFlags usage = WGPUBufferUsage_None;
         // Indicate if writeHandle needs to be destroyed on unmap
         bool mappedAtCreation = false;
@@ -19,8 +19,10 @@ namespace dawn::wire::server {
 
     Server::Server(const DawnProcTable& procs,
                    CommandSerializer* serializer,
-                   MemoryTransferService* memoryTransferService)
+                   MemoryTransferService* memoryTransferService,
+                   bool useCompactCommands)
         : mSerializer(serializer),
+          mUseCompactCommands(useCompactCommands),
           mProcs(procs),
           mMemoryTransferService(memoryTransferService),
           mIsAlive(std::make_shared<bool>(true)) {
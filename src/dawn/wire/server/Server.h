@@ -146,7 +146,8 @@ namespace dawn::wire::server {
       public:
         Server(const DawnProcTable& procs,
                CommandSerializer* serializer,
-               MemoryTransferService* memoryTransferService);
+               MemoryTransferService* memoryTransferService,
+               bool useCompactCommands);
         ~Server() override;
 
         // ChunkedCommandHandler implementation
@@ -226,6 +227,9 @@ namespace dawn::wire::server {
 
         WireDeserializeAllocator mAllocator;
         ChunkedCommandSerializer mSerializer;
+        bool mUseCompactCommands;
+        bool mReceivedCompactCommandsMarker = false;
+        CompactCommandState mCompactCommandState;
         DawnProcTable mProcs;
         std::unique_ptr<MemoryTransferService> mOwnedMemoryTransferService = nullptr;
         MemoryTransferService* mMemoryTransferService = nullptr;
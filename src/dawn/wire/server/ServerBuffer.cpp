@@ -163,6 +163,8 @@ namespace dawn::wire::server {
                 writeHandle->SetTarget(mapping);
 
                 resultData->mapWriteState = BufferMapWriteState::Mapped;
+                resultData->mapWriteOffset = 0;
+                resultData->mapWriteSize = descriptor->size;
             }
         }
 
@@ -218,6 +220,14 @@ namespace dawn::wire::server {
             return false;
         }
 
+        // The client may send several updates for a single unmap, one per range it wrote, but
+        // each of them must be inside of the mapped range. The target of the handle is only
+        // valid there.
+        if (offset < buffer->mapWriteOffset || size > buffer->mapWriteSize ||
+            offset - buffer->mapWriteOffset > buffer->mapWriteSize - size) {
+            return false;
+        }
+
         // Deserialize the flush info and flush updated data from the handle into the target
         // of the handle. The target is set via WriteHandle::SetTarget.
         return buffer->writeHandle->DeserializeDataUpdate(
@@ -254,6 +264,8 @@ namespace dawn::wire::server {
                 ASSERT(data->mode & WGPUMapMode_Write);
                 // The in-flight map request returned successfully.
                 bufferData->mapWriteState = BufferMapWriteState::Mapped;
+                bufferData->mapWriteOffset = data->offset;
+                bufferData->mapWriteSize = data->size;
                 // Set the target of the WriteHandle to the mapped buffer data.
                 // writeHandle Target always refers to the buffer base address.
                 // but we call getMappedRange exactly with the range of data that is potentially
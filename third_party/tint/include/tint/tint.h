@@ -22,6 +22,7 @@
 #include "src/demangler.h"
 #include "src/diagnostic/printer.h"
 #include "src/inspector/inspector.h"
+#include "src/program_serialization.h"
 #include "src/reader/reader.h"
 #include "src/sem/type_manager.h"
 #include "src/transform/binding_remapper.h"
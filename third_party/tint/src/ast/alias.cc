@@ -22,10 +22,11 @@ namespace tint {
 namespace ast {
 
 Alias::Alias(ProgramID pid,
+             NodeID nid,
              const Source& src,
              const Symbol& n,
              const Type* subtype)
-    : Base(pid, src, n), type(subtype) {
+    : Base(pid, nid, src, n), type(subtype) {
   TINT_ASSERT(AST, type);
 }
 
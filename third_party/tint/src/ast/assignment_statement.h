@@ -26,10 +26,12 @@ class AssignmentStatement : public Castable<AssignmentStatement, Statement> {
  public:
   /// Constructor
   /// @param program_id the identifier of the program that owns this node
+  /// @param nid the unique node identifier
   /// @param source the assignment statement source
   /// @param lhs the left side of the expression
   /// @param rhs the right side of the expression
   AssignmentStatement(ProgramID program_id,
+                      NodeID nid,
                       const Source& source,
                       const Expression* lhs,
                       const Expression* rhs);
@@ -31,7 +31,8 @@ TINT_INSTANTIATE_TYPEINFO(tint::ast::Type);
 namespace tint {
 namespace ast {
 
-Type::Type(ProgramID pid, const Source& src) : Base(pid, src) {}
+Type::Type(ProgramID pid, NodeID nid, const Source& src)
+    : Base(pid, nid, src) {}
 
 Type::Type(Type&&) = default;
 
@@ -27,9 +27,13 @@ class Atomic : public Castable<Atomic, Type> {
  public:
   /// Constructor
   /// @param pid the identifier of the program that owns this node
+  /// @param nid the unique node identifier
   /// @param src the source of this node
   /// @param subtype the pointee type
-  Atomic(ProgramID pid, const Source& src, const Type* const subtype);
+  Atomic(ProgramID pid,
+         NodeID nid,
+         const Source& src,
+         const Type* const subtype);
   /// Move constructor
   Atomic(Atomic&&);
   ~Atomic() override;
@@ -34,8 +34,10 @@ class Attribute : public Castable<Attribute, Node> {
  protected:
   /// Constructor
   /// @param pid the identifier of the program that owns this node
+  /// @param nid the unique node identifier
   /// @param src the source of this node
-  Attribute(ProgramID pid, const Source& src) : Base(pid, src) {}
+  Attribute(ProgramID pid, NodeID nid, const Source& src)
+      : Base(pid, nid, src) {}
 };
 
 /// A list of attributes
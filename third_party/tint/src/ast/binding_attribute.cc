@@ -24,9 +24,10 @@ namespace tint {
 namespace ast {
 
 BindingAttribute::BindingAttribute(ProgramID pid,
+                                   NodeID nid,
                                    const Source& src,
                                    uint32_t val)
-    : Base(pid, src), value(val) {}
+    : Base(pid, nid, src), value(val) {}
 
 BindingAttribute::~BindingAttribute() = default;
 
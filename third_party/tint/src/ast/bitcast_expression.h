@@ -28,10 +28,12 @@ class BitcastExpression : public Castable<BitcastExpression, Expression> {
  public:
   /// Constructor
   /// @param program_id the identifier of the program that owns this node
+  /// @param nid the unique node identifier
   /// @param source the bitcast expression source
   /// @param type the type
   /// @param expr the expr
   BitcastExpression(ProgramID program_id,
+                    NodeID nid,
                     const Source& source,
                     const Type* type,
                     const Expression* expr);
@@ -22,9 +22,10 @@ namespace tint {
 namespace ast {
 
 BlockStatement::BlockStatement(ProgramID pid,
+                               NodeID nid,
                                const Source& src,
                                const StatementList& stmts)
-    : Base(pid, src), statements(std::move(stmts)) {
+    : Base(pid, nid, src), statements(std::move(stmts)) {
   for (auto* stmt : statements) {
     TINT_ASSERT(AST, stmt);
     TINT_ASSERT_PROGRAM_IDS_EQUAL_IF_VALID(AST, stmt, program_id);
@@ -27,9 +27,11 @@ class BlockStatement : public Castable<BlockStatement, Statement> {
  public:
   /// Constructor
   /// @param program_id the identifier of the program that owns this node
+  /// @param nid the unique node identifier
   /// @param source the block statement source
   /// @param statements the statements
   BlockStatement(ProgramID program_id,
+                 NodeID nid,
                  const Source& source,
                  const StatementList& statements);
   /// Move constructor
@@ -21,7 +21,8 @@ TINT_INSTANTIATE_TYPEINFO(tint::ast::Bool);
 namespace tint {
 namespace ast {
 
-Bool::Bool(ProgramID pid, const Source& src) : Base(pid, src) {}
+Bool::Bool(ProgramID pid, NodeID nid, const Source& src)
+    : Base(pid, nid, src) {}
 
 Bool::Bool(Bool&&) = default;
 
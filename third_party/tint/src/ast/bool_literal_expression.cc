@@ -22,9 +22,10 @@ namespace tint {
 namespace ast {
 
 BoolLiteralExpression::BoolLiteralExpression(ProgramID pid,
+                                             NodeID nid,
                                              const Source& src,
                                              bool val)
-    : Base(pid, src), value(val) {}
+    : Base(pid, nid, src), value(val) {}
 
 BoolLiteralExpression::~BoolLiteralExpression() = default;
 
@@ -25,8 +25,9 @@ class BreakStatement : public Castable<BreakStatement, Statement> {
  public:
   /// Constructor
   /// @param pid the identifier of the program that owns this node
+  /// @param nid the unique node identifier
   /// @param src the source of this node
-  BreakStatement(ProgramID pid, const Source& src);
+  BreakStatement(ProgramID pid, NodeID nid, const Source& src);
   /// Move constructor
   BreakStatement(BreakStatement&&);
   ~BreakStatement() override;
@@ -23,8 +23,11 @@ TINT_INSTANTIATE_TYPEINFO(tint::ast::BuiltinAttribute);
 namespace tint {
 namespace ast {
 
-BuiltinAttribute::BuiltinAttribute(ProgramID pid, const Source& src, Builtin b)
-    : Base(pid, src), builtin(b) {}
+BuiltinAttribute::BuiltinAttribute(ProgramID pid,
+                                   NodeID nid,
+                                   const Source& src,
+                                   Builtin b)
+    : Base(pid, nid, src), builtin(b) {}
 
 BuiltinAttribute::~BuiltinAttribute() = default;
 
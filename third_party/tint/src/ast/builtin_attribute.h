@@ -28,9 +28,13 @@ class BuiltinAttribute : public Castable<BuiltinAttribute, Attribute> {
  public:
   /// constructor
   /// @param pid the identifier of the program that owns this node
+  /// @param nid the unique node identifier
   /// @param src the source of this node
   /// @param builtin the builtin value
-  BuiltinAttribute(ProgramID pid, const Source& src, Builtin builtin);
+  BuiltinAttribute(ProgramID pid,
+                   NodeID nid,
+                   const Source& src,
+                   Builtin builtin);
   ~BuiltinAttribute() override;
 
   /// @returns the WGSL name for the attribute
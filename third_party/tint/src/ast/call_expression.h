@@ -33,20 +33,24 @@ class CallExpression : public Castable<CallExpression, Expression> {
  public:
   /// Constructor
   /// @param program_id the identifier of the program that owns this node
+  /// @param nid the unique node identifier
   /// @param source the call expression source
   /// @param name the function or type name
   /// @param args the arguments
   CallExpression(ProgramID program_id,
+                 NodeID nid,
                  const Source& source,
                  const IdentifierExpression* name,
                  ExpressionList args);
 
   /// Constructor
   /// @param program_id the identifier of the program that owns this node
+  /// @param nid the unique node identifier
   /// @param source the call expression source
   /// @param type the type
   /// @param args the arguments
   CallExpression(ProgramID program_id,
+                 NodeID nid,
                  const Source& source,
                  const Type* type,
                  ExpressionList args);
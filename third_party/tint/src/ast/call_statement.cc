@@ -22,9 +22,10 @@ namespace tint {
 namespace ast {
 
 CallStatement::CallStatement(ProgramID pid,
+                             NodeID nid,
                              const Source& src,
                              const CallExpression* call)
-    : Base(pid, src), expr(call) {
+    : Base(pid, nid, src), expr(call) {
   TINT_ASSERT(AST, expr);
   TINT_ASSERT_PROGRAM_IDS_EQUAL_IF_VALID(AST, expr, program_id);
 }
@@ -21,8 +21,10 @@ TINT_INSTANTIATE_TYPEINFO(tint::ast::ContinueStatement);
 namespace tint {
 namespace ast {
 
-ContinueStatement::ContinueStatement(ProgramID pid, const Source& src)
-    : Base(pid, src) {}
+ContinueStatement::ContinueStatement(ProgramID pid,
+                                     NodeID nid,
+                                     const Source& src)
+    : Base(pid, nid, src) {}
 
 ContinueStatement::ContinueStatement(ContinueStatement&&) = default;
 
@@ -25,8 +25,9 @@ class ContinueStatement : public Castable<ContinueStatement, Statement> {
  public:
   /// Constructor
   /// @param pid the identifier of the program that owns this node
+  /// @param nid the unique node identifier
   /// @param src the source of this node
-  ContinueStatement(ProgramID pid, const Source& src);
+  ContinueStatement(ProgramID pid, NodeID nid, const Source& src);
   /// Move constructor
   ContinueStatement(ContinueStatement&&);
   ~ContinueStatement() override;
@@ -28,9 +28,11 @@ class DepthMultisampledTexture
  public:
   /// Constructor
   /// @param pid the identifier of the program that owns this node
+  /// @param nid the unique node identifier
   /// @param src the source of this node
   /// @param dim the dimensionality of the texture
   DepthMultisampledTexture(ProgramID pid,
+                           NodeID nid,
                            const Source& src,
                            TextureDimension dim);
   /// Move constructor
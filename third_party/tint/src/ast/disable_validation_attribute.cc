@@ -22,8 +22,9 @@ namespace tint {
 namespace ast {
 
 DisableValidationAttribute::DisableValidationAttribute(ProgramID pid,
+                                                       NodeID nid,
                                                        DisabledValidation val)
-    : Base(pid), validation(val) {}
+    : Base(pid, nid), validation(val) {}
 
 DisableValidationAttribute::~DisableValidationAttribute() = default;
 
@@ -49,8 +50,8 @@ std::string DisableValidationAttribute::InternalName() const {
 
 const DisableValidationAttribute* DisableValidationAttribute::Clone(
     CloneContext* ctx) const {
-  return ctx->dst->ASTNodes().Create<DisableValidationAttribute>(ctx->dst->ID(),
-                                                                 validation);
+  return ctx->dst->ASTNodes().Create<DisableValidationAttribute>(
+      ctx->dst->ID(), ctx->dst->AllocateNodeID(), validation);
 }
 
 }  // namespace ast
@@ -57,8 +57,10 @@ class DisableValidationAttribute
  public:
   /// Constructor
   /// @param program_id the identifier of the program that owns this node
+  /// @param nid the unique node identifier
   /// @param validation the validation to disable
   explicit DisableValidationAttribute(ProgramID program_id,
+                                      NodeID nid,
                                       DisabledValidation validation);
 
   /// Destructor
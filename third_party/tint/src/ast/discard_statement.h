@@ -25,8 +25,9 @@ class DiscardStatement : public Castable<DiscardStatement, Statement> {
  public:
   /// Constructor
   /// @param pid the identifier of the program that owns this node
+  /// @param nid the unique node identifier
   /// @param src the source of this node
-  DiscardStatement(ProgramID pid, const Source& src);
+  DiscardStatement(ProgramID pid, NodeID nid, const Source& src);
   /// Move constructor
   DiscardStatement(DiscardStatement&&);
   ~DiscardStatement() override;
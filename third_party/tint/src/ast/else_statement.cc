@@ -22,10 +22,11 @@ namespace tint {
 namespace ast {
 
 ElseStatement::ElseStatement(ProgramID pid,
+                             NodeID nid,
                              const Source& src,
                              const Expression* cond,
                              const BlockStatement* b)
-    : Base(pid, src), condition(cond), body(b) {
+    : Base(pid, nid, src), condition(cond), body(b) {
   TINT_ASSERT(AST, body);
   TINT_ASSERT_PROGRAM_IDS_EQUAL_IF_VALID(AST, body, program_id);
   TINT_ASSERT_PROGRAM_IDS_EQUAL_IF_VALID(AST, condition, program_id);
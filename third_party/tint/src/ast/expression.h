@@ -32,8 +32,9 @@ class Expression : public Castable<Expression, Node> {
  protected:
   /// Constructor
   /// @param pid the identifier of the program that owns this node
+  /// @param nid the unique node identifier
   /// @param src the source of this node
-  Expression(ProgramID pid, const Source& src);
+  Expression(ProgramID pid, NodeID nid, const Source& src);
   /// Move constructor
   Expression(Expression&&);
 };
@@ -27,8 +27,9 @@ class F32 : public Castable<F32, Type> {
  public:
   /// Constructor
   /// @param pid the identifier of the program that owns this node
+  /// @param nid the unique node identifier
   /// @param src the source of this node
-  F32(ProgramID pid, const Source& src);
+  F32(ProgramID pid, NodeID nid, const Source& src);
   /// Move constructor
   F32(F32&&);
   ~F32() override;
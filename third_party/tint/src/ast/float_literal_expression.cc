@@ -24,9 +24,10 @@ namespace tint {
 namespace ast {
 
 FloatLiteralExpression::FloatLiteralExpression(ProgramID pid,
+                                               NodeID nid,
                                                const Source& src,
                                                float val)
-    : Base(pid, src), value(val) {}
+    : Base(pid, nid, src), value(val) {}
 
 FloatLiteralExpression::~FloatLiteralExpression() = default;
 
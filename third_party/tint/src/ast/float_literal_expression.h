@@ -28,9 +28,13 @@ class FloatLiteralExpression
  public:
   /// Constructor
   /// @param pid the identifier of the program that owns this node
+  /// @param nid the unique node identifier
   /// @param src the source of this node
   /// @param value the float literals value
-  FloatLiteralExpression(ProgramID pid, const Source& src, float value);
+  FloatLiteralExpression(ProgramID pid,
+                         NodeID nid,
+                         const Source& src,
+                         float value);
   ~FloatLiteralExpression() override;
 
   /// Clones this node and all transitive child nodes using the `CloneContext`
@@ -22,12 +22,13 @@ namespace tint {
 namespace ast {
 
 ForLoopStatement::ForLoopStatement(ProgramID pid,
+                                   NodeID nid,
                                    const Source& src,
                                    const Statement* init,
                                    const Expression* cond,
                                    const Statement* cont,
                                    const BlockStatement* b)
-    : Base(pid, src),
+    : Base(pid, nid, src),
       initializer(init),
       condition(cond),
       continuing(cont),
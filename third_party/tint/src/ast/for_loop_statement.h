@@ -27,12 +27,14 @@ class ForLoopStatement : public Castable<ForLoopStatement, Statement> {
  public:
   /// Constructor
   /// @param program_id the identifier of the program that owns this node
+  /// @param nid the unique node identifier
   /// @param source the for loop statement source
   /// @param initializer the optional loop initializer statement
   /// @param condition the optional loop condition expression
   /// @param continuing the optional continuing statement
   /// @param body the loop body
   ForLoopStatement(ProgramID program_id,
+                   NodeID nid,
                    Source const& source,
                    const Statement* initializer,
                    const Expression* condition,
@@ -24,6 +24,7 @@ namespace tint {
 namespace ast {
 
 Function::Function(ProgramID pid,
+                   NodeID nid,
                    const Source& src,
                    Symbol sym,
                    VariableList parameters,
@@ -31,7 +32,7 @@ Function::Function(ProgramID pid,
                    const BlockStatement* b,
                    AttributeList attrs,
                    AttributeList return_type_attrs)
-    : Base(pid, src),
+    : Base(pid, nid, src),
       symbol(sym),
       params(std::move(parameters)),
       return_type(return_ty),
@@ -37,6 +37,7 @@ class Function : public Castable<Function, Node> {
  public:
   /// Create a function
   /// @param program_id the identifier of the program that owns this node
+  /// @param nid the unique node identifier
   /// @param source the variable source
   /// @param symbol the function symbol
   /// @param params the function parameters
@@ -45,6 +46,7 @@ class Function : public Castable<Function, Node> {
   /// @param attributes the function attributes
   /// @param return_type_attributes the return type attributes
   Function(ProgramID program_id,
+           NodeID nid,
            const Source& source,
            Symbol symbol,
            VariableList params,
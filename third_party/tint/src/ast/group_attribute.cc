@@ -23,8 +23,11 @@ TINT_INSTANTIATE_TYPEINFO(tint::ast::GroupAttribute);
 namespace tint {
 namespace ast {
 
-GroupAttribute::GroupAttribute(ProgramID pid, const Source& src, uint32_t val)
-    : Base(pid, src), value(val) {}
+GroupAttribute::GroupAttribute(ProgramID pid,
+                               NodeID nid,
+                               const Source& src,
+                               uint32_t val)
+    : Base(pid, nid, src), value(val) {}
 
 GroupAttribute::~GroupAttribute() = default;
 
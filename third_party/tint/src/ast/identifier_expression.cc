@@ -22,9 +22,10 @@ namespace tint {
 namespace ast {
 
 IdentifierExpression::IdentifierExpression(ProgramID pid,
+                                           NodeID nid,
                                            const Source& src,
                                            Symbol sym)
-    : Base(pid, src), symbol(sym) {
+    : Base(pid, nid, src), symbol(sym) {
   TINT_ASSERT_PROGRAM_IDS_EQUAL_IF_VALID(AST, symbol, program_id);
   TINT_ASSERT(AST, symbol.IsValid());
 }
@@ -25,9 +25,13 @@ class IdentifierExpression : public Castable<IdentifierExpression, Expression> {
  public:
   /// Constructor
   /// @param pid the identifier of the program that owns this node
+  /// @param nid the unique node identifier
   /// @param src the source of this node
   /// @param sym the symbol for the identifier
-  IdentifierExpression(ProgramID pid, const Source& src, Symbol sym);
+  IdentifierExpression(ProgramID pid,
+                       NodeID nid,
+                       const Source& src,
+                       Symbol sym);
   /// Move constructor
   IdentifierExpression(IdentifierExpression&&);
   ~IdentifierExpression() override;
@@ -22,11 +22,12 @@ namespace tint {
 namespace ast {
 
 IfStatement::IfStatement(ProgramID pid,
+                         NodeID nid,
                          const Source& src,
                          const Expression* cond,
                          const BlockStatement* b,
                          ElseStatementList else_stmts)
-    : Base(pid, src),
+    : Base(pid, nid, src),
       condition(cond),
       body(b),
       else_statements(std::move(else_stmts)) {
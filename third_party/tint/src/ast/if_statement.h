@@ -27,11 +27,13 @@ class IfStatement : public Castable<IfStatement, Statement> {
  public:
   /// Constructor
   /// @param pid the identifier of the program that owns this node
+  /// @param nid the unique node identifier
   /// @param src the source of this node
   /// @param condition the if condition
   /// @param body the if body
   /// @param else_stmts the else statements
   IfStatement(ProgramID pid,
+              NodeID nid,
               const Source& src,
               const Expression* condition,
               const BlockStatement* body,
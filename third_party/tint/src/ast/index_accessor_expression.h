@@ -26,10 +26,12 @@ class IndexAccessorExpression
  public:
   /// Constructor
   /// @param program_id the identifier of the program that owns this node
+  /// @param nid the unique node identifier
   /// @param source the index accessor source
   /// @param obj the object
   /// @param idx the index expression
   IndexAccessorExpression(ProgramID program_id,
+                          NodeID nid,
                           const Source& source,
                           const Expression* obj,
                           const Expression* idx);
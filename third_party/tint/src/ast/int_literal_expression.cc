@@ -19,8 +19,10 @@ TINT_INSTANTIATE_TYPEINFO(tint::ast::IntLiteralExpression);
 namespace tint {
 namespace ast {
 
-IntLiteralExpression::IntLiteralExpression(ProgramID pid, const Source& src)
-    : Base(pid, src) {}
+IntLiteralExpression::IntLiteralExpression(ProgramID pid,
+                                           NodeID nid,
+                                           const Source& src)
+    : Base(pid, nid, src) {}
 
 IntLiteralExpression::~IntLiteralExpression() = default;
 
@@ -35,8 +35,9 @@ class IntLiteralExpression
  protected:
   /// Constructor
   /// @param pid the identifier of the program that owns this node
+  /// @param nid the unique node identifier
   /// @param src the source of this node
-  IntLiteralExpression(ProgramID pid, const Source& src);
+  IntLiteralExpression(ProgramID pid, NodeID nid, const Source& src);
 };  // namespace ast
 
 }  // namespace ast
@@ -19,7 +19,8 @@ TINT_INSTANTIATE_TYPEINFO(tint::ast::InternalAttribute);
 namespace tint {
 namespace ast {
 
-InternalAttribute::InternalAttribute(ProgramID pid) : Base(pid, Source{}) {}
+InternalAttribute::InternalAttribute(ProgramID pid, NodeID nid)
+    : Base(pid, nid, Source{}) {}
 
 InternalAttribute::~InternalAttribute() = default;
 
@@ -27,8 +27,9 @@ class InvariantAttribute : public Castable<InvariantAttribute, Attribute> {
  public:
   /// constructor
   /// @param pid the identifier of the program that owns this node
+  /// @param nid the unique node identifier
   /// @param src the source of this node
-  InvariantAttribute(ProgramID pid, const Source& src);
+  InvariantAttribute(ProgramID pid, NodeID nid, const Source& src);
   ~InvariantAttribute() override;
 
   /// @returns the WGSL name for the attribute
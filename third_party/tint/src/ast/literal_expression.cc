@@ -19,8 +19,10 @@ TINT_INSTANTIATE_TYPEINFO(tint::ast::LiteralExpression);
 namespace tint {
 namespace ast {
 
-LiteralExpression::LiteralExpression(ProgramID pid, const Source& src)
-    : Base(pid, src) {}
+LiteralExpression::LiteralExpression(ProgramID pid,
+                                     NodeID nid,
+                                     const Source& src)
+    : Base(pid, nid, src) {}
 
 LiteralExpression::~LiteralExpression() = default;
 
@@ -30,8 +30,9 @@ class LiteralExpression : public Castable<LiteralExpression, Expression> {
  protected:
   /// Constructor
   /// @param pid the identifier of the program that owns this node
+  /// @param nid the unique node identifier
   /// @param src the input source
-  LiteralExpression(ProgramID pid, const Source& src);
+  LiteralExpression(ProgramID pid, NodeID nid, const Source& src);
 };
 
 }  // namespace ast
@@ -27,9 +27,13 @@ class LocationAttribute : public Castable<LocationAttribute, Attribute> {
  public:
   /// constructor
   /// @param pid the identifier of the program that owns this node
+  /// @param nid the unique node identifier
   /// @param src the source of this node
   /// @param value the location value
-  LocationAttribute(ProgramID pid, const Source& src, uint32_t value);
+  LocationAttribute(ProgramID pid,
+                    NodeID nid,
+                    const Source& src,
+                    uint32_t value);
   ~LocationAttribute() override;
 
   /// @returns the WGSL name for the attribute
@@ -25,10 +25,12 @@ class LoopStatement : public Castable<LoopStatement, Statement> {
  public:
   /// Constructor
   /// @param program_id the identifier of the program that owns this node
+  /// @param nid the unique node identifier
   /// @param source the loop statement source
   /// @param body the body statements
   /// @param continuing the continuing statements
   LoopStatement(ProgramID program_id,
+                NodeID nid,
                 const Source& source,
                 const BlockStatement* body,
                 const BlockStatement* continuing);
@@ -22,11 +22,12 @@ namespace tint {
 namespace ast {
 
 Matrix::Matrix(ProgramID pid,
+               NodeID nid,
                const Source& src,
                const Type* subtype,
                uint32_t r,
                uint32_t c)
-    : Base(pid, src), type(subtype), rows(r), columns(c) {
+    : Base(pid, nid, src), type(subtype), rows(r), columns(c) {
   TINT_ASSERT_PROGRAM_IDS_EQUAL_IF_VALID(AST, subtype, program_id);
   TINT_ASSERT(AST, rows > 1);
   TINT_ASSERT(AST, rows < 5);
@@ -26,10 +26,12 @@ class MemberAccessorExpression
  public:
   /// Constructor
   /// @param program_id the identifier of the program that owns this node
+  /// @param nid the unique node identifier
   /// @param source the member accessor expression source
   /// @param structure the structure
   /// @param member the member
   MemberAccessorExpression(ProgramID program_id,
+                           NodeID nid,
                            const Source& source,
                            const Expression* structure,
                            const IdentifierExpression* member);
@@ -0,0 +1,39 @@
+// Copyright 2022 The Tint Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SRC_AST_NODE_ID_H_
+#define SRC_AST_NODE_ID_H_
+
+#include <stdint.h>
+
+namespace tint {
+namespace ast {
+
+/// NodeID is a unique identifier of an AST node within its program.
+/// NodeIDs are allocated densely by the ProgramBuilder, starting at 0, so they
+/// can be used to index per-node side tables.
+struct NodeID {
+  /// Equality operator
+  /// @param other the other NodeID
+  /// @returns true if the NodeIDs are the same
+  bool operator==(const NodeID& other) const { return value == other.value; }
+
+  /// The numerical value for the node identifier
+  uint32_t value = 0;
+};
+
+}  // namespace ast
+}  // namespace tint
+
+#endif  // SRC_AST_NODE_ID_H_
@@ -23,13 +23,16 @@ TINT_INSTANTIATE_TYPEINFO(tint::ast::OverrideAttribute);
 namespace tint {
 namespace ast {
 
-OverrideAttribute::OverrideAttribute(ProgramID pid, const Source& src)
-    : Base(pid, src), has_value(false), value(0) {}
+OverrideAttribute::OverrideAttribute(ProgramID pid,
+                                     NodeID nid,
+                                     const Source& src)
+    : Base(pid, nid, src), has_value(false), value(0) {}
 
 OverrideAttribute::OverrideAttribute(ProgramID pid,
+                                     NodeID nid,
                                      const Source& src,
                                      uint32_t val)
-    : Base(pid, src), has_value(true), value(val) {}
+    : Base(pid, nid, src), has_value(true), value(val) {}
 
 OverrideAttribute::~OverrideAttribute() = default;
 
@@ -27,13 +27,15 @@ class OverrideAttribute : public Castable<OverrideAttribute, Attribute> {
  public:
   /// Create an override attribute with no specified id.
   /// @param pid the identifier of the program that owns this node
+  /// @param nid the unique node identifier
   /// @param src the source of this node
-  OverrideAttribute(ProgramID pid, const Source& src);
+  OverrideAttribute(ProgramID pid, NodeID nid, const Source& src);
   /// Create an override attribute with a specific id value.
   /// @param pid the identifier of the program that owns this node
+  /// @param nid the unique node identifier
   /// @param src the source of this node
   /// @param val the override value
-  OverrideAttribute(ProgramID pid, const Source& src, uint32_t val);
+  OverrideAttribute(ProgramID pid, NodeID nid, const Source& src, uint32_t val);
   ~OverrideAttribute() override;
 
   /// @returns the WGSL name for the attribute
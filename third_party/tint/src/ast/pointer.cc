@@ -22,11 +22,12 @@ namespace tint {
 namespace ast {
 
 Pointer::Pointer(ProgramID pid,
+                 NodeID nid,
                  const Source& src,
                  const Type* const subtype,
                  ast::StorageClass sc,
                  ast::Access ac)
-    : Base(pid, src), type(subtype), storage_class(sc), access(ac) {}
+    : Base(pid, nid, src), type(subtype), storage_class(sc), access(ac) {}
 
 std::string Pointer::FriendlyName(const SymbolTable& symbols) const {
   std::ostringstream out;
@@ -22,10 +22,11 @@ namespace tint {
 namespace ast {
 
 SampledTexture::SampledTexture(ProgramID pid,
+                               NodeID nid,
                                const Source& src,
                                TextureDimension d,
                                const Type* ty)
-    : Base(pid, src, d), type(ty) {
+    : Base(pid, nid, src, d), type(ty) {
   TINT_ASSERT(AST, type);
 }
 
@@ -27,10 +27,12 @@ class SampledTexture : public Castable<SampledTexture, Texture> {
  public:
   /// Constructor
   /// @param pid the identifier of the program that owns this node
+  /// @param nid the unique node identifier
   /// @param src the source of this node
   /// @param dim the dimensionality of the texture
   /// @param type the data type of the sampled texture
   SampledTexture(ProgramID pid,
+                 NodeID nid,
                  const Source& src,
                  TextureDimension dim,
                  const Type* type);
@@ -22,9 +22,10 @@ namespace tint {
 namespace ast {
 
 SintLiteralExpression::SintLiteralExpression(ProgramID pid,
+                                             NodeID nid,
                                              const Source& src,
                                              int32_t val)
-    : Base(pid, src), value(val) {}
+    : Base(pid, nid, src), value(val) {}
 
 SintLiteralExpression::~SintLiteralExpression() = default;
 
@@ -28,9 +28,13 @@ class SintLiteralExpression
  public:
   /// Constructor
   /// @param pid the identifier of the program that owns this node
+  /// @param nid the unique node identifier
   /// @param src the source of this node
   /// @param value the signed int literals value
-  SintLiteralExpression(ProgramID pid, const Source& src, int32_t value);
+  SintLiteralExpression(ProgramID pid,
+                        NodeID nid,
+                        const Source& src,
+                        int32_t value);
   ~SintLiteralExpression() override;
 
   /// @returns the literal value as a u32
@@ -24,9 +24,10 @@ namespace tint {
 namespace ast {
 
 StageAttribute::StageAttribute(ProgramID pid,
+                               NodeID nid,
                                const Source& src,
                                PipelineStage s)
-    : Base(pid, src), stage(s) {}
+    : Base(pid, nid, src), stage(s) {}
 
 StageAttribute::~StageAttribute() = default;
 
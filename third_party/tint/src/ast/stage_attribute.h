@@ -28,9 +28,11 @@ class StageAttribute : public Castable<StageAttribute, Attribute> {
  public:
   /// constructor
   /// @param program_id the identifier of the program that owns this node
+  /// @param nid the unique node identifier
   /// @param stage the pipeline stage
   /// @param source the source of this attribute
   StageAttribute(ProgramID program_id,
+                 NodeID nid,
                  const Source& source,
                  PipelineStage stage);
   ~StageAttribute() override;
@@ -31,7 +31,8 @@ TINT_INSTANTIATE_TYPEINFO(tint::ast::Statement);
 namespace tint {
 namespace ast {
 
-Statement::Statement(ProgramID pid, const Source& src) : Base(pid, src) {}
+Statement::Statement(ProgramID pid, NodeID nid, const Source& src)
+    : Base(pid, nid, src) {}
 
 Statement::Statement(Statement&&) = default;
 
@@ -54,12 +54,14 @@ class StorageTexture : public Castable<StorageTexture, Texture> {
  public:
   /// Constructor
   /// @param pid the identifier of the program that owns this node
+  /// @param nid the unique node identifier
   /// @param src the source of this node
   /// @param dim the dimensionality of the texture
   /// @param format the image format of the texture
   /// @param subtype the storage subtype. Use SubtypeFor() to calculate this.
   /// @param access_control the access control for the texture.
   StorageTexture(ProgramID pid,
+                 NodeID nid,
                  const Source& src,
                  TextureDimension dim,
                  TexelFormat format,
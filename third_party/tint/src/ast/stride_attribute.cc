@@ -23,8 +23,11 @@ TINT_INSTANTIATE_TYPEINFO(tint::ast::StrideAttribute);
 namespace tint {
 namespace ast {
 
-StrideAttribute::StrideAttribute(ProgramID pid, const Source& src, uint32_t s)
-    : Base(pid, src), stride(s) {}
+StrideAttribute::StrideAttribute(ProgramID pid,
+                                 NodeID nid,
+                                 const Source& src,
+                                 uint32_t s)
+    : Base(pid, nid, src), stride(s) {}
 
 StrideAttribute::~StrideAttribute() = default;
 
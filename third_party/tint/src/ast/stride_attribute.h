@@ -27,9 +27,13 @@ class StrideAttribute : public Castable<StrideAttribute, Attribute> {
  public:
   /// constructor
   /// @param pid the identifier of the program that owns this node
+  /// @param nid the unique node identifier
   /// @param src the source of this node
   /// @param stride the stride value
-  StrideAttribute(ProgramID pid, const Source& src, uint32_t stride);
+  StrideAttribute(ProgramID pid,
+                  NodeID nid,
+                  const Source& src,
+                  uint32_t stride);
   ~StrideAttribute() override;
 
   /// @returns the WGSL name for the attribute
@@ -25,11 +25,14 @@ namespace tint {
 namespace ast {
 
 Struct::Struct(ProgramID pid,
+               NodeID nid,
                const Source& src,
                Symbol n,
                StructMemberList m,
                AttributeList attrs)
-    : Base(pid, src, n), members(std::move(m)), attributes(std::move(attrs)) {
+    : Base(pid, nid, src, n),
+      members(std::move(m)),
+      attributes(std::move(attrs)) {
   for (auto* mem : members) {
     TINT_ASSERT(AST, mem);
     TINT_ASSERT_PROGRAM_IDS_EQUAL_IF_VALID(AST, mem, program_id);
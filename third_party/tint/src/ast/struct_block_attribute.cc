@@ -23,8 +23,10 @@ TINT_INSTANTIATE_TYPEINFO(tint::ast::StructBlockAttribute);
 namespace tint {
 namespace ast {
 
-StructBlockAttribute::StructBlockAttribute(ProgramID pid, const Source& src)
-    : Base(pid, src) {}
+StructBlockAttribute::StructBlockAttribute(ProgramID pid,
+                                           NodeID nid,
+                                           const Source& src)
+    : Base(pid, nid, src) {}
 
 StructBlockAttribute::~StructBlockAttribute() = default;
 
@@ -28,8 +28,9 @@ class StructBlockAttribute : public Castable<StructBlockAttribute, Attribute> {
  public:
   /// Constructor
   /// @param pid the identifier of the program that owns this node
+  /// @param nid the unique node identifier
   /// @param src the source of this node
-  StructBlockAttribute(ProgramID pid, const Source& src);
+  StructBlockAttribute(ProgramID pid, NodeID nid, const Source& src);
   ~StructBlockAttribute() override;
 
   /// @returns the WGSL name for the attribute
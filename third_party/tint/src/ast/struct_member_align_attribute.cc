@@ -25,9 +25,10 @@ namespace tint {
 namespace ast {
 
 StructMemberAlignAttribute::StructMemberAlignAttribute(ProgramID pid,
+                                                       NodeID nid,
                                                        const Source& src,
                                                        uint32_t a)
-    : Base(pid, src), align(a) {}
+    : Base(pid, nid, src), align(a) {}
 
 StructMemberAlignAttribute::~StructMemberAlignAttribute() = default;
 
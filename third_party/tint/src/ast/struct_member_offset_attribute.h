@@ -37,9 +37,11 @@ class StructMemberOffsetAttribute
  public:
   /// constructor
   /// @param pid the identifier of the program that owns this node
+  /// @param nid the unique node identifier
   /// @param src the source of this node
   /// @param offset the offset value
   StructMemberOffsetAttribute(ProgramID pid,
+                              NodeID nid,
                               const Source& src,
                               uint32_t offset);
   ~StructMemberOffsetAttribute() override;
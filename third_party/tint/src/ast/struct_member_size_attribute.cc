@@ -25,9 +25,10 @@ namespace tint {
 namespace ast {
 
 StructMemberSizeAttribute::StructMemberSizeAttribute(ProgramID pid,
+                                                     NodeID nid,
                                                      const Source& src,
                                                      uint32_t sz)
-    : Base(pid, src), size(sz) {}
+    : Base(pid, nid, src), size(sz) {}
 
 StructMemberSizeAttribute::~StructMemberSizeAttribute() = default;
 
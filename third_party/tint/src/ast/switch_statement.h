@@ -26,10 +26,12 @@ class SwitchStatement : public Castable<SwitchStatement, Statement> {
  public:
   /// Constructor
   /// @param pid the identifier of the program that owns this node
+  /// @param nid the unique node identifier
   /// @param src the source of this node
   /// @param condition the switch condition
   /// @param body the switch body
   SwitchStatement(ProgramID pid,
+                  NodeID nid,
                   const Source& src,
                   const Expression* condition,
                   CaseStatementList body);
@@ -22,9 +22,10 @@ namespace tint {
 namespace ast {
 
 UintLiteralExpression::UintLiteralExpression(ProgramID pid,
+                                             NodeID nid,
                                              const Source& src,
                                              uint32_t val)
-    : Base(pid, src), value(val) {}
+    : Base(pid, nid, src), value(val) {}
 
 UintLiteralExpression::~UintLiteralExpression() = default;
 
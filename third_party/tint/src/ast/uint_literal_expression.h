@@ -28,9 +28,13 @@ class UintLiteralExpression
  public:
   /// Constructor
   /// @param pid the identifier of the program that owns this node
+  /// @param nid the unique node identifier
   /// @param src the source of this node
   /// @param value the uint literals value
-  UintLiteralExpression(ProgramID pid, const Source& src, uint32_t value);
+  UintLiteralExpression(ProgramID pid,
+                        NodeID nid,
+                        const Source& src,
+                        uint32_t value);
   ~UintLiteralExpression() override;
 
   /// @returns the literal value as a u32
@@ -22,10 +22,11 @@ namespace tint {
 namespace ast {
 
 UnaryOpExpression::UnaryOpExpression(ProgramID pid,
+                                     NodeID nid,
                                      const Source& src,
                                      UnaryOp o,
                                      const Expression* e)
-    : Base(pid, src), op(o), expr(e) {
+    : Base(pid, nid, src), op(o), expr(e) {
   TINT_ASSERT(AST, expr);
   TINT_ASSERT_PROGRAM_IDS_EQUAL_IF_VALID(AST, expr, program_id);
 }
@@ -26,10 +26,12 @@ class UnaryOpExpression : public Castable<UnaryOpExpression, Expression> {
  public:
   /// Constructor
   /// @param program_id the identifier of the program that owns this node
+  /// @param nid the unique node identifier
   /// @param source the unary op expression source
   /// @param op the op
   /// @param expr the expr
   UnaryOpExpression(ProgramID program_id,
+                    NodeID nid,
                     const Source& source,
                     UnaryOp op,
                     const Expression* expr);
@@ -24,6 +24,7 @@ namespace tint {
 namespace ast {
 
 Variable::Variable(ProgramID pid,
+                   NodeID nid,
                    const Source& src,
                    const Symbol& sym,
                    StorageClass dsc,
@@ -32,7 +33,7 @@ Variable::Variable(ProgramID pid,
                    bool constant,
                    const Expression* ctor,
                    AttributeList attrs)
-    : Base(pid, src),
+    : Base(pid, nid, src),
       symbol(sym),
       type(ty),
       is_const(constant),
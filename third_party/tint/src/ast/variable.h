@@ -101,6 +101,7 @@ class Variable : public Castable<Variable, Node> {
  public:
   /// Create a variable
   /// @param program_id the identifier of the program that owns this node
+  /// @param nid the unique node identifier
   /// @param source the variable source
   /// @param sym the variable symbol
   /// @param declared_storage_class the declared storage class
@@ -110,6 +111,7 @@ class Variable : public Castable<Variable, Node> {
   /// @param constructor the constructor expression
   /// @param attributes the variable attributes
   Variable(ProgramID program_id,
+           NodeID nid,
            const Source& source,
            const Symbol& sym,
            StorageClass declared_storage_class,
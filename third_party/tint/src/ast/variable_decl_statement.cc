@@ -22,9 +22,10 @@ namespace tint {
 namespace ast {
 
 VariableDeclStatement::VariableDeclStatement(ProgramID pid,
+                                             NodeID nid,
                                              const Source& src,
                                              const Variable* var)
-    : Base(pid, src), variable(var) {
+    : Base(pid, nid, src), variable(var) {
   TINT_ASSERT(AST, variable);
   TINT_ASSERT_PROGRAM_IDS_EQUAL_IF_VALID(AST, variable, program_id);
 }
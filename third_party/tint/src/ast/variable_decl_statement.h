@@ -27,9 +27,11 @@ class VariableDeclStatement
  public:
   /// Constructor
   /// @param program_id the identifier of the program that owns this node
+  /// @param nid the unique node identifier
   /// @param source the variable statement source
   /// @param variable the variable
   VariableDeclStatement(ProgramID program_id,
+                        NodeID nid,
                         const Source& source,
                         const Variable* variable);
   /// Move constructor
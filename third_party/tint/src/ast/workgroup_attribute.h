@@ -31,11 +31,13 @@ class WorkgroupAttribute : public Castable<WorkgroupAttribute, Attribute> {
  public:
   /// constructor
   /// @param pid the identifier of the program that owns this node
+  /// @param nid the unique node identifier
   /// @param src the source of this node
   /// @param x the workgroup x dimension expression
   /// @param y the optional workgroup y dimension expression
   /// @param z the optional workgroup z dimension expression
   WorkgroupAttribute(ProgramID pid,
+                     NodeID nid,
                      const Source& src,
                      const ast::Expression* x,
                      const ast::Expression* y = nullptr,
@@ -14,7 +14,12 @@
 
 #include "src/bench/benchmark.h"
 
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
 #include <filesystem>
+#include <new>
 #include <sstream>
 #include <utility>
 #include <vector>
@@ -24,6 +29,19 @@ namespace {
 
 std::filesystem::path kInputFileDir;
 
+/// The number of calls to the global operator new
+std::atomic<uint64_t> allocation_count{0};
+/// The number of bytes currently allocated by the global operator new
+std::atomic<uint64_t> allocated_bytes{0};
+/// The highest value of allocated_bytes since the last reset
+std::atomic<uint64_t> peak_allocated_bytes{0};
+/// The value of allocated_bytes at the last reset
+std::atomic<uint64_t> peak_base_bytes{0};
+
+/// The size of the header placed before each allocation to record its size.
+/// This preserves the alignment guaranteed by operator new.
+constexpr size_t kAllocationHeaderSize = alignof(std::max_align_t);
+
 /// Copies the content from the file named `input_file` to `buffer`,
 /// assuming each element in the file is of type `T`.  If any error occurs,
 /// writes error messages to the standard error stream and returns false.
@@ -86,6 +104,36 @@ bool FindBenchmarkInputDir() {
 
 }  // namespace
 
+uint64_t AllocationCount() {
+  return allocation_count.load(std::memory_order_relaxed);
+}
+
+void ResetPeakAllocatedBytes() {
+  auto bytes = allocated_bytes.load(std::memory_order_relaxed);
+  peak_base_bytes.store(bytes, std::memory_order_relaxed);
+  peak_allocated_bytes.store(bytes, std::memory_order_relaxed);
+}
+
+uint64_t PeakAllocatedBytes() {
+  return peak_allocated_bytes.load(std::memory_order_relaxed) -
+         peak_base_bytes.load(std::memory_order_relaxed);
+}
+
+void ReportCounters(benchmark::State& state,
+                    size_t output_bytes,
+                    uint64_t allocations) {
+  if (output_bytes > 0) {
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                            static_cast<int64_t>(output_bytes));
+  }
+  state.counters["allocations"] = benchmark::Counter(
+      static_cast<double>(allocations), benchmark::Counter::kAvgIterations);
+  state.counters["peak_memory"] =
+      benchmark::Counter(static_cast<double>(PeakAllocatedBytes()),
+                         benchmark::Counter::kDefaults,
+                         benchmark::Counter::kIs1024);
+}
+
 std::variant<tint::Source::File, Error> LoadInputFile(std::string name) {
   auto path = (kInputFileDir / name).string();
   auto data = ReadFile<uint8_t>(path);
@@ -110,6 +158,43 @@ std::variant<ProgramAndFile, Error> LoadProgram(std::string name) {
 
 }  // namespace tint::bench
 
+// Replacements of the global allocation functions that count the allocations
+// and track the number of allocated bytes. The array and nothrow forms call
+// these. The size of each allocation is stored in a header before it.
+void* operator new(std::size_t size) {
+  namespace bench = tint::bench;
+  bench::allocation_count.fetch_add(1, std::memory_order_relaxed);
+  auto* header = static_cast<uint8_t*>(
+      std::malloc(size + bench::kAllocationHeaderSize));
+  if (header == nullptr) {
+    std::abort();
+  }
+  memcpy(header, &size, sizeof(size));
+  auto bytes =
+      bench::allocated_bytes.fetch_add(size, std::memory_order_relaxed) + size;
+  auto peak = bench::peak_allocated_bytes.load(std::memory_order_relaxed);
+  while (bytes > peak && !bench::peak_allocated_bytes.compare_exchange_weak(
+                             peak, bytes, std::memory_order_relaxed)) {
+  }
+  return header + bench::kAllocationHeaderSize;
+}
+
+void operator delete(void* ptr) noexcept {
+  namespace bench = tint::bench;
+  if (ptr == nullptr) {
+    return;
+  }
+  auto* header = static_cast<uint8_t*>(ptr) - bench::kAllocationHeaderSize;
+  std::size_t size = 0;
+  memcpy(&size, header, sizeof(size));
+  bench::allocated_bytes.fetch_sub(size, std::memory_order_relaxed);
+  std::free(header);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+  operator delete(ptr);
+}
+
 int main(int argc, char** argv) {
   benchmark::Initialize(&argc, argv);
   if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
@@ -51,6 +51,30 @@ std::variant<Source::File, Error> LoadInputFile(std::string name);
 /// @returns either the loaded Program or an Error
 std::variant<ProgramAndFile, Error> LoadProgram(std::string name);
 
+/// @returns the number of heap allocations made by the benchmark executable so
+/// far. The allocations are counted by replacing the global operator new.
+uint64_t AllocationCount();
+
+/// Resets the peak returned by PeakAllocatedBytes() to the number of bytes
+/// currently allocated.
+void ResetPeakAllocatedBytes();
+
+/// @returns the highest number of bytes allocated on the heap at any one time
+/// since the last call to ResetPeakAllocatedBytes(), minus the number of bytes
+/// that were allocated at the time of that call.
+uint64_t PeakAllocatedBytes();
+
+/// Reports the throughput of the benchmark, the average number of heap
+/// allocations per iteration, and the peak heap usage since the last call to
+/// ResetPeakAllocatedBytes()
+/// @param state the benchmark state
+/// @param output_bytes the number of bytes generated by each iteration, or 0
+/// if the benchmark does not produce any output
+/// @param allocations the number of allocations made by all the iterations
+void ReportCounters(benchmark::State& state,
+                    size_t output_bytes,
+                    uint64_t allocations);
+
 /// Declares a benchmark with the given function and WGSL file name
 #define TINT_BENCHMARK_WGSL_PROGRAM(FUNC, WGSL_NAME) \
   BENCHMARK_CAPTURE(FUNC, WGSL_NAME, WGSL_NAME);
@@ -47,6 +47,12 @@ class Any : public Castable<Any, sem::Type> {
  public:
   Any() = default;
   ~Any() override = default;
+  size_t Hash() const override {
+    return static_cast<size_t>(TypeInfo::Of<Any>().full_hashcode);
+  }
+  bool Equals(const sem::Type& other) const override {
+    return other.Is<Any>();
+  }
   std::string type_name() const override { return "<any>"; }
   std::string FriendlyName(const SymbolTable&) const override {
     return "<any>";
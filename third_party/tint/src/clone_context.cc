@@ -34,7 +34,15 @@ CloneContext::CloneContext(ProgramBuilder* to,
     // Almost all transforms will want to clone all symbols before doing any
     // work, to avoid any newly created symbols clashing with existing symbols
     // in the source program and causing them to be renamed.
-    from->Symbols().Foreach([&](Symbol s, const std::string&) { Clone(s); });
+    if (to->Symbols().Count() == 0) {
+      // Cloning all the symbols into an empty symbol table gives each symbol
+      // its original value, so the destination can simply share the names of
+      // the source until it registers a new one.
+      to->Symbols() = SymbolTable(from->Symbols(), to->ID());
+      symbols_shared_ = true;
+    } else {
+      from->Symbols().Foreach([&](Symbol s, std::string_view) { Clone(s); });
+    }
   }
 }
 
@@ -47,6 +55,10 @@ Symbol CloneContext::Clone(Symbol s) {
   if (!src) {
     return s;  // In-place clone
   }
+  if (symbols_shared_) {
+    TINT_ASSERT_PROGRAM_IDS_EQUAL_IF_VALID(Clone, src, s);
+    return dst->Symbols().Get(s.value());
+  }
   return utils::GetOrCreate(cloned_symbols_, s, [&]() -> Symbol {
     if (symbol_transform_) {
       return symbol_transform_(s);
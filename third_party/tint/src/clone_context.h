@@ -569,6 +569,11 @@ class CloneContext {
   /// A map of symbol in #src to their cloned equivalent in #dst
   std::unordered_map<Symbol, Symbol> cloned_symbols_;
 
+  /// True if the symbol table of #dst was constructed from the symbol table of
+  /// #src, in which case symbols are cloned by value and #cloned_symbols_ is
+  /// unused
+  bool symbols_shared_ = false;
+
   /// Cloneable transform functions registered with ReplaceAll()
   std::vector<CloneableTransform> transforms_;
 
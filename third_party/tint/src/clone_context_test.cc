@@ -904,6 +904,12 @@ TEST_F(CloneContextTest, CloneNewSymbols_AfterCloneSymbols) {
   EXPECT_EQ(cloned.Symbols().NameFor(new_b), "b");
   EXPECT_EQ(cloned.Symbols().NameFor(new_z), "c_1");
   EXPECT_EQ(cloned.Symbols().NameFor(new_c), "c");
+  EXPECT_EQ(new_a.ProgramID(), cloned.ID());
+  EXPECT_EQ(new_x.ProgramID(), cloned.ID());
+
+  // The symbols registered in the clone must not be visible in the original.
+  EXPECT_EQ(original.Symbols().Count(), 3u);
+  EXPECT_FALSE(original.Symbols().Get("a_1").IsValid());
 }
 
 TEST_F(CloneContextTest, ProgramIDs) {
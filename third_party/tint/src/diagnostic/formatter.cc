@@ -196,9 +196,9 @@ void Formatter::format(const Diagnostic& diag, State& state) const {
 
     for (size_t line_num = rng.begin.line;
          (line_num <= rng.end.line) &&
-         (line_num <= src.file->content.lines.size());
+         (line_num <= src.file->content.LineCount());
          line_num++) {
-      auto& line = src.file->content.lines[line_num - 1];
+      auto line = src.file->content.Line(line_num - 1);
       auto line_len = line.size();
 
       for (auto c : line) {
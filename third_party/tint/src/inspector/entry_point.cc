@@ -32,7 +32,7 @@ StageVariable::StageVariable(const StageVariable& other)
 StageVariable::~StageVariable() = default;
 
 EntryPoint::EntryPoint() = default;
-EntryPoint::EntryPoint(EntryPoint&) = default;
+EntryPoint::EntryPoint(const EntryPoint&) = default;
 EntryPoint::EntryPoint(EntryPoint&&) = default;
 EntryPoint::~EntryPoint() = default;
 
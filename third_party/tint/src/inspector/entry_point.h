@@ -135,7 +135,7 @@ struct EntryPoint {
   /// Constructors
   EntryPoint();
   /// Copy Constructor
-  EntryPoint(EntryPoint&);
+  EntryPoint(const EntryPoint&);
   /// Move Constructor
   EntryPoint(EntryPoint&&);
   ~EntryPoint();
@@ -14,6 +14,8 @@
 
 #include "src/inspector/inspector.h"
 
+#include <algorithm>
+#include <array>
 #include <limits>
 #include <utility>
 
@@ -29,12 +31,15 @@
 #include "src/sem/array.h"
 #include "src/sem/call.h"
 #include "src/sem/depth_multisampled_texture_type.h"
+#include "src/sem/depth_texture_type.h"
+#include "src/sem/external_texture_type.h"
 #include "src/sem/f32_type.h"
 #include "src/sem/function.h"
 #include "src/sem/i32_type.h"
 #include "src/sem/matrix_type.h"
 #include "src/sem/multisampled_texture_type.h"
 #include "src/sem/sampled_texture_type.h"
+#include "src/sem/sampler_type.h"
 #include "src/sem/statement.h"
 #include "src/sem/storage_texture_type.h"
 #include "src/sem/struct.h"
@@ -129,102 +134,26 @@ Inspector::Inspector(const Program* program) : program_(program) {}
 
 Inspector::~Inspector() = default;
 
-std::vector<EntryPoint> Inspector::GetEntryPoints() {
-  std::vector<EntryPoint> result;
-
-  for (auto* func : program_->AST().Functions()) {
-    if (!func->IsEntryPoint()) {
-      continue;
-    }
-
-    auto* sem = program_->Sem().Get(func);
-
-    EntryPoint entry_point;
-    entry_point.name = program_->Symbols().NameFor(func->symbol);
-    entry_point.remapped_name = program_->Symbols().NameFor(func->symbol);
-    entry_point.stage = func->PipelineStage();
-
-    auto wgsize = sem->WorkgroupSize();
-    entry_point.workgroup_size_x = wgsize[0].value;
-    entry_point.workgroup_size_y = wgsize[1].value;
-    entry_point.workgroup_size_z = wgsize[2].value;
-    if (wgsize[0].overridable_const || wgsize[1].overridable_const ||
-        wgsize[2].overridable_const) {
-      // TODO(crbug.com/tint/713): Handle overridable constants.
-      TINT_ASSERT(Inspector, false);
-    }
-
-    for (auto* param : sem->Parameters()) {
-      AddEntryPointInOutVariables(
-          program_->Symbols().NameFor(param->Declaration()->symbol),
-          param->Type(), param->Declaration()->attributes,
-          entry_point.input_variables);
-
-      entry_point.input_position_used |=
-          ContainsBuiltin(ast::Builtin::kPosition, param->Type(),
-                          param->Declaration()->attributes);
-      entry_point.front_facing_used |=
-          ContainsBuiltin(ast::Builtin::kFrontFacing, param->Type(),
-                          param->Declaration()->attributes);
-      entry_point.sample_index_used |=
-          ContainsBuiltin(ast::Builtin::kSampleIndex, param->Type(),
-                          param->Declaration()->attributes);
-      entry_point.input_sample_mask_used |=
-          ContainsBuiltin(ast::Builtin::kSampleMask, param->Type(),
-                          param->Declaration()->attributes);
-      entry_point.num_workgroups_used |=
-          ContainsBuiltin(ast::Builtin::kNumWorkgroups, param->Type(),
-                          param->Declaration()->attributes);
-    }
-
-    if (!sem->ReturnType()->Is<sem::Void>()) {
-      AddEntryPointInOutVariables("<retval>", sem->ReturnType(),
-                                  func->return_type_attributes,
-                                  entry_point.output_variables);
-
-      entry_point.output_sample_mask_used =
-          ContainsBuiltin(ast::Builtin::kSampleMask, sem->ReturnType(),
-                          func->return_type_attributes);
-    }
-
-    for (auto* var : sem->TransitivelyReferencedGlobals()) {
-      auto* decl = var->Declaration();
-
-      auto name = program_->Symbols().NameFor(decl->symbol);
-
-      auto* global = var->As<sem::GlobalVariable>();
-      if (global && global->IsOverridable()) {
-        OverridableConstant overridable_constant;
-        overridable_constant.name = name;
-        overridable_constant.numeric_id = global->ConstantId();
-        auto* type = var->Type();
-        TINT_ASSERT(Inspector, type->is_scalar());
-        if (type->is_bool_scalar_or_vector()) {
-          overridable_constant.type = OverridableConstant::Type::kBool;
-        } else if (type->is_float_scalar()) {
-          overridable_constant.type = OverridableConstant::Type::kFloat32;
-        } else if (type->is_signed_integer_scalar()) {
-          overridable_constant.type = OverridableConstant::Type::kInt32;
-        } else if (type->is_unsigned_integer_scalar()) {
-          overridable_constant.type = OverridableConstant::Type::kUint32;
-        } else {
-          TINT_UNREACHABLE(Inspector, diagnostics_);
-        }
-
-        overridable_constant.is_initialized =
-            global->Declaration()->constructor;
-        auto* override_attr = ast::GetAttribute<ast::OverrideAttribute>(
-            global->Declaration()->attributes);
-        overridable_constant.is_numeric_id_specified =
-            override_attr ? override_attr->has_value : false;
-
-        entry_point.overridable_constants.push_back(overridable_constant);
+const std::vector<EntryPointReflection>& Inspector::GetReflection() {
+  // Do not re-generate, since |program_| should not change during the lifetime
+  // of the inspector.
+  if (reflection_ == nullptr) {
+    reflection_ = std::make_unique<std::vector<EntryPointReflection>>();
+    for (auto* func : program_->AST().Functions()) {
+      if (func->IsEntryPoint()) {
+        reflection_indices_.emplace(func, reflection_->size());
+        reflection_->emplace_back(ReflectEntryPoint(func));
       }
     }
-
-    result.push_back(std::move(entry_point));
   }
+  return *reflection_;
+}
 
+std::vector<EntryPoint> Inspector::GetEntryPoints() {
+  std::vector<EntryPoint> result;
+  for (auto& reflection : GetReflection()) {
+    result.push_back(reflection.entry_point);
+  }
   return result;
 }
 
@@ -309,230 +238,95 @@ std::map<std::string, uint32_t> Inspector::GetConstantNameToIdMap() {
 }
 
 uint32_t Inspector::GetStorageSize(const std::string& entry_point) {
-  auto* func = FindEntryPointByName(entry_point);
-  if (!func) {
-    return 0;
-  }
-
-  size_t size = 0;
-  auto* func_sem = program_->Sem().Get(func);
-  for (auto& ruv : func_sem->TransitivelyReferencedUniformVariables()) {
-    size += ruv.first->Type()->UnwrapRef()->Size();
-  }
-  for (auto& rsv : func_sem->TransitivelyReferencedStorageBufferVariables()) {
-    size += rsv.first->Type()->UnwrapRef()->Size();
-  }
-
-  if (static_cast<uint64_t>(size) >
-      static_cast<uint64_t>(std::numeric_limits<uint32_t>::max())) {
-    return std::numeric_limits<uint32_t>::max();
-  }
-  return static_cast<uint32_t>(size);
+  auto* reflection = FindReflection(entry_point);
+  return reflection ? reflection->storage_size : 0;
 }
 
 std::vector<ResourceBinding> Inspector::GetResourceBindings(
     const std::string& entry_point) {
-  auto* func = FindEntryPointByName(entry_point);
-  if (!func) {
+  auto* reflection = FindReflection(entry_point);
+  if (!reflection) {
     return {};
   }
-
-  std::vector<ResourceBinding> result;
-  for (auto fn : {
-           &Inspector::GetUniformBufferResourceBindings,
-           &Inspector::GetStorageBufferResourceBindings,
-           &Inspector::GetReadOnlyStorageBufferResourceBindings,
-           &Inspector::GetSamplerResourceBindings,
-           &Inspector::GetComparisonSamplerResourceBindings,
-           &Inspector::GetSampledTextureResourceBindings,
-           &Inspector::GetMultisampledTextureResourceBindings,
-           &Inspector::GetWriteOnlyStorageTextureResourceBindings,
-           &Inspector::GetDepthTextureResourceBindings,
-           &Inspector::GetDepthMultisampledTextureResourceBindings,
-           &Inspector::GetExternalTextureResourceBindings,
-       }) {
-    AppendResourceBindings(&result, (this->*fn)(entry_point));
-  }
-  return result;
+  return reflection->resource_bindings;
 }
 
 std::vector<ResourceBinding> Inspector::GetUniformBufferResourceBindings(
     const std::string& entry_point) {
-  auto* func = FindEntryPointByName(entry_point);
-  if (!func) {
-    return {};
-  }
-
-  std::vector<ResourceBinding> result;
-
-  auto* func_sem = program_->Sem().Get(func);
-  for (auto& ruv : func_sem->TransitivelyReferencedUniformVariables()) {
-    auto* var = ruv.first;
-    auto binding_info = ruv.second;
-
-    auto* unwrapped_type = var->Type()->UnwrapRef();
-
-    ResourceBinding entry;
-    entry.resource_type = ResourceBinding::ResourceType::kUniformBuffer;
-    entry.bind_group = binding_info.group->value;
-    entry.binding = binding_info.binding->value;
-    entry.size = unwrapped_type->Size();
-    entry.size_no_padding = entry.size;
-    if (auto* str = unwrapped_type->As<sem::Struct>()) {
-      entry.size_no_padding = str->SizeNoPadding();
-    } else {
-      entry.size_no_padding = entry.size;
-    }
-
-    result.push_back(entry);
-  }
-
-  return result;
+  return GetResourceBindingsOfType(
+      entry_point, ResourceBinding::ResourceType::kUniformBuffer);
 }
 
 std::vector<ResourceBinding> Inspector::GetStorageBufferResourceBindings(
     const std::string& entry_point) {
-  return GetStorageBufferResourceBindingsImpl(entry_point, false);
+  return GetResourceBindingsOfType(
+      entry_point, ResourceBinding::ResourceType::kStorageBuffer);
 }
 
 std::vector<ResourceBinding>
 Inspector::GetReadOnlyStorageBufferResourceBindings(
     const std::string& entry_point) {
-  return GetStorageBufferResourceBindingsImpl(entry_point, true);
+  return GetResourceBindingsOfType(
+      entry_point, ResourceBinding::ResourceType::kReadOnlyStorageBuffer);
 }
 
 std::vector<ResourceBinding> Inspector::GetSamplerResourceBindings(
     const std::string& entry_point) {
-  auto* func = FindEntryPointByName(entry_point);
-  if (!func) {
-    return {};
-  }
-
-  std::vector<ResourceBinding> result;
-
-  auto* func_sem = program_->Sem().Get(func);
-  for (auto& rs : func_sem->TransitivelyReferencedSamplerVariables()) {
-    auto binding_info = rs.second;
-
-    ResourceBinding entry;
-    entry.resource_type = ResourceBinding::ResourceType::kSampler;
-    entry.bind_group = binding_info.group->value;
-    entry.binding = binding_info.binding->value;
-
-    result.push_back(entry);
-  }
-
-  return result;
+  return GetResourceBindingsOfType(entry_point,
+                                   ResourceBinding::ResourceType::kSampler);
 }
 
 std::vector<ResourceBinding> Inspector::GetComparisonSamplerResourceBindings(
     const std::string& entry_point) {
-  auto* func = FindEntryPointByName(entry_point);
-  if (!func) {
-    return {};
-  }
-
-  std::vector<ResourceBinding> result;
-
-  auto* func_sem = program_->Sem().Get(func);
-  for (auto& rcs :
-       func_sem->TransitivelyReferencedComparisonSamplerVariables()) {
-    auto binding_info = rcs.second;
-
-    ResourceBinding entry;
-    entry.resource_type = ResourceBinding::ResourceType::kComparisonSampler;
-    entry.bind_group = binding_info.group->value;
-    entry.binding = binding_info.binding->value;
-
-    result.push_back(entry);
-  }
-
-  return result;
+  return GetResourceBindingsOfType(
+      entry_point, ResourceBinding::ResourceType::kComparisonSampler);
 }
 
 std::vector<ResourceBinding> Inspector::GetSampledTextureResourceBindings(
     const std::string& entry_point) {
-  return GetSampledTextureResourceBindingsImpl(entry_point, false);
+  return GetResourceBindingsOfType(
+      entry_point, ResourceBinding::ResourceType::kSampledTexture);
 }
 
 std::vector<ResourceBinding> Inspector::GetMultisampledTextureResourceBindings(
     const std::string& entry_point) {
-  return GetSampledTextureResourceBindingsImpl(entry_point, true);
+  return GetResourceBindingsOfType(
+      entry_point, ResourceBinding::ResourceType::kMultisampledTexture);
 }
 
 std::vector<ResourceBinding>
 Inspector::GetWriteOnlyStorageTextureResourceBindings(
     const std::string& entry_point) {
-  return GetStorageTextureResourceBindingsImpl(entry_point);
-}
-
-std::vector<ResourceBinding> Inspector::GetTextureResourceBindings(
-    const std::string& entry_point,
-    const tint::TypeInfo* texture_type,
-    ResourceBinding::ResourceType resource_type) {
-  auto* func = FindEntryPointByName(entry_point);
-  if (!func) {
-    return {};
-  }
-
-  std::vector<ResourceBinding> result;
-  auto* func_sem = program_->Sem().Get(func);
-  for (auto& ref :
-       func_sem->TransitivelyReferencedVariablesOfType(texture_type)) {
-    auto* var = ref.first;
-    auto binding_info = ref.second;
-
-    ResourceBinding entry;
-    entry.resource_type = resource_type;
-    entry.bind_group = binding_info.group->value;
-    entry.binding = binding_info.binding->value;
-
-    auto* tex = var->Type()->UnwrapRef()->As<sem::Texture>();
-    entry.dim =
-        TypeTextureDimensionToResourceBindingTextureDimension(tex->dim());
-
-    result.push_back(entry);
-  }
-
-  return result;
+  return GetResourceBindingsOfType(
+      entry_point, ResourceBinding::ResourceType::kWriteOnlyStorageTexture);
 }
 
 std::vector<ResourceBinding> Inspector::GetDepthTextureResourceBindings(
     const std::string& entry_point) {
-  return GetTextureResourceBindings(
-      entry_point, &TypeInfo::Of<sem::DepthTexture>(),
-      ResourceBinding::ResourceType::kDepthTexture);
+  return GetResourceBindingsOfType(
+      entry_point, ResourceBinding::ResourceType::kDepthTexture);
 }
 
 std::vector<ResourceBinding>
 Inspector::GetDepthMultisampledTextureResourceBindings(
     const std::string& entry_point) {
-  return GetTextureResourceBindings(
-      entry_point, &TypeInfo::Of<sem::DepthMultisampledTexture>(),
-      ResourceBinding::ResourceType::kDepthMultisampledTexture);
+  return GetResourceBindingsOfType(
+      entry_point, ResourceBinding::ResourceType::kDepthMultisampledTexture);
 }
 
 std::vector<ResourceBinding> Inspector::GetExternalTextureResourceBindings(
     const std::string& entry_point) {
-  return GetTextureResourceBindings(
-      entry_point, &TypeInfo::Of<sem::ExternalTexture>(),
-      ResourceBinding::ResourceType::kExternalTexture);
+  return GetResourceBindingsOfType(
+      entry_point, ResourceBinding::ResourceType::kExternalTexture);
 }
 
 std::vector<sem::SamplerTexturePair> Inspector::GetSamplerTextureUses(
     const std::string& entry_point) {
-  auto* func = FindEntryPointByName(entry_point);
-  if (!func) {
-    return {};
-  }
-
-  GenerateSamplerTargets();
-
-  auto it = sampler_targets_->find(entry_point);
-  if (it == sampler_targets_->end()) {
+  auto* reflection = FindReflection(entry_point);
+  if (!reflection) {
     return {};
   }
-  return it->second;
+  return reflection->sampler_texture_uses;
 }
 
 std::vector<sem::SamplerTexturePair> Inspector::GetSamplerTextureUses(
@@ -559,28 +353,190 @@ std::vector<sem::SamplerTexturePair> Inspector::GetSamplerTextureUses(
 }
 
 uint32_t Inspector::GetWorkgroupStorageSize(const std::string& entry_point) {
-  auto* func = FindEntryPointByName(entry_point);
-  if (!func) {
-    return 0;
-  }
+  auto* reflection = FindReflection(entry_point);
+  return reflection ? reflection->workgroup_storage_size : 0;
+}
+
+EntryPointReflection Inspector::ReflectEntryPoint(const ast::Function* func) {
+  auto* sem = program_->Sem().Get(func);
+
+  EntryPointReflection reflection;
+  auto& entry_point = reflection.entry_point;
+  entry_point.name = program_->Symbols().NameFor(func->symbol);
+  entry_point.remapped_name = program_->Symbols().NameFor(func->symbol);
+  entry_point.stage = func->PipelineStage();
+
+  auto wgsize = sem->WorkgroupSize();
+  entry_point.workgroup_size_x = wgsize[0].value;
+  entry_point.workgroup_size_y = wgsize[1].value;
+  entry_point.workgroup_size_z = wgsize[2].value;
+  if (wgsize[0].overridable_const || wgsize[1].overridable_const ||
+      wgsize[2].overridable_const) {
+    // TODO(crbug.com/tint/713): Handle overridable constants.
+    TINT_ASSERT(Inspector, false);
+  }
+
+  for (auto* param : sem->Parameters()) {
+    AddEntryPointInOutVariables(
+        program_->Symbols().NameFor(param->Declaration()->symbol),
+        param->Type(), param->Declaration()->attributes,
+        entry_point.input_variables);
+
+    entry_point.input_position_used |=
+        ContainsBuiltin(ast::Builtin::kPosition, param->Type(),
+                        param->Declaration()->attributes);
+    entry_point.front_facing_used |=
+        ContainsBuiltin(ast::Builtin::kFrontFacing, param->Type(),
+                        param->Declaration()->attributes);
+    entry_point.sample_index_used |=
+        ContainsBuiltin(ast::Builtin::kSampleIndex, param->Type(),
+                        param->Declaration()->attributes);
+    entry_point.input_sample_mask_used |=
+        ContainsBuiltin(ast::Builtin::kSampleMask, param->Type(),
+                        param->Declaration()->attributes);
+    entry_point.num_workgroups_used |=
+        ContainsBuiltin(ast::Builtin::kNumWorkgroups, param->Type(),
+                        param->Declaration()->attributes);
+  }
+
+  if (!sem->ReturnType()->Is<sem::Void>()) {
+    AddEntryPointInOutVariables("<retval>", sem->ReturnType(),
+                                func->return_type_attributes,
+                                entry_point.output_variables);
+
+    entry_point.output_sample_mask_used =
+        ContainsBuiltin(ast::Builtin::kSampleMask, sem->ReturnType(),
+                        func->return_type_attributes);
+  }
+
+  // The resource bindings are gathered per resource type, and then
+  // concatenated in the order of ResourceBinding::ResourceType.
+  constexpr size_t kNumResourceTypes =
+      static_cast<size_t>(ResourceBinding::ResourceType::kExternalTexture) + 1;
+  std::array<std::vector<ResourceBinding>, kNumResourceTypes> bindings;
+  uint64_t storage_size = 0;
+
+  for (auto* var : sem->TransitivelyReferencedGlobals()) {
+    auto* decl = var->Declaration();
+
+    auto* global = var->As<sem::GlobalVariable>();
+    if (global && global->IsOverridable()) {
+      OverridableConstant overridable_constant;
+      overridable_constant.name = program_->Symbols().NameFor(decl->symbol);
+      overridable_constant.numeric_id = global->ConstantId();
+      auto* type = var->Type();
+      TINT_ASSERT(Inspector, type->is_scalar());
+      if (type->is_bool_scalar_or_vector()) {
+        overridable_constant.type = OverridableConstant::Type::kBool;
+      } else if (type->is_float_scalar()) {
+        overridable_constant.type = OverridableConstant::Type::kFloat32;
+      } else if (type->is_signed_integer_scalar()) {
+        overridable_constant.type = OverridableConstant::Type::kInt32;
+      } else if (type->is_unsigned_integer_scalar()) {
+        overridable_constant.type = OverridableConstant::Type::kUint32;
+      } else {
+        TINT_UNREACHABLE(Inspector, diagnostics_);
+      }
 
-  uint32_t total_size = 0;
-  auto* func_sem = program_->Sem().Get(func);
-  for (const sem::Variable* var : func_sem->TransitivelyReferencedGlobals()) {
-    if (var->StorageClass() == ast::StorageClass::kWorkgroup) {
-      auto* ty = var->Type()->UnwrapRef();
-      uint32_t align = ty->Align();
-      uint32_t size = ty->Size();
+      overridable_constant.is_initialized =
+          global->Declaration()->constructor;
+      auto* override_attr = ast::GetAttribute<ast::OverrideAttribute>(
+          global->Declaration()->attributes);
+      overridable_constant.is_numeric_id_specified =
+          override_attr ? override_attr->has_value : false;
+
+      entry_point.overridable_constants.push_back(overridable_constant);
+    }
 
+    auto* unwrapped_type = var->Type()->UnwrapRef();
+
+    if (var->StorageClass() == ast::StorageClass::kWorkgroup) {
       // This essentially matches std430 layout rules from GLSL, which are in
       // turn specified as an upper bound for Vulkan layout sizing. Since D3D
       // and Metal are even less specific, we assume Vulkan behavior as a
       // good-enough approximation everywhere.
-      total_size += utils::RoundUp(align, size);
+      reflection.workgroup_storage_size +=
+          utils::RoundUp(unwrapped_type->Align(), unwrapped_type->Size());
+    }
+
+    auto binding_point = decl->BindingPoint();
+    if (!binding_point) {
+      continue;
+    }
+
+    ResourceBinding entry;
+    entry.bind_group = binding_point.group->value;
+    entry.binding = binding_point.binding->value;
+
+    if (var->StorageClass() == ast::StorageClass::kUniform ||
+        var->StorageClass() == ast::StorageClass::kStorage) {
+      if (var->StorageClass() == ast::StorageClass::kUniform) {
+        entry.resource_type = ResourceBinding::ResourceType::kUniformBuffer;
+      } else if (var->Access() == ast::Access::kRead) {
+        entry.resource_type =
+            ResourceBinding::ResourceType::kReadOnlyStorageBuffer;
+      } else {
+        entry.resource_type = ResourceBinding::ResourceType::kStorageBuffer;
+      }
+      entry.size = unwrapped_type->Size();
+      if (auto* str = unwrapped_type->As<sem::Struct>()) {
+        entry.size_no_padding = str->SizeNoPadding();
+      } else {
+        entry.size_no_padding = entry.size;
+      }
+      storage_size += entry.size;
+    } else if (auto* sampler = unwrapped_type->As<sem::Sampler>()) {
+      entry.resource_type =
+          sampler->kind() == ast::SamplerKind::kComparisonSampler
+              ? ResourceBinding::ResourceType::kComparisonSampler
+              : ResourceBinding::ResourceType::kSampler;
+    } else if (auto* texture = unwrapped_type->As<sem::Texture>()) {
+      entry.dim =
+          TypeTextureDimensionToResourceBindingTextureDimension(texture->dim());
+      if (auto* sampled = texture->As<sem::SampledTexture>()) {
+        entry.resource_type = ResourceBinding::ResourceType::kSampledTexture;
+        entry.sampled_kind = BaseTypeToSampledKind(sampled->type());
+      } else if (auto* ms = texture->As<sem::MultisampledTexture>()) {
+        entry.resource_type =
+            ResourceBinding::ResourceType::kMultisampledTexture;
+        entry.sampled_kind = BaseTypeToSampledKind(ms->type());
+      } else if (auto* storage = texture->As<sem::StorageTexture>()) {
+        entry.resource_type =
+            ResourceBinding::ResourceType::kWriteOnlyStorageTexture;
+        entry.sampled_kind = BaseTypeToSampledKind(storage->type());
+        entry.image_format = TypeTexelFormatToResourceBindingTexelFormat(
+            storage->texel_format());
+      } else if (texture->Is<sem::DepthTexture>()) {
+        entry.resource_type = ResourceBinding::ResourceType::kDepthTexture;
+      } else if (texture->Is<sem::DepthMultisampledTexture>()) {
+        entry.resource_type =
+            ResourceBinding::ResourceType::kDepthMultisampledTexture;
+      } else if (texture->Is<sem::ExternalTexture>()) {
+        entry.resource_type = ResourceBinding::ResourceType::kExternalTexture;
+      } else {
+        continue;
+      }
+    } else {
+      continue;
     }
+
+    bindings[static_cast<size_t>(entry.resource_type)].push_back(entry);
+  }
+
+  for (auto& bindings_of_type : bindings) {
+    AppendResourceBindings(&reflection.resource_bindings, bindings_of_type);
+  }
+
+  reflection.storage_size = static_cast<uint32_t>(std::min<uint64_t>(
+      storage_size, std::numeric_limits<uint32_t>::max()));
+
+  GenerateSamplerTargets();
+  auto it = sampler_targets_->find(entry_point.name);
+  if (it != sampler_targets_->end()) {
+    reflection.sampler_texture_uses = it->second;
   }
 
-  return total_size;
+  return reflection;
 }
 
 const ast::Function* Inspector::FindEntryPointByName(const std::string& name) {
@@ -667,121 +623,35 @@ bool Inspector::ContainsBuiltin(ast::Builtin builtin,
   return true;
 }
 
-std::vector<ResourceBinding> Inspector::GetStorageBufferResourceBindingsImpl(
-    const std::string& entry_point,
-    bool read_only) {
+const EntryPointReflection* Inspector::FindReflection(
+    const std::string& entry_point) {
   auto* func = FindEntryPointByName(entry_point);
   if (!func) {
-    return {};
+    return nullptr;
   }
-
-  auto* func_sem = program_->Sem().Get(func);
-  std::vector<ResourceBinding> result;
-  for (auto& rsv : func_sem->TransitivelyReferencedStorageBufferVariables()) {
-    auto* var = rsv.first;
-    auto binding_info = rsv.second;
-
-    if (read_only != (var->Access() == ast::Access::kRead)) {
-      continue;
-    }
-
-    auto* unwrapped_type = var->Type()->UnwrapRef();
-
-    ResourceBinding entry;
-    entry.resource_type =
-        read_only ? ResourceBinding::ResourceType::kReadOnlyStorageBuffer
-                  : ResourceBinding::ResourceType::kStorageBuffer;
-    entry.bind_group = binding_info.group->value;
-    entry.binding = binding_info.binding->value;
-    entry.size = unwrapped_type->Size();
-    if (auto* str = unwrapped_type->As<sem::Struct>()) {
-      entry.size_no_padding = str->SizeNoPadding();
-    } else {
-      entry.size_no_padding = entry.size;
-    }
-
-    result.push_back(entry);
+  auto& reflection = GetReflection();
+  auto it = reflection_indices_.find(func);
+  if (it == reflection_indices_.end()) {
+    TINT_ICE(Inspector, diagnostics_)
+        << "entry point " << entry_point << " has no reflection";
+    return nullptr;
   }
-
-  return result;
+  return &reflection[it->second];
 }
 
-std::vector<ResourceBinding> Inspector::GetSampledTextureResourceBindingsImpl(
+std::vector<ResourceBinding> Inspector::GetResourceBindingsOfType(
     const std::string& entry_point,
-    bool multisampled_only) {
-  auto* func = FindEntryPointByName(entry_point);
-  if (!func) {
+    ResourceBinding::ResourceType resource_type) {
+  auto* reflection = FindReflection(entry_point);
+  if (!reflection) {
     return {};
   }
-
   std::vector<ResourceBinding> result;
-  auto* func_sem = program_->Sem().Get(func);
-  auto referenced_variables =
-      multisampled_only
-          ? func_sem->TransitivelyReferencedMultisampledTextureVariables()
-          : func_sem->TransitivelyReferencedSampledTextureVariables();
-  for (auto& ref : referenced_variables) {
-    auto* var = ref.first;
-    auto binding_info = ref.second;
-
-    ResourceBinding entry;
-    entry.resource_type =
-        multisampled_only ? ResourceBinding::ResourceType::kMultisampledTexture
-                          : ResourceBinding::ResourceType::kSampledTexture;
-    entry.bind_group = binding_info.group->value;
-    entry.binding = binding_info.binding->value;
-
-    auto* texture_type = var->Type()->UnwrapRef()->As<sem::Texture>();
-    entry.dim = TypeTextureDimensionToResourceBindingTextureDimension(
-        texture_type->dim());
-
-    const sem::Type* base_type = nullptr;
-    if (multisampled_only) {
-      base_type = texture_type->As<sem::MultisampledTexture>()->type();
-    } else {
-      base_type = texture_type->As<sem::SampledTexture>()->type();
+  for (auto& binding : reflection->resource_bindings) {
+    if (binding.resource_type == resource_type) {
+      result.push_back(binding);
     }
-    entry.sampled_kind = BaseTypeToSampledKind(base_type);
-
-    result.push_back(entry);
-  }
-
-  return result;
-}
-
-std::vector<ResourceBinding> Inspector::GetStorageTextureResourceBindingsImpl(
-    const std::string& entry_point) {
-  auto* func = FindEntryPointByName(entry_point);
-  if (!func) {
-    return {};
   }
-
-  auto* func_sem = program_->Sem().Get(func);
-  std::vector<ResourceBinding> result;
-  for (auto& ref :
-       func_sem->TransitivelyReferencedVariablesOfType<sem::StorageTexture>()) {
-    auto* var = ref.first;
-    auto binding_info = ref.second;
-
-    auto* texture_type = var->Type()->UnwrapRef()->As<sem::StorageTexture>();
-
-    ResourceBinding entry;
-    entry.resource_type =
-        ResourceBinding::ResourceType::kWriteOnlyStorageTexture;
-    entry.bind_group = binding_info.group->value;
-    entry.binding = binding_info.binding->value;
-
-    entry.dim = TypeTextureDimensionToResourceBindingTextureDimension(
-        texture_type->dim());
-
-    auto* base_type = texture_type->type();
-    entry.sampled_kind = BaseTypeToSampledKind(base_type);
-    entry.image_format = TypeTexelFormatToResourceBindingTexelFormat(
-        texture_type->texel_format());
-
-    result.push_back(entry);
-  }
-
   return result;
 }
 
@@ -35,6 +35,24 @@ namespace inspector {
 /// A temporary alias to sem::SamplerTexturePair. [DEPRECATED]
 using SamplerTexturePair = sem::SamplerTexturePair;
 
+/// EntryPointReflection holds all the information the Inspector extracts about
+/// a single entry point.
+struct EntryPointReflection {
+  /// The entry point, as returned by Inspector::GetEntryPoints()
+  EntryPoint entry_point;
+  /// All the resource bindings, as returned by
+  /// Inspector::GetResourceBindings()
+  std::vector<ResourceBinding> resource_bindings;
+  /// The sampler/texture sampling pairs, as returned by
+  /// Inspector::GetSamplerTextureUses()
+  std::vector<sem::SamplerTexturePair> sampler_texture_uses;
+  /// The size of shared storage, as returned by Inspector::GetStorageSize()
+  uint32_t storage_size = 0;
+  /// The size of workgroup storage, as returned by
+  /// Inspector::GetWorkgroupStorageSize()
+  uint32_t workgroup_storage_size = 0;
+};
+
 /// Extracts information from a program
 class Inspector {
  public:
@@ -50,6 +68,13 @@ class Inspector {
   /// @returns true if an error was encountered
   bool has_error() const { return diagnostics_.contains_errors(); }
 
+  /// @returns the reflection of all the entry points of the program, in
+  /// declaration order. The reflection is built the first time it is
+  /// requested, with a single traversal of the globals referenced by each
+  /// entry point, and is reused by all the other per entry point queries of
+  /// this Inspector.
+  const std::vector<EntryPointReflection>& GetReflection();
+
   /// @returns vector of entry point information
   std::vector<EntryPoint> GetEntryPoints();
 
@@ -156,6 +181,8 @@ class Inspector {
       std::unordered_map<std::string,
                          utils::UniqueVector<sem::SamplerTexturePair>>>
       sampler_targets_;
+  std::unique_ptr<std::vector<EntryPointReflection>> reflection_;
+  std::unordered_map<const ast::Function*, size_t> reflection_indices_;
 
   /// @param name name of the entry point to find
   /// @returns a pointer to the entry point if it exists, otherwise returns
@@ -181,38 +208,21 @@ class Inspector {
                        const sem::Type* type,
                        const ast::AttributeList& attributes) const;
 
-  /// Gathers all the texture resource bindings of the given type for the given
-  /// entry point.
-  /// @param entry_point name of the entry point to get information about.
-  /// @param texture_type the type of the textures to gather.
-  /// @param resource_type the ResourceBinding::ResourceType for the given
-  /// texture type.
-  /// @returns vector of all of the bindings for depth textures.
-  std::vector<ResourceBinding> GetTextureResourceBindings(
-      const std::string& entry_point,
-      const tint::TypeInfo* texture_type,
-      ResourceBinding::ResourceType resource_type);
+  /// @param func the entry point to reflect
+  /// @returns the reflection of the entry point `func`
+  EntryPointReflection ReflectEntryPoint(const ast::Function* func);
 
   /// @param entry_point name of the entry point to get information about.
-  /// @param read_only if true get only read-only bindings, if false get
-  ///                  write-only bindings.
-  /// @returns vector of all of the bindings for the requested storage buffers.
-  std::vector<ResourceBinding> GetStorageBufferResourceBindingsImpl(
-      const std::string& entry_point,
-      bool read_only);
+  /// @returns the reflection of the entry point, or nullptr if it does not
+  ///          exist, in which case the error string is set.
+  const EntryPointReflection* FindReflection(const std::string& entry_point);
 
   /// @param entry_point name of the entry point to get information about.
-  /// @param multisampled_only only get multisampled textures if true, otherwise
-  ///                          only get sampled textures.
-  /// @returns vector of all of the bindings for the request storage buffers.
-  std::vector<ResourceBinding> GetSampledTextureResourceBindingsImpl(
+  /// @param resource_type the type of the bindings to get.
+  /// @returns vector of all of the bindings of the given type.
+  std::vector<ResourceBinding> GetResourceBindingsOfType(
       const std::string& entry_point,
-      bool multisampled_only);
-
-  /// @param entry_point name of the entry point to get information about.
-  /// @returns vector of all of the bindings for the requested storage textures.
-  std::vector<ResourceBinding> GetStorageTextureResourceBindingsImpl(
-      const std::string& entry_point);
+      ResourceBinding::ResourceType resource_type);
 
   /// Constructs |sampler_targets_| if it hasn't already been instantiated.
   void GenerateSamplerTargets();
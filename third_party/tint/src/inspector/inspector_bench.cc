@@ -0,0 +1,134 @@
+// Copyright 2022 The Tint Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <sstream>
+#include <string>
+
+#include "src/bench/benchmark.h"
+
+namespace tint::inspector {
+namespace {
+
+/// Queries the reflection data the way Dawn used to: one call per entry point
+/// per kind of data, each of which walks the entry point's globals again.
+void PerQuery(Inspector& inspector) {
+  for (auto& entry_point : inspector.GetEntryPoints()) {
+    benchmark::DoNotOptimize(inspector.GetResourceBindings(entry_point.name));
+    benchmark::DoNotOptimize(
+        inspector.GetSamplerTextureUses(entry_point.name));
+    benchmark::DoNotOptimize(inspector.GetStorageSize(entry_point.name));
+    benchmark::DoNotOptimize(
+        inspector.GetWorkgroupStorageSize(entry_point.name));
+  }
+}
+
+void ReflectPerQuery(benchmark::State& state, std::string input_name) {
+  auto res = bench::LoadProgram(input_name);
+  if (auto err = std::get_if<bench::Error>(&res)) {
+    state.SkipWithError(err->msg.c_str());
+    return;
+  }
+  auto& program = std::get<bench::ProgramAndFile>(res).program;
+  auto allocations = bench::AllocationCount();
+  bench::ResetPeakAllocatedBytes();
+  for (auto _ : state) {
+    Inspector inspector(&program);
+    PerQuery(inspector);
+  }
+  allocations = bench::AllocationCount() - allocations;
+  bench::ReportCounters(state, 0, allocations);
+}
+
+void ReflectSinglePass(benchmark::State& state, std::string input_name) {
+  auto res = bench::LoadProgram(input_name);
+  if (auto err = std::get_if<bench::Error>(&res)) {
+    state.SkipWithError(err->msg.c_str());
+    return;
+  }
+  auto& program = std::get<bench::ProgramAndFile>(res).program;
+  auto allocations = bench::AllocationCount();
+  bench::ResetPeakAllocatedBytes();
+  for (auto _ : state) {
+    Inspector inspector(&program);
+    benchmark::DoNotOptimize(inspector.GetReflection());
+  }
+  allocations = bench::AllocationCount() - allocations;
+  bench::ReportCounters(state, 0, allocations);
+}
+
+TINT_BENCHMARK_WGSL_PROGRAMS(ReflectPerQuery);
+TINT_BENCHMARK_WGSL_PROGRAMS(ReflectSinglePass);
+
+/// @returns a WGSL module with `num_entry_points` compute entry points, each of
+/// which uses all of `num_bindings` storage buffers and textures.
+std::string LargeModule(int num_entry_points, int num_bindings) {
+  std::stringstream wgsl;
+  wgsl << "struct S { a : array<f32, 64>, }\n";
+  wgsl << "var<workgroup> wg : array<f32, 256>;\n";
+  wgsl << "@group(0) @binding(0) var smp : sampler;\n";
+  for (int i = 0; i < num_bindings; i++) {
+    wgsl << "@group(1) @binding(" << i << ") var<storage, read_write> b" << i
+         << " : S;\n";
+    wgsl << "@group(2) @binding(" << i << ") var t" << i
+         << " : texture_2d<f32>;\n";
+  }
+  wgsl << "fn use_all() {\n";
+  wgsl << "  wg[0] = 1.0;\n";
+  for (int i = 0; i < num_bindings; i++) {
+    wgsl << "  b" << i << ".a[0] = textureSampleLevel(t" << i
+         << ", smp, vec2<f32>(), 0.0).x;\n";
+  }
+  wgsl << "}\n";
+  for (int i = 0; i < num_entry_points; i++) {
+    wgsl << "@stage(compute) @workgroup_size(1) fn main" << i
+         << "() { use_all(); }\n";
+  }
+  return wgsl.str();
+}
+
+void ReflectLargeModule(benchmark::State& state, bool single_pass) {
+  Source::File file("large.wgsl",
+                    LargeModule(static_cast<int>(state.range(0)),
+                                static_cast<int>(state.range(1))));
+  auto program = reader::wgsl::Parse(&file);
+  if (!program.IsValid()) {
+    state.SkipWithError(program.Diagnostics().str().c_str());
+    return;
+  }
+  auto allocations = bench::AllocationCount();
+  bench::ResetPeakAllocatedBytes();
+  for (auto _ : state) {
+    Inspector inspector(&program);
+    if (single_pass) {
+      benchmark::DoNotOptimize(inspector.GetReflection());
+    } else {
+      PerQuery(inspector);
+    }
+  }
+  allocations = bench::AllocationCount() - allocations;
+  bench::ReportCounters(state, 0, allocations);
+}
+
+BENCHMARK_CAPTURE(ReflectLargeModule, PerQuery, false)
+    ->Args({1, 64})
+    ->Args({16, 16})
+    ->Args({16, 64});
+BENCHMARK_CAPTURE(ReflectLargeModule, SinglePass, true)
+    ->Args({1, 64})
+    ->Args({16, 16})
+    ->Args({16, 64});
+
+}  // namespace
+}  // namespace tint::inspector
@@ -149,6 +149,9 @@ class InspectorGetSamplerTextureUsesTest : public InspectorRunner,
 class InspectorGetWorkgroupStorageSizeTest : public InspectorBuilder,
                                              public testing::Test {};
 
+class InspectorGetReflectionTest : public InspectorBuilder,
+                                   public testing::Test {};
+
 // This is a catch all for shaders that have demonstrated regressions/crashes in
 // the wild.
 class InspectorRegressionTest : public InspectorRunner, public testing::Test {};
@@ -3082,6 +3085,96 @@ TEST_F(InspectorGetWorkgroupStorageSizeTest, StructAlignment) {
 
 // Crash was occuring in ::GenerateSamplerTargets, when
 // ::GetSamplerTextureUses was called.
+TEST_F(InspectorGetReflectionTest, NoEntryPoints) {
+  MakeEmptyBodyFunction("foo", {});
+
+  Inspector& inspector = Build();
+
+  auto& result = inspector.GetReflection();
+  ASSERT_FALSE(inspector.has_error()) << inspector.error();
+  EXPECT_TRUE(result.empty());
+}
+
+TEST_F(InspectorGetReflectionTest, MatchesPerEntryPointQueries) {
+  auto* ub_struct_type = MakeUniformBufferType("ub_type", {ty.i32()});
+  AddUniformBuffer("ub_var", ty.Of(ub_struct_type), 0, 0);
+  MakeStructVariableReferenceBodyFunction("ub_func", "ub_var", {{0, ty.i32()}});
+
+  auto sb = MakeStorageBufferTypes("sb_type", {ty.i32()});
+  AddStorageBuffer("sb_var", sb(), ast::Access::kReadWrite, 1, 0);
+  MakeStructVariableReferenceBodyFunction("sb_func", "sb_var", {{0, ty.i32()}});
+
+  auto* s_texture_type =
+      ty.sampled_texture(ast::TextureDimension::k1d, ty.f32());
+  AddResource("s_texture", s_texture_type, 2, 0);
+  AddSampler("s_var", 3, 0);
+  AddGlobalVariable("s_coords", ty.f32());
+  MakeSamplerReferenceBodyFunction("s_func", "s_texture", "s_var", "s_coords",
+                                   ty.f32(), {});
+
+  AddWorkgroupStorage("wg_f32", ty.f32());
+  MakePlainGlobalReferenceBodyFunction("wg_func", "wg_f32", ty.f32(), {});
+
+  MakeCallerBodyFunction("frag_main", {"ub_func", "sb_func", "s_func"},
+                         ast::AttributeList{
+                             Stage(ast::PipelineStage::kFragment),
+                         });
+  MakeCallerBodyFunction("comp_main", {"sb_func", "wg_func"},
+                         ast::AttributeList{
+                             Stage(ast::PipelineStage::kCompute),
+                             WorkgroupSize(1),
+                         });
+
+  Inspector& inspector = Build();
+
+  auto& result = inspector.GetReflection();
+  ASSERT_FALSE(inspector.has_error()) << inspector.error();
+  ASSERT_EQ(2u, result.size());
+
+  // The reflection is only built once
+  EXPECT_EQ(&result, &inspector.GetReflection());
+
+  auto& frag = result[0];
+  EXPECT_EQ("frag_main", frag.entry_point.name);
+  EXPECT_EQ(ast::PipelineStage::kFragment, frag.entry_point.stage);
+  ASSERT_EQ(4u, frag.resource_bindings.size());
+  EXPECT_EQ(ResourceBinding::ResourceType::kUniformBuffer,
+            frag.resource_bindings[0].resource_type);
+  EXPECT_EQ(ResourceBinding::ResourceType::kStorageBuffer,
+            frag.resource_bindings[1].resource_type);
+  EXPECT_EQ(ResourceBinding::ResourceType::kSampler,
+            frag.resource_bindings[2].resource_type);
+  EXPECT_EQ(ResourceBinding::ResourceType::kSampledTexture,
+            frag.resource_bindings[3].resource_type);
+  ASSERT_EQ(1u, frag.sampler_texture_uses.size());
+  EXPECT_EQ((sem::BindingPoint{3, 0}),
+            frag.sampler_texture_uses[0].sampler_binding_point);
+  EXPECT_EQ((sem::BindingPoint{2, 0}),
+            frag.sampler_texture_uses[0].texture_binding_point);
+  EXPECT_EQ(0u, frag.workgroup_storage_size);
+
+  auto& comp = result[1];
+  EXPECT_EQ("comp_main", comp.entry_point.name);
+  EXPECT_EQ(ast::PipelineStage::kCompute, comp.entry_point.stage);
+  ASSERT_EQ(1u, comp.resource_bindings.size());
+  EXPECT_EQ(ResourceBinding::ResourceType::kStorageBuffer,
+            comp.resource_bindings[0].resource_type);
+  EXPECT_TRUE(comp.sampler_texture_uses.empty());
+  EXPECT_EQ(4u, comp.workgroup_storage_size);
+
+  for (auto& reflection : result) {
+    auto& name = reflection.entry_point.name;
+    EXPECT_EQ(reflection.storage_size, inspector.GetStorageSize(name));
+    EXPECT_EQ(reflection.workgroup_storage_size,
+              inspector.GetWorkgroupStorageSize(name));
+    EXPECT_EQ(reflection.resource_bindings.size(),
+              inspector.GetResourceBindings(name).size());
+    EXPECT_EQ(reflection.sampler_texture_uses,
+              inspector.GetSamplerTextureUses(name));
+  }
+  ASSERT_FALSE(inspector.has_error()) << inspector.error();
+}
+
 TEST_F(InspectorRegressionTest, tint967) {
   std::string shader = R"(
 @group(0) @binding(1) var mySampler: sampler;
@@ -35,6 +35,7 @@ Program::Program() = default;
 
 Program::Program(Program&& program)
     : id_(std::move(program.id_)),
+      next_ast_node_id_(program.next_ast_node_id_),
       types_(std::move(program.types_)),
       ast_nodes_(std::move(program.ast_nodes_)),
       sem_nodes_(std::move(program.sem_nodes_)),
@@ -49,6 +50,7 @@ Program::Program(Program&& program)
 
 Program::Program(ProgramBuilder&& builder) {
   id_ = builder.ID();
+  next_ast_node_id_ = builder.NextASTNodeID();
 
   is_valid_ = builder.IsValid();
   if (builder.ResolveOnBuild() && builder.IsValid()) {
@@ -83,6 +85,7 @@ Program& Program::operator=(Program&& program) {
   program.moved_ = true;
   moved_ = false;
   id_ = std::move(program.id_);
+  next_ast_node_id_ = program.next_ast_node_id_;
   types_ = std::move(program.types_);
   ast_nodes_ = std::move(program.ast_nodes_);
   sem_nodes_ = std::move(program.sem_nodes_);
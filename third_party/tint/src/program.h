@@ -36,6 +36,9 @@ class Module;
 }  // namespace ast
 
 /// Program holds the AST, Type information and SymbolTable for a tint program.
+/// A Program is immutable, and its `const` methods may be called from several
+/// threads at once, for example to clone and transform the same Program for
+/// several entry points concurrently.
 class Program {
  public:
   /// ASTNodeAllocator is an alias to BlockAllocator<ast::Node>
@@ -66,6 +69,10 @@ class Program {
   /// @returns the unique identifier for this program
   ProgramID ID() const { return id_; }
 
+  /// @returns one past the highest NodeID of the AST nodes owned by this
+  /// program
+  ast::NodeID NextASTNodeID() const { return next_ast_node_id_; }
+
   /// @returns a reference to the program's types
   const sem::Manager& Types() const {
     AssertNotMoved();
@@ -158,6 +165,7 @@ class Program {
   void AssertNotMoved() const;
 
   ProgramID id_;
+  ast::NodeID next_ast_node_id_;
   sem::Manager types_;
   ASTNodeAllocator ast_nodes_;
   SemNodeAllocator sem_nodes_;
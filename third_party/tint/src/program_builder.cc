@@ -28,10 +28,11 @@ ProgramBuilder::VarOptionals::~VarOptionals() = default;
 
 ProgramBuilder::ProgramBuilder()
     : id_(ProgramID::New()),
-      ast_(ast_nodes_.Create<ast::Module>(id_, Source{})) {}
+      ast_(ast_nodes_.Create<ast::Module>(id_, AllocateNodeID(), Source{})) {}
 
 ProgramBuilder::ProgramBuilder(ProgramBuilder&& rhs)
     : id_(std::move(rhs.id_)),
+      next_ast_node_id_(rhs.next_ast_node_id_),
       types_(std::move(rhs.types_)),
       ast_nodes_(std::move(rhs.ast_nodes_)),
       sem_nodes_(std::move(rhs.sem_nodes_)),
@@ -48,6 +49,7 @@ ProgramBuilder& ProgramBuilder::operator=(ProgramBuilder&& rhs) {
   rhs.MarkAsMoved();
   AssertNotMoved();
   id_ = std::move(rhs.id_);
+  next_ast_node_id_ = rhs.next_ast_node_id_;
   types_ = std::move(rhs.types_);
   ast_nodes_ = std::move(rhs.ast_nodes_);
   sem_nodes_ = std::move(rhs.sem_nodes_);
@@ -62,6 +64,7 @@ ProgramBuilder& ProgramBuilder::operator=(ProgramBuilder&& rhs) {
 ProgramBuilder ProgramBuilder::Wrap(const Program* program) {
   ProgramBuilder builder;
   builder.id_ = program->ID();
+  builder.next_ast_node_id_ = program->NextASTNodeID();
   builder.types_ = sem::Manager::Wrap(program->Types());
   builder.ast_ = builder.create<ast::Module>(
       program->AST().source, program->AST().GlobalDeclarations());
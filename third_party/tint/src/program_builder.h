@@ -201,6 +201,17 @@ class ProgramBuilder {
   /// @returns the unique identifier for this program
   ProgramID ID() const { return id_; }
 
+  /// @returns a new unique identifier for an AST node owned by this program.
+  /// NodeIDs are allocated sequentially, so they can be used to densely index
+  /// per-node tables such as sem::Info.
+  ast::NodeID AllocateNodeID() {
+    return ast::NodeID{next_ast_node_id_.value++};
+  }
+
+  /// @returns the NodeID that will be given to the next AST node created by
+  /// this builder
+  ast::NodeID NextASTNodeID() const { return next_ast_node_id_; }
+
   /// @returns a reference to the program's types
   sem::Manager& Types() {
     AssertNotMoved();
@@ -306,7 +317,8 @@ class ProgramBuilder {
   traits::EnableIfIsType<T, ast::Node>* create(const Source& source,
                                                ARGS&&... args) {
     AssertNotMoved();
-    return ast_nodes_.Create<T>(id_, source, std::forward<ARGS>(args)...);
+    return ast_nodes_.Create<T>(id_, AllocateNodeID(), source,
+                                std::forward<ARGS>(args)...);
   }
 
   /// Creates a new ast::Node owned by the ProgramBuilder, injecting the current
@@ -318,7 +330,7 @@ class ProgramBuilder {
   template <typename T>
   traits::EnableIfIsType<T, ast::Node>* create() {
     AssertNotMoved();
-    return ast_nodes_.Create<T>(id_, source_);
+    return ast_nodes_.Create<T>(id_, AllocateNodeID(), source_);
   }
 
   /// Creates a new ast::Node owned by the ProgramBuilder, injecting the current
@@ -336,7 +348,8 @@ class ProgramBuilder {
                    T>*
   create(ARG0&& arg0, ARGS&&... args) {
     AssertNotMoved();
-    return ast_nodes_.Create<T>(id_, source_, std::forward<ARG0>(arg0),
+    return ast_nodes_.Create<T>(id_, AllocateNodeID(), source_,
+                                std::forward<ARG0>(arg0),
                                 std::forward<ARGS>(args)...);
   }
 
@@ -2477,7 +2490,8 @@ class ProgramBuilder {
   /// @returns the disable validation attribute pointer
   const ast::DisableValidationAttribute* Disable(
       ast::DisabledValidation validation) {
-    return ASTNodes().Create<ast::DisableValidationAttribute>(ID(), validation);
+    return ASTNodes().Create<ast::DisableValidationAttribute>(
+        ID(), AllocateNodeID(), validation);
   }
 
   /// Sets the current builder source to `src`
@@ -2567,6 +2581,7 @@ class ProgramBuilder {
 
  private:
   ProgramID id_;
+  ast::NodeID next_ast_node_id_;
   sem::Manager types_;
   ASTNodeAllocator ast_nodes_;
   SemNodeAllocator sem_nodes_;
@@ -15,6 +15,8 @@
 #include "src/program_builder.h"
 
 #include "gtest/gtest.h"
+#include "src/sem/expression.h"
+#include "src/sem/function.h"
 
 namespace tint {
 namespace {
@@ -30,6 +32,54 @@ TEST_F(ProgramBuilderTest, IDsAreUnique) {
   EXPECT_NE(program_c.ID(), program_a.ID());
 }
 
+TEST_F(ProgramBuilderTest, NodeIDsAreSequential) {
+  ProgramBuilder builder;
+  auto* a = builder.Expr(1);
+  auto* b = builder.Expr(2);
+  auto* c = builder.Expr(3);
+  EXPECT_EQ(b->node_id.value, a->node_id.value + 1);
+  EXPECT_EQ(c->node_id.value, b->node_id.value + 1);
+  EXPECT_EQ(builder.NextASTNodeID().value, c->node_id.value + 1);
+}
+
+TEST_F(ProgramBuilderTest, WrapContinuesNodeIDs) {
+  Program inner([] {
+    ProgramBuilder builder;
+    builder.Func("a", {}, builder.ty.void_(), {}, {});
+    return builder;
+  }());
+  ASSERT_TRUE(inner.IsValid());
+
+  ProgramBuilder outer = ProgramBuilder::Wrap(&inner);
+  auto* expr = outer.Expr(1);
+  EXPECT_GE(expr->node_id.value, inner.NextASTNodeID().value);
+
+  auto* func = inner.AST().Functions()[0];
+  EXPECT_NE(outer.Sem().Get(func), nullptr);
+  EXPECT_EQ(outer.Sem().Get(expr), nullptr);
+}
+
+TEST_F(ProgramBuilderTest, SemGetIgnoresNodesOfOtherPrograms) {
+  Program program([] {
+    ProgramBuilder builder;
+    builder.Func("a", {}, builder.ty.void_(), {}, {});
+    return builder;
+  }());
+  ASSERT_TRUE(program.IsValid());
+  auto* func = program.AST().Functions()[0];
+  ASSERT_NE(program.Sem().Get(func), nullptr);
+
+  // NodeIDs are only unique within a program, so a node of another program
+  // with the same NodeID must not resolve to the semantic node of `func`.
+  ProgramBuilder other;
+  const ast::Expression* expr = other.Expr(1);
+  while (expr->node_id.value < func->node_id.value) {
+    expr = other.Expr(1);
+  }
+  ASSERT_EQ(expr->node_id, func->node_id);
+  EXPECT_EQ(program.Sem().Get(expr), nullptr);
+}
+
 TEST_F(ProgramBuilderTest, WrapDoesntAffectInner) {
   Program inner([] {
     ProgramBuilder builder;
@@ -0,0 +1,1267 @@
+// Copyright 2022 The Tint Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "src/program_serialization.h"
+
+#include <cstring>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
+#include "src/program_builder.h"
+
+namespace tint {
+namespace {
+
+/// The first four bytes of all serialized programs: "TAST", little-endian.
+constexpr uint32_t kMagic = 0x54534154;
+
+/// The size of the header that precedes the encoded program: the magic
+/// number, the version, the size of the encoded program, and its checksum.
+constexpr size_t kHeaderSize = 16;
+
+/// The maximum nesting depth of AST nodes that DeserializeProgram() will
+/// accept, which bounds the recursion of the deserializer.
+constexpr uint32_t kMaxDepth = 1024;
+
+/// @returns the 32-bit FNV-1a hash of the `size` bytes at `data`
+uint32_t Checksum(const uint8_t* data, size_t size) {
+  uint32_t hash = 2166136261u;
+  for (size_t i = 0; i < size; i++) {
+    hash = (hash ^ data[i]) * 16777619u;
+  }
+  return hash;
+}
+
+/// EnumRange holds the first and last valid values of the enum ENUM, which
+/// DeserializeProgram() uses to reject out of range values.
+template <typename ENUM>
+struct EnumRange;
+
+#define TINT_ENUM_RANGE(ENUM, FIRST, LAST)   \
+  template <>                               \
+  struct EnumRange<ENUM> {                  \
+    static constexpr ENUM kFirst = (FIRST); \
+    static constexpr ENUM kLast = (LAST);   \
+  }
+
+TINT_ENUM_RANGE(ast::Access, ast::Access::kUndefined, ast::Access::kLastValid);
+TINT_ENUM_RANGE(ast::BinaryOp, ast::BinaryOp::kNone, ast::BinaryOp::kModulo);
+TINT_ENUM_RANGE(ast::Builtin, ast::Builtin::kNone, ast::Builtin::kPointSize);
+TINT_ENUM_RANGE(ast::DisabledValidation,
+                ast::DisabledValidation::kFunctionHasNoBody,
+                ast::DisabledValidation::kIgnoreInvalidPointerArgument);
+TINT_ENUM_RANGE(ast::InterpolationSampling,
+                ast::InterpolationSampling::kNone,
+                ast::InterpolationSampling::kSample);
+TINT_ENUM_RANGE(ast::InterpolationType,
+                ast::InterpolationType::kPerspective,
+                ast::InterpolationType::kFlat);
+TINT_ENUM_RANGE(ast::PipelineStage,
+                ast::PipelineStage::kNone,
+                ast::PipelineStage::kCompute);
+TINT_ENUM_RANGE(ast::SamplerKind,
+                ast::SamplerKind::kSampler,
+                ast::SamplerKind::kComparisonSampler);
+TINT_ENUM_RANGE(ast::StorageClass,
+                ast::StorageClass::kInvalid,
+                ast::StorageClass::kFunction);
+TINT_ENUM_RANGE(ast::TexelFormat,
+                ast::TexelFormat::kNone,
+                ast::TexelFormat::kRgba32Float);
+TINT_ENUM_RANGE(ast::TextureDimension,
+                ast::TextureDimension::kNone,
+                ast::TextureDimension::kCubeArray);
+TINT_ENUM_RANGE(ast::UnaryOp, ast::UnaryOp::kAddressOf, ast::UnaryOp::kNot);
+
+#undef TINT_ENUM_RANGE
+
+/// Tag identifies the type of a serialized AST node.
+/// Tags are part of the binary format: new tags must be appended, and
+/// kProgramSerializationVersion incremented if any tag is changed.
+enum class Tag : uint8_t {
+  kNull,
+  // Global declarations
+  kAlias,
+  kStruct,
+  kFunction,
+  kVariable,
+  // Types
+  kArray,
+  kAtomic,
+  kBool,
+  kDepthMultisampledTexture,
+  kDepthTexture,
+  kExternalTexture,
+  kF32,
+  kI32,
+  kMatrix,
+  kMultisampledTexture,
+  kPointer,
+  kSampledTexture,
+  kSampler,
+  kStorageTexture,
+  kTypeName,
+  kU32,
+  kVector,
+  kVoid,
+  // Expressions
+  kBinaryExpression,
+  kBitcastExpression,
+  kBoolLiteralExpression,
+  kCallExpression,
+  kFloatLiteralExpression,
+  kIdentifierExpression,
+  kIndexAccessorExpression,
+  kMemberAccessorExpression,
+  kPhonyExpression,
+  kSintLiteralExpression,
+  kUintLiteralExpression,
+  kUnaryOpExpression,
+  // Statements
+  kAssignmentStatement,
+  kBlockStatement,
+  kBreakStatement,
+  kCallStatement,
+  kContinueStatement,
+  kDiscardStatement,
+  kFallthroughStatement,
+  kForLoopStatement,
+  kIfStatement,
+  kLoopStatement,
+  kReturnStatement,
+  kSwitchStatement,
+  kVariableDeclStatement,
+  // Attributes
+  kBindingAttribute,
+  kBuiltinAttribute,
+  kDisableValidationAttribute,
+  kGroupAttribute,
+  kInterpolateAttribute,
+  kInvariantAttribute,
+  kLocationAttribute,
+  kOverrideAttribute,
+  kStageAttribute,
+  kStrideAttribute,
+  kStructBlockAttribute,
+  kStructMemberAlignAttribute,
+  kStructMemberOffsetAttribute,
+  kStructMemberSizeAttribute,
+  kWorkgroupAttribute,
+};
+
+/// Serializer encodes a program into a byte stream.
+///
+/// All integers, enums and symbols are encoded as unsigned LEB128. Each node
+/// that may be one of several types, or may be null, is prefixed with its Tag.
+/// Nodes that always have the same type at a given position, such as struct
+/// members, function parameters, case and else statements, are encoded
+/// without a tag.
+class Serializer {
+ public:
+  /// Constructor
+  /// @param program the program to serialize
+  explicit Serializer(const Program* program) : program_(program) {}
+
+  /// Serializes the program
+  /// @returns true on success, false if the program holds a node that cannot
+  /// be serialized.
+  bool Serialize() {
+    // The size and checksum are patched by Finish()
+    Fixed32(kMagic);
+    Fixed32(kProgramSerializationVersion);
+    Fixed32(0);
+    Fixed32(0);
+
+    auto& symbols = program_->Symbols();
+    U32(static_cast<uint32_t>(symbols.Count()));
+    symbols.Foreach([&](Symbol symbol, std::string_view name) {
+      symbol_indices_.emplace(symbol.value(),
+                              static_cast<uint32_t>(symbol_indices_.size()));
+      U32(static_cast<uint32_t>(name.size()));
+      out_.insert(out_.end(), name.begin(), name.end());
+    });
+
+    auto& decls = program_->AST().GlobalDeclarations();
+    U32(static_cast<uint32_t>(decls.size()));
+    for (auto* decl : decls) {
+      bool ok = Switch(
+          decl,  //
+          [&](const ast::Alias* alias) {
+            Write(Tag::kAlias, alias);
+            Sym(alias->name);
+            return Type(alias->type);
+          },
+          [&](const ast::Struct* str) {
+            Write(Tag::kStruct, str);
+            Sym(str->name);
+            U32(static_cast<uint32_t>(str->members.size()));
+            for (auto* member : str->members) {
+              Src(member->source);
+              Sym(member->symbol);
+              if (!Type(member->type) || !Attributes(member->attributes)) {
+                return false;
+              }
+            }
+            return Attributes(str->attributes);
+          },
+          [&](const ast::Function* func) {
+            Write(Tag::kFunction, func);
+            return Function(func);
+          },
+          [&](const ast::Variable* var) {
+            Write(Tag::kVariable, var);
+            return Variable(var);
+          },
+          [&](Default) { return Unsupported(decl); });
+      if (!ok) {
+        return false;
+      }
+    }
+    Finish();
+    return true;
+  }
+
+  /// @returns the serialized program
+  std::vector<uint8_t>& Data() { return out_; }
+
+  /// @returns the serialization error
+  const std::string& Error() const { return error_; }
+
+ private:
+  void Byte(uint8_t value) { out_.push_back(value); }
+
+  /// Writes the size and checksum of the encoded program into the header
+  void Finish() {
+    auto size = out_.size() - kHeaderSize;
+    auto checksum = Checksum(out_.data() + kHeaderSize, size);
+    for (int i = 0; i < 4; i++) {
+      out_[8 + i] = static_cast<uint8_t>(size >> (i * 8));
+      out_[12 + i] = static_cast<uint8_t>(checksum >> (i * 8));
+    }
+  }
+
+  void U32(uint32_t value) {
+    while (value >= 0x80) {
+      Byte(static_cast<uint8_t>(value | 0x80));
+      value >>= 7;
+    }
+    Byte(static_cast<uint8_t>(value));
+  }
+
+  void Fixed32(uint32_t value) {
+    for (int i = 0; i < 4; i++) {
+      Byte(static_cast<uint8_t>(value >> (i * 8)));
+    }
+  }
+
+  template <typename ENUM>
+  void Enum(ENUM value) {
+    U32(static_cast<uint32_t>(value));
+  }
+
+  void Src(const Source& source) {
+    U32(static_cast<uint32_t>(source.range.begin.line));
+    U32(static_cast<uint32_t>(source.range.begin.column));
+    U32(static_cast<uint32_t>(source.range.end.line));
+    U32(static_cast<uint32_t>(source.range.end.column));
+  }
+
+  /// Symbols are encoded as one plus their index in the symbol table. All the
+  /// symbols of a valid program are in its symbol table, so 0 is only written
+  /// for an invalid symbol, which the Deserializer rejects.
+  void Sym(Symbol symbol) {
+    auto it = symbol_indices_.find(symbol.value());
+    U32(it != symbol_indices_.end() ? it->second + 1 : 0);
+  }
+
+  void Write(Tag tag, const ast::Node* node) {
+    Byte(static_cast<uint8_t>(tag));
+    Src(node->source);
+  }
+
+  bool Unsupported(const ast::Node* node) {
+    error_ = "cannot serialize AST node of type " +
+             std::string(node->TypeInfo().name);
+    return false;
+  }
+
+  bool Type(const ast::Type* ty) {
+    if (!ty) {
+      Byte(static_cast<uint8_t>(Tag::kNull));
+      return true;
+    }
+    return Switch(
+        ty,  //
+        [&](const ast::Array* arr) {
+          Write(Tag::kArray, arr);
+          return Type(arr->type) && Expression(arr->count) &&
+                 Attributes(arr->attributes);
+        },
+        [&](const ast::Atomic* atomic) {
+          Write(Tag::kAtomic, atomic);
+          return Type(atomic->type);
+        },
+        [&](const ast::Bool* b) {
+          Write(Tag::kBool, b);
+          return true;
+        },
+        [&](const ast::DepthMultisampledTexture* tex) {
+          Write(Tag::kDepthMultisampledTexture, tex);
+          Enum(tex->dim);
+          return true;
+        },
+        [&](const ast::DepthTexture* tex) {
+          Write(Tag::kDepthTexture, tex);
+          Enum(tex->dim);
+          return true;
+        },
+        [&](const ast::ExternalTexture* tex) {
+          Write(Tag::kExternalTexture, tex);
+          return true;
+        },
+        [&](const ast::F32* f) {
+          Write(Tag::kF32, f);
+          return true;
+        },
+        [&](const ast::I32* i) {
+          Write(Tag::kI32, i);
+          return true;
+        },
+        [&](const ast::Matrix* mat) {
+          Write(Tag::kMatrix, mat);
+          U32(mat->rows);
+          U32(mat->columns);
+          return Type(mat->type);
+        },
+        [&](const ast::MultisampledTexture* tex) {
+          Write(Tag::kMultisampledTexture, tex);
+          Enum(tex->dim);
+          return Type(tex->type);
+        },
+        [&](const ast::Pointer* ptr) {
+          Write(Tag::kPointer, ptr);
+          Enum(ptr->storage_class);
+          Enum(ptr->access);
+          return Type(ptr->type);
+        },
+        [&](const ast::SampledTexture* tex) {
+          Write(Tag::kSampledTexture, tex);
+          Enum(tex->dim);
+          return Type(tex->type);
+        },
+        [&](const ast::Sampler* sampler) {
+          Write(Tag::kSampler, sampler);
+          Enum(sampler->kind);
+          return true;
+        },
+        [&](const ast::StorageTexture* tex) {
+          Write(Tag::kStorageTexture, tex);
+          Enum(tex->dim);
+          Enum(tex->format);
+          Enum(tex->access);
+          return Type(tex->type);
+        },
+        [&](const ast::TypeName* name) {
+          Write(Tag::kTypeName, name);
+          Sym(name->name);
+          return true;
+        },
+        [&](const ast::U32* u) {
+          Write(Tag::kU32, u);
+          return true;
+        },
+        [&](const ast::Vector* vec) {
+          Write(Tag::kVector, vec);
+          U32(vec->width);
+          return Type(vec->type);
+        },
+        [&](const ast::Void* v) {
+          Write(Tag::kVoid, v);
+          return true;
+        },
+        [&](Default) { return Unsupported(ty); });
+  }
+
+  bool Expression(const ast::Expression* expr) {
+    if (!expr) {
+      Byte(static_cast<uint8_t>(Tag::kNull));
+      return true;
+    }
+    return Switch(
+        expr,  //
+        [&](const ast::BinaryExpression* b) {
+          Write(Tag::kBinaryExpression, b);
+          Enum(b->op);
+          return Expression(b->lhs) && Expression(b->rhs);
+        },
+        [&](const ast::BitcastExpression* b) {
+          Write(Tag::kBitcastExpression, b);
+          return Type(b->type) && Expression(b->expr);
+        },
+        [&](const ast::BoolLiteralExpression* l) {
+          Write(Tag::kBoolLiteralExpression, l);
+          Byte(l->value ? 1 : 0);
+          return true;
+        },
+        [&](const ast::CallExpression* call) {
+          Write(Tag::kCallExpression, call);
+          // The target is either an identifier or a type, which the tag
+          // distinguishes.
+          bool ok = call->target.name ? Expression(call->target.name)
+                                      : Type(call->target.type);
+          return ok && Expressions(call->args);
+        },
+        [&](const ast::FloatLiteralExpression* l) {
+          Write(Tag::kFloatLiteralExpression, l);
+          uint32_t bits = 0;
+          std::memcpy(&bits, &l->value, sizeof(bits));
+          Fixed32(bits);
+          return true;
+        },
+        [&](const ast::IdentifierExpression* i) {
+          Write(Tag::kIdentifierExpression, i);
+          Sym(i->symbol);
+          return true;
+        },
+        [&](const ast::IndexAccessorExpression* a) {
+          Write(Tag::kIndexAccessorExpression, a);
+          return Expression(a->object) && Expression(a->index);
+        },
+        [&](const ast::MemberAccessorExpression* m) {
+          Write(Tag::kMemberAccessorExpression, m);
+          return Expression(m->structure) && Expression(m->member);
+        },
+        [&](const ast::PhonyExpression* p) {
+          Write(Tag::kPhonyExpression, p);
+          return true;
+        },
+        [&](const ast::SintLiteralExpression* l) {
+          Write(Tag::kSintLiteralExpression, l);
+          Fixed32(static_cast<uint32_t>(l->value));
+          return true;
+        },
+        [&](const ast::UintLiteralExpression* l) {
+          Write(Tag::kUintLiteralExpression, l);
+          U32(l->value);
+          return true;
+        },
+        [&](const ast::UnaryOpExpression* u) {
+          Write(Tag::kUnaryOpExpression, u);
+          Enum(u->op);
+          return Expression(u->expr);
+        },
+        [&](Default) { return Unsupported(expr); });
+  }
+
+  bool Expressions(const ast::ExpressionList& exprs) {
+    U32(static_cast<uint32_t>(exprs.size()));
+    for (auto* expr : exprs) {
+      if (!Expression(expr)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  bool Statement(const ast::Statement* stmt) {
+    if (!stmt) {
+      Byte(static_cast<uint8_t>(Tag::kNull));
+      return true;
+    }
+    return Switch(
+        stmt,  //
+        [&](const ast::AssignmentStatement* a) {
+          Write(Tag::kAssignmentStatement, a);
+          return Expression(a->lhs) && Expression(a->rhs);
+        },
+        [&](const ast::BlockStatement* b) {
+          Write(Tag::kBlockStatement, b);
+          U32(static_cast<uint32_t>(b->statements.size()));
+          for (auto* s : b->statements) {
+            if (!Statement(s)) {
+              return false;
+            }
+          }
+          return true;
+        },
+        [&](const ast::BreakStatement* b) {
+          Write(Tag::kBreakStatement, b);
+          return true;
+        },
+        [&](const ast::CallStatement* c) {
+          Write(Tag::kCallStatement, c);
+          return Expression(c->expr);
+        },
+        [&](const ast::ContinueStatement* c) {
+          Write(Tag::kContinueStatement, c);
+          return true;
+        },
+        [&](const ast::DiscardStatement* d) {
+          Write(Tag::kDiscardStatement, d);
+          return true;
+        },
+        [&](const ast::FallthroughStatement* f) {
+          Write(Tag::kFallthroughStatement, f);
+          return true;
+        },
+        [&](const ast::ForLoopStatement* l) {
+          Write(Tag::kForLoopStatement, l);
+          return Statement(l->initializer) && Expression(l->condition) &&
+                 Statement(l->continuing) && Statement(l->body);
+        },
+        [&](const ast::IfStatement* i) {
+          Write(Tag::kIfStatement, i);
+          if (!Expression(i->condition) || !Statement(i->body)) {
+            return false;
+          }
+          U32(static_cast<uint32_t>(i->else_statements.size()));
+          for (auto* e : i->else_statements) {
+            Src(e->source);
+            if (!Expression(e->condition) || !Statement(e->body)) {
+              return false;
+            }
+          }
+          return true;
+        },
+        [&](const ast::LoopStatement* l) {
+          Write(Tag::kLoopStatement, l);
+          return Statement(l->body) && Statement(l->continuing);
+        },
+        [&](const ast::ReturnStatement* r) {
+          Write(Tag::kReturnStatement, r);
+          return Expression(r->value);
+        },
+        [&](const ast::SwitchStatement* s) {
+          Write(Tag::kSwitchStatement, s);
+          if (!Expression(s->condition)) {
+            return false;
+          }
+          U32(static_cast<uint32_t>(s->body.size()));
+          for (auto* c : s->body) {
+            Src(c->source);
+            U32(static_cast<uint32_t>(c->selectors.size()));
+            for (auto* selector : c->selectors) {
+              if (!Expression(selector)) {
+                return false;
+              }
+            }
+            if (!Statement(c->body)) {
+              return false;
+            }
+          }
+          return true;
+        },
+        [&](const ast::VariableDeclStatement* v) {
+          Write(Tag::kVariableDeclStatement, v);
+          Src(v->variable->source);
+          return Variable(v->variable);
+        },
+        [&](Default) { return Unsupported(stmt); });
+  }
+
+  bool Attributes(const ast::AttributeList& attrs) {
+    U32(static_cast<uint32_t>(attrs.size()));
+    for (auto* attr : attrs) {
+      bool ok = Switch(
+          attr,  //
+          [&](const ast::BindingAttribute* a) {
+            Write(Tag::kBindingAttribute, a);
+            U32(a->value);
+            return true;
+          },
+          [&](const ast::BuiltinAttribute* a) {
+            Write(Tag::kBuiltinAttribute, a);
+            Enum(a->builtin);
+            return true;
+          },
+          [&](const ast::DisableValidationAttribute* a) {
+            Write(Tag::kDisableValidationAttribute, a);
+            Enum(a->validation);
+            return true;
+          },
+          [&](const ast::GroupAttribute* a) {
+            Write(Tag::kGroupAttribute, a);
+            U32(a->value);
+            return true;
+          },
+          [&](const ast::InterpolateAttribute* a) {
+            Write(Tag::kInterpolateAttribute, a);
+            Enum(a->type);
+            Enum(a->sampling);
+            return true;
+          },
+          [&](const ast::InvariantAttribute* a) {
+            Write(Tag::kInvariantAttribute, a);
+            return true;
+          },
+          [&](const ast::LocationAttribute* a) {
+            Write(Tag::kLocationAttribute, a);
+            U32(a->value);
+            return true;
+          },
+          [&](const ast::OverrideAttribute* a) {
+            Write(Tag::kOverrideAttribute, a);
+            Byte(a->has_value ? 1 : 0);
+            U32(a->value);
+            return true;
+          },
+          [&](const ast::StageAttribute* a) {
+            Write(Tag::kStageAttribute, a);
+            Enum(a->stage);
+            return true;
+          },
+          [&](const ast::StrideAttribute* a) {
+            Write(Tag::kStrideAttribute, a);
+            U32(a->stride);
+            return true;
+          },
+          [&](const ast::StructBlockAttribute* a) {
+            Write(Tag::kStructBlockAttribute, a);
+            return true;
+          },
+          [&](const ast::StructMemberAlignAttribute* a) {
+            Write(Tag::kStructMemberAlignAttribute, a);
+            U32(a->align);
+            return true;
+          },
+          [&](const ast::StructMemberOffsetAttribute* a) {
+            Write(Tag::kStructMemberOffsetAttribute, a);
+            U32(a->offset);
+            return true;
+          },
+          [&](const ast::StructMemberSizeAttribute* a) {
+            Write(Tag::kStructMemberSizeAttribute, a);
+            U32(a->size);
+            return true;
+          },
+          [&](const ast::WorkgroupAttribute* a) {
+            Write(Tag::kWorkgroupAttribute, a);
+            return Expression(a->x) && Expression(a->y) && Expression(a->z);
+          },
+          [&](Default) { return Unsupported(attr); });
+      if (!ok) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /// Writes everything but the source of `var`
+  bool Variable(const ast::Variable* var) {
+    Sym(var->symbol);
+    Enum(var->declared_storage_class);
+    Enum(var->declared_access);
+    Byte(var->is_const ? 1 : 0);
+    return Type(var->type) && Expression(var->constructor) &&
+           Attributes(var->attributes);
+  }
+
+  /// Writes everything but the source of `func`
+  bool Function(const ast::Function* func) {
+    Sym(func->symbol);
+    U32(static_cast<uint32_t>(func->params.size()));
+    for (auto* param : func->params) {
+      Src(param->source);
+      if (!Variable(param)) {
+        return false;
+      }
+    }
+    return Type(func->return_type) && Statement(func->body) &&
+           Attributes(func->attributes) &&
+           Attributes(func->return_type_attributes);
+  }
+
+  const Program* const program_;
+  std::vector<uint8_t> out_;
+  std::unordered_map<uint32_t, uint32_t> symbol_indices_;
+  std::string error_;
+};
+
+/// Deserializer decodes a program encoded by a Serializer.
+///
+/// The checksum in the header is verified before anything is decoded, so a
+/// truncated or corrupted cache entry is rejected up front. Reads are still
+/// bounds checked: on the first error, Deserializer records a diagnostic, and
+/// all subsequent reads return zeros and null nodes, and no more nodes are
+/// created, so that decoding unwinds without further checks.
+class Deserializer {
+ public:
+  /// Constructor
+  /// @param data the serialized program
+  /// @param size the size of `data` in bytes
+  Deserializer(const uint8_t* data, size_t size)
+      : ptr_(data), end_(data + size) {}
+
+  /// Deserializes the program
+  /// @returns the deserialized program
+  Program Deserialize() {
+    if (Fixed32() != kMagic) {
+      Fail("not a serialized program");
+      return Program(std::move(b_));
+    }
+    auto version = Fixed32();
+    if (version != kProgramSerializationVersion) {
+      Fail("unsupported version " + std::to_string(version) + ", expected " +
+           std::to_string(kProgramSerializationVersion));
+      return Program(std::move(b_));
+    }
+    auto size = Fixed32();
+    auto checksum = Fixed32();
+    if (failed_ || size != static_cast<size_t>(end_ - ptr_) ||
+        checksum != Checksum(ptr_, size)) {
+      Fail("checksum mismatch");
+      return Program(std::move(b_));
+    }
+
+    auto num_symbols = Count();
+    symbols_.reserve(num_symbols);
+    for (uint32_t i = 0; i < num_symbols && !failed_; i++) {
+      auto len = Count();
+      if (len == 0) {
+        Fail("empty symbol name");
+        break;
+      }
+      std::string_view name(reinterpret_cast<const char*>(ptr_), len);
+      ptr_ += len;
+      symbols_.emplace_back(b_.Symbols().Register(name));
+    }
+
+    auto num_decls = Count();
+    for (uint32_t i = 0; i < num_decls && !failed_; i++) {
+      const ast::Node* decl = nullptr;
+      auto tag = ReadTag();
+      auto source = Src();
+      switch (tag) {
+        case Tag::kAlias: {
+          auto name = Sym();
+          decl = Create<ast::Alias>(source, name, Type());
+          break;
+        }
+        case Tag::kStruct: {
+          auto name = Sym();
+          ast::StructMemberList members(Count());
+          for (auto& member : members) {
+            auto member_source = Src();
+            auto symbol = Sym();
+            auto* type = Type();
+            member = Create<ast::StructMember>(member_source, symbol, type,
+                                                  Attributes());
+          }
+          decl = Create<ast::Struct>(source, name, std::move(members),
+                                        Attributes());
+          break;
+        }
+        case Tag::kFunction:
+          decl = Function(source);
+          break;
+        case Tag::kVariable:
+          decl = Variable(source);
+          break;
+        default:
+          Fail("expected a global declaration");
+          break;
+      }
+      if (decl) {
+        b_.AST().AddGlobalDeclaration(decl);
+      }
+    }
+
+    if (!failed_ && ptr_ != end_) {
+      Fail("unexpected data after the last global declaration");
+    }
+    return Program(std::move(b_));
+  }
+
+ private:
+  /// DepthGuard counts the nesting depth of the node being read
+  struct DepthGuard {
+    explicit DepthGuard(Deserializer* d) : d_(d) {
+      if (++d_->depth_ > kMaxDepth) {
+        d_->Fail("AST nodes nested too deeply");
+      }
+    }
+    ~DepthGuard() { d_->depth_--; }
+    Deserializer* const d_;
+  };
+
+  /// @returns a new node of type `T`, or nullptr if an error has been raised
+  /// while reading the node's fields
+  template <typename T, typename... ARGS>
+  const T* Create(const Source& source, ARGS&&... args) {
+    if (failed_) {
+      return nullptr;
+    }
+    return b_.create<T>(source, std::forward<ARGS>(args)...);
+  }
+
+  void Fail(const std::string& msg) {
+    if (!failed_) {
+      b_.Diagnostics().add_error(diag::System::Program,
+                                 "invalid serialized program: " + msg);
+      failed_ = true;
+    }
+    ptr_ = end_;
+  }
+
+  uint8_t Byte() {
+    if (ptr_ == end_) {
+      Fail("unexpected end of data");
+      return 0;
+    }
+    return *ptr_++;
+  }
+
+  uint32_t U32() {
+    uint32_t value = 0;
+    for (uint32_t shift = 0; shift < 35; shift += 7) {
+      auto byte = Byte();
+      value |= static_cast<uint32_t>(byte & 0x7f) << shift;
+      if ((byte & 0x80) == 0) {
+        return value;
+      }
+    }
+    Fail("malformed integer");
+    return 0;
+  }
+
+  /// @returns a count of items that follow, which must each be at least one
+  /// byte long
+  uint32_t Count() {
+    auto count = U32();
+    if (count > static_cast<size_t>(end_ - ptr_)) {
+      Fail("unexpected end of data");
+      return 0;
+    }
+    return count;
+  }
+
+  uint32_t Fixed32() {
+    uint32_t value = 0;
+    for (int i = 0; i < 4; i++) {
+      value |= static_cast<uint32_t>(Byte()) << (i * 8);
+    }
+    return value;
+  }
+
+  /// Enums are encoded as their underlying value, so negative values are
+  /// read back as the two's complement of the unsigned integer.
+  template <typename ENUM>
+  ENUM Enum() {
+    using Range = EnumRange<ENUM>;
+    auto value = static_cast<int64_t>(static_cast<int32_t>(U32()));
+    if (value < static_cast<int64_t>(Range::kFirst) ||
+        value > static_cast<int64_t>(Range::kLast)) {
+      Fail("enum value " + std::to_string(value) + " out of range");
+      return Range::kFirst;
+    }
+    return static_cast<ENUM>(value);
+  }
+
+  Source Src() {
+    Source source;
+    source.range.begin.line = U32();
+    source.range.begin.column = U32();
+    source.range.end.line = U32();
+    source.range.end.column = U32();
+    return source;
+  }
+
+  Symbol Sym() {
+    auto index = U32();
+    if (index == 0) {
+      Fail("invalid symbol");
+      return Symbol();
+    }
+    if (index > symbols_.size()) {
+      Fail("symbol out of range");
+      return Symbol();
+    }
+    return symbols_[index - 1];
+  }
+
+  Tag ReadTag() { return static_cast<Tag>(Byte()); }
+
+  const ast::Type* Type() {
+    DepthGuard guard(this);
+    auto tag = ReadTag();
+    if (tag == Tag::kNull || failed_) {
+      return nullptr;
+    }
+    auto source = Src();
+    switch (tag) {
+      case Tag::kArray: {
+        auto* el = Type();
+        auto* count = Expression();
+        return Create<ast::Array>(source, el, count, Attributes());
+      }
+      case Tag::kAtomic:
+        return Create<ast::Atomic>(source, Type());
+      case Tag::kBool:
+        return Create<ast::Bool>(source);
+      case Tag::kDepthMultisampledTexture:
+        return Create<ast::DepthMultisampledTexture>(
+            source, Enum<ast::TextureDimension>());
+      case Tag::kDepthTexture:
+        return Create<ast::DepthTexture>(source,
+                                            Enum<ast::TextureDimension>());
+      case Tag::kExternalTexture:
+        return Create<ast::ExternalTexture>(source);
+      case Tag::kF32:
+        return Create<ast::F32>(source);
+      case Tag::kI32:
+        return Create<ast::I32>(source);
+      case Tag::kMatrix: {
+        auto rows = U32();
+        auto columns = U32();
+        return Create<ast::Matrix>(source, Type(), rows, columns);
+      }
+      case Tag::kMultisampledTexture: {
+        auto dim = Enum<ast::TextureDimension>();
+        return Create<ast::MultisampledTexture>(source, dim, Type());
+      }
+      case Tag::kPointer: {
+        auto storage_class = Enum<ast::StorageClass>();
+        auto access = Enum<ast::Access>();
+        return Create<ast::Pointer>(source, Type(), storage_class, access);
+      }
+      case Tag::kSampledTexture: {
+        auto dim = Enum<ast::TextureDimension>();
+        return Create<ast::SampledTexture>(source, dim, Type());
+      }
+      case Tag::kSampler:
+        return Create<ast::Sampler>(source, Enum<ast::SamplerKind>());
+      case Tag::kStorageTexture: {
+        auto dim = Enum<ast::TextureDimension>();
+        auto format = Enum<ast::TexelFormat>();
+        auto access = Enum<ast::Access>();
+        return Create<ast::StorageTexture>(source, dim, format, Type(),
+                                              access);
+      }
+      case Tag::kTypeName:
+        return Create<ast::TypeName>(source, Sym());
+      case Tag::kU32:
+        return Create<ast::U32>(source);
+      case Tag::kVector: {
+        auto width = U32();
+        return Create<ast::Vector>(source, Type(), width);
+      }
+      case Tag::kVoid:
+        return Create<ast::Void>(source);
+      default:
+        Fail("expected a type");
+        return nullptr;
+    }
+  }
+
+  const ast::Expression* Expression() {
+    DepthGuard guard(this);
+    auto tag = ReadTag();
+    if (tag == Tag::kNull || failed_) {
+      return nullptr;
+    }
+    auto source = Src();
+    switch (tag) {
+      case Tag::kBinaryExpression: {
+        auto op = Enum<ast::BinaryOp>();
+        auto* lhs = Expression();
+        auto* rhs = Expression();
+        return Create<ast::BinaryExpression>(source, op, lhs, rhs);
+      }
+      case Tag::kBitcastExpression: {
+        auto* type = Type();
+        return Create<ast::BitcastExpression>(source, type, Expression());
+      }
+      case Tag::kBoolLiteralExpression:
+        return Create<ast::BoolLiteralExpression>(source, Byte() != 0);
+      case Tag::kCallExpression: {
+        if (ptr_ != end_ && static_cast<Tag>(*ptr_) ==
+                                Tag::kIdentifierExpression) {
+          auto* name = As<ast::IdentifierExpression>(Expression());
+          return Create<ast::CallExpression>(source, name, Expressions());
+        }
+        auto* type = Type();
+        if (!type) {
+          Fail("expected a call target");
+          return nullptr;
+        }
+        return Create<ast::CallExpression>(source, type, Expressions());
+      }
+      case Tag::kFloatLiteralExpression: {
+        auto bits = Fixed32();
+        float value = 0;
+        std::memcpy(&value, &bits, sizeof(value));
+        return Create<ast::FloatLiteralExpression>(source, value);
+      }
+      case Tag::kIdentifierExpression:
+        return Create<ast::IdentifierExpression>(source, Sym());
+      case Tag::kIndexAccessorExpression: {
+        auto* object = Expression();
+        auto* index = Expression();
+        return Create<ast::IndexAccessorExpression>(source, object, index);
+      }
+      case Tag::kMemberAccessorExpression: {
+        auto* structure = Expression();
+        auto* member = As<ast::IdentifierExpression>(Expression());
+        return Create<ast::MemberAccessorExpression>(source, structure,
+                                                        member);
+      }
+      case Tag::kPhonyExpression:
+        return Create<ast::PhonyExpression>(source);
+      case Tag::kSintLiteralExpression:
+        return Create<ast::SintLiteralExpression>(
+            source, static_cast<int32_t>(Fixed32()));
+      case Tag::kUintLiteralExpression:
+        return Create<ast::UintLiteralExpression>(source, U32());
+      case Tag::kUnaryOpExpression: {
+        auto op = Enum<ast::UnaryOp>();
+        return Create<ast::UnaryOpExpression>(source, op, Expression());
+      }
+      default:
+        Fail("expected an expression");
+        return nullptr;
+    }
+  }
+
+  ast::ExpressionList Expressions() {
+    ast::ExpressionList exprs(Count());
+    for (auto& expr : exprs) {
+      expr = Expression();
+    }
+    return exprs;
+  }
+
+  /// @returns `node` cast to `T`, or nullptr after raising an error if `node`
+  /// is not null and not a `T`.
+  template <typename T>
+  const T* As(const ast::Node* node) {
+    if (node && !node->Is<T>()) {
+      Fail("unexpected " + std::string(node->TypeInfo().name));
+      return nullptr;
+    }
+    return static_cast<const T*>(node);
+  }
+
+  const ast::Statement* Statement() {
+    DepthGuard guard(this);
+    auto tag = ReadTag();
+    if (tag == Tag::kNull || failed_) {
+      return nullptr;
+    }
+    auto source = Src();
+    switch (tag) {
+      case Tag::kAssignmentStatement: {
+        auto* lhs = Expression();
+        auto* rhs = Expression();
+        return Create<ast::AssignmentStatement>(source, lhs, rhs);
+      }
+      case Tag::kBlockStatement: {
+        ast::StatementList stmts(Count());
+        for (auto& stmt : stmts) {
+          stmt = Statement();
+        }
+        return Create<ast::BlockStatement>(source, std::move(stmts));
+      }
+      case Tag::kBreakStatement:
+        return Create<ast::BreakStatement>(source);
+      case Tag::kCallStatement:
+        return Create<ast::CallStatement>(
+            source, As<ast::CallExpression>(Expression()));
+      case Tag::kContinueStatement:
+        return Create<ast::ContinueStatement>(source);
+      case Tag::kDiscardStatement:
+        return Create<ast::DiscardStatement>(source);
+      case Tag::kFallthroughStatement:
+        return Create<ast::FallthroughStatement>(source);
+      case Tag::kForLoopStatement: {
+        auto* initializer = Statement();
+        auto* condition = Expression();
+        auto* continuing = Statement();
+        auto* body = Block();
+        return Create<ast::ForLoopStatement>(source, initializer, condition,
+                                                continuing, body);
+      }
+      case Tag::kIfStatement: {
+        auto* condition = Expression();
+        auto* body = Block();
+        ast::ElseStatementList else_stmts(Count());
+        for (auto& else_stmt : else_stmts) {
+          auto else_source = Src();
+          auto* else_condition = Expression();
+          else_stmt = Create<ast::ElseStatement>(else_source, else_condition,
+                                                    Block());
+        }
+        return Create<ast::IfStatement>(source, condition, body,
+                                           std::move(else_stmts));
+      }
+      case Tag::kLoopStatement: {
+        auto* body = Block();
+        return Create<ast::LoopStatement>(source, body, Block());
+      }
+      case Tag::kReturnStatement:
+        return Create<ast::ReturnStatement>(source, Expression());
+      case Tag::kSwitchStatement: {
+        auto* condition = Expression();
+        ast::CaseStatementList cases(Count());
+        for (auto& c : cases) {
+          auto case_source = Src();
+          ast::CaseSelectorList selectors(Count());
+          for (auto& selector : selectors) {
+            selector = As<ast::IntLiteralExpression>(Expression());
+          }
+          c = Create<ast::CaseStatement>(case_source, std::move(selectors),
+                                            Block());
+        }
+        return Create<ast::SwitchStatement>(source, condition,
+                                               std::move(cases));
+      }
+      case Tag::kVariableDeclStatement:
+        return Create<ast::VariableDeclStatement>(source, Variable(Src()));
+      default:
+        Fail("expected a statement");
+        return nullptr;
+    }
+  }
+
+  const ast::BlockStatement* Block() {
+    return As<ast::BlockStatement>(Statement());
+  }
+
+  ast::AttributeList Attributes() {
+    ast::AttributeList attrs(Count());
+    for (auto& attr : attrs) {
+      attr = Attribute();
+    }
+    return attrs;
+  }
+
+  const ast::Attribute* Attribute() {
+    auto tag = ReadTag();
+    if (failed_) {
+      return nullptr;
+    }
+    auto source = Src();
+    switch (tag) {
+      case Tag::kBindingAttribute:
+        return Create<ast::BindingAttribute>(source, U32());
+      case Tag::kBuiltinAttribute:
+        return Create<ast::BuiltinAttribute>(source, Enum<ast::Builtin>());
+      case Tag::kDisableValidationAttribute: {
+        auto validation = Enum<ast::DisabledValidation>();
+        return failed_ ? nullptr : b_.Disable(validation);
+      }
+      case Tag::kGroupAttribute:
+        return Create<ast::GroupAttribute>(source, U32());
+      case Tag::kInterpolateAttribute: {
+        auto type = Enum<ast::InterpolationType>();
+        auto sampling = Enum<ast::InterpolationSampling>();
+        return Create<ast::InterpolateAttribute>(source, type, sampling);
+      }
+      case Tag::kInvariantAttribute:
+        return Create<ast::InvariantAttribute>(source);
+      case Tag::kLocationAttribute:
+        return Create<ast::LocationAttribute>(source, U32());
+      case Tag::kOverrideAttribute: {
+        auto has_value = Byte() != 0;
+        auto value = U32();
+        return has_value ? Create<ast::OverrideAttribute>(source, value)
+                         : Create<ast::OverrideAttribute>(source);
+      }
+      case Tag::kStageAttribute:
+        return Create<ast::StageAttribute>(source,
+                                              Enum<ast::PipelineStage>());
+      case Tag::kStrideAttribute:
+        return Create<ast::StrideAttribute>(source, U32());
+      case Tag::kStructBlockAttribute:
+        return Create<ast::StructBlockAttribute>(source);
+      case Tag::kStructMemberAlignAttribute:
+        return Create<ast::StructMemberAlignAttribute>(source, U32());
+      case Tag::kStructMemberOffsetAttribute:
+        return Create<ast::StructMemberOffsetAttribute>(source, U32());
+      case Tag::kStructMemberSizeAttribute:
+        return Create<ast::StructMemberSizeAttribute>(source, U32());
+      case Tag::kWorkgroupAttribute: {
+        auto* x = Expression();
+        auto* y = Expression();
+        auto* z = Expression();
+        return Create<ast::WorkgroupAttribute>(source, x, y, z);
+      }
+      default:
+        Fail("expected an attribute");
+        return nullptr;
+    }
+  }
+
+  const ast::Variable* Variable(const Source& source) {
+    auto symbol = Sym();
+    auto storage_class = Enum<ast::StorageClass>();
+    auto access = Enum<ast::Access>();
+    auto is_const = Byte() != 0;
+    auto* type = Type();
+    auto* constructor = Expression();
+    return Create<ast::Variable>(source, symbol, storage_class, access,
+                                    type, is_const, constructor, Attributes());
+  }
+
+  const ast::Function* Function(const Source& source) {
+    auto symbol = Sym();
+    ast::VariableList params(Count());
+    for (auto& param : params) {
+      param = Variable(Src());
+    }
+    auto* return_type = Type();
+    auto* body = Block();
+    auto attributes = Attributes();
+    auto return_type_attributes = Attributes();
+    return Create<ast::Function>(source, symbol, std::move(params),
+                                    return_type, body, std::move(attributes),
+                                    std::move(return_type_attributes));
+  }
+
+  ProgramBuilder b_;
+  const uint8_t* ptr_;
+  const uint8_t* const end_;
+  std::vector<Symbol> symbols_;
+  uint32_t depth_ = 0;
+  bool failed_ = false;
+};
+
+}  // namespace
+
+SerializedProgram::SerializedProgram() = default;
+SerializedProgram::~SerializedProgram() = default;
+SerializedProgram::SerializedProgram(const SerializedProgram&) = default;
+
+SerializedProgram SerializeProgram(const Program* program) {
+  SerializedProgram result;
+  if (!program->IsValid()) {
+    result.error = "input program is not valid";
+    return result;
+  }
+
+  Serializer serializer(program);
+  result.success = serializer.Serialize();
+  result.error = serializer.Error();
+  if (result.success) {
+    result.data = std::move(serializer.Data());
+  }
+  return result;
+}
+
+Program DeserializeProgram(const uint8_t* data, size_t size) {
+  return Deserializer(data, size).Deserialize();
+}
+
+}  // namespace tint
@@ -0,0 +1,85 @@
+// Copyright 2022 The Tint Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef SRC_PROGRAM_SERIALIZATION_H_
+#define SRC_PROGRAM_SERIALIZATION_H_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "src/program.h"
+
+namespace tint {
+
+/// The version of the binary format written by SerializeProgram().
+/// DeserializeProgram() rejects data written with any other version, so this
+/// must be incremented whenever the encoding of any AST node changes.
+constexpr uint32_t kProgramSerializationVersion = 1;
+
+/// The result produced when serializing a program.
+struct SerializedProgram {
+  /// Constructor
+  SerializedProgram();
+
+  /// Destructor
+  ~SerializedProgram();
+
+  /// Copy constructor
+  SerializedProgram(const SerializedProgram&);
+
+  /// True if the program was serialized successfully.
+  bool success = false;
+
+  /// The errors generated during serialization, if any.
+  std::string error;
+
+  /// The serialized program.
+  std::vector<uint8_t> data;
+};
+
+/// SerializeProgram encodes the symbols and AST of `program` into a compact,
+/// versioned binary form that can be loaded back with DeserializeProgram()
+/// without reparsing the source.
+///
+/// The encoding is a flat little-endian byte stream with no pointers or
+/// alignment requirements, so it can be stored in a cache and later loaded
+/// directly from a memory mapped file.
+///
+/// Source locations are preserved, but not the source files, so diagnostics
+/// raised for a deserialized program do not include source snippets.
+/// Programs holding transform-internal attributes, other than
+/// ast::DisableValidationAttribute, cannot be serialized.
+/// @param program the valid program to serialize
+/// @returns the serialized program, or an error
+SerializedProgram SerializeProgram(const Program* program);
+
+/// DeserializeProgram rebuilds the program encoded in `data` by
+/// SerializeProgram().
+///
+/// The AST and symbols are read directly from `data`, which is not retained
+/// after the call. The semantic information is rebuilt by resolving the
+/// loaded AST, so the returned program is equivalent to the one that was
+/// serialized.
+/// @param data the serialized program
+/// @param size the size of `data` in bytes
+/// @returns the deserialized program. If `data` is truncated, corrupt or was
+/// written with a different kProgramSerializationVersion, the returned
+/// program is invalid and its diagnostics describe the error.
+Program DeserializeProgram(const uint8_t* data, size_t size);
+
+}  // namespace tint
+
+#endif  // SRC_PROGRAM_SERIALIZATION_H_
@@ -0,0 +1,76 @@
+// Copyright 2022 The Tint Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <string>
+
+#include "src/bench/benchmark.h"
+#include "src/program_serialization.h"
+
+namespace tint {
+namespace {
+
+// Compare with ParseWGSL in reader/wgsl/parser_bench.cc, which produces the
+// same resolved program from the WGSL source.
+void Deserialize(benchmark::State& state, std::string input_name) {
+  auto res = bench::LoadProgram(input_name);
+  if (auto err = std::get_if<bench::Error>(&res)) {
+    state.SkipWithError(err->msg.c_str());
+    return;
+  }
+  auto& program = std::get<bench::ProgramAndFile>(res).program;
+  auto serialized = SerializeProgram(&program);
+  if (!serialized.success) {
+    state.SkipWithError(serialized.error.c_str());
+    return;
+  }
+  auto allocations = bench::AllocationCount();
+  bench::ResetPeakAllocatedBytes();
+  for (auto _ : state) {
+    auto loaded =
+        DeserializeProgram(serialized.data.data(), serialized.data.size());
+    if (!loaded.IsValid()) {
+      state.SkipWithError(loaded.Diagnostics().str().c_str());
+    }
+  }
+  allocations = bench::AllocationCount() - allocations;
+  bench::ReportCounters(state, serialized.data.size(), allocations);
+}
+
+void Serialize(benchmark::State& state, std::string input_name) {
+  auto res = bench::LoadProgram(input_name);
+  if (auto err = std::get_if<bench::Error>(&res)) {
+    state.SkipWithError(err->msg.c_str());
+    return;
+  }
+  auto& program = std::get<bench::ProgramAndFile>(res).program;
+  size_t output_size = 0;
+  auto allocations = bench::AllocationCount();
+  bench::ResetPeakAllocatedBytes();
+  for (auto _ : state) {
+    auto serialized = SerializeProgram(&program);
+    if (!serialized.success) {
+      state.SkipWithError(serialized.error.c_str());
+    }
+    output_size = serialized.data.size();
+  }
+  allocations = bench::AllocationCount() - allocations;
+  bench::ReportCounters(state, output_size, allocations);
+}
+
+TINT_BENCHMARK_WGSL_PROGRAMS(Deserialize);
+TINT_BENCHMARK_WGSL_PROGRAMS(Serialize);
+
+}  // namespace
+}  // namespace tint
@@ -0,0 +1,320 @@
+// Copyright 2022 The Tint Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "src/program_serialization.h"
+
+#include "gtest/gtest.h"
+#include "src/program_builder.h"
+#include "src/reader/wgsl/parser.h"
+#include "src/sem/function.h"
+#include "src/writer/wgsl/generator.h"
+
+namespace tint {
+namespace {
+
+constexpr const char* kWGSL = R"(type Arr = array<vec4<f32>, 4u>;
+
+struct S {
+  a : i32;
+  @size(16)
+  b : vec3<u32>;
+  @align(16)
+  c : mat2x3<f32>;
+  d : Arr;
+  e : atomic<u32>;
+  f : array<f32>;
+}
+
+@group(0) @binding(0) var<storage, read_write> sb : S;
+
+@group(0) @binding(1) var t2d : texture_2d<f32>;
+
+@group(0) @binding(2) var tms : texture_multisampled_2d<i32>;
+
+@group(0) @binding(3) var tdepth : texture_depth_cube;
+
+@group(0) @binding(4) var tstorage : texture_storage_2d<rgba8unorm, write>;
+
+@group(0) @binding(5) var text : texture_external;
+
+@group(0) @binding(6) var smp : sampler;
+
+@group(0) @binding(7) var smpc : sampler_comparison;
+
+@override(7) let o : f32 = 1.5;
+
+var<private> p : array<i32, 8>;
+
+var<workgroup> wg : array<vec2<f32>, 64>;
+
+fn helper(p_a : ptr<function, i32>, x : f32) -> f32 {
+  *(p_a) = (*(p_a) + bitcast<i32>(x));
+  return -(x);
+}
+
+@stage(vertex)
+fn vs(@builtin(vertex_index) idx : u32, @location(0) @interpolate(flat) v : vec4<i32>) -> @invariant @builtin(position) vec4<f32> {
+  return vec4<f32>(f32(idx), 0.0, o, 1.0);
+}
+
+@stage(fragment)
+fn fs() -> @location(0) vec4<f32> {
+  var a : i32 = 1;
+  let b = helper(&(a), 2.0);
+  if ((b > 0.0)) {
+    discard;
+  } else if (!(true)) {
+    a = 3;
+  } else {
+    a = ~(a);
+  }
+  _ = textureSample(t2d, smp, vec2<f32>());
+  _ = textureSampleCompare(tdepth, smpc, vec3<f32>(), 0.5);
+  _ = textureLoad(tms, vec2<i32>(), 0);
+  _ = textureLoad(text, vec2<i32>());
+  return vec4<f32>(b);
+}
+
+@stage(compute) @workgroup_size(8, 1, 1)
+fn cs(@builtin(local_invocation_index) idx : u32) {
+  for(var i : i32 = 0; (i < 4); i = (i + 1)) {
+    if ((i == 2)) {
+      continue;
+    }
+    p[i] = (i * 2);
+  }
+  loop {
+    if ((p[0] > 10)) {
+      break;
+    }
+
+    continuing {
+      p[0] = (p[0] + 1);
+    }
+  }
+  switch(p[1]) {
+    case 0, 1: {
+      fallthrough;
+    }
+    case -2: {
+      sb.a = 4;
+    }
+    default: {
+    }
+  }
+  wg[idx] = vec2<f32>(1.0, -0.0025);
+  atomicAdd(&(sb.e), 1u);
+  sb.b = vec3<u32>(arrayLength(&(sb.f)), 4294967295u, 0u);
+  textureStore(tstorage, vec2<i32>(), vec4<f32>());
+}
+)";
+
+std::string WGSL(const Program& program) {
+  auto result = writer::wgsl::Generate(&program, {});
+  EXPECT_TRUE(result.success) << result.error;
+  return result.wgsl;
+}
+
+class ProgramSerializationTest : public testing::Test {
+ protected:
+  Program Parse(const char* wgsl) {
+    file_ = std::make_unique<Source::File>("test.wgsl", wgsl);
+    auto program = reader::wgsl::Parse(file_.get());
+    EXPECT_TRUE(program.IsValid()) << program.Diagnostics().str();
+    return program;
+  }
+
+  std::unique_ptr<Source::File> file_;
+};
+
+TEST_F(ProgramSerializationTest, RoundTrip) {
+  auto program = Parse(kWGSL);
+  ASSERT_TRUE(program.IsValid());
+
+  auto serialized = SerializeProgram(&program);
+  ASSERT_TRUE(serialized.success) << serialized.error;
+  ASSERT_FALSE(serialized.data.empty());
+
+  auto loaded =
+      DeserializeProgram(serialized.data.data(), serialized.data.size());
+  ASSERT_TRUE(loaded.IsValid()) << loaded.Diagnostics().str();
+  EXPECT_EQ(WGSL(program), WGSL(loaded));
+  EXPECT_EQ(kWGSL, WGSL(loaded));
+
+  // The semantic info is rebuilt on load
+  auto* fs = loaded.AST().Functions().Find(loaded.Symbols().Get("fs"));
+  ASSERT_NE(fs, nullptr);
+  ASSERT_NE(loaded.Sem().Get(fs), nullptr);
+  EXPECT_EQ(loaded.Sem().Get(fs)->TransitivelyCalledFunctions().size(), 1u);
+
+  // Source locations are preserved
+  EXPECT_EQ(fs->source.range, program.AST()
+                                  .Functions()
+                                  .Find(program.Symbols().Get("fs"))
+                                  ->source.range);
+
+  // Serializing the loaded program gives the same data
+  auto reserialized = SerializeProgram(&loaded);
+  ASSERT_TRUE(reserialized.success) << reserialized.error;
+  EXPECT_EQ(serialized.data, reserialized.data);
+}
+
+TEST_F(ProgramSerializationTest, Symbols) {
+  ProgramBuilder b;
+  b.Symbols().Register("unused");
+  auto sym = b.Symbols().New("f");
+  auto renamed = b.Symbols().New("f");
+  b.Func(sym, {}, b.ty.void_(), {});
+  b.Func(renamed, {}, b.ty.void_(), {},
+         {b.Stage(ast::PipelineStage::kCompute), b.WorkgroupSize(1),
+          b.Disable(ast::DisabledValidation::kFunctionHasNoBody)});
+  Program program(std::move(b));
+  ASSERT_TRUE(program.IsValid()) << program.Diagnostics().str();
+
+  auto serialized = SerializeProgram(&program);
+  ASSERT_TRUE(serialized.success) << serialized.error;
+  auto loaded =
+      DeserializeProgram(serialized.data.data(), serialized.data.size());
+  ASSERT_TRUE(loaded.IsValid()) << loaded.Diagnostics().str();
+
+  EXPECT_EQ(loaded.Symbols().Count(), program.Symbols().Count());
+  EXPECT_TRUE(loaded.Symbols().Get("unused").IsValid());
+  auto& funcs = loaded.AST().Functions();
+  ASSERT_EQ(funcs.size(), 2u);
+  EXPECT_EQ(loaded.Symbols().NameFor(funcs[0]->symbol), "f");
+  EXPECT_EQ(loaded.Symbols().NameFor(funcs[1]->symbol),
+            program.Symbols().NameFor(renamed));
+  EXPECT_TRUE(ast::HasAttribute<ast::DisableValidationAttribute>(
+      funcs[1]->attributes));
+}
+
+TEST_F(ProgramSerializationTest, InvalidProgram) {
+  ProgramBuilder b;
+  b.Diagnostics().add_error(diag::System::Program, "error");
+  Program program(std::move(b));
+
+  auto serialized = SerializeProgram(&program);
+  EXPECT_FALSE(serialized.success);
+  EXPECT_EQ(serialized.error, "input program is not valid");
+}
+
+TEST_F(ProgramSerializationTest, Empty) {
+  auto loaded = DeserializeProgram(nullptr, 0);
+  EXPECT_FALSE(loaded.IsValid());
+  EXPECT_EQ(loaded.Diagnostics().str(),
+            "error: invalid serialized program: unexpected end of data");
+}
+
+TEST_F(ProgramSerializationTest, BadMagic) {
+  auto program = Parse(kWGSL);
+  auto serialized = SerializeProgram(&program);
+  ASSERT_TRUE(serialized.success) << serialized.error;
+
+  serialized.data[0] = 'X';
+  auto loaded =
+      DeserializeProgram(serialized.data.data(), serialized.data.size());
+  EXPECT_FALSE(loaded.IsValid());
+  EXPECT_EQ(loaded.Diagnostics().str(),
+            "error: invalid serialized program: not a serialized program");
+}
+
+TEST_F(ProgramSerializationTest, BadVersion) {
+  auto program = Parse(kWGSL);
+  auto serialized = SerializeProgram(&program);
+  ASSERT_TRUE(serialized.success) << serialized.error;
+
+  serialized.data[4]++;
+  auto loaded =
+      DeserializeProgram(serialized.data.data(), serialized.data.size());
+  EXPECT_FALSE(loaded.IsValid());
+  EXPECT_EQ(loaded.Diagnostics().str(),
+            "error: invalid serialized program: unsupported version " +
+                std::to_string(kProgramSerializationVersion + 1) +
+                ", expected " + std::to_string(kProgramSerializationVersion) +
+                "");
+}
+
+TEST_F(ProgramSerializationTest, Truncated) {
+  auto program = Parse(kWGSL);
+  auto serialized = SerializeProgram(&program);
+  ASSERT_TRUE(serialized.success) << serialized.error;
+
+  for (size_t size : {size_t{10}, size_t{16}, serialized.data.size() / 2,
+                      serialized.data.size() - 1}) {
+    auto loaded = DeserializeProgram(serialized.data.data(), size);
+    EXPECT_FALSE(loaded.IsValid());
+    EXPECT_FALSE(loaded.Diagnostics().str().empty());
+  }
+}
+
+TEST_F(ProgramSerializationTest, Corrupted) {
+  auto program = Parse(kWGSL);
+  auto serialized = SerializeProgram(&program);
+  ASSERT_TRUE(serialized.success) << serialized.error;
+
+  serialized.data[serialized.data.size() / 2] ^= 0x40;
+  auto loaded =
+      DeserializeProgram(serialized.data.data(), serialized.data.size());
+  EXPECT_FALSE(loaded.IsValid());
+  EXPECT_EQ(loaded.Diagnostics().str(),
+            "error: invalid serialized program: checksum mismatch");
+}
+
+/// @returns `payload` prefixed with the header written by SerializeProgram()
+std::vector<uint8_t> WithHeader(const std::vector<uint8_t>& payload) {
+  uint32_t checksum = 2166136261u;
+  for (auto byte : payload) {
+    checksum = (checksum ^ byte) * 16777619u;
+  }
+  std::vector<uint8_t> data;
+  for (uint32_t word : {0x54534154u, kProgramSerializationVersion,
+                        static_cast<uint32_t>(payload.size()), checksum}) {
+    for (int i = 0; i < 4; i++) {
+      data.push_back(static_cast<uint8_t>(word >> (i * 8)));
+    }
+  }
+  data.insert(data.end(), payload.begin(), payload.end());
+  return data;
+}
+
+TEST_F(ProgramSerializationTest, EmptySymbolName) {
+  // One symbol with an empty name, no declarations.
+  auto data = WithHeader({1, 0, 0});
+  auto loaded = DeserializeProgram(data.data(), data.size());
+  EXPECT_FALSE(loaded.IsValid());
+  EXPECT_EQ(loaded.Diagnostics().str(),
+            "error: invalid serialized program: empty symbol name");
+}
+
+TEST_F(ProgramSerializationTest, InvalidSymbol) {
+  // One symbol 'a', then an alias named with the invalid symbol 0.
+  auto data = WithHeader({1, 1, 'a', 1, 1, 0, 0, 0, 0, 0});
+  auto loaded = DeserializeProgram(data.data(), data.size());
+  EXPECT_FALSE(loaded.IsValid());
+  EXPECT_EQ(loaded.Diagnostics().str(),
+            "error: invalid serialized program: invalid symbol");
+}
+
+TEST_F(ProgramSerializationTest, EnumOutOfRange) {
+  // One symbol 'a', then a variable 'a' with storage class 100.
+  auto data = WithHeader({1, 1, 'a', 1, 4, 0, 0, 0, 0, 1, 100});
+  auto loaded = DeserializeProgram(data.data(), data.size());
+  EXPECT_FALSE(loaded.IsValid());
+  EXPECT_EQ(loaded.Diagnostics().str(),
+            "error: invalid serialized program: enum value 100 out of range");
+}
+
+}  // namespace
+}  // namespace tint
@@ -507,7 +507,8 @@ ast::AttributeList ParserImpl::ConvertMemberDecoration(
       return {
           create<ast::StrideAttribute>(Source{}, decoration[1]),
           builder_.ASTNodes().Create<ast::DisableValidationAttribute>(
-              builder_.ID(), ast::DisabledValidation::kIgnoreStrideAttribute),
+              builder_.ID(), builder_.AllocateNodeID(),
+              ast::DisabledValidation::kIgnoreStrideAttribute),
       };
     }
     default:
@@ -57,7 +57,7 @@ std::string ToString(const Program& program, const ast::StatementList& stmts) {
 std::string ToString(const Program& program, const ast::Node* node) {
   writer::wgsl::GeneratorImpl writer(&program);
   if (auto* expr = node->As<ast::Expression>()) {
-    std::stringstream out;
+    utils::StringStream out;
     if (!writer.EmitExpression(out, expr)) {
       return "WGSL writer error: " + writer.error();
     }
@@ -67,7 +67,7 @@ std::string ToString(const Program& program, const ast::Node* node) {
       return "WGSL writer error: " + writer.error();
     }
   } else if (auto* ty = node->As<ast::Type>()) {
-    std::stringstream out;
+    utils::StringStream out;
     if (!writer.EmitType(out, ty)) {
       return "WGSL writer error: " + writer.error();
     }
@@ -27,10 +27,190 @@ namespace reader {
 namespace wgsl {
 namespace {
 
+/// Character classes, used as bit flags in kCharClasses
+enum CharClass : uint8_t {
+  kWhitespace = 1 << 0,
+  kAlpha = 1 << 1,
+  kDigit = 1 << 2,
+  kHexLetter = 1 << 3,
+  kUnderscore = 1 << 4,
+  /// Characters that need to be looked at when skipping a block comment
+  kBlockCommentSpecial = 1 << 5,
+};
+
+/// A table of the CharClass flags of every character. This is equivalent to
+/// the <cctype> functions in the "C" locale, without their per-call overhead.
+struct CharClassTable {
+  uint8_t flags[256] = {};
+};
+
+constexpr CharClassTable BuildCharClassTable() {
+  CharClassTable table;
+  for (int c = 0; c < 256; c++) {
+    uint8_t flags = 0;
+    if (c == ' ' || (c >= '\t' && c <= '\r')) {
+      flags |= kWhitespace;
+    }
+    if ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z')) {
+      flags |= kAlpha;
+    }
+    if ((c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F')) {
+      flags |= kHexLetter;
+    }
+    if (c >= '0' && c <= '9') {
+      flags |= kDigit;
+    }
+    if (c == '_') {
+      flags |= kUnderscore;
+    }
+    if (c == '/' || c == '*' || c == '\n' || c == '\0') {
+      flags |= kBlockCommentSpecial;
+    }
+    table.flags[c] = flags;
+  }
+  return table;
+}
+
+constexpr CharClassTable kCharClasses = BuildCharClassTable();
+
+bool has_class(char c, uint8_t classes) {
+  return (kCharClasses.flags[static_cast<uint8_t>(c)] & classes) != 0;
+}
+
 bool is_whitespace(char c) {
-  return std::isspace(c);
+  return has_class(c, kWhitespace);
+}
+
+/// A WGSL keyword
+struct Keyword {
+  /// The keyword as written in the source
+  std::string_view str;
+  /// The type of the token for the keyword
+  Token::Type type;
+  /// The string of the token, if different from `str`
+  std::string_view token_str = {};
+};
+
+constexpr Keyword kKeywords[] = {
+    {"array", Token::Type::kArray},
+    {"atomic", Token::Type::kAtomic},
+    {"bitcast", Token::Type::kBitcast},
+    {"bool", Token::Type::kBool},
+    {"break", Token::Type::kBreak},
+    {"case", Token::Type::kCase},
+    {"continue", Token::Type::kContinue},
+    {"continuing", Token::Type::kContinuing},
+    {"default", Token::Type::kDefault},
+    {"discard", Token::Type::kDiscard},
+    {"else", Token::Type::kElse},
+    {"elseif", Token::Type::kElseIf},
+    {"f32", Token::Type::kF32},
+    {"fallthrough", Token::Type::kFallthrough},
+    {"false", Token::Type::kFalse},
+    {"fn", Token::Type::kFn},
+    {"for", Token::Type::kFor},
+    {"function", Token::Type::kFunction},
+    {"i32", Token::Type::kI32},
+    {"if", Token::Type::kIf},
+    {"import", Token::Type::kImport},
+    {"let", Token::Type::kLet},
+    {"loop", Token::Type::kLoop},
+    {"mat2x2", Token::Type::kMat2x2},
+    {"mat2x3", Token::Type::kMat2x3},
+    {"mat2x4", Token::Type::kMat2x4},
+    {"mat3x2", Token::Type::kMat3x2},
+    {"mat3x3", Token::Type::kMat3x3},
+    {"mat3x4", Token::Type::kMat3x4},
+    {"mat4x2", Token::Type::kMat4x2},
+    {"mat4x3", Token::Type::kMat4x3},
+    {"mat4x4", Token::Type::kMat4x4},
+    {"private", Token::Type::kPrivate},
+    {"ptr", Token::Type::kPtr},
+    {"return", Token::Type::kReturn},
+    {"sampler", Token::Type::kSampler},
+    {"sampler_comparison", Token::Type::kComparisonSampler},
+    {"storage", Token::Type::kStorage},
+    {"storage_buffer", Token::Type::kStorage, "storage"},
+    {"struct", Token::Type::kStruct},
+    {"switch", Token::Type::kSwitch},
+    {"texture_1d", Token::Type::kTextureSampled1d},
+    {"texture_2d", Token::Type::kTextureSampled2d},
+    {"texture_2d_array", Token::Type::kTextureSampled2dArray},
+    {"texture_3d", Token::Type::kTextureSampled3d},
+    {"texture_cube", Token::Type::kTextureSampledCube},
+    {"texture_cube_array", Token::Type::kTextureSampledCubeArray},
+    {"texture_depth_2d", Token::Type::kTextureDepth2d},
+    {"texture_depth_2d_array", Token::Type::kTextureDepth2dArray},
+    {"texture_depth_cube", Token::Type::kTextureDepthCube},
+    {"texture_depth_cube_array", Token::Type::kTextureDepthCubeArray},
+    {"texture_depth_multisampled_2d", Token::Type::kTextureDepthMultisampled2d},
+    {"texture_external", Token::Type::kTextureExternal},
+    {"texture_multisampled_2d", Token::Type::kTextureMultisampled2d},
+    {"texture_storage_1d", Token::Type::kTextureStorage1d},
+    {"texture_storage_2d", Token::Type::kTextureStorage2d},
+    {"texture_storage_2d_array", Token::Type::kTextureStorage2dArray},
+    {"texture_storage_3d", Token::Type::kTextureStorage3d},
+    {"true", Token::Type::kTrue},
+    {"type", Token::Type::kType},
+    {"u32", Token::Type::kU32},
+    {"uniform", Token::Type::kUniform},
+    {"var", Token::Type::kVar},
+    {"vec2", Token::Type::kVec2},
+    {"vec3", Token::Type::kVec3},
+    {"vec4", Token::Type::kVec4},
+    {"workgroup", Token::Type::kWorkgroup},
+};
+
+constexpr size_t kNumKeywords = sizeof(kKeywords) / sizeof(kKeywords[0]);
+
+/// The seed of keyword_hash(). It was chosen so that no two keywords have the
+/// same hash. If adding a keyword makes the static_assert below fail, search
+/// for another seed.
+constexpr uint32_t kKeywordHashSeed = 577;
+
+/// @returns an 8-bit FNV-1a hash of `str`
+constexpr uint8_t keyword_hash(std::string_view str) {
+  uint32_t hash = kKeywordHashSeed;
+  for (char c : str) {
+    hash = (hash ^ static_cast<uint8_t>(c)) * 16777619u;
+  }
+  return static_cast<uint8_t>(hash >> 24);
+}
+
+/// A perfect hash table of the keywords, indexed by keyword_hash().
+struct KeywordTable {
+  static constexpr uint8_t kEmpty = 0xff;
+  /// The index in kKeywords of the keyword with a given hash, or kEmpty
+  uint8_t slots[256] = {};
+  /// The length of the longest keyword
+  size_t max_length = 0;
+  /// True if two keywords have the same hash
+  bool has_collisions = false;
+};
+
+constexpr KeywordTable BuildKeywordTable() {
+  KeywordTable table;
+  for (auto& slot : table.slots) {
+    slot = KeywordTable::kEmpty;
+  }
+  for (size_t i = 0; i < kNumKeywords; i++) {
+    uint8_t hash = keyword_hash(kKeywords[i].str);
+    if (table.slots[hash] != KeywordTable::kEmpty) {
+      table.has_collisions = true;
+    }
+    table.slots[hash] = static_cast<uint8_t>(i);
+    if (kKeywords[i].str.size() > table.max_length) {
+      table.max_length = kKeywords[i].str.size();
+    }
+  }
+  return table;
 }
 
+constexpr KeywordTable kKeywordTable = BuildKeywordTable();
+static_assert(kNumKeywords < KeywordTable::kEmpty, "too many keywords");
+static_assert(!kKeywordTable.has_collisions,
+              "keyword_hash() is not a perfect hash of the keywords");
+
 uint32_t dec_value(char c) {
   if (c >= '0' && c <= '9') {
     return static_cast<uint32_t>(c - '0');
@@ -65,20 +245,25 @@ Token Lexer::next() {
     return t;
   }
 
-  if (auto t = try_hex_float(); !t.IsUninitialized()) {
-    return t;
-  }
+  // Numeric literals start with a digit, a '-' or a '.', so don't try to lex
+  // one in front of identifiers, keywords and most of the punctuation.
+  char c = file_->content.data[pos_];
+  if (is_digit(c) || c == '-' || c == '.') {
+    if (auto t = try_hex_float(); !t.IsUninitialized()) {
+      return t;
+    }
 
-  if (auto t = try_hex_integer(); !t.IsUninitialized()) {
-    return t;
-  }
+    if (auto t = try_hex_integer(); !t.IsUninitialized()) {
+      return t;
+    }
 
-  if (auto t = try_float(); !t.IsUninitialized()) {
-    return t;
-  }
+    if (auto t = try_float(); !t.IsUninitialized()) {
+      return t;
+    }
 
-  if (auto t = try_integer(); !t.IsUninitialized()) {
-    return t;
+    if (auto t = try_integer(); !t.IsUninitialized()) {
+      return t;
+    }
   }
 
   if (auto t = try_ident(); !t.IsUninitialized()) {
@@ -114,19 +299,19 @@ bool Lexer::is_null() const {
 }
 
 bool Lexer::is_alpha(char ch) const {
-  return std::isalpha(ch);
+  return has_class(ch, kAlpha);
 }
 
 bool Lexer::is_digit(char ch) const {
-  return std::isdigit(ch);
+  return has_class(ch, kDigit);
 }
 
 bool Lexer::is_alphanum_underscore(char ch) const {
-  return is_alpha(ch) || is_digit(ch) || ch == '_';
+  return has_class(ch, kAlpha | kDigit | kUnderscore);
 }
 
 bool Lexer::is_hex(char ch) const {
-  return std::isxdigit(ch);
+  return has_class(ch, kDigit | kHexLetter);
 }
 
 bool Lexer::matches(size_t pos, std::string_view substr) {
@@ -136,10 +321,11 @@ bool Lexer::matches(size_t pos, std::string_view substr) {
 }
 
 Token Lexer::skip_whitespace_and_comments() {
+  const char* data = file_->content.data.data();
   for (;;) {
     auto pos = pos_;
-    while (!is_eof() && is_whitespace(file_->content.data[pos_])) {
-      if (matches(pos_, "\n")) {
+    while (pos_ < len_ && is_whitespace(data[pos_])) {
+      if (data[pos_] == '\n') {
         pos_++;
         location_.line++;
         location_.column = 1;
@@ -168,16 +354,24 @@ Token Lexer::skip_whitespace_and_comments() {
 }
 
 Token Lexer::skip_comment() {
+  const char* data = file_->content.data.data();
+
   if (matches(pos_, "//")) {
     // Line comment: ignore everything until the end of line
-    // or end of input.
-    while (!is_eof() && !matches(pos_, "\n")) {
-      if (is_null()) {
-        return {Token::Type::kError, begin_source(), "null character found"};
-      }
-      pos_++;
-      location_.column++;
+    // or end of input. memchr() scans many characters at a time.
+    const char* start = data + pos_;
+    size_t length = len_ - pos_;
+    if (auto* eol = static_cast<const char*>(memchr(start, '\n', length))) {
+      length = static_cast<size_t>(eol - start);
+    }
+    if (auto* null = static_cast<const char*>(memchr(start, '\0', length))) {
+      auto offset = static_cast<uint32_t>(null - start);
+      pos_ += offset;
+      location_.column += offset;
+      return {Token::Type::kError, begin_source(), "null character found"};
     }
+    pos_ += static_cast<uint32_t>(length);
+    location_.column += static_cast<uint32_t>(length);
     return {};
   }
 
@@ -193,6 +387,17 @@ Token Lexer::skip_comment() {
 
     int depth = 1;
     while (!is_eof() && depth > 0) {
+      // Skip the characters that can't start or end a comment, a line or the
+      // input in one go.
+      auto run_start = pos_;
+      while (pos_ < len_ && !has_class(data[pos_], kBlockCommentSpecial)) {
+        pos_++;
+      }
+      location_.column += pos_ - run_start;
+      if (is_eof()) {
+        break;
+      }
+
       if (matches(pos_, "/*")) {
         // Start of block comment: increase nesting depth.
         pos_ += 2;
@@ -269,8 +474,8 @@ Token Lexer::try_float() {
     // If an 'e' or 'E' was present, then the number part must also be present.
     if (!has_exponent) {
       const auto str = file_->content.data.substr(start, end - start);
-      return {Token::Type::kError, source,
-              "incomplete exponent for floating point literal: " + str};
+      return build_error_token(
+          source, "incomplete exponent for floating point literal: " + str);
     }
   }
 
@@ -299,17 +504,15 @@ Token Lexer::try_float() {
   const auto magnitude = std::fabs(res);
   if (0.0 < magnitude &&
       magnitude < static_cast<double>(std::numeric_limits<float>::min())) {
-    return {Token::Type::kError, source,
-            "f32 (" + str + ") magnitude too small, not representable"};
+    return build_error_token(
+        source, "f32 (" + str + ") magnitude too small, not representable");
   }
   // This handles if the number is really large negative number
   if (res < static_cast<double>(std::numeric_limits<float>::lowest())) {
-    return {Token::Type::kError, source,
-            "f32 (" + str + ") too large (negative)"};
+    return build_error_token(source, "f32 (" + str + ") too large (negative)");
   }
   if (res > static_cast<double>(std::numeric_limits<float>::max())) {
-    return {Token::Type::kError, source,
-            "f32 (" + str + ") too large (positive)"};
+    return build_error_token(source, "f32 (" + str + ") too large (positive)");
   }
 
   return {source, static_cast<float>(res)};
@@ -613,6 +816,12 @@ Token Lexer::try_hex_float() {
   return {source, static_cast<float>(result)};
 }
 
+Token Lexer::build_error_token(const Source& source, std::string message) {
+  error_messages_.emplace_back(std::move(message));
+  return {Token::Type::kError, source,
+          std::string_view(error_messages_.back())};
+}
+
 Token Lexer::build_token_from_int_if_possible(Source source,
                                               size_t start,
                                               size_t end,
@@ -621,9 +830,9 @@ Token Lexer::build_token_from_int_if_possible(Source source,
   if (matches(pos_, "u")) {
     if (static_cast<uint64_t>(res) >
         static_cast<uint64_t>(std::numeric_limits<uint32_t>::max())) {
-      return {Token::Type::kError, source,
-              "u32 (" + file_->content.data.substr(start, end - start) +
-                  ") too large"};
+      return build_error_token(
+          source, "u32 (" + file_->content.data.substr(start, end - start) +
+                      ") too large");
     }
     pos_ += 1;
     location_.column += 1;
@@ -632,14 +841,14 @@ Token Lexer::build_token_from_int_if_possible(Source source,
   }
 
   if (res < static_cast<int64_t>(std::numeric_limits<int32_t>::min())) {
-    return {Token::Type::kError, source,
-            "i32 (" + file_->content.data.substr(start, end - start) +
-                ") too small"};
+    return build_error_token(
+        source, "i32 (" + file_->content.data.substr(start, end - start) +
+                    ") too small");
   }
   if (res > static_cast<int64_t>(std::numeric_limits<int32_t>::max())) {
-    return {Token::Type::kError, source,
-            "i32 (" + file_->content.data.substr(start, end - start) +
-                ") too large"};
+    return build_error_token(
+        source, "i32 (" + file_->content.data.substr(start, end - start) +
+                    ") too large");
   }
   end_source(source);
   return {source, static_cast<int32_t>(res)};
@@ -668,10 +877,10 @@ Token Lexer::try_hex_integer() {
 
     auto digits = end - first;
     if (digits > kMaxDigits) {
-      return {Token::Type::kError, source,
-              "integer literal (" +
-                  file_->content.data.substr(start, end - 1 - start) +
-                  "...) has too many digits"};
+      return build_error_token(
+          source, "integer literal (" +
+                      file_->content.data.substr(start, end - 1 - start) +
+                      "...) has too many digits");
     }
   }
   if (first == end) {
@@ -707,20 +916,20 @@ Token Lexer::try_integer() {
   if (next < len_) {
     if (file_->content.data[first] == '0' &&
         is_digit(file_->content.data[next])) {
-      return {Token::Type::kError, source,
-              "integer literal (" +
-                  file_->content.data.substr(start, end - 1 - start) +
-                  "...) has leading 0s"};
+      return build_error_token(
+          source, "integer literal (" +
+                      file_->content.data.substr(start, end - 1 - start) +
+                      "...) has leading 0s");
     }
   }
 
   while (end < len_ && is_digit(file_->content.data[end])) {
     auto digits = end - first;
     if (digits > kMaxDigits) {
-      return {Token::Type::kError, source,
-              "integer literal (" +
-                  file_->content.data.substr(start, end - 1 - start) +
-                  "...) has too many digits"};
+      return build_error_token(
+          source, "integer literal (" +
+                      file_->content.data.substr(start, end - 1 - start) +
+                      "...) has too many digits");
     }
 
     end++;
@@ -741,11 +950,12 @@ Token Lexer::try_ident() {
 
   auto source = begin_source();
 
+  const char* data = file_->content.data.data();
   auto s = pos_;
-  while (!is_eof() && is_alphanum_underscore(file_->content.data[pos_])) {
+  while (pos_ < len_ && is_alphanum_underscore(data[pos_])) {
     pos_++;
-    location_.column++;
   }
+  location_.column += pos_ - s;
 
   if (file_->content.data[s] == '_') {
     // Check for an underscore on its own (special token), or a
@@ -932,155 +1142,16 @@ Token Lexer::try_punctuation() {
 }
 
 Token Lexer::check_keyword(const Source& source, std::string_view str) {
-  if (str == "array")
-    return {Token::Type::kArray, source, "array"};
-  if (str == "atomic")
-    return {Token::Type::kAtomic, source, "atomic"};
-  if (str == "bitcast")
-    return {Token::Type::kBitcast, source, "bitcast"};
-  if (str == "bool")
-    return {Token::Type::kBool, source, "bool"};
-  if (str == "break")
-    return {Token::Type::kBreak, source, "break"};
-  if (str == "case")
-    return {Token::Type::kCase, source, "case"};
-  if (str == "continue")
-    return {Token::Type::kContinue, source, "continue"};
-  if (str == "continuing")
-    return {Token::Type::kContinuing, source, "continuing"};
-  if (str == "discard")
-    return {Token::Type::kDiscard, source, "discard"};
-  if (str == "default")
-    return {Token::Type::kDefault, source, "default"};
-  if (str == "else")
-    return {Token::Type::kElse, source, "else"};
-  if (str == "elseif")
-    return {Token::Type::kElseIf, source, "elseif"};
-  if (str == "f32")
-    return {Token::Type::kF32, source, "f32"};
-  if (str == "fallthrough")
-    return {Token::Type::kFallthrough, source, "fallthrough"};
-  if (str == "false")
-    return {Token::Type::kFalse, source, "false"};
-  if (str == "fn")
-    return {Token::Type::kFn, source, "fn"};
-  if (str == "for")
-    return {Token::Type::kFor, source, "for"};
-  if (str == "function")
-    return {Token::Type::kFunction, source, "function"};
-  if (str == "i32")
-    return {Token::Type::kI32, source, "i32"};
-  if (str == "if")
-    return {Token::Type::kIf, source, "if"};
-  if (str == "import")
-    return {Token::Type::kImport, source, "import"};
-  if (str == "let")
-    return {Token::Type::kLet, source, "let"};
-  if (str == "loop")
-    return {Token::Type::kLoop, source, "loop"};
-  if (str == "mat2x2")
-    return {Token::Type::kMat2x2, source, "mat2x2"};
-  if (str == "mat2x3")
-    return {Token::Type::kMat2x3, source, "mat2x3"};
-  if (str == "mat2x4")
-    return {Token::Type::kMat2x4, source, "mat2x4"};
-  if (str == "mat3x2")
-    return {Token::Type::kMat3x2, source, "mat3x2"};
-  if (str == "mat3x3")
-    return {Token::Type::kMat3x3, source, "mat3x3"};
-  if (str == "mat3x4")
-    return {Token::Type::kMat3x4, source, "mat3x4"};
-  if (str == "mat4x2")
-    return {Token::Type::kMat4x2, source, "mat4x2"};
-  if (str == "mat4x3")
-    return {Token::Type::kMat4x3, source, "mat4x3"};
-  if (str == "mat4x4")
-    return {Token::Type::kMat4x4, source, "mat4x4"};
-  if (str == "private")
-    return {Token::Type::kPrivate, source, "private"};
-  if (str == "ptr")
-    return {Token::Type::kPtr, source, "ptr"};
-  if (str == "return")
-    return {Token::Type::kReturn, source, "return"};
-  if (str == "sampler")
-    return {Token::Type::kSampler, source, "sampler"};
-  if (str == "sampler_comparison")
-    return {Token::Type::kComparisonSampler, source, "sampler_comparison"};
-  if (str == "storage_buffer" || str == "storage")
-    return {Token::Type::kStorage, source, "storage"};
-  if (str == "struct")
-    return {Token::Type::kStruct, source, "struct"};
-  if (str == "switch")
-    return {Token::Type::kSwitch, source, "switch"};
-  if (str == "texture_1d")
-    return {Token::Type::kTextureSampled1d, source, "texture_1d"};
-  if (str == "texture_2d")
-    return {Token::Type::kTextureSampled2d, source, "texture_2d"};
-  if (str == "texture_2d_array")
-    return {Token::Type::kTextureSampled2dArray, source, "texture_2d_array"};
-  if (str == "texture_3d")
-    return {Token::Type::kTextureSampled3d, source, "texture_3d"};
-  if (str == "texture_cube")
-    return {Token::Type::kTextureSampledCube, source, "texture_cube"};
-  if (str == "texture_cube_array") {
-    return {Token::Type::kTextureSampledCubeArray, source,
-            "texture_cube_array"};
-  }
-  if (str == "texture_depth_2d")
-    return {Token::Type::kTextureDepth2d, source, "texture_depth_2d"};
-  if (str == "texture_depth_2d_array") {
-    return {Token::Type::kTextureDepth2dArray, source,
-            "texture_depth_2d_array"};
-  }
-  if (str == "texture_depth_cube")
-    return {Token::Type::kTextureDepthCube, source, "texture_depth_cube"};
-  if (str == "texture_depth_cube_array") {
-    return {Token::Type::kTextureDepthCubeArray, source,
-            "texture_depth_cube_array"};
-  }
-  if (str == "texture_depth_multisampled_2d") {
-    return {Token::Type::kTextureDepthMultisampled2d, source,
-            "texture_depth_multisampled_2d"};
-  }
-  if (str == "texture_external") {
-    return {Token::Type::kTextureExternal, source, "texture_external"};
-  }
-  if (str == "texture_multisampled_2d") {
-    return {Token::Type::kTextureMultisampled2d, source,
-            "texture_multisampled_2d"};
-  }
-  if (str == "texture_storage_1d") {
-    return {Token::Type::kTextureStorage1d, source, "texture_storage_1d"};
-  }
-  if (str == "texture_storage_2d") {
-    return {Token::Type::kTextureStorage2d, source, "texture_storage_2d"};
-  }
-  if (str == "texture_storage_2d_array") {
-    return {Token::Type::kTextureStorage2dArray, source,
-            "texture_storage_2d_array"};
+  if (str.size() > kKeywordTable.max_length) {
+    return {};
   }
-  if (str == "texture_storage_3d") {
-    return {Token::Type::kTextureStorage3d, source, "texture_storage_3d"};
+  auto slot = kKeywordTable.slots[keyword_hash(str)];
+  if (slot == KeywordTable::kEmpty || kKeywords[slot].str != str) {
+    return {};
   }
-  if (str == "true")
-    return {Token::Type::kTrue, source, "true"};
-  if (str == "type")
-    return {Token::Type::kType, source, "type"};
-  if (str == "u32")
-    return {Token::Type::kU32, source, "u32"};
-  if (str == "uniform")
-    return {Token::Type::kUniform, source, "uniform"};
-  if (str == "var")
-    return {Token::Type::kVar, source, "var"};
-  if (str == "vec2")
-    return {Token::Type::kVec2, source, "vec2"};
-  if (str == "vec3")
-    return {Token::Type::kVec3, source, "vec3"};
-  if (str == "vec4")
-    return {Token::Type::kVec4, source, "vec4"};
-  if (str == "workgroup")
-    return {Token::Type::kWorkgroup, source, "workgroup"};
-  return {};
+  auto& keyword = kKeywords[slot];
+  return {keyword.type, source,
+          keyword.token_str.empty() ? keyword.str : keyword.token_str};
 }
 
 }  // namespace wgsl
@@ -15,6 +15,7 @@
 #ifndef SRC_READER_WGSL_LEXER_H_
 #define SRC_READER_WGSL_LEXER_H_
 
+#include <list>
 #include <string>
 
 #include "src/reader/wgsl/token.h"
@@ -50,6 +51,12 @@ class Lexer {
                                          size_t start,
                                          size_t end,
                                          int32_t base);
+  /// Creates an error token for a message built at runtime. Tokens don't own
+  /// their strings, so the lexer keeps the message alive.
+  /// @param source the source of the error
+  /// @param message the error message
+  /// @returns the error token
+  Token build_error_token(const Source& source, std::string message);
   Token check_keyword(const Source&, std::string_view);
 
   /// The try_* methods have the following in common:
@@ -98,6 +105,9 @@ class Lexer {
   uint32_t pos_ = 0;
   /// The current location within the input
   Source::Location location_;
+  /// The messages of the error tokens created by build_error_token(). A list
+  /// never moves its elements, so the tokens can point into the strings.
+  std::list<std::string> error_messages_;
 };
 
 }  // namespace wgsl
@@ -0,0 +1,47 @@
+// Copyright 2022 The Tint Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <string>
+
+#include "src/bench/benchmark.h"
+#include "src/reader/wgsl/lexer.h"
+
+namespace tint::reader::wgsl {
+namespace {
+
+void LexWGSL(benchmark::State& state, std::string input_name) {
+  auto res = bench::LoadInputFile(input_name);
+  if (auto err = std::get_if<bench::Error>(&res)) {
+    state.SkipWithError(err->msg.c_str());
+    return;
+  }
+  auto& file = std::get<Source::File>(res);
+  for (auto _ : state) {
+    Lexer lexer(&file);
+    for (auto t = lexer.next(); !t.IsEof(); t = lexer.next()) {
+      if (t.IsError()) {
+        state.SkipWithError(t.to_str().c_str());
+        return;
+      }
+    }
+  }
+  // Reported as bytes_per_second
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                          static_cast<int64_t>(file.content.data.size()));
+}
+
+TINT_BENCHMARK_WGSL_PROGRAMS(LexWGSL);
+
+}  // namespace
+}  // namespace tint::reader::wgsl
@@ -154,6 +154,19 @@ TEST_F(LexerTest, Null_InLineComment_IsError) {
   EXPECT_EQ(t.to_str(), "null character found");
 }
 
+TEST_F(LexerTest, Null_AfterLineComment_IsError) {
+  Source::File file("", std::string{'/', '/', ' ', '\n', 0});
+  Lexer l(&file);
+
+  auto t = l.next();
+  EXPECT_TRUE(t.IsError());
+  EXPECT_EQ(t.source().range.begin.line, 2u);
+  EXPECT_EQ(t.source().range.begin.column, 1u);
+  EXPECT_EQ(t.source().range.end.line, 2u);
+  EXPECT_EQ(t.source().range.end.column, 1u);
+  EXPECT_EQ(t.to_str(), "null character found");
+}
+
 TEST_F(LexerTest, Null_InBlockComment_IsError) {
   Source::File file("", std::string{'/', '*', ' ', 0, '*', '/'});
   Lexer l(&file);
@@ -340,7 +353,17 @@ INSTANTIATE_TEST_SUITE_P(LexerTest,
                                          "MiXeD_CaSe",
                                          "abcdefghijklmnopqrstuvwxyz",
                                          "ABCDEFGHIJKLMNOPQRSTUVWXYZ",
-                                         "alldigits_0123456789"));
+                                         "alldigits_0123456789",
+                                         // Not keywords, but close to one
+                                         "arrays",
+                                         "vec",
+                                         "vec5",
+                                         "mat2x5",
+                                         "Struct",
+                                         "storage_",
+                                         "texture_2",
+                                         "texture_storage_4d",
+                                         "texture_depth_multisampled_2d_array"));
 
 TEST_F(LexerTest, IdentifierTest_SingleUnderscoreDoesNotMatch) {
   Source::File file("", "_");
@@ -26,12 +26,24 @@ void ParseWGSL(benchmark::State& state, std::string input_name) {
     return;
   }
   auto& file = std::get<Source::File>(res);
+  auto allocations = bench::AllocationCount();
   for (auto _ : state) {
     auto res = Parse(&file);
     if (res.Diagnostics().contains_errors()) {
       state.SkipWithError(res.Diagnostics().str().c_str());
     }
   }
+  allocations = bench::AllocationCount() - allocations;
+
+  auto bytes = static_cast<int64_t>(state.iterations()) *
+               static_cast<int64_t>(file.content.data.size());
+  state.SetBytesProcessed(bytes);
+  state.counters["allocations"] = benchmark::Counter(
+      static_cast<double>(allocations), benchmark::Counter::kAvgIterations);
+  if (bytes > 0) {
+    state.counters["allocations_per_byte"] =
+        static_cast<double>(allocations) / static_cast<double>(bytes);
+  }
 }
 
 TINT_BENCHMARK_WGSL_PROGRAMS(ParseWGSL);
@@ -292,10 +292,10 @@ void ParserImpl::deprecated(const Source& source, const std::string& msg) {
 }
 
 Token ParserImpl::next() {
-  if (!token_queue_.empty()) {
-    auto t = token_queue_.front();
-    token_queue_.pop_front();
-    last_token_ = t;
+  if (token_buffer_count_ > 0) {
+    last_token_ = token_buffer_[token_buffer_begin_];
+    token_buffer_begin_ = (token_buffer_begin_ + 1) % kTokenBufferSize;
+    token_buffer_count_--;
     return last_token_;
   }
   last_token_ = lexer_->next();
@@ -303,9 +303,21 @@ Token ParserImpl::next() {
 }
 
 Token ParserImpl::peek(size_t idx) {
-  while (token_queue_.size() < (idx + 1))
-    token_queue_.push_back(lexer_->next());
-  return token_queue_[idx];
+  TINT_ASSERT(Reader, idx < kTokenBufferSize);
+  while (token_buffer_count_ <= idx) {
+    auto end = (token_buffer_begin_ + token_buffer_count_) % kTokenBufferSize;
+    token_buffer_[end] = lexer_->next();
+    token_buffer_count_++;
+  }
+  return token_buffer_[(token_buffer_begin_ + idx) % kTokenBufferSize];
+}
+
+void ParserImpl::push_front(const Token& t) {
+  TINT_ASSERT(Reader, token_buffer_count_ < kTokenBufferSize);
+  token_buffer_begin_ =
+      (token_buffer_begin_ + kTokenBufferSize - 1) % kTokenBufferSize;
+  token_buffer_[token_buffer_begin_] = t;
+  token_buffer_count_++;
 }
 
 bool ParserImpl::peek_is(Token::Type tok, size_t idx) {
@@ -3141,9 +3153,9 @@ bool ParserImpl::expect(std::string_view use, Token::Type tok) {
     auto source = t.source();
     source.range.begin.column++;
     if (t.Is(Token::Type::kShiftRight)) {
-      token_queue_.push_front(Token(Token::Type::kGreaterThan, source));
+      push_front(Token(Token::Type::kGreaterThan, source));
     } else if (t.Is(Token::Type::kGreaterThanEqual)) {
-      token_queue_.push_front(Token(Token::Type::kEqual, source));
+      push_front(Token(Token::Type::kEqual, source));
     }
 
     synchronized_ = true;
@@ -3156,7 +3168,7 @@ bool ParserImpl::expect(std::string_view use, Token::Type tok) {
     next();
     auto source = t.source();
     source.range.begin.column++;
-    token_queue_.push_front({Token::Type::kBracketRight, source});
+    push_front({Token::Type::kBracketRight, source});
     synchronized_ = true;
     return true;
   }
@@ -3293,6 +3305,9 @@ T ParserImpl::sync(Token::Type tok, F&& body) {
 }
 
 bool ParserImpl::sync_to(Token::Type tok, bool consume) {
+  static_assert(kMaxResynchronizeLookahead < kTokenBufferSize,
+                "the token buffer is too small for the resynchronization");
+
   // Clear the synchronized state - gets set to true again on success.
   synchronized_ = false;
 
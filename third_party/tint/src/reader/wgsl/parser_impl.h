@@ -15,7 +15,7 @@
 #ifndef SRC_READER_WGSL_PARSER_IMPL_H_
 #define SRC_READER_WGSL_PARSER_IMPL_H_
 
-#include <deque>
+#include <array>
 #include <memory>
 #include <string>
 #include <string_view>
@@ -873,8 +873,21 @@ class ParserImpl {
     return builder_.create<T>(std::forward<ARGS>(args)...);
   }
 
+  /// Pushes `t` to the front of the token buffer, so that it is the next
+  /// token returned by peek() and next().
+  /// @param t the token to push
+  void push_front(const Token& t);
+
+  /// The size of #token_buffer_. Must be larger than the furthest lookahead of
+  /// the parser, which is the one of the resynchronization.
+  static constexpr size_t kTokenBufferSize = 64;
+
   std::unique_ptr<Lexer> lexer_;
-  std::deque<Token> token_queue_;
+  /// A ring buffer of the tokens that were peeked but not consumed yet. They
+  /// start at #token_buffer_begin_, wrapping around.
+  std::array<Token, kTokenBufferSize> token_buffer_;
+  size_t token_buffer_begin_ = 0;
+  size_t token_buffer_count_ = 0;
   Token last_token_;
   bool synchronized_ = true;
   uint32_t parse_depth_ = 0;
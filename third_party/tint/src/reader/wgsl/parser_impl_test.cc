@@ -138,6 +138,31 @@ fn main() -> @location(0) vec4<f32> {
   EXPECT_EQ(p->error(), "5:3: unterminated block comment") << p->error();
 }
 
+// Test that peeked tokens are returned in order while the token buffer wraps
+// around.
+TEST_F(ParserImplTest, PeekAndNext_ManyTokens) {
+  constexpr size_t kNumIdents = 200;
+  constexpr size_t kLookahead = 40;
+
+  std::string src;
+  for (size_t i = 0; i < kNumIdents; i++) {
+    src += "a" + std::to_string(i) + " ";
+  }
+  auto p = parser(src);
+
+  for (size_t i = 0; i < kNumIdents; i++) {
+    for (size_t j = 0; j < kLookahead && i + j < kNumIdents; j++) {
+      EXPECT_EQ(p->peek(j).to_str(), "a" + std::to_string(i + j));
+    }
+    auto t = p->next();
+    ASSERT_TRUE(t.IsIdentifier());
+    EXPECT_EQ(t.to_str(), "a" + std::to_string(i));
+    EXPECT_EQ(p->last_token().to_str(), t.to_str());
+  }
+  EXPECT_TRUE(p->peek().IsEof());
+  EXPECT_TRUE(p->next().IsEof());
+}
+
 }  // namespace
 }  // namespace wgsl
 }  // namespace reader
@@ -14,6 +14,8 @@
 
 #include "src/reader/wgsl/token.h"
 
+#include <type_traits>
+
 namespace tint {
 namespace reader {
 namespace wgsl {
@@ -250,75 +252,64 @@ std::string_view Token::TypeToName(Type type) {
   return "<unknown>";
 }
 
+static_assert(std::is_trivially_copyable_v<Token>,
+              "Tokens are copied on every peek and must stay cheap to copy");
+
 Token::Token() : type_(Type::kUninitialized) {}
 
 Token::Token(Type type, const Source& source, const std::string_view& view)
-    : type_(type), source_(source), value_(view) {}
-
-Token::Token(Type type, const Source& source, const std::string& str)
-    : type_(type), source_(source), value_(str) {}
+    : type_(type), source_(source), str_(view) {}
 
 Token::Token(Type type, const Source& source, const char* str)
-    : type_(type), source_(source), value_(std::string_view(str)) {}
+    : type_(type), source_(source), str_(str) {}
 
 Token::Token(const Source& source, uint32_t val)
-    : type_(Type::kUintLiteral), source_(source), value_(val) {}
+    : type_(Type::kUintLiteral), source_(source) {
+  value_.u32 = val;
+}
 
 Token::Token(const Source& source, int32_t val)
-    : type_(Type::kSintLiteral), source_(source), value_(val) {}
+    : type_(Type::kSintLiteral), source_(source) {
+  value_.i32 = val;
+}
 
 Token::Token(const Source& source, float val)
-    : type_(Type::kFloatLiteral), source_(source), value_(val) {}
+    : type_(Type::kFloatLiteral), source_(source) {
+  value_.f32 = val;
+}
 
 Token::Token(Type type, const Source& source) : type_(type), source_(source) {}
 
-Token::Token(Token&&) = default;
-
-Token::Token(const Token&) = default;
-
-Token::~Token() = default;
-
-Token& Token::operator=(const Token& rhs) = default;
-
 bool Token::operator==(std::string_view ident) {
-  if (type_ != Type::kIdentifier) {
-    return false;
-  }
-  if (auto* view = std::get_if<std::string_view>(&value_)) {
-    return *view == ident;
-  }
-  return std::get<std::string>(value_) == ident;
+  return type_ == Type::kIdentifier && str_ == ident;
 }
 
 std::string Token::to_str() const {
   switch (type_) {
     case Type::kFloatLiteral:
-      return std::to_string(std::get<float>(value_));
+      return std::to_string(value_.f32);
     case Type::kSintLiteral:
-      return std::to_string(std::get<int32_t>(value_));
+      return std::to_string(value_.i32);
     case Type::kUintLiteral:
-      return std::to_string(std::get<uint32_t>(value_));
+      return std::to_string(value_.u32);
     case Type::kIdentifier:
     case Type::kError:
-      if (auto* view = std::get_if<std::string_view>(&value_)) {
-        return std::string(*view);
-      }
-      return std::get<std::string>(value_);
+      return std::string(str_);
     default:
       return "";
   }
 }
 
 float Token::to_f32() const {
-  return std::get<float>(value_);
+  return type_ == Type::kFloatLiteral ? value_.f32 : 0.0f;
 }
 
 uint32_t Token::to_u32() const {
-  return std::get<uint32_t>(value_);
+  return type_ == Type::kUintLiteral ? value_.u32 : 0u;
 }
 
 int32_t Token::to_i32() const {
-  return std::get<int32_t>(value_);
+  return type_ == Type::kSintLiteral ? value_.i32 : 0;
 }
 
 }  // namespace wgsl
@@ -17,7 +17,6 @@
 
 #include <string>
 #include <string_view>
-#include <variant>  // NOLINT: cpplint doesn't recognise this
 
 #include "src/source.h"
 
@@ -25,7 +24,10 @@ namespace tint {
 namespace reader {
 namespace wgsl {
 
-/// Stores tokens generated by the Lexer
+/// Stores tokens generated by the Lexer.
+/// Tokens are trivially copyable and never own memory. The strings of
+/// identifiers point into the source file content, and the strings of errors
+/// point to constant strings or to strings owned by the Lexer.
 class Token {
  public:
   /// The type of the parsed token
@@ -278,11 +280,6 @@ class Token {
   /// @param type the Token::Type of the token
   /// @param source the source of the token
   /// @param str the source string for the token
-  Token(Type type, const Source& source, const std::string& str);
-  /// Create a string Token
-  /// @param type the Token::Type of the token
-  /// @param source the source of the token
-  /// @param str the source string for the token
   Token(Type type, const Source& source, const char* str);
   /// Create a unsigned integer Token
   /// @param source the source of the token
@@ -297,15 +294,15 @@ class Token {
   /// @param val the source float for the token
   Token(const Source& source, float val);
   /// Move constructor
-  Token(Token&&);
+  Token(Token&&) = default;
   /// Copy constructor
-  Token(const Token&);
-  ~Token();
+  Token(const Token&) = default;
+  ~Token() = default;
 
   /// Assignment operator
   /// @param b the token to copy
   /// @return Token
-  Token& operator=(const Token& b);
+  Token& operator=(const Token& b) = default;
 
   /// Equality operator with an identifier
   /// @param ident the identifier string
@@ -392,8 +389,14 @@ class Token {
   Type type_ = Type::kError;
   /// The source where the token appeared
   Source source_;
-  /// The value represented by the token
-  std::variant<int32_t, uint32_t, float, std::string, std::string_view> value_;
+  /// The string of identifier, keyword and error tokens
+  std::string_view str_;
+  /// The value of literal tokens
+  union Value {
+    int32_t i32;
+    uint32_t u32;
+    float f32;
+  } value_ = {};
 };
 
 #ifndef NDEBUG
@@ -99,6 +99,10 @@ bool Resolver::Resolve() {
     return false;
   }
 
+  // Size the semantic table for every AST node up front, avoiding regrowth as
+  // nodes are resolved.
+  builder_->Sem().Reserve(builder_->NextASTNodeID().value);
+
   // Create the semantic module
   builder_->Sem().SetModule(
       builder_->create<sem::Module>(dependencies_.ordered_globals));
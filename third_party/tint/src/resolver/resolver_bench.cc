@@ -0,0 +1,50 @@
+// Copyright 2022 The Tint Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <string>
+#include <utility>
+
+// ProgramBuilder must be included before benchmark.h, as it cannot be included
+// after tint.h.
+#include "src/program_builder.h"
+
+#include "src/bench/benchmark.h"
+
+namespace tint::resolver {
+namespace {
+
+void ResolveWGSL(benchmark::State& state, std::string input_name) {
+  auto res = bench::LoadProgram(input_name);
+  if (auto err = std::get_if<bench::Error>(&res)) {
+    state.SkipWithError(err->msg.c_str());
+    return;
+  }
+  auto& program = std::get<bench::ProgramAndFile>(res).program;
+  for (auto _ : state) {
+    // Cloning produces an unresolved AST, which is resolved by the Program
+    // constructor. Only the resolve is timed.
+    state.PauseTiming();
+    auto builder = program.CloneAsBuilder();
+    state.ResumeTiming();
+    Program resolved(std::move(builder));
+    if (!resolved.IsValid()) {
+      state.SkipWithError(resolved.Diagnostics().str().c_str());
+    }
+  }
+}
+
+TINT_BENCHMARK_WGSL_PROGRAMS(ResolveWGSL);
+
+}  // namespace
+}  // namespace tint::resolver
@@ -17,6 +17,7 @@
 #include <string>
 
 #include "src/debug.h"
+#include "src/utils/hash.h"
 
 TINT_INSTANTIATE_TYPEINFO(tint::sem::Array);
 
@@ -44,6 +45,38 @@ bool Array::IsConstructible() const {
   return constructible_;
 }
 
+size_t Array::Hash() const {
+  return HashOf(element_, count_, align_, size_, stride_, implicit_stride_);
+}
+
+bool Array::Equals(const Type& other) const {
+  if (auto* o = other.As<Array>()) {
+    return o->element_ == element_ && o->count_ == count_ &&
+           o->align_ == align_ && o->size_ == size_ && o->stride_ == stride_;
+  }
+  return false;
+}
+
+size_t Array::HashOf(const Type* element,
+                     uint32_t count,
+                     uint32_t align,
+                     uint32_t size,
+                     uint32_t stride,
+                     uint32_t /* implicit_stride */) {
+  return utils::Hash(TypeInfo::Of<Array>().full_hashcode, element, count,
+                     align, size, stride);
+}
+
+bool Array::Matches(const Type* element,
+                    uint32_t count,
+                    uint32_t align,
+                    uint32_t size,
+                    uint32_t stride,
+                    uint32_t /* implicit_stride */) const {
+  return element_ == element && count_ == count && align_ == align &&
+         size_ == size && stride_ == stride;
+}
+
 std::string Array::type_name() const {
   std::string type_name = "__array" + element_->type_name();
   type_name += "_count_" + std::to_string(count_);
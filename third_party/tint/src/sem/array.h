@@ -89,6 +89,52 @@ class Array : public Castable<Array, Type> {
   /// https://gpuweb.github.io/gpuweb/wgsl/#constructible-types
   bool IsConstructible() const override;
 
+  /// @returns a hash of the type.
+  size_t Hash() const override;
+
+  /// @param other the other type to compare against
+  /// @returns true if the this type is equal to the given type
+  bool Equals(const Type& other) const override;
+
+  /// @param element the array element type
+  /// @param count the number of elements in the array. 0 represents a
+  /// runtime-sized array.
+  /// @param align the byte alignment of the array
+  /// @param size the byte size of the array
+  /// @param stride the number of bytes from the start of one element of the
+  /// array to the start of the next element
+  /// @param implicit_stride the number of bytes from the start of one element
+  /// of the array to the start of the next element, if there was no `@stride`
+  /// attribute applied.
+  /// @returns the Hash() of the type that the constructor would build from
+  /// the same arguments. Used by Manager::Get() to look up types without
+  /// constructing them.
+  static size_t HashOf(const Type* element,
+                       uint32_t count,
+                       uint32_t align,
+                       uint32_t size,
+                       uint32_t stride,
+                       uint32_t implicit_stride);
+
+  /// @param element the array element type
+  /// @param count the number of elements in the array. 0 represents a
+  /// runtime-sized array.
+  /// @param align the byte alignment of the array
+  /// @param size the byte size of the array
+  /// @param stride the number of bytes from the start of one element of the
+  /// array to the start of the next element
+  /// @param implicit_stride the number of bytes from the start of one element
+  /// of the array to the start of the next element, if there was no `@stride`
+  /// attribute applied.
+  /// @returns true if this type is Equals() to the type that the constructor
+  /// would build from the same arguments
+  bool Matches(const Type* element,
+               uint32_t count,
+               uint32_t align,
+               uint32_t size,
+               uint32_t stride,
+               uint32_t implicit_stride) const;
+
   /// @returns the name for the type
   std::string type_name() const override;
 
@@ -16,6 +16,7 @@
 
 #include "src/program_builder.h"
 #include "src/sem/reference_type.h"
+#include "src/utils/hash.h"
 
 TINT_INSTANTIATE_TYPEINFO(tint::sem::Atomic);
 
@@ -26,6 +27,25 @@ Atomic::Atomic(const sem::Type* subtype) : subtype_(subtype) {
   TINT_ASSERT(AST, !subtype->Is<Reference>());
 }
 
+size_t Atomic::Hash() const {
+  return HashOf(subtype_);
+}
+
+bool Atomic::Equals(const sem::Type& other) const {
+  if (auto* o = other.As<Atomic>()) {
+    return o->subtype_ == subtype_;
+  }
+  return false;
+}
+
+size_t Atomic::HashOf(const sem::Type* subtype) {
+  return utils::Hash(TypeInfo::Of<Atomic>().full_hashcode, subtype);
+}
+
+bool Atomic::Matches(const sem::Type* subtype) const {
+  return subtype_ == subtype;
+}
+
 std::string Atomic::type_name() const {
   std::ostringstream out;
   out << "__atomic" << subtype_->type_name();
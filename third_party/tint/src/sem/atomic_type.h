@@ -36,6 +36,24 @@ class Atomic : public Castable<Atomic, Type> {
   /// @returns the atomic type
   const sem::Type* Type() const { return subtype_; }
 
+  /// @returns a hash of the type.
+  size_t Hash() const override;
+
+  /// @param other the other type to compare against
+  /// @returns true if the this type is equal to the given type
+  bool Equals(const sem::Type& other) const override;
+
+  /// @param subtype the atomic type
+  /// @returns the Hash() of the type that the constructor would build from
+  /// the same arguments. Used by Manager::Get() to look up types without
+  /// constructing them.
+  static size_t HashOf(const sem::Type* subtype);
+
+  /// @param subtype the atomic type
+  /// @returns true if this type is Equals() to the type that the constructor
+  /// would build from the same arguments
+  bool Matches(const sem::Type* subtype) const;
+
   /// @returns the name for this type
   std::string type_name() const override;
 
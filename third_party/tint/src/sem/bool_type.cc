@@ -27,6 +27,22 @@ Bool::Bool(Bool&&) = default;
 
 Bool::~Bool() = default;
 
+size_t Bool::Hash() const {
+  return HashOf();
+}
+
+bool Bool::Equals(const Type& other) const {
+  return other.Is<Bool>();
+}
+
+size_t Bool::HashOf() {
+  return static_cast<size_t>(TypeInfo::Of<Bool>().full_hashcode);
+}
+
+bool Bool::Matches() const {
+  return true;
+}
+
 std::string Bool::type_name() const {
   return "__bool";
 }
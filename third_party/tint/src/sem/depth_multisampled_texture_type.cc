@@ -15,6 +15,7 @@
 #include "src/sem/depth_multisampled_texture_type.h"
 
 #include "src/program_builder.h"
+#include "src/utils/hash.h"
 
 TINT_INSTANTIATE_TYPEINFO(tint::sem::DepthMultisampledTexture);
 
@@ -38,6 +39,26 @@ DepthMultisampledTexture::DepthMultisampledTexture(DepthMultisampledTexture&&) =
 
 DepthMultisampledTexture::~DepthMultisampledTexture() = default;
 
+size_t DepthMultisampledTexture::Hash() const {
+  return HashOf(dim());
+}
+
+bool DepthMultisampledTexture::Equals(const Type& other) const {
+  if (auto* o = other.As<DepthMultisampledTexture>()) {
+    return o->dim() == dim();
+  }
+  return false;
+}
+
+size_t DepthMultisampledTexture::HashOf(ast::TextureDimension dim) {
+  return utils::Hash(TypeInfo::Of<DepthMultisampledTexture>().full_hashcode,
+                     dim);
+}
+
+bool DepthMultisampledTexture::Matches(ast::TextureDimension dim) const {
+  return this->dim() == dim;
+}
+
 std::string DepthMultisampledTexture::type_name() const {
   std::ostringstream out;
   out << "__depth_multisampled_texture_" << dim();
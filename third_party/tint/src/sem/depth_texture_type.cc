@@ -15,6 +15,7 @@
 #include "src/sem/depth_texture_type.h"
 
 #include "src/program_builder.h"
+#include "src/utils/hash.h"
 
 TINT_INSTANTIATE_TYPEINFO(tint::sem::DepthTexture);
 
@@ -39,6 +40,25 @@ DepthTexture::DepthTexture(DepthTexture&&) = default;
 
 DepthTexture::~DepthTexture() = default;
 
+size_t DepthTexture::Hash() const {
+  return HashOf(dim());
+}
+
+bool DepthTexture::Equals(const Type& other) const {
+  if (auto* o = other.As<DepthTexture>()) {
+    return o->dim() == dim();
+  }
+  return false;
+}
+
+size_t DepthTexture::HashOf(ast::TextureDimension dim) {
+  return utils::Hash(TypeInfo::Of<DepthTexture>().full_hashcode, dim);
+}
+
+bool DepthTexture::Matches(ast::TextureDimension dim) const {
+  return this->dim() == dim;
+}
+
 std::string DepthTexture::type_name() const {
   std::ostringstream out;
   out << "__depth_texture_" << dim();
@@ -32,6 +32,24 @@ class DepthTexture : public Castable<DepthTexture, Texture> {
   DepthTexture(DepthTexture&&);
   ~DepthTexture() override;
 
+  /// @returns a hash of the type.
+  size_t Hash() const override;
+
+  /// @param other the other type to compare against
+  /// @returns true if the this type is equal to the given type
+  bool Equals(const Type& other) const override;
+
+  /// @param dim the dimensionality of the texture
+  /// @returns the Hash() of the type that the constructor would build from
+  /// the same arguments. Used by Manager::Get() to look up types without
+  /// constructing them.
+  static size_t HashOf(ast::TextureDimension dim);
+
+  /// @param dim the dimensionality of the texture
+  /// @returns true if this type is Equals() to the type that the constructor
+  /// would build from the same arguments
+  bool Matches(ast::TextureDimension dim) const;
+
   /// @returns the name for this type
   std::string type_name() const override;
 
@@ -27,6 +27,22 @@ ExternalTexture::ExternalTexture(ExternalTexture&&) = default;
 
 ExternalTexture::~ExternalTexture() = default;
 
+size_t ExternalTexture::Hash() const {
+  return HashOf();
+}
+
+bool ExternalTexture::Equals(const Type& other) const {
+  return other.Is<ExternalTexture>();
+}
+
+size_t ExternalTexture::HashOf() {
+  return static_cast<size_t>(TypeInfo::Of<ExternalTexture>().full_hashcode);
+}
+
+bool ExternalTexture::Matches() const {
+  return true;
+}
+
 std::string ExternalTexture::type_name() const {
   return "__external_texture";
 }
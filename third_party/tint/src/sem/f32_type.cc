@@ -27,6 +27,22 @@ F32::F32(F32&&) = default;
 
 F32::~F32() = default;
 
+size_t F32::Hash() const {
+  return HashOf();
+}
+
+bool F32::Equals(const Type& other) const {
+  return other.Is<F32>();
+}
+
+size_t F32::HashOf() {
+  return static_cast<size_t>(TypeInfo::Of<F32>().full_hashcode);
+}
+
+bool F32::Matches() const {
+  return true;
+}
+
 std::string F32::type_name() const {
   return "__f32";
 }
@@ -27,6 +27,22 @@ I32::I32(I32&&) = default;
 
 I32::~I32() = default;
 
+size_t I32::Hash() const {
+  return HashOf();
+}
+
+bool I32::Equals(const Type& other) const {
+  return other.Is<I32>();
+}
+
+size_t I32::HashOf() {
+  return static_cast<size_t>(TypeInfo::Of<I32>().full_hashcode);
+}
+
+bool I32::Matches() const {
+  return true;
+}
+
 std::string I32::type_name() const {
   return "__i32";
 }
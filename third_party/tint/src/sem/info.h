@@ -16,7 +16,7 @@
 #define SRC_SEM_INFO_H_
 
 #include <type_traits>
-#include <unordered_map>
+#include <vector>
 
 #include "src/debug.h"
 #include "src/sem/node.h"
@@ -59,14 +59,23 @@ class Info {
   /// @param node the AST or type node
   /// @returns a pointer to the semantic node if found, otherwise nullptr
   template <typename SEM = InferFromAST,
-            typename AST_OR_TYPE = CastableBase,
+            typename AST_OR_TYPE = ast::Node,
             typename RESULT = GetResultType<SEM, AST_OR_TYPE>>
   const RESULT* Get(const AST_OR_TYPE* node) const {
-    auto it = map_.find(node);
-    if (it == map_.end()) {
+    if (!node) {
       return nullptr;
     }
-    return As<RESULT>(it->second);
+    auto id = node->node_id.value;
+    if (id >= nodes_.size()) {
+      return nullptr;
+    }
+    // NodeIDs are only unique within a program, so check the entry actually
+    // belongs to `node`.
+    auto& entry = nodes_[id];
+    if (entry.ast != node) {
+      return nullptr;
+    }
+    return As<RESULT>(entry.sem);
   }
 
   /// Add registers the semantic node `sem_node` for the AST or type node
@@ -78,9 +87,18 @@ class Info {
            const SemanticNodeTypeFor<AST_OR_TYPE>* sem_node) {
     // Check there's no semantic info already existing for the node
     TINT_ASSERT(Semantic, Get(node) == nullptr);
-    map_.emplace(node, sem_node);
+    auto id = node->node_id.value;
+    if (id >= nodes_.size()) {
+      nodes_.resize(id + 1);
+    }
+    nodes_[id] = Entry{node, sem_node};
   }
 
+  /// Reserve allocates space in the table for `count` AST nodes, so that Add()
+  /// does not need to grow the table while resolving.
+  /// @param count the number of AST nodes
+  void Reserve(size_t count) { nodes_.reserve(count); }
+
   /// Wrap returns a new Info created with the contents of `inner`.
   /// The Info returned by Wrap is intended to temporarily extend the contents
   /// of an existing immutable Info.
@@ -90,7 +108,7 @@ class Info {
   /// @return the Info that wraps `inner`
   static Info Wrap(const Info& inner) {
     Info out;
-    out.map_ = inner.map_;
+    out.nodes_ = inner.nodes_;
     out.module_ = inner.module_;
     return out;
   }
@@ -103,9 +121,17 @@ class Info {
   const sem::Module* Module() const { return module_; }
 
  private:
-  // TODO(crbug.com/tint/724): Once finished, this map should be:
-  // std::unordered_map<const ast::Node*, const sem::Node*>
-  std::unordered_map<const CastableBase*, const CastableBase*> map_;
+  /// An entry in the node table
+  struct Entry {
+    /// The AST node that owns this entry
+    const ast::Node* ast = nullptr;
+    // TODO(crbug.com/tint/724): Once finished, this should be a sem::Node.
+    /// The semantic node for `ast`
+    const CastableBase* sem = nullptr;
+  };
+
+  // The semantic nodes, indexed by ast::Node::node_id
+  std::vector<Entry> nodes_;
   // The semantic module
   sem::Module* module_ = nullptr;
 };
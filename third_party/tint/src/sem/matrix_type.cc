@@ -16,6 +16,7 @@
 
 #include "src/program_builder.h"
 #include "src/sem/vector_type.h"
+#include "src/utils/hash.h"
 
 TINT_INSTANTIATE_TYPEINFO(tint::sem::Matrix);
 
@@ -37,6 +38,27 @@ Matrix::Matrix(Matrix&&) = default;
 
 Matrix::~Matrix() = default;
 
+size_t Matrix::Hash() const {
+  return HashOf(column_type_, columns_);
+}
+
+bool Matrix::Equals(const Type& other) const {
+  if (auto* o = other.As<Matrix>()) {
+    return o->rows_ == rows_ && o->columns_ == columns_ &&
+           o->subtype_ == subtype_;
+  }
+  return false;
+}
+
+size_t Matrix::HashOf(const Vector* column_type, uint32_t columns) {
+  return utils::Hash(TypeInfo::Of<Matrix>().full_hashcode,
+                     column_type->Width(), columns, column_type->type());
+}
+
+bool Matrix::Matches(const Vector* column_type, uint32_t columns) const {
+  return column_type_ == column_type && columns_ == columns;
+}
+
 std::string Matrix::type_name() const {
   return "__mat_" + std::to_string(rows_) + "_" + std::to_string(columns_) +
          subtype_->type_name();
@@ -46,6 +46,26 @@ class Matrix : public Castable<Matrix, Type> {
   /// @returns the column-vector type of the matrix
   const Vector* ColumnType() const { return column_type_; }
 
+  /// @returns a hash of the type.
+  size_t Hash() const override;
+
+  /// @param other the other type to compare against
+  /// @returns true if the this type is equal to the given type
+  bool Equals(const Type& other) const override;
+
+  /// @param column_type the type of a column of the matrix
+  /// @param columns the number of columns in the matrix
+  /// @returns the Hash() of the type that the constructor would build from
+  /// the same arguments. Used by Manager::Get() to look up types without
+  /// constructing them.
+  static size_t HashOf(const Vector* column_type, uint32_t columns);
+
+  /// @param column_type the type of a column of the matrix
+  /// @param columns the number of columns in the matrix
+  /// @returns true if this type is Equals() to the type that the constructor
+  /// would build from the same arguments
+  bool Matches(const Vector* column_type, uint32_t columns) const;
+
   /// @returns the name for this type
   std::string type_name() const override;
 
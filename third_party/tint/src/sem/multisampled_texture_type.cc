@@ -15,6 +15,7 @@
 #include "src/sem/multisampled_texture_type.h"
 
 #include "src/program_builder.h"
+#include "src/utils/hash.h"
 
 TINT_INSTANTIATE_TYPEINFO(tint::sem::MultisampledTexture);
 
@@ -31,6 +32,28 @@ MultisampledTexture::MultisampledTexture(MultisampledTexture&&) = default;
 
 MultisampledTexture::~MultisampledTexture() = default;
 
+size_t MultisampledTexture::Hash() const {
+  return HashOf(dim(), type_);
+}
+
+bool MultisampledTexture::Equals(const Type& other) const {
+  if (auto* o = other.As<MultisampledTexture>()) {
+    return o->dim() == dim() && o->type_ == type_;
+  }
+  return false;
+}
+
+size_t MultisampledTexture::HashOf(ast::TextureDimension dim,
+                                   const Type* type) {
+  return utils::Hash(TypeInfo::Of<MultisampledTexture>().full_hashcode, dim,
+                     type);
+}
+
+bool MultisampledTexture::Matches(ast::TextureDimension dim,
+                                  const Type* type) const {
+  return this->dim() == dim && type_ == type;
+}
+
 std::string MultisampledTexture::type_name() const {
   std::ostringstream out;
   out << "__multisampled_texture_" << dim() << type_->type_name();
@@ -16,6 +16,7 @@
 
 #include "src/program_builder.h"
 #include "src/sem/reference_type.h"
+#include "src/utils/hash.h"
 
 TINT_INSTANTIATE_TYPEINFO(tint::sem::Pointer);
 
@@ -30,6 +31,32 @@ Pointer::Pointer(const Type* subtype,
   TINT_ASSERT(Semantic, access != ast::Access::kUndefined);
 }
 
+size_t Pointer::Hash() const {
+  return HashOf(subtype_, storage_class_, access_);
+}
+
+bool Pointer::Equals(const Type& other) const {
+  if (auto* o = other.As<Pointer>()) {
+    return o->storage_class_ == storage_class_ && o->subtype_ == subtype_ &&
+           o->access_ == access_;
+  }
+  return false;
+}
+
+size_t Pointer::HashOf(const Type* subtype,
+                       ast::StorageClass storage_class,
+                       ast::Access access) {
+  return utils::Hash(TypeInfo::Of<Pointer>().full_hashcode, storage_class,
+                     subtype, access);
+}
+
+bool Pointer::Matches(const Type* subtype,
+                      ast::StorageClass storage_class,
+                      ast::Access access) const {
+  return subtype_ == subtype && storage_class_ == storage_class &&
+         access_ == access;
+}
+
 std::string Pointer::type_name() const {
   std::ostringstream out;
   out << "__ptr_" << storage_class_ << subtype_->type_name() << "__" << access_;
@@ -15,6 +15,7 @@
 #include "src/sem/reference_type.h"
 
 #include "src/program_builder.h"
+#include "src/utils/hash.h"
 
 TINT_INSTANTIATE_TYPEINFO(tint::sem::Reference);
 
@@ -29,6 +30,32 @@ Reference::Reference(const Type* subtype,
   TINT_ASSERT(Semantic, access != ast::Access::kUndefined);
 }
 
+size_t Reference::Hash() const {
+  return HashOf(subtype_, storage_class_, access_);
+}
+
+bool Reference::Equals(const Type& other) const {
+  if (auto* o = other.As<Reference>()) {
+    return o->storage_class_ == storage_class_ && o->subtype_ == subtype_ &&
+           o->access_ == access_;
+  }
+  return false;
+}
+
+size_t Reference::HashOf(const Type* subtype,
+                         ast::StorageClass storage_class,
+                         ast::Access access) {
+  return utils::Hash(TypeInfo::Of<Reference>().full_hashcode, storage_class,
+                     subtype, access);
+}
+
+bool Reference::Matches(const Type* subtype,
+                        ast::StorageClass storage_class,
+                        ast::Access access) const {
+  return subtype_ == subtype && storage_class_ == storage_class &&
+         access_ == access;
+}
+
 std::string Reference::type_name() const {
   std::ostringstream out;
   out << "__ref_" << storage_class_ << subtype_->type_name() << "__" << access_;
@@ -48,6 +48,32 @@ class Reference : public Castable<Reference, Type> {
   /// @returns the resolved access control of the reference.
   ast::Access Access() const { return access_; }
 
+  /// @returns a hash of the type.
+  size_t Hash() const override;
+
+  /// @param other the other type to compare against
+  /// @returns true if the this type is equal to the given type
+  bool Equals(const Type& other) const override;
+
+  /// @param subtype the pointee type
+  /// @param storage_class the storage class of the reference
+  /// @param access the resolved access control of the reference
+  /// @returns the Hash() of the type that the constructor would build from
+  /// the same arguments. Used by Manager::Get() to look up types without
+  /// constructing them.
+  static size_t HashOf(const Type* subtype,
+                       ast::StorageClass storage_class,
+                       ast::Access access);
+
+  /// @param subtype the pointee type
+  /// @param storage_class the storage class of the reference
+  /// @param access the resolved access control of the reference
+  /// @returns true if this type is Equals() to the type that the constructor
+  /// would build from the same arguments
+  bool Matches(const Type* subtype,
+               ast::StorageClass storage_class,
+               ast::Access access) const;
+
   /// @returns the name for this type
   std::string type_name() const override;
 
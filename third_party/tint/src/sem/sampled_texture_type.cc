@@ -15,6 +15,7 @@
 #include "src/sem/sampled_texture_type.h"
 
 #include "src/program_builder.h"
+#include "src/utils/hash.h"
 
 TINT_INSTANTIATE_TYPEINFO(tint::sem::SampledTexture);
 
@@ -30,6 +31,26 @@ SampledTexture::SampledTexture(SampledTexture&&) = default;
 
 SampledTexture::~SampledTexture() = default;
 
+size_t SampledTexture::Hash() const {
+  return HashOf(dim(), type_);
+}
+
+bool SampledTexture::Equals(const Type& other) const {
+  if (auto* o = other.As<SampledTexture>()) {
+    return o->dim() == dim() && o->type_ == type_;
+  }
+  return false;
+}
+
+size_t SampledTexture::HashOf(ast::TextureDimension dim, const Type* type) {
+  return utils::Hash(TypeInfo::Of<SampledTexture>().full_hashcode, dim, type);
+}
+
+bool SampledTexture::Matches(ast::TextureDimension dim,
+                             const Type* type) const {
+  return this->dim() == dim && type_ == type;
+}
+
 std::string SampledTexture::type_name() const {
   std::ostringstream out;
   out << "__sampled_texture_" << dim() << type_->type_name();
@@ -15,6 +15,7 @@
 #include "src/sem/sampler_type.h"
 
 #include "src/program_builder.h"
+#include "src/utils/hash.h"
 
 TINT_INSTANTIATE_TYPEINFO(tint::sem::Sampler);
 
@@ -27,6 +28,25 @@ Sampler::Sampler(Sampler&&) = default;
 
 Sampler::~Sampler() = default;
 
+size_t Sampler::Hash() const {
+  return HashOf(kind_);
+}
+
+bool Sampler::Equals(const Type& other) const {
+  if (auto* o = other.As<Sampler>()) {
+    return o->kind_ == kind_;
+  }
+  return false;
+}
+
+size_t Sampler::HashOf(ast::SamplerKind kind) {
+  return utils::Hash(TypeInfo::Of<Sampler>().full_hashcode, kind);
+}
+
+bool Sampler::Matches(ast::SamplerKind kind) const {
+  return kind_ == kind;
+}
+
 std::string Sampler::type_name() const {
   return std::string("__sampler_") +
          (kind_ == ast::SamplerKind::kSampler ? "sampler" : "comparison");
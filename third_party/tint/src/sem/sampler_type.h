@@ -41,6 +41,24 @@ class Sampler : public Castable<Sampler, Type> {
     return kind_ == ast::SamplerKind::kComparisonSampler;
   }
 
+  /// @returns a hash of the type.
+  size_t Hash() const override;
+
+  /// @param other the other type to compare against
+  /// @returns true if the this type is equal to the given type
+  bool Equals(const Type& other) const override;
+
+  /// @param kind the kind of sampler
+  /// @returns the Hash() of the type that the constructor would build from
+  /// the same arguments. Used by Manager::Get() to look up types without
+  /// constructing them.
+  static size_t HashOf(ast::SamplerKind kind);
+
+  /// @param kind the kind of sampler
+  /// @returns true if this type is Equals() to the type that the constructor
+  /// would build from the same arguments
+  bool Matches(ast::SamplerKind kind) const;
+
   /// @returns the name for this type
   std::string type_name() const override;
 
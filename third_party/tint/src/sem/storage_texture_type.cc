@@ -15,6 +15,7 @@
 #include "src/sem/storage_texture_type.h"
 
 #include "src/program_builder.h"
+#include "src/utils/hash.h"
 
 TINT_INSTANTIATE_TYPEINFO(tint::sem::StorageTexture);
 
@@ -31,6 +32,34 @@ StorageTexture::StorageTexture(StorageTexture&&) = default;
 
 StorageTexture::~StorageTexture() = default;
 
+size_t StorageTexture::Hash() const {
+  return HashOf(dim(), texel_format_, access_, subtype_);
+}
+
+bool StorageTexture::Equals(const Type& other) const {
+  if (auto* o = other.As<StorageTexture>()) {
+    return o->dim() == dim() && o->texel_format_ == texel_format_ &&
+           o->access_ == access_;
+  }
+  return false;
+}
+
+size_t StorageTexture::HashOf(ast::TextureDimension dim,
+                              ast::TexelFormat format,
+                              ast::Access access,
+                              const sem::Type* /* subtype */) {
+  return utils::Hash(TypeInfo::Of<StorageTexture>().full_hashcode, dim, format,
+                     access);
+}
+
+bool StorageTexture::Matches(ast::TextureDimension dim,
+                             ast::TexelFormat format,
+                             ast::Access access,
+                             const sem::Type* /* subtype */) const {
+  return this->dim() == dim && texel_format_ == format &&
+         access_ == access;
+}
+
 std::string StorageTexture::type_name() const {
   std::ostringstream out;
   out << "__storage_texture_" << dim() << "_" << texel_format_ << "_"
@@ -52,6 +52,36 @@ class StorageTexture : public Castable<StorageTexture, Texture> {
   /// @returns the access control
   ast::Access access() const { return access_; }
 
+  /// @returns a hash of the type.
+  size_t Hash() const override;
+
+  /// @param other the other type to compare against
+  /// @returns true if the this type is equal to the given type
+  bool Equals(const Type& other) const override;
+
+  /// @param dim the dimensionality of the texture
+  /// @param format the texel format of the texture
+  /// @param access the access control type of the texture
+  /// @param subtype the storage subtype. Use SubtypeFor() to calculate this.
+  /// @returns the Hash() of the type that the constructor would build from
+  /// the same arguments. Used by Manager::Get() to look up types without
+  /// constructing them.
+  static size_t HashOf(ast::TextureDimension dim,
+                       ast::TexelFormat format,
+                       ast::Access access,
+                       const sem::Type* subtype);
+
+  /// @param dim the dimensionality of the texture
+  /// @param format the texel format of the texture
+  /// @param access the access control type of the texture
+  /// @param subtype the storage subtype. Use SubtypeFor() to calculate this.
+  /// @returns true if this type is Equals() to the type that the constructor
+  /// would build from the same arguments
+  bool Matches(ast::TextureDimension dim,
+               ast::TexelFormat format,
+               ast::Access access,
+               const sem::Type* subtype) const;
+
   /// @returns the name for this type
   std::string type_name() const override;
 
@@ -21,6 +21,7 @@
 
 #include "src/ast/struct_member.h"
 #include "src/symbol_table.h"
+#include "src/utils/hash.h"
 
 TINT_INSTANTIATE_TYPEINFO(tint::sem::Struct);
 TINT_INSTANTIATE_TYPEINFO(tint::sem::StructMember);
@@ -60,6 +61,36 @@ const StructMember* Struct::FindMember(Symbol name) const {
   return nullptr;
 }
 
+size_t Struct::Hash() const {
+  return HashOf(declaration_, name_, members_, align_, size_,
+                size_no_padding_);
+}
+
+bool Struct::Equals(const Type& other) const {
+  if (auto* o = other.As<Struct>()) {
+    return o->name_ == name_;
+  }
+  return false;
+}
+
+size_t Struct::HashOf(const ast::Struct* /* declaration */,
+                      Symbol name,
+                      const StructMemberList& /* members */,
+                      uint32_t /* align */,
+                      uint32_t /* size */,
+                      uint32_t /* size_no_padding */) {
+  return utils::Hash(TypeInfo::Of<Struct>().full_hashcode, name);
+}
+
+bool Struct::Matches(const ast::Struct* /* declaration */,
+                     Symbol name,
+                     const StructMemberList& /* members */,
+                     uint32_t /* align */,
+                     uint32_t /* size */,
+                     uint32_t /* size_no_padding */) const {
+  return name_ == name;
+}
+
 std::string Struct::type_name() const {
   return "__struct_" + name_.to_str();
 }
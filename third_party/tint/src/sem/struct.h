@@ -142,6 +142,46 @@ class Struct : public Castable<Struct, Type> {
     return pipeline_stage_uses_;
   }
 
+  /// @returns a hash of the type.
+  size_t Hash() const override;
+
+  /// @param other the other type to compare against
+  /// @returns true if the this type is equal to the given type
+  bool Equals(const Type& other) const override;
+
+  /// @param declaration the AST structure declaration
+  /// @param name the name of the structure
+  /// @param members the structure members
+  /// @param align the byte alignment of the structure
+  /// @param size the byte size of the structure
+  /// @param size_no_padding size of the members without the end of structure
+  /// alignment padding
+  /// @returns the Hash() of the type that the constructor would build from
+  /// the same arguments. Used by Manager::Get() to look up types without
+  /// constructing them.
+  static size_t HashOf(const ast::Struct* declaration,
+                       Symbol name,
+                       const StructMemberList& members,
+                       uint32_t align,
+                       uint32_t size,
+                       uint32_t size_no_padding);
+
+  /// @param declaration the AST structure declaration
+  /// @param name the name of the structure
+  /// @param members the structure members
+  /// @param align the byte alignment of the structure
+  /// @param size the byte size of the structure
+  /// @param size_no_padding size of the members without the end of structure
+  /// alignment padding
+  /// @returns true if this type is Equals() to the type that the constructor
+  /// would build from the same arguments
+  bool Matches(const ast::Struct* declaration,
+               Symbol name,
+               const StructMemberList& members,
+               uint32_t align,
+               uint32_t size,
+               uint32_t size_no_padding) const;
+
   /// @returns the name for the type
   std::string type_name() const override;
 
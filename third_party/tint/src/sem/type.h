@@ -37,6 +37,16 @@ class Type : public Castable<Type, Node> {
   Type(Type&&);
   ~Type() override;
 
+  /// @returns a hash of the type's structure. Types that are Equals() have the
+  /// same hash.
+  virtual size_t Hash() const = 0;
+
+  /// @param other the other type to compare against
+  /// @returns true if this type has the same structure as `other`. Types are
+  /// unique in a Manager, so two types are Equals() if and only if they are
+  /// the same object once registered.
+  virtual bool Equals(const Type& other) const = 0;
+
   /// @returns the name for this type. The type name is unique over all types.
   virtual std::string type_name() const = 0;
 
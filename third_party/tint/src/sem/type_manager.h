@@ -15,7 +15,6 @@
 #ifndef SRC_SEM_TYPE_MANAGER_H_
 #define SRC_SEM_TYPE_MANAGER_H_
 
-#include <string>
 #include <unordered_map>
 #include <utility>
 
@@ -31,6 +30,23 @@ class Manager {
   /// Iterator is the type returned by begin() and end()
   using Iterator = BlockAllocator<sem::Type>::ConstIterator;
 
+  /// Hashes types by structure, for maps keyed by types
+  struct Hasher {
+    /// @param type the type to hash
+    /// @returns the hash of the type's structure
+    size_t operator()(const sem::Type* type) const { return type->Hash(); }
+  };
+
+  /// Compares types by structure
+  struct Equality {
+    /// @param a the first type to compare
+    /// @param b the second type to compare
+    /// @returns true if `a` and `b` have the same structure
+    bool operator()(const sem::Type* a, const sem::Type* b) const {
+      return a->Equals(*b);
+    }
+  };
+
   /// Constructor
   Manager();
 
@@ -50,47 +66,55 @@ class Manager {
   /// @return the pointer to the registered type
   template <typename T, typename... ARGS>
   T* Get(ARGS&&... args) {
+    // Look up the registered types by hashing and comparing the constructor
+    // arguments with T::HashOf() and T::Matches(), so that getting a type
+    // that already exists doesn't construct a T.
     // Note: We do not use std::forward here, as we may need to use the
     // arguments again for the call to Create<T>() below.
-    auto name = T(args...).type_name();
-    auto it = by_name_.find(name);
-    if (it != by_name_.end()) {
-      return static_cast<T*>(it->second);
+    const size_t hash = T::HashOf(args...);
+    for (const Manager* manager = this; manager != nullptr;
+         manager = manager->inner_) {
+      auto range = manager->by_hash_.equal_range(hash);
+      for (auto it = range.first; it != range.second; ++it) {
+        if (auto* existing = it->second->template As<T>()) {
+          if (existing->Matches(args...)) {
+            return existing;
+          }
+        }
+      }
     }
 
     auto* type = types_.Create<T>(std::forward<ARGS>(args)...);
-    by_name_.emplace(name, type);
+    by_hash_.emplace(hash, type);
     return type;
   }
 
-  /// Wrap returns a new Manager created with the types of `inner`.
+  /// Wrap returns a new Manager which extends the types of `inner`.
   /// The Manager returned by Wrap is intended to temporarily extend the types
-  /// of an existing immutable Manager.
-  /// As the copied types are owned by `inner`, `inner` must not be destructed
-  /// or assigned while using the returned Manager.
+  /// of an existing immutable Manager. The types of `inner` are not copied,
+  /// but looked up in `inner` by the returned Manager.
+  /// As the types are owned by `inner`, `inner` must not be destructed,
+  /// modified or assigned while using the returned Manager.
   /// TODO(bclayton) - Evaluate whether there are safer alternatives to this
   /// function. See crbug.com/tint/460.
   /// @param inner the immutable Manager to extend
   /// @return the Manager that wraps `inner`
   static Manager Wrap(const Manager& inner) {
     Manager out;
-    out.by_name_ = inner.by_name_;
+    out.inner_ = &inner;
     return out;
   }
 
-  /// Returns the type map
-  /// @returns the mapping from name string to type.
-  const std::unordered_map<std::string, sem::Type*>& types() const {
-    return by_name_;
-  }
-
   /// @returns an iterator to the beginning of the types
   Iterator begin() const { return types_.Objects().begin(); }
   /// @returns an iterator to the end of the types
   Iterator end() const { return types_.Objects().end(); }
 
  private:
-  std::unordered_map<std::string, sem::Type*> by_name_;
+  /// Maps the hash of each type owned by this Manager to the type.
+  std::unordered_multimap<size_t, sem::Type*> by_hash_;
+  /// The Manager wrapped by this Manager, if any.
+  const Manager* inner_ = nullptr;
   BlockAllocator<sem::Type> types_;
 };
 
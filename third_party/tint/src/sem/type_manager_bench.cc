@@ -0,0 +1,66 @@
+// Copyright 2022 The Tint Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// ProgramBuilder must be included before benchmark.h, as it cannot be included
+// after tint.h.
+#include "src/program_builder.h"
+#include "src/sem/reference_type.h"
+
+#include "src/bench/benchmark.h"
+
+namespace tint::sem {
+namespace {
+
+constexpr uint32_t kStructMemberCount = 8;
+
+// Gets types that are already registered in the Manager, as the resolver does
+// for every expression.
+void GetExistingTypes(benchmark::State& state) {
+  Manager types;
+  auto* f32 = types.Get<F32>();
+  auto* vec4 = types.Get<Vector>(f32, 4u);
+  std::vector<std::unique_ptr<StructMember>> members;
+  StructMemberList member_list;
+  for (uint32_t i = 0; i < kStructMemberCount; i++) {
+    members.emplace_back(std::make_unique<StructMember>(
+        nullptr, Symbol(i + 2, ProgramID()), vec4, i, i * 16, 16, 16));
+    member_list.emplace_back(members.back().get());
+  }
+  Symbol struct_name(1, ProgramID());
+
+  auto allocations = bench::AllocationCount();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(types.Get<F32>());
+    benchmark::DoNotOptimize(types.Get<Vector>(f32, 4u));
+    benchmark::DoNotOptimize(
+        types.Get<Matrix>(types.Get<Vector>(f32, 4u), 4u));
+    benchmark::DoNotOptimize(types.Get<Array>(f32, 64u, 4u, 256u, 4u, 4u));
+    benchmark::DoNotOptimize(types.Get<Pointer>(
+        vec4, ast::StorageClass::kFunction, ast::Access::kReadWrite));
+    benchmark::DoNotOptimize(types.Get<Reference>(
+        vec4, ast::StorageClass::kFunction, ast::Access::kReadWrite));
+    benchmark::DoNotOptimize(types.Get<Struct>(
+        nullptr, struct_name, member_list, 16u, kStructMemberCount * 16u,
+        kStructMemberCount * 16u));
+  }
+  allocations = bench::AllocationCount() - allocations;
+
+  state.counters["allocations"] = benchmark::Counter(
+      static_cast<double>(allocations), benchmark::Counter::kAvgIterations);
+}
+
+BENCHMARK(GetExistingTypes);
+
+}  // namespace
+}  // namespace tint::sem
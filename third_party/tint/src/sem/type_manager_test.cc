@@ -15,8 +15,10 @@
 #include "src/sem/type_manager.h"
 
 #include "gtest/gtest.h"
+#include "src/sem/f32_type.h"
 #include "src/sem/i32_type.h"
 #include "src/sem/u32_type.h"
+#include "src/sem/vector_type.h"
 
 namespace tint {
 namespace sem {
@@ -63,6 +65,18 @@ TEST_F(TypeManagerTest, GetDifferentTypeReturnsDifferentPtr) {
   EXPECT_TRUE(t2->Is<U32>());
 }
 
+TEST_F(TypeManagerTest, GetSameStructureReturnsSamePtr) {
+  Manager tm;
+  auto* i32 = tm.Get<I32>();
+  auto* f32 = tm.Get<F32>();
+
+  auto* v = tm.Get<Vector>(i32, 3u);
+  EXPECT_EQ(v, tm.Get<Vector>(i32, 3u));
+  EXPECT_NE(v, tm.Get<Vector>(i32, 2u));
+  EXPECT_NE(v, tm.Get<Vector>(f32, 3u));
+  EXPECT_EQ(count(tm), 5u);
+}
+
 TEST_F(TypeManagerTest, WrapDoesntAffectInner) {
   Manager inner;
   Manager outer = Manager::Wrap(inner);
@@ -78,6 +92,22 @@ TEST_F(TypeManagerTest, WrapDoesntAffectInner) {
   EXPECT_EQ(count(outer), 1u);
 }
 
+TEST_F(TypeManagerTest, WrapReturnsInnerTypes) {
+  Manager inner;
+  auto* i32 = inner.Get<I32>();
+  auto* vec = inner.Get<Vector>(i32, 4u);
+
+  Manager outer = Manager::Wrap(inner);
+  EXPECT_EQ(outer.Get<I32>(), i32);
+  EXPECT_EQ(outer.Get<Vector>(i32, 4u), vec);
+  EXPECT_EQ(count(outer), 0u);
+
+  auto* outer_vec = outer.Get<Vector>(i32, 2u);
+  EXPECT_EQ(outer.Get<Vector>(i32, 2u), outer_vec);
+  EXPECT_EQ(count(inner), 2u);
+  EXPECT_EQ(count(outer), 1u);
+}
+
 }  // namespace
 }  // namespace sem
 }  // namespace tint
@@ -27,6 +27,22 @@ U32::~U32() = default;
 
 U32::U32(U32&&) = default;
 
+size_t U32::Hash() const {
+  return HashOf();
+}
+
+bool U32::Equals(const Type& other) const {
+  return other.Is<U32>();
+}
+
+size_t U32::HashOf() {
+  return static_cast<size_t>(TypeInfo::Of<U32>().full_hashcode);
+}
+
+bool U32::Matches() const {
+  return true;
+}
+
 std::string U32::type_name() const {
   return "__u32";
 }
@@ -15,6 +15,7 @@
 #include "src/sem/vector_type.h"
 
 #include "src/program_builder.h"
+#include "src/utils/hash.h"
 
 TINT_INSTANTIATE_TYPEINFO(tint::sem::Vector);
 
@@ -31,6 +32,25 @@ Vector::Vector(Vector&&) = default;
 
 Vector::~Vector() = default;
 
+size_t Vector::Hash() const {
+  return HashOf(subtype_, width_);
+}
+
+bool Vector::Equals(const Type& other) const {
+  if (auto* o = other.As<Vector>()) {
+    return o->width_ == width_ && o->subtype_ == subtype_;
+  }
+  return false;
+}
+
+size_t Vector::HashOf(const Type* subtype, uint32_t width) {
+  return utils::Hash(TypeInfo::Of<Vector>().full_hashcode, width, subtype);
+}
+
+bool Vector::Matches(const Type* subtype, uint32_t width) const {
+  return width_ == width && subtype_ == subtype;
+}
+
 std::string Vector::type_name() const {
   return "__vec_" + std::to_string(width_) + subtype_->type_name();
 }
@@ -36,6 +36,26 @@ class Vector : public Castable<Vector, Type> {
   /// @returns the type of the vector elements
   const Type* type() const { return subtype_; }
 
+  /// @returns a hash of the type.
+  size_t Hash() const override;
+
+  /// @param other the other type to compare against
+  /// @returns true if the this type is equal to the given type
+  bool Equals(const Type& other) const override;
+
+  /// @param subtype the vector element type
+  /// @param width the number of elements in the vector
+  /// @returns the Hash() of the type that the constructor would build from
+  /// the same arguments. Used by Manager::Get() to look up types without
+  /// constructing them.
+  static size_t HashOf(const Type* subtype, uint32_t width);
+
+  /// @param subtype the vector element type
+  /// @param width the number of elements in the vector
+  /// @returns true if this type is Equals() to the type that the constructor
+  /// would build from the same arguments
+  bool Matches(const Type* subtype, uint32_t width) const;
+
   /// @returns the name for th type
   std::string type_name() const override;
 
@@ -28,6 +28,31 @@ TEST_F(VectorTest, Creation) {
   EXPECT_EQ(v.Width(), 2u);
 }
 
+TEST_F(VectorTest, Hash) {
+  auto* i32 = create<I32>();
+  auto* f32 = create<F32>();
+  Vector a{i32, 3};
+  Vector b{i32, 3};
+  Vector c{f32, 3};
+  Vector d{i32, 2};
+  EXPECT_EQ(a.Hash(), b.Hash());
+  EXPECT_NE(a.Hash(), c.Hash());
+  EXPECT_NE(a.Hash(), d.Hash());
+}
+
+TEST_F(VectorTest, Equals) {
+  auto* i32 = create<I32>();
+  auto* f32 = create<F32>();
+  Vector a{i32, 3};
+  Vector b{i32, 3};
+  Vector c{f32, 3};
+  Vector d{i32, 2};
+  EXPECT_TRUE(a.Equals(b));
+  EXPECT_FALSE(a.Equals(c));
+  EXPECT_FALSE(a.Equals(d));
+  EXPECT_FALSE(a.Equals(*i32));
+}
+
 TEST_F(VectorTest, TypeName) {
   auto* i32 = create<I32>();
   auto* v = create<Vector>(i32, 3);
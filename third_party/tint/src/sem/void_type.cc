@@ -27,6 +27,22 @@ Void::Void(Void&&) = default;
 
 Void::~Void() = default;
 
+size_t Void::Hash() const {
+  return HashOf();
+}
+
+bool Void::Equals(const Type& other) const {
+  return other.Is<Void>();
+}
+
+size_t Void::HashOf() {
+  return static_cast<size_t>(TypeInfo::Of<Void>().full_hashcode);
+}
+
+bool Void::Matches() const {
+  return true;
+}
+
 std::string Void::type_name() const {
   return "__void";
 }
@@ -15,54 +15,61 @@
 #include "src/source.h"
 
 #include <algorithm>
+#include <cstring>
 #include <sstream>
 #include <string_view>
 #include <utility>
 
 namespace tint {
-namespace {
-std::vector<std::string_view> SplitLines(std::string_view str) {
-  std::vector<std::string_view> lines;
-
-  size_t lineStart = 0;
-  for (size_t i = 0; i < str.size(); ++i) {
-    if (str[i] == '\n') {
-      lines.push_back(str.substr(lineStart, i - lineStart));
-      lineStart = i + 1;
-    }
-  }
-  if (lineStart < str.size()) {
-    lines.push_back(str.substr(lineStart));
-  }
-
-  return lines;
-}
-
-std::vector<std::string_view> CopyRelativeStringViews(
-    const std::vector<std::string_view>& src_list,
-    const std::string_view& src_view,
-    const std::string_view& dst_view) {
-  std::vector<std::string_view> out(src_list.size());
-  for (size_t i = 0; i < src_list.size(); i++) {
-    auto offset = static_cast<size_t>(&src_list[i].front() - &src_view.front());
-    auto count = src_list[i].length();
-    out[i] = dst_view.substr(offset, count);
-  }
-  return out;
-}
-
-}  // namespace
 
 Source::FileContent::FileContent(const std::string& body)
-    : data(body), data_view(data), lines(SplitLines(data_view)) {}
+    : data(body), data_view(data) {}
 
+// The line offsets are not copied as they are only computed on demand.
 Source::FileContent::FileContent(const FileContent& rhs)
-    : data(rhs.data),
-      data_view(data),
-      lines(CopyRelativeStringViews(rhs.lines, rhs.data_view, data_view)) {}
+    : data(rhs.data), data_view(data) {}
 
 Source::FileContent::~FileContent() = default;
 
+const std::vector<size_t>& Source::FileContent::LineOffsets() const {
+  std::call_once(line_offsets_once_, [&] {
+    // memchr() is vectorized by the C library, so the scan is fast even for
+    // very large files.
+    const char* begin = data.data();
+    const char* end = begin + data.size();
+    const char* line = begin;
+    while (line < end) {
+      line_offsets_.push_back(static_cast<size_t>(line - begin));
+      auto* newline = static_cast<const char*>(
+          memchr(line, '\n', static_cast<size_t>(end - line)));
+      if (newline == nullptr) {
+        break;
+      }
+      line = newline + 1;
+    }
+  });
+  return line_offsets_;
+}
+
+size_t Source::FileContent::LineCount() const {
+  return LineOffsets().size();
+}
+
+std::string_view Source::FileContent::Line(size_t index) const {
+  auto& offsets = LineOffsets();
+  if (index >= offsets.size()) {
+    return {};
+  }
+  size_t begin = offsets[index];
+  size_t end = data.size();
+  if (index + 1 < offsets.size()) {
+    end = offsets[index + 1] - 1;
+  } else if (data.back() == '\n') {
+    end--;
+  }
+  return data_view.substr(begin, end - begin);
+}
+
 Source::File::~File() = default;
 
 std::ostream& operator<<(std::ostream& out, const Source& source) {
@@ -87,10 +94,11 @@ std::ostream& operator<<(std::ostream& out, const Source& source) {
       };
 
       for (size_t line = rng.begin.line; line <= rng.end.line; line++) {
-        if (line < source.file->content.lines.size() + 1) {
-          auto len = source.file->content.lines[line - 1].size();
+        if (line < source.file->content.LineCount() + 1) {
+          auto content = source.file->content.Line(line - 1);
+          auto len = content.size();
 
-          out << source.file->content.lines[line - 1];
+          out << content;
 
           out << std::endl;
 
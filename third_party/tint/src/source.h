@@ -17,6 +17,7 @@
 #define SRC_SOURCE_H_
 
 #include <iostream>
+#include <mutex>
 #include <string>
 #include <string_view>
 #include <tuple>
@@ -41,12 +42,30 @@ class Source {
     /// Destructor
     ~FileContent();
 
+    /// @returns the number of lines in #data. A trailing newline doesn't start
+    /// a new line.
+    size_t LineCount() const;
+
+    /// @param index the 0-based index of the line
+    /// @returns the line at `index`, without its newline character, or an
+    /// empty string if `index` is not less than LineCount()
+    std::string_view Line(size_t index) const;
+
     /// The original un-split file content
     const std::string data;
     /// A string_view over #data
     const std::string_view data_view;
-    /// #data split by lines
-    const std::vector<std::string_view> lines;
+
+   private:
+    /// Builds #line_offsets_ on the first call.
+    /// Most files are only parsed and never split into lines, as lines are
+    /// only needed to print diagnostics.
+    const std::vector<size_t>& LineOffsets() const;
+
+    /// Guards the lazy initialization of #line_offsets_
+    mutable std::once_flag line_offsets_once_;
+    /// The offset in #data of the start of each line
+    mutable std::vector<size_t> line_offsets_;
   };
 
   /// File describes a source file, including path and content.
@@ -32,10 +32,10 @@ TEST_F(SourceFileContentTest, Ctor) {
   Source::FileContent fc(kSource);
   EXPECT_EQ(fc.data, kSource);
   EXPECT_EQ(fc.data_view, kSource);
-  ASSERT_EQ(fc.lines.size(), 3u);
-  EXPECT_EQ(fc.lines[0], "line one");
-  EXPECT_EQ(fc.lines[1], "line two");
-  EXPECT_EQ(fc.lines[2], "line three");
+  ASSERT_EQ(fc.LineCount(), 3u);
+  EXPECT_EQ(fc.Line(0), "line one");
+  EXPECT_EQ(fc.Line(1), "line two");
+  EXPECT_EQ(fc.Line(2), "line three");
 }
 
 TEST_F(SourceFileContentTest, CopyCtor) {
@@ -44,10 +44,10 @@ TEST_F(SourceFileContentTest, CopyCtor) {
   src.reset();
   EXPECT_EQ(fc.data, kSource);
   EXPECT_EQ(fc.data_view, kSource);
-  ASSERT_EQ(fc.lines.size(), 3u);
-  EXPECT_EQ(fc.lines[0], "line one");
-  EXPECT_EQ(fc.lines[1], "line two");
-  EXPECT_EQ(fc.lines[2], "line three");
+  ASSERT_EQ(fc.LineCount(), 3u);
+  EXPECT_EQ(fc.Line(0), "line one");
+  EXPECT_EQ(fc.Line(1), "line two");
+  EXPECT_EQ(fc.Line(2), "line three");
 }
 
 TEST_F(SourceFileContentTest, MoveCtor) {
@@ -56,10 +56,44 @@ TEST_F(SourceFileContentTest, MoveCtor) {
   src.reset();
   EXPECT_EQ(fc.data, kSource);
   EXPECT_EQ(fc.data_view, kSource);
-  ASSERT_EQ(fc.lines.size(), 3u);
-  EXPECT_EQ(fc.lines[0], "line one");
-  EXPECT_EQ(fc.lines[1], "line two");
-  EXPECT_EQ(fc.lines[2], "line three");
+  ASSERT_EQ(fc.LineCount(), 3u);
+  EXPECT_EQ(fc.Line(0), "line one");
+  EXPECT_EQ(fc.Line(1), "line two");
+  EXPECT_EQ(fc.Line(2), "line three");
+}
+
+TEST_F(SourceFileContentTest, CopyCtorAfterLineAccess) {
+  auto src = std::make_unique<Source::FileContent>(kSource);
+  ASSERT_EQ(src->LineCount(), 3u);
+  Source::FileContent fc{*src};
+  src.reset();
+  ASSERT_EQ(fc.LineCount(), 3u);
+  EXPECT_EQ(fc.Line(0), "line one");
+  EXPECT_EQ(fc.Line(1), "line two");
+  EXPECT_EQ(fc.Line(2), "line three");
+}
+
+TEST_F(SourceFileContentTest, Empty) {
+  Source::FileContent fc("");
+  EXPECT_EQ(fc.LineCount(), 0u);
+  EXPECT_EQ(fc.Line(0), "");
+}
+
+TEST_F(SourceFileContentTest, TrailingNewline) {
+  Source::FileContent fc("line one\nline two\n");
+  ASSERT_EQ(fc.LineCount(), 2u);
+  EXPECT_EQ(fc.Line(0), "line one");
+  EXPECT_EQ(fc.Line(1), "line two");
+  EXPECT_EQ(fc.Line(2), "");
+}
+
+TEST_F(SourceFileContentTest, EmptyLines) {
+  Source::FileContent fc("\n\nline three\r\n\n");
+  ASSERT_EQ(fc.LineCount(), 4u);
+  EXPECT_EQ(fc.Line(0), "");
+  EXPECT_EQ(fc.Line(1), "");
+  EXPECT_EQ(fc.Line(2), "line three\r");
+  EXPECT_EQ(fc.Line(3), "");
 }
 
 }  // namespace
@@ -14,13 +14,48 @@
 
 #include "src/symbol_table.h"
 
+#include <algorithm>
+#include <cstring>
+
 #include "src/debug.h"
 
 namespace tint {
+namespace {
+
+/// The size in bytes of the blocks holding the interned names
+constexpr size_t kBlockSize = 4096;
+
+}  // namespace
+
+SymbolTable::Storage::Storage() = default;
+
+SymbolTable::Storage::Storage(const Storage& other)
+    : blocks(other.blocks),
+      names(other.names),
+      name_to_value(other.name_to_value) {}
+
+SymbolTable::Storage::~Storage() = default;
+
+std::string_view SymbolTable::Storage::Intern(std::string_view name) {
+  if (name.size() > free_size) {
+    auto size = std::max(kBlockSize, name.size());
+    blocks.emplace_back(new char[size]);
+    free = blocks.back().get();
+    free_size = size;
+  }
+  memcpy(free, name.data(), name.size());
+  std::string_view interned(free, name.size());
+  free += name.size();
+  free_size -= name.size();
+  return interned;
+}
 
 SymbolTable::SymbolTable(tint::ProgramID program_id)
     : program_id_(program_id) {}
 
+SymbolTable::SymbolTable(const SymbolTable& other, tint::ProgramID program_id)
+    : storage_(other.storage_), program_id_(program_id) {}
+
 SymbolTable::SymbolTable(const SymbolTable&) = default;
 
 SymbolTable::SymbolTable(SymbolTable&&) = default;
@@ -31,54 +66,72 @@ SymbolTable& SymbolTable::operator=(const SymbolTable& other) = default;
 
 SymbolTable& SymbolTable::operator=(SymbolTable&&) = default;
 
-Symbol SymbolTable::Register(const std::string& name) {
+SymbolTable::Storage& SymbolTable::Mutable() {
+  if (!storage_) {
+    storage_ = std::make_shared<Storage>();
+  } else if (storage_.use_count() > 1) {
+    storage_ = std::make_shared<Storage>(*storage_);
+  }
+  return *storage_;
+}
+
+Symbol SymbolTable::Register(std::string_view name) {
   TINT_ASSERT(Symbol, !name.empty());
 
-  auto it = name_to_symbol_.find(name);
-  if (it != name_to_symbol_.end())
-    return it->second;
+  if (auto sym = Get(name); sym.IsValid()) {
+    return sym;
+  }
 
-#if TINT_SYMBOL_STORE_DEBUG_NAME
-  Symbol sym(next_symbol_, program_id_, name);
-#else
-  Symbol sym(next_symbol_, program_id_);
-#endif
-  ++next_symbol_;
+  auto& storage = Mutable();
+  auto interned = storage.Intern(name);
+  storage.names.emplace_back(interned);
+  auto value = static_cast<uint32_t>(storage.names.size());
+  storage.name_to_value.emplace(interned, value);
 
-  name_to_symbol_[name] = sym;
-  symbol_to_name_[sym] = name;
+  return Get(value);
+}
 
-  return sym;
+Symbol SymbolTable::Get(std::string_view name) const {
+  if (!storage_) {
+    return Symbol();
+  }
+  auto it = storage_->name_to_value.find(name);
+  return it != storage_->name_to_value.end() ? Get(it->second) : Symbol();
 }
 
-Symbol SymbolTable::Get(const std::string& name) const {
-  auto it = name_to_symbol_.find(name);
-  return it != name_to_symbol_.end() ? it->second : Symbol();
+Symbol SymbolTable::Get(uint32_t value) const {
+  if (value == 0 || value > Count()) {
+    return Symbol();
+  }
+#if TINT_SYMBOL_STORE_DEBUG_NAME
+  return Symbol(value, program_id_, std::string(storage_->names[value - 1]));
+#else
+  return Symbol(value, program_id_);
+#endif
 }
 
 std::string SymbolTable::NameFor(const Symbol symbol) const {
   TINT_ASSERT_PROGRAM_IDS_EQUAL(Symbol, program_id_, symbol);
-  auto it = symbol_to_name_.find(symbol);
-  if (it == symbol_to_name_.end()) {
+  auto value = symbol.value();
+  if (value == 0 || value > Count()) {
     return symbol.to_str();
   }
 
-  return it->second;
+  return std::string(storage_->names[value - 1]);
 }
 
-Symbol SymbolTable::New(std::string prefix /* = "" */) {
+Symbol SymbolTable::New(std::string_view prefix /* = "" */) {
   if (prefix.empty()) {
     prefix = "tint_symbol";
   }
-  auto it = name_to_symbol_.find(prefix);
-  if (it == name_to_symbol_.end()) {
+  if (!Get(prefix).IsValid()) {
     return Register(prefix);
   }
   std::string name;
   size_t i = 1;
   do {
-    name = prefix + "_" + std::to_string(i++);
-  } while (name_to_symbol_.count(name));
+    name = std::string(prefix) + "_" + std::to_string(i++);
+  } while (Get(name).IsValid());
   return Register(name);
 }
 
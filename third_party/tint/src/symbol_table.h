@@ -15,20 +15,35 @@
 #ifndef SRC_SYMBOL_TABLE_H_
 #define SRC_SYMBOL_TABLE_H_
 
+#include <memory>
 #include <string>
+#include <string_view>
 #include <unordered_map>
+#include <vector>
 
 #include "src/symbol.h"
 
 namespace tint {
 
-/// Holds mappings from symbols to their associated string names
+/// Holds mappings from symbols to their associated string names.
+/// SymbolTables constructed from, or copied from, another SymbolTable share
+/// its names until either of them registers a new symbol. The `const` methods
+/// of a SymbolTable are safe to call from several threads at once, including
+/// while other threads construct SymbolTables from it.
 class SymbolTable {
  public:
   /// Constructor
   /// @param program_id the identifier of the program that owns this symbol
   /// table
   explicit SymbolTable(tint::ProgramID program_id);
+  /// Constructor
+  /// Constructs a symbol table that holds the same names, with the same symbol
+  /// values, as `other`. The two tables share their storage until one of them
+  /// registers a new name.
+  /// @param other the symbol table to copy the names of
+  /// @param program_id the identifier of the program that owns this symbol
+  /// table
+  SymbolTable(const SymbolTable& other, tint::ProgramID program_id);
   /// Copy constructor
   SymbolTable(const SymbolTable&);
   /// Move Constructor
@@ -48,12 +63,18 @@ class SymbolTable {
   /// Registers a name into the symbol table, returning the Symbol.
   /// @param name the name to register
   /// @returns the symbol representing the given name
-  Symbol Register(const std::string& name);
+  Symbol Register(std::string_view name);
 
   /// Returns the symbol for the given `name`
   /// @param name the name to lookup
   /// @returns the symbol for the name or symbol::kInvalid if not found.
-  Symbol Get(const std::string& name) const;
+  Symbol Get(std::string_view name) const;
+
+  /// Returns the symbol with the given value
+  /// @param value the symbol value
+  /// @returns the symbol with the given value or symbol::kInvalid if there is
+  /// no such symbol in this table.
+  Symbol Get(uint32_t value) const;
 
   /// Returns the name for the given symbol
   /// @param symbol the symbol to retrieve the name for
@@ -66,15 +87,19 @@ class SymbolTable {
   /// @returns a new, unnamed symbol with the given name. If the name is already
   /// taken then this will be suffixed with an underscore and a unique numerical
   /// value
-  Symbol New(std::string name = "");
+  Symbol New(std::string_view name = "");
+
+  /// @returns the number of symbols in the table
+  size_t Count() const { return storage_ ? storage_->names.size() : 0; }
 
-  /// Foreach calls the callback function `F` for each symbol in the table.
+  /// Foreach calls the callback function `F` for each symbol in the table, in
+  /// the order they were registered.
   /// @param callback must be a function or function-like object with the
-  /// signature: `void(Symbol, const std::string&)`
+  /// signature: `void(Symbol, std::string_view)`
   template <typename F>
   void Foreach(F&& callback) const {
-    for (auto it : symbol_to_name_) {
-      callback(it.first, it.second);
+    for (uint32_t value = 1; value <= Count(); value++) {
+      callback(Get(value), storage_->names[value - 1]);
     }
   }
 
@@ -82,11 +107,45 @@ class SymbolTable {
   tint::ProgramID ProgramID() const { return program_id_; }
 
  private:
-  // The value to be associated to the next registered symbol table entry.
-  uint32_t next_symbol_ = 1;
-
-  std::unordered_map<Symbol, std::string> symbol_to_name_;
-  std::unordered_map<std::string, Symbol> name_to_symbol_;
+  /// Storage holds the names of a symbol table. The names are interned in
+  /// blocks of memory that are never freed nor moved while the Storage is
+  /// alive, so that the string_views over them stay valid.
+  /// Storage can be shared by several symbol tables, as long as none of them
+  /// modifies it.
+  struct Storage {
+    /// Constructor
+    Storage();
+    /// Copy constructor
+    /// The blocks holding the names are shared with `other`, as they are never
+    /// modified once written. New names are interned in new blocks.
+    /// @param other the storage to copy
+    Storage(const Storage& other);
+    /// Destructor
+    ~Storage();
+
+    /// Copies `name` into the blocks
+    /// @param name the name to intern
+    /// @returns a view of the interned copy of `name`
+    std::string_view Intern(std::string_view name);
+
+    /// The blocks of memory holding the interned names
+    std::vector<std::shared_ptr<char[]>> blocks;
+    /// The free space at the end of the last block
+    char* free = nullptr;
+    /// The number of free bytes at `free`
+    size_t free_size = 0;
+    /// The names of the symbols, indexed by the symbol value minus one
+    std::vector<std::string_view> names;
+    /// The map of name to symbol value
+    std::unordered_map<std::string_view, uint32_t> name_to_value;
+  };
+
+  /// @returns the storage of this table, after making a copy of the storage if
+  /// it is shared with another table
+  Storage& Mutable();
+
+  /// The storage of the names. Null if no name was registered.
+  std::shared_ptr<Storage> storage_;
   tint::ProgramID program_id_;
 };
 
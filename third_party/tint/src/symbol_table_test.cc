@@ -14,6 +14,10 @@
 
 #include "src/symbol_table.h"
 
+#include <string>
+#include <utility>
+#include <vector>
+
 #include "gtest/gtest-spi.h"
 
 namespace tint {
@@ -49,6 +53,87 @@ TEST_F(SymbolTableTest, ReturnsBlankForMissingSymbol) {
   EXPECT_EQ("$2", s.NameFor(Symbol(2, program_id)));
 }
 
+TEST_F(SymbolTableTest, GetByValue) {
+  auto program_id = ProgramID::New();
+  SymbolTable s{program_id};
+  auto a = s.Register("a");
+  auto b = s.Register("b");
+  EXPECT_EQ(a, s.Get(a.value()));
+  EXPECT_EQ(b, s.Get(b.value()));
+  EXPECT_FALSE(s.Get(0u).IsValid());
+  EXPECT_FALSE(s.Get(3u).IsValid());
+}
+
+TEST_F(SymbolTableTest, New) {
+  auto program_id = ProgramID::New();
+  SymbolTable s{program_id};
+  EXPECT_EQ("name", s.NameFor(s.New("name")));
+  EXPECT_EQ("name_1", s.NameFor(s.New("name")));
+  EXPECT_EQ("name_2", s.NameFor(s.New("name")));
+  EXPECT_EQ("tint_symbol", s.NameFor(s.New()));
+  EXPECT_EQ(4u, s.Count());
+}
+
+TEST_F(SymbolTableTest, LongNames) {
+  auto program_id = ProgramID::New();
+  SymbolTable s{program_id};
+  std::string long_name(10000, 'x');
+  auto a = s.Register("a");
+  auto b = s.Register(long_name);
+  auto c = s.Register("c");
+  EXPECT_EQ("a", s.NameFor(a));
+  EXPECT_EQ(long_name, s.NameFor(b));
+  EXPECT_EQ("c", s.NameFor(c));
+  EXPECT_EQ(b, s.Get(long_name));
+}
+
+TEST_F(SymbolTableTest, Foreach) {
+  auto program_id = ProgramID::New();
+  SymbolTable s{program_id};
+  auto a = s.Register("a");
+  auto b = s.Register("b");
+  auto c = s.Register("c");
+  std::vector<std::pair<Symbol, std::string>> got;
+  s.Foreach([&](Symbol sym, std::string_view name) {
+    got.emplace_back(sym, std::string(name));
+  });
+  std::vector<std::pair<Symbol, std::string>> expect{
+      {a, "a"}, {b, "b"}, {c, "c"}};
+  EXPECT_EQ(got, expect);
+}
+
+TEST_F(SymbolTableTest, CopyIsIndependent) {
+  auto program_id = ProgramID::New();
+  SymbolTable a{program_id};
+  auto x = a.Register("x");
+  SymbolTable b{a};
+  auto y = b.Register("y");
+  auto z = a.Register("z");
+  EXPECT_EQ(2u, a.Count());
+  EXPECT_EQ(2u, b.Count());
+  EXPECT_EQ(x, b.Get("x"));
+  EXPECT_EQ("x", a.NameFor(x));
+  EXPECT_EQ("y", b.NameFor(y));
+  EXPECT_EQ("z", a.NameFor(z));
+  EXPECT_FALSE(a.Get("y").IsValid());
+  EXPECT_FALSE(b.Get("z").IsValid());
+}
+
+TEST_F(SymbolTableTest, ConstructFromOtherProgram) {
+  auto program_id_a = ProgramID::New();
+  auto program_id_b = ProgramID::New();
+  SymbolTable a{program_id_a};
+  a.Register("x");
+  a.Register("y");
+  SymbolTable b{a, program_id_b};
+  EXPECT_EQ(program_id_b, b.ProgramID());
+  EXPECT_EQ(Symbol(1, program_id_b), b.Get("x"));
+  EXPECT_EQ(Symbol(2, program_id_b), b.Get("y"));
+  EXPECT_EQ(Symbol(3, program_id_b), b.New("x"));
+  EXPECT_EQ("x_1", b.NameFor(Symbol(3, program_id_b)));
+  EXPECT_EQ(2u, a.Count());
+}
+
 TEST_F(SymbolTableTest, AssertsForBlankString) {
   EXPECT_FATAL_FAILURE(
       {
@@ -75,7 +75,8 @@ void AddSpirvBlockAttribute::Run(CloneContext& ctx,
       // need to wrap it first.
       auto* wrapper = utils::GetOrCreate(wrapper_structs, ty, [&]() {
         auto* block =
-            ctx.dst->ASTNodes().Create<SpirvBlockAttribute>(ctx.dst->ID());
+            ctx.dst->ASTNodes().Create<SpirvBlockAttribute>(
+                ctx.dst->ID(), ctx.dst->AllocateNodeID());
         auto wrapper_name = ctx.src->Symbols().NameFor(var->symbol) + "_block";
         auto* ret = ctx.dst->create<ast::Struct>(
             ctx.dst->Symbols().New(wrapper_name),
@@ -97,7 +98,8 @@ void AddSpirvBlockAttribute::Run(CloneContext& ctx,
     } else {
       // Add a block attribute to this struct directly.
       auto* block =
-          ctx.dst->ASTNodes().Create<SpirvBlockAttribute>(ctx.dst->ID());
+          ctx.dst->ASTNodes().Create<SpirvBlockAttribute>(
+              ctx.dst->ID(), ctx.dst->AllocateNodeID());
       ctx.InsertFront(str->Declaration()->attributes, block);
     }
   }
@@ -105,8 +107,10 @@ void AddSpirvBlockAttribute::Run(CloneContext& ctx,
   ctx.Clone();
 }
 
-AddSpirvBlockAttribute::SpirvBlockAttribute::SpirvBlockAttribute(ProgramID pid)
-    : Base(pid) {}
+AddSpirvBlockAttribute::SpirvBlockAttribute::SpirvBlockAttribute(
+    ProgramID pid,
+    ast::NodeID nid)
+    : Base(pid, nid) {}
 AddSpirvBlockAttribute::SpirvBlockAttribute::~SpirvBlockAttribute() = default;
 std::string AddSpirvBlockAttribute::SpirvBlockAttribute::InternalName() const {
   return "spirv_block";
@@ -115,7 +119,8 @@ std::string AddSpirvBlockAttribute::SpirvBlockAttribute::InternalName() const {
 const AddSpirvBlockAttribute::SpirvBlockAttribute*
 AddSpirvBlockAttribute::SpirvBlockAttribute::Clone(CloneContext* ctx) const {
   return ctx->dst->ASTNodes()
-      .Create<AddSpirvBlockAttribute::SpirvBlockAttribute>(ctx->dst->ID());
+      .Create<AddSpirvBlockAttribute::SpirvBlockAttribute>(
+          ctx->dst->ID(), ctx->dst->AllocateNodeID());
 }
 
 }  // namespace transform
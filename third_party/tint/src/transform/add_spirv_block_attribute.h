@@ -38,7 +38,8 @@ class AddSpirvBlockAttribute
    public:
     /// Constructor
     /// @param program_id the identifier of the program that owns this node
-    explicit SpirvBlockAttribute(ProgramID program_id);
+    /// @param nid the unique node identifier
+    explicit SpirvBlockAttribute(ProgramID program_id, ast::NodeID nid);
     /// Destructor
     ~SpirvBlockAttribute() override;
 
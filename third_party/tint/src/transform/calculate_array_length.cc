@@ -56,8 +56,9 @@ struct ArrayUsage {
 
 }  // namespace
 
-CalculateArrayLength::BufferSizeIntrinsic::BufferSizeIntrinsic(ProgramID pid)
-    : Base(pid) {}
+CalculateArrayLength::BufferSizeIntrinsic::BufferSizeIntrinsic(ProgramID pid,
+                                                               ast::NodeID nid)
+    : Base(pid, nid) {}
 CalculateArrayLength::BufferSizeIntrinsic::~BufferSizeIntrinsic() = default;
 std::string CalculateArrayLength::BufferSizeIntrinsic::InternalName() const {
   return "intrinsic_buffer_size";
@@ -66,7 +67,7 @@ std::string CalculateArrayLength::BufferSizeIntrinsic::InternalName() const {
 const CalculateArrayLength::BufferSizeIntrinsic*
 CalculateArrayLength::BufferSizeIntrinsic::Clone(CloneContext* ctx) const {
   return ctx->dst->ASTNodes().Create<CalculateArrayLength::BufferSizeIntrinsic>(
-      ctx->dst->ID());
+      ctx->dst->ID(), ctx->dst->AllocateNodeID());
 }
 
 CalculateArrayLength::CalculateArrayLength() = default;
@@ -116,7 +117,8 @@ void CalculateArrayLength::Run(CloneContext& ctx,
           },
           ctx.dst->ty.void_(), nullptr,
           ast::AttributeList{
-              ctx.dst->ASTNodes().Create<BufferSizeIntrinsic>(ctx.dst->ID()),
+              ctx.dst->ASTNodes().Create<BufferSizeIntrinsic>(
+                  ctx.dst->ID(), ctx.dst->AllocateNodeID()),
           },
           ast::AttributeList{}));
 
@@ -41,7 +41,8 @@ class CalculateArrayLength : public Castable<CalculateArrayLength, Transform> {
    public:
     /// Constructor
     /// @param program_id the identifier of the program that owns this node
-    explicit BufferSizeIntrinsic(ProgramID program_id);
+    /// @param nid the unique node identifier
+    explicit BufferSizeIntrinsic(ProgramID program_id, ast::NodeID nid);
     /// Destructor
     ~BufferSizeIntrinsic() override;
 
@@ -202,8 +202,8 @@ DecomposeMemoryAccess::Intrinsic* IntrinsicLoadFor(
     return nullptr;
   }
   return builder->ASTNodes().Create<DecomposeMemoryAccess::Intrinsic>(
-      builder->ID(), DecomposeMemoryAccess::Intrinsic::Op::kLoad, storage_class,
-      type);
+      builder->ID(), builder->AllocateNodeID(),
+      DecomposeMemoryAccess::Intrinsic::Op::kLoad, storage_class, type);
 }
 
 /// @returns a DecomposeMemoryAccess::Intrinsic attribute that can be applied
@@ -217,8 +217,8 @@ DecomposeMemoryAccess::Intrinsic* IntrinsicStoreFor(
     return nullptr;
   }
   return builder->ASTNodes().Create<DecomposeMemoryAccess::Intrinsic>(
-      builder->ID(), DecomposeMemoryAccess::Intrinsic::Op::kStore,
-      storage_class, type);
+      builder->ID(), builder->AllocateNodeID(),
+      DecomposeMemoryAccess::Intrinsic::Op::kStore, storage_class, type);
 }
 
 /// @returns a DecomposeMemoryAccess::Intrinsic attribute that can be applied
@@ -273,7 +273,8 @@ DecomposeMemoryAccess::Intrinsic* IntrinsicAtomicFor(ProgramBuilder* builder,
     return nullptr;
   }
   return builder->ASTNodes().Create<DecomposeMemoryAccess::Intrinsic>(
-      builder->ID(), op, ast::StorageClass::kStorage, type);
+      builder->ID(), builder->AllocateNodeID(), op, ast::StorageClass::kStorage,
+      type);
 }
 
 /// BufferAccess describes a single storage or uniform buffer access
@@ -691,10 +692,11 @@ struct DecomposeMemoryAccess::State {
 };
 
 DecomposeMemoryAccess::Intrinsic::Intrinsic(ProgramID pid,
+                                            ast::NodeID nid,
                                             Op o,
                                             ast::StorageClass sc,
                                             DataType ty)
-    : Base(pid), op(o), storage_class(sc), type(ty) {}
+    : Base(pid, nid), op(o), storage_class(sc), type(ty) {}
 DecomposeMemoryAccess::Intrinsic::~Intrinsic() = default;
 std::string DecomposeMemoryAccess::Intrinsic::InternalName() const {
   std::stringstream ss;
@@ -784,7 +786,7 @@ std::string DecomposeMemoryAccess::Intrinsic::InternalName() const {
 const DecomposeMemoryAccess::Intrinsic* DecomposeMemoryAccess::Intrinsic::Clone(
     CloneContext* ctx) const {
   return ctx->dst->ASTNodes().Create<DecomposeMemoryAccess::Intrinsic>(
-      ctx->dst->ID(), op, storage_class, type);
+      ctx->dst->ID(), ctx->dst->AllocateNodeID(), op, storage_class, type);
 }
 
 DecomposeMemoryAccess::DecomposeMemoryAccess() = default;
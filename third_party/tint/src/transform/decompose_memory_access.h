@@ -74,10 +74,15 @@ class DecomposeMemoryAccess
 
     /// Constructor
     /// @param program_id the identifier of the program that owns this node
+    /// @param nid the unique node identifier
     /// @param o the op of the intrinsic
     /// @param sc the storage class of the buffer
     /// @param ty the data type of the intrinsic
-    Intrinsic(ProgramID program_id, Op o, ast::StorageClass sc, DataType ty);
+    Intrinsic(ProgramID program_id,
+              ast::NodeID nid,
+              Op o,
+              ast::StorageClass sc,
+              DataType ty);
     /// Destructor
     ~Intrinsic() override;
 
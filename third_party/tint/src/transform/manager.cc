@@ -25,6 +25,8 @@
 #endif  // TINT_PRINT_PROGRAM_FOR_EACH_TRANSFORM
 
 TINT_INSTANTIATE_TYPEINFO(tint::transform::Manager);
+TINT_INSTANTIATE_TYPEINFO(tint::transform::Manager::Config);
+TINT_INSTANTIATE_TYPEINFO(tint::transform::Manager::Timings);
 
 namespace tint {
 namespace transform {
@@ -51,22 +53,47 @@ Output Manager::Run(const Program* program, const DataMap& data) const {
   };
 #endif
 
+  using Clock = std::chrono::steady_clock;
+
   Output out;
+  std::unique_ptr<Timings> timings;
+  if (auto* cfg = data.Get<Config>(); cfg && cfg->report_timings) {
+    timings = std::make_unique<Timings>();
+    timings->entries.reserve(transforms_.size());
+  }
   for (const auto& transform : transforms_) {
+    auto start = timings ? Clock::now() : Clock::time_point{};
     if (!transform->ShouldRun(in, data)) {
       TINT_IF_PRINT_PROGRAM(std::cout << "Skipping "
                                       << transform->TypeInfo().name);
+      if (timings) {
+        timings->entries.emplace_back(Timings::Entry{
+            &transform->TypeInfo(), false, Clock::now() - start, {}});
+      }
       continue;
     }
     TINT_IF_PRINT_PROGRAM(print_program("Input to", transform.get()));
 
     auto res = transform->Run(in, data);
+    if (timings) {
+      Timings::Entry entry{&transform->TypeInfo(), true, Clock::now() - start,
+                           {}};
+      // A nested Manager reports the timings of its own inner transforms.
+      // Merge them under its entry, the outer Timings replaces them below.
+      if (auto* inner = res.data.Get<Timings>()) {
+        entry.inner = inner->entries;
+      }
+      timings->entries.emplace_back(std::move(entry));
+    }
     out.program = std::move(res.program);
     out.data.Add(std::move(res.data));
     in = &out.program;
     if (!in->IsValid()) {
       TINT_IF_PRINT_PROGRAM(
           print_program("Invalid output of", transform.get()));
+      if (timings) {
+        out.data.Put(std::move(timings));
+      }
       return out;
     }
 
@@ -79,8 +106,19 @@ Output Manager::Run(const Program* program, const DataMap& data) const {
     out.program = program->Clone();
   }
 
+  if (timings) {
+    out.data.Put(std::move(timings));
+  }
   return out;
 }
 
+Manager::Config::Config(bool report) : report_timings(report) {}
+Manager::Config::Config(const Config&) = default;
+Manager::Config::~Config() = default;
+
+Manager::Timings::Timings() = default;
+Manager::Timings::Timings(const Timings&) = default;
+Manager::Timings::~Timings() = default;
+
 }  // namespace transform
 }  // namespace tint
@@ -15,6 +15,7 @@
 #ifndef SRC_TRANSFORM_MANAGER_H_
 #define SRC_TRANSFORM_MANAGER_H_
 
+#include <chrono>  // NOLINT(build/c++11)
 #include <memory>
 #include <utility>
 #include <vector>
@@ -28,8 +29,62 @@ namespace transform {
 /// The inner transforms will execute in the appended order.
 /// If any inner transform fails the manager will return immediately and
 /// the error can be retrieved with the Output's diagnostics.
+/// The time spent in each inner transform is reported with a Timings in the
+/// Output's data when requested with a Config in the input data.
 class Manager : public Castable<Manager, Transform> {
  public:
+  /// Config is consumed by the Manager, and holds the options of the Manager.
+  /// As the input data is passed to the inner transforms, the Config also
+  /// applies to nested Managers.
+  struct Config : public Castable<Config, transform::Data> {
+    /// Constructor
+    /// @param report_timings true to report the time spent in each inner
+    /// transform with a Timings in the output data
+    explicit Config(bool report_timings = false);
+
+    /// Copy constructor
+    Config(const Config&);
+
+    /// Destructor
+    ~Config() override;
+
+    /// True to report the time spent in each inner transform
+    bool report_timings;
+  };
+
+  /// Timings is produced by the Manager as output data when
+  /// Config::report_timings is set, and holds the time spent in each of the
+  /// inner transforms.
+  struct Timings : public Castable<Timings, transform::Data> {
+    /// Entry holds the timing of a single inner transform
+    struct Entry {
+      /// The type of the transform
+      const tint::TypeInfo* transform;
+      /// True if the transform ran, false if ShouldRun() returned false
+      bool ran;
+      /// The time spent in the transform, including ShouldRun(), cloning the
+      /// program and resolving the transformed program
+      std::chrono::nanoseconds duration;
+      /// The timings of the inner transforms if the transform is itself a
+      /// Manager, in the order they were considered
+      std::vector<Entry> inner;
+    };
+
+    /// Constructor
+    Timings();
+
+    /// Copy constructor
+    Timings(const Timings&);
+
+    /// Destructor
+    ~Timings() override;
+
+    /// The timings of the inner transforms, in the order they were
+    /// considered. Transforms that were not reached due to an earlier failure
+    /// are not listed.
+    std::vector<Entry> entries;
+  };
+
   /// Constructor
   Manager();
   ~Manager() override;
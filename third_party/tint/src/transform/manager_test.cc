@@ -0,0 +1,143 @@
+// Copyright 2022 The Tint Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/transform/manager.h"
+
+#include "src/program_builder.h"
+#include "src/transform/test_helper.h"
+
+namespace tint {
+namespace transform {
+namespace {
+
+struct CloneTransform : public Castable<CloneTransform, Transform> {
+ protected:
+  void Run(CloneContext& ctx, const DataMap&, DataMap&) const override {
+    ctx.Clone();
+  }
+};
+
+struct SkippedTransform : public Castable<SkippedTransform, Transform> {
+  bool ShouldRun(const Program*, const DataMap&) const override {
+    return false;
+  }
+};
+
+struct FailingTransform : public Castable<FailingTransform, Transform> {
+ protected:
+  void Run(CloneContext& ctx, const DataMap&, DataMap&) const override {
+    ctx.dst->Diagnostics().add_error(diag::System::Transform, "failed");
+  }
+};
+
+struct NestedManager : public Castable<NestedManager, Manager> {
+  NestedManager() {
+    Add<SkippedTransform>();
+    Add<CloneTransform>();
+  }
+};
+
+using ManagerTest = TransformTest;
+
+TEST_F(ManagerTest, NoTimingsByDefault) {
+  auto* src = R"(
+fn f() {
+}
+)";
+
+  auto got = Run<CloneTransform, NestedManager>(src);
+  EXPECT_EQ(src, str(got));
+  EXPECT_EQ(got.data.Get<Manager::Timings>(), nullptr);
+}
+
+TEST_F(ManagerTest, Timings) {
+  auto* src = R"(
+fn f() {
+}
+)";
+
+  DataMap data;
+  data.Add<Manager::Config>(true);
+  auto got = Run<CloneTransform, SkippedTransform, CloneTransform>(src, data);
+  EXPECT_EQ(src, str(got));
+
+  auto* timings = got.data.Get<Manager::Timings>();
+  ASSERT_NE(timings, nullptr);
+  ASSERT_EQ(timings->entries.size(), 3u);
+  EXPECT_EQ(timings->entries[0].transform, &TypeInfo::Of<CloneTransform>());
+  EXPECT_TRUE(timings->entries[0].ran);
+  EXPECT_EQ(timings->entries[1].transform, &TypeInfo::Of<SkippedTransform>());
+  EXPECT_FALSE(timings->entries[1].ran);
+  EXPECT_EQ(timings->entries[2].transform, &TypeInfo::Of<CloneTransform>());
+  EXPECT_TRUE(timings->entries[2].ran);
+  for (auto& entry : timings->entries) {
+    EXPECT_GE(entry.duration.count(), 0);
+  }
+}
+
+TEST_F(ManagerTest, TimingsStopAtFailure) {
+  auto* src = R"(
+fn f() {
+}
+)";
+
+  DataMap data;
+  data.Add<Manager::Config>(true);
+  auto got = Run<CloneTransform, FailingTransform, CloneTransform>(src, data);
+  EXPECT_FALSE(got.program.IsValid());
+
+  auto* timings = got.data.Get<Manager::Timings>();
+  ASSERT_NE(timings, nullptr);
+  ASSERT_EQ(timings->entries.size(), 2u);
+  EXPECT_EQ(timings->entries[0].transform, &TypeInfo::Of<CloneTransform>());
+  EXPECT_EQ(timings->entries[1].transform, &TypeInfo::Of<FailingTransform>());
+  EXPECT_TRUE(timings->entries[1].ran);
+}
+
+TEST_F(ManagerTest, TimingsOfNestedManager) {
+  auto* src = R"(
+fn f() {
+}
+)";
+
+  DataMap data;
+  data.Add<Manager::Config>(true);
+  auto got = Run<CloneTransform, NestedManager>(src, data);
+  EXPECT_EQ(src, str(got));
+
+  auto* timings = got.data.Get<Manager::Timings>();
+  ASSERT_NE(timings, nullptr);
+  ASSERT_EQ(timings->entries.size(), 2u);
+  EXPECT_EQ(timings->entries[0].transform, &TypeInfo::Of<CloneTransform>());
+  EXPECT_TRUE(timings->entries[0].inner.empty());
+
+  auto& nested = timings->entries[1];
+  EXPECT_EQ(nested.transform, &TypeInfo::Of<NestedManager>());
+  EXPECT_TRUE(nested.ran);
+  ASSERT_EQ(nested.inner.size(), 2u);
+  EXPECT_EQ(nested.inner[0].transform, &TypeInfo::Of<SkippedTransform>());
+  EXPECT_FALSE(nested.inner[0].ran);
+  EXPECT_EQ(nested.inner[1].transform, &TypeInfo::Of<CloneTransform>());
+  EXPECT_TRUE(nested.inner[1].ran);
+  EXPECT_GE(nested.duration, nested.inner[1].duration);
+}
+
+}  // namespace
+}  // namespace transform
+}  // namespace tint
+
+TINT_INSTANTIATE_TYPEINFO(tint::transform::CloneTransform);
+TINT_INSTANTIATE_TYPEINFO(tint::transform::SkippedTransform);
+TINT_INSTANTIATE_TYPEINFO(tint::transform::FailingTransform);
+TINT_INSTANTIATE_TYPEINFO(tint::transform::NestedManager);
@@ -16,17 +16,23 @@
 
 #include <algorithm>
 #include <limits>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "src/program_builder.h"
 #include "src/sem/block_statement.h"
 #include "src/sem/call.h"
 #include "src/sem/expression.h"
+#include "src/sem/for_loop_statement.h"
 #include "src/sem/reference_type.h"
 #include "src/sem/statement.h"
+#include "src/sem/type_conversion.h"
+#include "src/sem/variable.h"
 
 TINT_INSTANTIATE_TYPEINFO(tint::transform::Robustness);
 TINT_INSTANTIATE_TYPEINFO(tint::transform::Robustness::Config);
+TINT_INSTANTIATE_TYPEINFO(tint::transform::Robustness::Statistics);
 
 namespace tint {
 namespace transform {
@@ -39,6 +45,44 @@ struct Robustness::State {
   /// Set of storage classes to not apply the transform to
   std::unordered_set<ast::StorageClass> omitted_classes;
 
+  /// The number of accesses with a clamped index
+  uint32_t clamped = 0;
+
+  /// The number of accesses with an index proven to be in bounds
+  uint32_t elided = 0;
+
+  /// Range is an inclusive range of integer values
+  struct Range {
+    /// True if the range is known
+    bool valid = false;
+    /// The smallest value
+    int64_t min = 0;
+    /// The largest value
+    int64_t max = 0;
+  };
+
+  /// Writes holds the statements that may modify a function-scope variable
+  /// after its declaration
+  struct Writes {
+    /// The assignments to the variable
+    std::vector<const ast::AssignmentStatement*> assignments;
+    /// True if a pointer to the variable is taken
+    bool address_taken = false;
+  };
+
+  /// The writes to each function-scope variable, built by GetWrites()
+  std::unordered_map<const sem::Variable*, Writes> writes = {};
+  /// True once `writes` has been built
+  bool writes_gathered = false;
+
+  /// The ranges computed by RangeOf(), so that expressions shared by several
+  /// indices, such as `let` initializers, are only analyzed once
+  std::unordered_map<const sem::Expression*, Range> ranges = {};
+
+  /// The maximum depth of expressions and variable initializers followed by
+  /// RangeOf()
+  static constexpr uint32_t kMaxRangeDepth = 16;
+
   /// Applies the transformation state to `ctx`.
   void Transform() {
     ctx.ReplaceAll([&](const ast::IndexAccessorExpression* expr) {
@@ -141,6 +185,14 @@ struct Robustness::State {
       }
     } else {
       // Dynamic value index
+      if (!limit.expr) {
+        auto range = RangeOf(idx_sem, 0);
+        if (range.valid && range.min >= 0 && range.max <= limit.u32) {
+          // The index is always in bounds, so clone without changes.
+          elided++;
+          return nullptr;
+        }
+      }
       idx.expr = ctx.Clone(expr->index);
       idx.is_signed = idx_ty->Is<sem::I32>();
     }
@@ -173,18 +225,27 @@ struct Robustness::State {
 
       // Perform the clamp with `min(idx, limit)`
       idx.expr = b.Call("min", idx.expr, limit.expr);
+      clamped++;
     } else {
       // Both idx and max are constant.
+      bool in_bounds = false;
       if (idx.is_signed) {
         // The index is signed. Calculate limit as signed.
         int32_t signed_limit = static_cast<int32_t>(
             std::min<uint32_t>(limit.u32, std::numeric_limits<int32_t>::max()));
+        in_bounds = idx.i32 >= 0 && idx.i32 <= signed_limit;
         idx.i32 = std::max(idx.i32, 0);
         idx.i32 = std::min(idx.i32, signed_limit);
       } else {
         // The index is unsigned.
+        in_bounds = idx.u32 <= limit.u32;
         idx.u32 = std::min(idx.u32, limit.u32);
       }
+      if (in_bounds) {
+        elided++;
+      } else {
+        clamped++;
+      }
     }
 
     // Convert idx to an expression, so we can emit the new accessor.
@@ -200,6 +261,315 @@ struct Robustness::State {
     return b.IndexAccessor(src, obj, idx.expr);
   }
 
+  /// @param expr the expression
+  /// @param depth the number of expressions and variables followed to reach
+  /// `expr`
+  /// @returns the range of values that `expr` may evaluate to. If nothing is
+  /// known about `expr`, this is the full range of its type. The range is
+  /// invalid if `expr` is not an i32 or u32 scalar.
+  Range RangeOf(const sem::Expression* expr, uint32_t depth) {
+    if (!expr) {
+      return {};
+    }
+    auto* ty = expr->Type()->UnwrapRef();
+    Range type_range;
+    if (ty->Is<sem::I32>()) {
+      type_range = {true, std::numeric_limits<int32_t>::min(),
+                    std::numeric_limits<int32_t>::max()};
+    } else if (ty->Is<sem::U32>()) {
+      type_range = {true, 0, std::numeric_limits<uint32_t>::max()};
+    } else {
+      return {};
+    }
+
+    if (auto constant = expr->ConstantValue()) {
+      auto& value = constant.Elements()[0];
+      int64_t v = ty->Is<sem::I32>() ? int64_t{value.i32} : int64_t{value.u32};
+      return {true, v, v};
+    }
+    if (depth > kMaxRangeDepth) {
+      return type_range;
+    }
+    auto cached = ranges.find(expr);
+    if (cached != ranges.end()) {
+      return cached->second;
+    }
+
+    Range result;
+
+    Switch(
+        expr,  //
+        [&](const sem::VariableUser* user) {
+          result = RangeOfVariable(user, depth + 1);
+        },
+        [&](const sem::Call* call) {
+          result = RangeOfCall(call, depth + 1);
+        },
+        [&](Default) {
+          auto* binary = expr->Declaration()->As<ast::BinaryExpression>();
+          if (binary) {
+            result = RangeOfBinary(binary, depth + 1);
+          }
+        });
+
+    // Discard ranges that do not fit the type, as the expression may wrap.
+    if (!result.valid || result.min < type_range.min ||
+        result.max > type_range.max) {
+      result = type_range;
+    }
+    ranges.emplace(expr, result);
+    return result;
+  }
+
+  /// @param user the variable expression
+  /// @param depth the RangeOf() depth of `user`
+  /// @returns the range of values that the variable may hold at `user`
+  Range RangeOfVariable(const sem::VariableUser* user, uint32_t depth) {
+    auto* var = user->Variable()->As<sem::LocalVariable>();
+    if (!var || !var->Constructor()) {
+      return {};
+    }
+    auto* decl = var->Declaration();
+    if (decl->is_const) {
+      // let: the value is the constructor
+      return RangeOf(var->Constructor(), depth);
+    }
+    auto& var_writes = GetWrites(var);
+    if (var_writes.address_taken) {
+      return {};
+    }
+    if (var_writes.assignments.empty()) {
+      // var that is never reassigned: the value is the constructor
+      return RangeOf(var->Constructor(), depth);
+    }
+    if (var_writes.assignments.size() == 1) {
+      return RangeOfInductionVariable(user, var, var_writes.assignments[0],
+                                      depth);
+    }
+    return {};
+  }
+
+  /// Determines the range of a `for` loop induction variable within the body
+  /// of the loop. The loop must have the form:
+  ///   for (var i = <init>; i < <end>; i = i + <step>) { <body> }
+  /// where `i` is not otherwise written to or referenced by pointer, and
+  /// <step> is a positive constant. `<=`, and `>` or `>=` with the operands
+  /// reversed, may also be used in the condition.
+  /// @param user the variable expression
+  /// @param var the variable
+  /// @param assignment the only assignment to `var`
+  /// @param depth the RangeOf() depth of `user`
+  /// @returns the range of values that `var` may hold at `user`
+  Range RangeOfInductionVariable(const sem::VariableUser* user,
+                                 const sem::LocalVariable* var,
+                                 const ast::AssignmentStatement* assignment,
+                                 uint32_t depth) {
+    auto& sem = ctx.src->Sem();
+    auto* loop = var->Statement()->Parent()->As<sem::ForLoopStatement>();
+    if (!loop) {
+      return {};
+    }
+    auto* loop_decl = loop->Declaration();
+    if (loop_decl->initializer != var->Statement()->Declaration() ||
+        loop_decl->continuing != assignment) {
+      return {};
+    }
+
+    // `user` must be in the body of the loop
+    bool in_body = false;
+    for (auto* stmt = user->Stmt(); stmt && stmt != loop;
+         stmt = stmt->Parent()) {
+      if (stmt->Declaration() == loop_decl->body) {
+        in_body = true;
+        break;
+      }
+    }
+    if (!in_body) {
+      return {};
+    }
+
+    // Continuing: `i = i + <step>` or `i = <step> + i`
+    auto* inc = assignment->rhs->As<ast::BinaryExpression>();
+    if (!inc || inc->op != ast::BinaryOp::kAdd) {
+      return {};
+    }
+    auto* step_expr = IsUserOf(inc->lhs, var) ? inc->rhs : inc->lhs;
+    if (!IsUserOf(inc->lhs, var) && !IsUserOf(inc->rhs, var)) {
+      return {};
+    }
+    auto step = RangeOf(sem.Get(step_expr), depth);
+    if (!step.valid || step.min != step.max || step.min <= 0) {
+      return {};
+    }
+
+    // Condition: `i < <end>`, `i <= <end>`, `<end> > i` or `<end> >= i`
+    auto* cond = loop_decl->condition
+                     ? loop_decl->condition->As<ast::BinaryExpression>()
+                     : nullptr;
+    if (!cond) {
+      return {};
+    }
+    const ast::Expression* end_expr = nullptr;
+    bool inclusive = false;
+    if (IsUserOf(cond->lhs, var) &&
+        (cond->IsLessThan() || cond->IsLessThanEqual())) {
+      end_expr = cond->rhs;
+      inclusive = cond->IsLessThanEqual();
+    } else if (IsUserOf(cond->rhs, var) &&
+               (cond->IsGreaterThan() || cond->IsGreaterThanEqual())) {
+      end_expr = cond->lhs;
+      inclusive = cond->IsGreaterThanEqual();
+    } else {
+      return {};
+    }
+    auto end = RangeOf(sem.Get(end_expr), depth);
+    auto init = RangeOf(var->Constructor(), depth);
+    if (!end.valid || !init.valid) {
+      return {};
+    }
+
+    int64_t max = inclusive ? end.max : end.max - 1;
+    // The increment after the last iteration must not wrap, otherwise the
+    // condition may hold again with a smaller value.
+    auto* ty = var->Type()->UnwrapRef();
+    int64_t type_max = ty->Is<sem::I32>()
+                           ? std::numeric_limits<int32_t>::max()
+                           : std::numeric_limits<uint32_t>::max();
+    if (max + step.max > type_max) {
+      return {};
+    }
+    return {true, init.min, std::max(init.max, max)};
+  }
+
+  /// @returns true if `expr` is an identifier that resolves to `var`
+  bool IsUserOf(const ast::Expression* expr, const sem::Variable* var) {
+    auto* user = ctx.src->Sem().Get<sem::VariableUser>(expr);
+    return user && user->Variable() == var;
+  }
+
+  /// @param call the call expression
+  /// @param depth the RangeOf() depth of `call`
+  /// @returns the range of the result of the type conversion, or `min()`,
+  /// `max()` or `clamp()` builtin call
+  Range RangeOfCall(const sem::Call* call, uint32_t depth) {
+    auto& args = call->Arguments();
+    if (call->Target()->Is<sem::TypeConversion>()) {
+      // Conversions between i32 and u32 preserve the values that fit both
+      // types. RangeOf() widens the range to the target type otherwise.
+      return args.size() == 1 ? RangeOf(args[0], depth) : Range{};
+    }
+    auto* builtin = call->Target()->As<sem::Builtin>();
+    if (!builtin) {
+      return {};
+    }
+    std::vector<Range> ranges;
+    for (auto* arg : args) {
+      ranges.emplace_back(RangeOf(arg, depth));
+      if (!ranges.back().valid) {
+        return {};
+      }
+    }
+    switch (builtin->Type()) {
+      case sem::BuiltinType::kMin:
+        return {true, std::min(ranges[0].min, ranges[1].min),
+                std::min(ranges[0].max, ranges[1].max)};
+      case sem::BuiltinType::kMax:
+        return {true, std::max(ranges[0].min, ranges[1].min),
+                std::max(ranges[0].max, ranges[1].max)};
+      case sem::BuiltinType::kClamp:
+        // clamp(e, low, high) is min(max(e, low), high) only when low <= high.
+        // Otherwise the result is undefined in MSL, GLSL and SPIR-V.
+        if (ranges[1].max > ranges[2].min) {
+          return {};
+        }
+        return {true,
+                std::min(std::max(ranges[0].min, ranges[1].min), ranges[2].min),
+                std::min(std::max(ranges[0].max, ranges[1].max),
+                         ranges[2].max)};
+      default:
+        return {};
+    }
+  }
+
+  /// @param binary the binary expression
+  /// @param depth the RangeOf() depth of `binary`
+  /// @returns the range of the result of the binary expression
+  Range RangeOfBinary(const ast::BinaryExpression* binary, uint32_t depth) {
+    auto lhs = RangeOf(ctx.src->Sem().Get(binary->lhs), depth);
+    auto rhs = RangeOf(ctx.src->Sem().Get(binary->rhs), depth);
+    if (!lhs.valid || !rhs.valid) {
+      return {};
+    }
+    switch (binary->op) {
+      case ast::BinaryOp::kAdd:
+        return {true, lhs.min + rhs.min, lhs.max + rhs.max};
+      case ast::BinaryOp::kSubtract:
+        return {true, lhs.min - rhs.max, lhs.max - rhs.min};
+      case ast::BinaryOp::kMultiply: {
+        // Limit the operands so that the products cannot overflow int64_t
+        constexpr int64_t kLimit = int64_t{1} << 31;
+        for (auto v : {lhs.min, lhs.max, rhs.min, rhs.max}) {
+          if (v < -kLimit || v > kLimit) {
+            return {};
+          }
+        }
+        auto products = {lhs.min * rhs.min, lhs.min * rhs.max,
+                         lhs.max * rhs.min, lhs.max * rhs.max};
+        return {true, std::min(products), std::max(products)};
+      }
+      case ast::BinaryOp::kModulo:
+        // With a non-negative dividend and positive divisor, the remainder is
+        // less than both the divisor and the dividend.
+        if (lhs.min >= 0 && rhs.min > 0) {
+          return {true, 0, std::min(lhs.max, rhs.max - 1)};
+        }
+        return {};
+      case ast::BinaryOp::kAnd:
+        // Masking with a non-negative mask clears the sign bit
+        if (lhs.min >= 0 || rhs.min >= 0) {
+          int64_t max = std::numeric_limits<int64_t>::max();
+          if (lhs.min >= 0) {
+            max = std::min(max, lhs.max);
+          }
+          if (rhs.min >= 0) {
+            max = std::min(max, rhs.max);
+          }
+          return {true, 0, max};
+        }
+        return {};
+      case ast::BinaryOp::kShiftRight:
+        if (lhs.min >= 0 && rhs.min >= 0 && rhs.max < 32) {
+          return {true, lhs.min >> rhs.max, lhs.max >> rhs.min};
+        }
+        return {};
+      default:
+        return {};
+    }
+  }
+
+  /// @param var the function-scope variable
+  /// @returns the writes to `var` after its declaration
+  const Writes& GetWrites(const sem::Variable* var) {
+    if (!writes_gathered) {
+      auto& sem = ctx.src->Sem();
+      for (auto* node : ctx.src->ASTNodes().Objects()) {
+        if (auto* assign = node->As<ast::AssignmentStatement>()) {
+          if (auto* user = sem.Get<sem::VariableUser>(assign->lhs)) {
+            writes[user->Variable()].assignments.emplace_back(assign);
+          }
+        } else if (auto* unary = node->As<ast::UnaryOpExpression>()) {
+          if (unary->op == ast::UnaryOp::kAddressOf) {
+            if (auto* user = sem.Get<sem::VariableUser>(unary->expr)) {
+              writes[user->Variable()].address_taken = true;
+            }
+          }
+        }
+      }
+      writes_gathered = true;
+    }
+    return writes[var];
+  }
+
   /// @param type builtin type
   /// @returns true if the given builtin is a texture function that requires
   /// argument clamping,
@@ -290,10 +660,17 @@ Robustness::Config::Config(const Config&) = default;
 Robustness::Config::~Config() = default;
 Robustness::Config& Robustness::Config::operator=(const Config&) = default;
 
+Robustness::Statistics::Statistics(uint32_t c, uint32_t e)
+    : clamped(c), elided(e) {}
+Robustness::Statistics::Statistics(const Statistics&) = default;
+Robustness::Statistics::~Statistics() = default;
+
 Robustness::Robustness() = default;
 Robustness::~Robustness() = default;
 
-void Robustness::Run(CloneContext& ctx, const DataMap& inputs, DataMap&) const {
+void Robustness::Run(CloneContext& ctx,
+                     const DataMap& inputs,
+                     DataMap& outputs) const {
   Config cfg;
   if (auto* cfg_data = inputs.Get<Config>()) {
     cfg = *cfg_data;
@@ -315,6 +692,8 @@ void Robustness::Run(CloneContext& ctx, const DataMap& inputs, DataMap&) const {
 
   state.Transform();
   ctx.Clone();
+
+  outputs.Add<Statistics>(state.clamped, state.elided);
 }
 
 }  // namespace transform
@@ -34,6 +34,11 @@ namespace transform {
 /// the bounds of the array. Any access before the start of the array will clamp
 /// to zero and any access past the end of the array will clamp to
 /// (array length - 1).
+/// Accesses to fixed size arrays, vectors and matrices are left unclamped if
+/// a range analysis of the index proves that it is always in bounds. The
+/// analysis understands constants, `let`s and never-reassigned `var`s, the
+/// induction variables of `for` loops with a constant step, arithmetic on
+/// these, and the `min()`, `max()` and `clamp()` builtins.
 class Robustness : public Castable<Robustness, Transform> {
  public:
   /// Storage class to be skipped in the transform
@@ -62,6 +67,29 @@ class Robustness : public Castable<Robustness, Transform> {
     std::unordered_set<StorageClass> omitted_classes;
   };
 
+  /// Statistics is the output data of the transform, counting the array,
+  /// vector and matrix accesses that were processed.
+  struct Statistics : public Castable<Statistics, Data> {
+    /// Constructor
+    /// @param clamped the number of accesses with a clamped index
+    /// @param elided the number of accesses with an index proven to be in
+    /// bounds
+    Statistics(uint32_t clamped, uint32_t elided);
+
+    /// Copy constructor
+    Statistics(const Statistics&);
+
+    /// Destructor
+    ~Statistics() override;
+
+    /// The number of accesses whose index was clamped, either at runtime or,
+    /// for out of bounds constant indices, at compile time
+    const uint32_t clamped;
+    /// The number of accesses whose index was proven to be in bounds, and so
+    /// were left unchanged
+    const uint32_t elided;
+  };
+
   /// Constructor
   Robustness();
   /// Destructor
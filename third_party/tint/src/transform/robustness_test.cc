@@ -1740,6 +1740,352 @@ fn f() {
   EXPECT_EQ(expect, str(got));
 }
 
+TEST_F(RobustnessTest, Elide_ForLoop_ConstantBounds) {
+  auto* src = R"(
+var<private> a : array<f32, 4>;
+
+var<private> m : array<array<f32, 4>, 8>;
+
+fn f() {
+  for(var i : i32 = 0; (i < 4); i = (i + 1)) {
+    a[i] = 1.0;
+    for(var j = 0u; (8u > j); j = (2u + j)) {
+      m[j][i] = a[i];
+    }
+  }
+}
+)";
+
+  auto* expect = src;
+
+  auto got = Run<Robustness>(src);
+
+  EXPECT_EQ(expect, str(got));
+}
+
+TEST_F(RobustnessTest, Elide_ForLoop_InclusiveBound) {
+  auto* src = R"(
+var<private> a : array<f32, 4>;
+
+fn f() {
+  for(var i : u32 = 1u; (i <= 3u); i = (i + 1u)) {
+    a[i] = 1.0;
+  }
+}
+)";
+
+  auto* expect = src;
+
+  auto got = Run<Robustness>(src);
+
+  EXPECT_EQ(expect, str(got));
+}
+
+TEST_F(RobustnessTest, Elide_Let) {
+  auto* src = R"(
+var<private> a : array<f32, 8>;
+
+var<private> v : vec4<f32>;
+
+var<private> x : u32;
+
+fn f() {
+  for(var i : i32 = 0; (i < 4); i = (i + 1)) {
+    let j = ((i * 2) + 1);
+    a[j] = 1.0;
+    let k = (u32(i) % 3u);
+    v[k] = a[(7 - j)];
+  }
+  let l = (x & 7u);
+  a[l] = 2.0;
+  v[min(x, 3u)] = 3.0;
+  v[clamp(i32(x), 0, 3)] = 4.0;
+  a[(x >> 29u)] = 5.0;
+}
+)";
+
+  auto* expect = src;
+
+  auto got = Run<Robustness>(src);
+
+  EXPECT_EQ(expect, str(got));
+}
+
+TEST_F(RobustnessTest, Elide_VarNeverAssigned) {
+  auto* src = R"(
+var<private> a : array<f32, 4>;
+
+fn f() {
+  var i : i32 = 3;
+  a[i] = 1.0;
+}
+)";
+
+  auto* expect = src;
+
+  auto got = Run<Robustness>(src);
+
+  EXPECT_EQ(expect, str(got));
+}
+
+TEST_F(RobustnessTest, Retain_ForLoop_BoundTooLarge) {
+  auto* src = R"(
+var<private> a : array<f32, 4>;
+
+fn f() {
+  for(var i : i32 = 0; (i <= 4); i = (i + 1)) {
+    a[i] = 1.0;
+  }
+}
+)";
+
+  auto* expect = R"(
+var<private> a : array<f32, 4>;
+
+fn f() {
+  for(var i : i32 = 0; (i <= 4); i = (i + 1)) {
+    a[min(u32(i), 3u)] = 1.0;
+  }
+}
+)";
+
+  auto got = Run<Robustness>(src);
+
+  EXPECT_EQ(expect, str(got));
+}
+
+TEST_F(RobustnessTest, Retain_ForLoop_NegativeStart) {
+  auto* src = R"(
+var<private> a : array<f32, 4>;
+
+fn f() {
+  for(var i : i32 = -1; (i < 4); i = (i + 1)) {
+    a[i] = 1.0;
+  }
+}
+)";
+
+  auto* expect = R"(
+var<private> a : array<f32, 4>;
+
+fn f() {
+  for(var i : i32 = -1; (i < 4); i = (i + 1)) {
+    a[min(u32(i), 3u)] = 1.0;
+  }
+}
+)";
+
+  auto got = Run<Robustness>(src);
+
+  EXPECT_EQ(expect, str(got));
+}
+
+TEST_F(RobustnessTest, Retain_ForLoop_Decrement) {
+  auto* src = R"(
+var<private> a : array<f32, 4>;
+
+fn f() {
+  for(var i : i32 = 0; (i < 4); i = (i - 1)) {
+    a[i] = 1.0;
+  }
+}
+)";
+
+  auto* expect = R"(
+var<private> a : array<f32, 4>;
+
+fn f() {
+  for(var i : i32 = 0; (i < 4); i = (i - 1)) {
+    a[min(u32(i), 3u)] = 1.0;
+  }
+}
+)";
+
+  auto got = Run<Robustness>(src);
+
+  EXPECT_EQ(expect, str(got));
+}
+
+TEST_F(RobustnessTest, Retain_ForLoop_AssignedInBody) {
+  auto* src = R"(
+var<private> a : array<f32, 4>;
+
+fn f() {
+  for(var i : i32 = 0; (i < 4); i = (i + 1)) {
+    i = (i + 2);
+    a[i] = 1.0;
+  }
+}
+)";
+
+  auto* expect = R"(
+var<private> a : array<f32, 4>;
+
+fn f() {
+  for(var i : i32 = 0; (i < 4); i = (i + 1)) {
+    i = (i + 2);
+    a[min(u32(i), 3u)] = 1.0;
+  }
+}
+)";
+
+  auto got = Run<Robustness>(src);
+
+  EXPECT_EQ(expect, str(got));
+}
+
+TEST_F(RobustnessTest, Retain_ForLoop_AddressTaken) {
+  auto* src = R"(
+var<private> a : array<f32, 4>;
+
+fn g(p : ptr<function, i32>) {
+  *(p) = 10;
+}
+
+fn f() {
+  for(var i : i32 = 0; (i < 4); i = (i + 1)) {
+    g(&(i));
+    a[i] = 1.0;
+  }
+}
+)";
+
+  auto* expect = R"(
+var<private> a : array<f32, 4>;
+
+fn g(p : ptr<function, i32>) {
+  *(p) = 10;
+}
+
+fn f() {
+  for(var i : i32 = 0; (i < 4); i = (i + 1)) {
+    g(&(i));
+    a[min(u32(i), 3u)] = 1.0;
+  }
+}
+)";
+
+  auto got = Run<Robustness>(src);
+
+  EXPECT_EQ(expect, str(got));
+}
+
+TEST_F(RobustnessTest, Retain_ForLoop_StepMayWrap) {
+  auto* src = R"(
+var<private> a : array<f32, 4>;
+
+fn f() {
+  for(var i : u32 = 0u; (i <= 4294967295u); i = (i + 1u)) {
+    a[(i & 3u)] = 1.0;
+    a[i] = 1.0;
+  }
+}
+)";
+
+  auto* expect = R"(
+var<private> a : array<f32, 4>;
+
+fn f() {
+  for(var i : u32 = 0u; (i <= 4294967295u); i = (i + 1u)) {
+    a[(i & 3u)] = 1.0;
+    a[min(i, 3u)] = 1.0;
+  }
+}
+)";
+
+  auto got = Run<Robustness>(src);
+
+  EXPECT_EQ(expect, str(got));
+}
+
+TEST_F(RobustnessTest, Retain_Let_OutOfRange) {
+  auto* src = R"(
+var<private> a : array<f32, 4>;
+
+var<private> x : u32;
+
+fn f(p : u32) {
+  for(var i : i32 = 0; (i < 4); i = (i + 1)) {
+    let j = (i + 1);
+    a[j] = 1.0;
+  }
+  let k = (x & 4u);
+  a[k] = 2.0;
+  a[p] = 3.0;
+}
+)";
+
+  auto* expect = R"(
+var<private> a : array<f32, 4>;
+
+var<private> x : u32;
+
+fn f(p : u32) {
+  for(var i : i32 = 0; (i < 4); i = (i + 1)) {
+    let j = (i + 1);
+    a[min(u32(j), 3u)] = 1.0;
+  }
+  let k = (x & 4u);
+  a[min(k, 3u)] = 2.0;
+  a[min(p, 3u)] = 3.0;
+}
+)";
+
+  auto got = Run<Robustness>(src);
+
+  EXPECT_EQ(expect, str(got));
+}
+
+TEST_F(RobustnessTest, Retain_Clamp_LowGreaterThanHigh) {
+  auto* src = R"(
+var<private> a : array<f32, 4>;
+
+var<private> x : u32;
+
+fn f() {
+  a[clamp(x, 10u, 3u)] = 1.0;
+}
+)";
+
+  auto* expect = R"(
+var<private> a : array<f32, 4>;
+
+var<private> x : u32;
+
+fn f() {
+  a[min(clamp(x, 10u, 3u), 3u)] = 1.0;
+}
+)";
+
+  auto got = Run<Robustness>(src);
+
+  EXPECT_EQ(expect, str(got));
+}
+
+TEST_F(RobustnessTest, Statistics) {
+  auto* src = R"(
+var<private> a : array<f32, 4>;
+
+var<private> x : u32;
+
+fn f() {
+  for(var i : i32 = 0; (i < 4); i = (i + 1)) {
+    a[i] = a[(i + 1)];
+  }
+  a[x] = a[2];
+  a[5] = 1.0;
+}
+)";
+
+  auto got = Run<Robustness>(src);
+  ASSERT_TRUE(got.program.IsValid()) << str(got);
+
+  auto* stats = got.data.Get<Robustness::Statistics>();
+  ASSERT_NE(stats, nullptr);
+  EXPECT_EQ(stats->clamped, 3u);
+  EXPECT_EQ(stats->elided, 2u);
+}
+
 }  // namespace
 }  // namespace transform
 }  // namespace tint
@@ -0,0 +1,111 @@
+// Copyright 2022 The Tint Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SRC_UTILS_STRING_STREAM_H_
+#define SRC_UTILS_STRING_STREAM_H_
+
+#include <charconv>
+#include <cstdio>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace tint {
+namespace utils {
+
+/// SetPrecision sets the number of significant digits used to write the
+/// floating point values that follow it to a StringStream, like
+/// std::setprecision().
+struct SetPrecision {
+  /// Constructor
+  /// @param d the number of significant digits
+  explicit SetPrecision(int d) : digits(d) {}
+  /// The number of significant digits
+  int digits;
+};
+
+/// StringStream appends the values written to it to a std::string.
+/// Strings, characters, integers and floating point values are formatted the
+/// way a default-constructed std::ostream formats them, but without going
+/// through the iostream machinery. Only values of other types, such as enums
+/// with an `operator<<(std::ostream&, ...)`, are formatted with a
+/// std::ostringstream.
+class StringStream {
+ public:
+  /// Constructor
+  StringStream() = default;
+
+  /// Constructor
+  /// @param str the string to append to. Used to reuse the storage of a
+  /// string that is no longer needed.
+  explicit StringStream(std::string&& str) : str_(std::move(str)) {}
+
+  /// @param value the value to append
+  /// @returns this StringStream so calls can be chained
+  template <typename T>
+  StringStream& operator<<(const T& value) {
+    if constexpr (std::is_convertible_v<const T&, std::string_view>) {
+      str_.append(std::string_view(value));
+    } else if constexpr (std::is_same_v<T, char> ||
+                         std::is_same_v<T, signed char> ||
+                         std::is_same_v<T, unsigned char>) {
+      str_.push_back(static_cast<char>(value));
+    } else if constexpr (std::is_same_v<T, bool>) {
+      str_.push_back(value ? '1' : '0');
+    } else if constexpr (std::is_integral_v<T>) {
+      char buf[24];
+      auto result = std::to_chars(buf, buf + sizeof(buf), value);
+      str_.append(buf, result.ptr);
+    } else if constexpr (std::is_floating_point_v<T>) {
+      char buf[64];
+      int len = snprintf(buf, sizeof(buf), "%.*g", precision_,
+                         static_cast<double>(value));
+      str_.append(buf, static_cast<size_t>(len));
+    } else if constexpr (std::is_same_v<T, SetPrecision>) {
+      precision_ = value.digits;
+    } else {
+      std::ostringstream ss;
+      ss << value;
+      str_.append(ss.str());
+    }
+    return *this;
+  }
+
+  /// @returns the string written so far
+  const std::string& str() const { return str_; }
+
+  /// Removes the string written so far from the StringStream, and restores
+  /// the default formatting.
+  /// @returns the string written so far
+  std::string Release() {
+    std::string str = std::move(str_);
+    str_.clear();
+    precision_ = kDefaultPrecision;
+    return str;
+  }
+
+ private:
+  /// The default number of significant digits of floating point values
+  static constexpr int kDefaultPrecision = 6;
+
+  std::string str_;
+  int precision_ = kDefaultPrecision;
+};
+
+}  // namespace utils
+}  // namespace tint
+
+#endif  // SRC_UTILS_STRING_STREAM_H_
@@ -0,0 +1,88 @@
+// Copyright 2022 The Tint Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/utils/string_stream.h"
+
+#include <cstdint>
+#include <limits>
+#include <sstream>
+
+#include "gtest/gtest.h"
+
+namespace tint {
+namespace utils {
+namespace {
+
+enum class Color { kRed };
+
+std::ostream& operator<<(std::ostream& out, Color) {
+  return out << "red";
+}
+
+// Returns the value formatted with a std::stringstream
+template <typename T>
+std::string ToStdString(const T& value) {
+  std::stringstream ss;
+  ss << value;
+  return ss.str();
+}
+
+// Returns the value formatted with a StringStream
+template <typename T>
+std::string ToString(const T& value) {
+  StringStream ss;
+  ss << value;
+  return ss.str();
+}
+
+TEST(StringStreamTest, Strings) {
+  StringStream ss;
+  std::string str = "b";
+  ss << "a" << str << std::string_view("c") << 'd';
+  EXPECT_EQ(ss.str(), "abcd");
+}
+
+TEST(StringStreamTest, MatchesStdStringStream) {
+  EXPECT_EQ(ToString(true), ToStdString(true));
+  EXPECT_EQ(ToString(0), ToStdString(0));
+  EXPECT_EQ(ToString(-42), ToStdString(-42));
+  EXPECT_EQ(ToString(std::numeric_limits<int64_t>::min()),
+            ToStdString(std::numeric_limits<int64_t>::min()));
+  EXPECT_EQ(ToString(std::numeric_limits<uint64_t>::max()),
+            ToStdString(std::numeric_limits<uint64_t>::max()));
+  EXPECT_EQ(ToString(1.0f), ToStdString(1.0f));
+  EXPECT_EQ(ToString(0.1f), ToStdString(0.1f));
+  EXPECT_EQ(ToString(-123456789.0), ToStdString(-123456789.0));
+  EXPECT_EQ(ToString(1e-20), ToStdString(1e-20));
+  EXPECT_EQ(ToString(Color::kRed), ToStdString(Color::kRed));
+}
+
+TEST(StringStreamTest, SetPrecision) {
+  StringStream ss;
+  ss << 3.14159265358979 << " " << SetPrecision(12) << 3.14159265358979;
+  EXPECT_EQ(ss.str(), "3.14159 3.14159265359");
+}
+
+TEST(StringStreamTest, Release) {
+  StringStream ss;
+  ss << SetPrecision(2) << 1.234;
+  EXPECT_EQ(ss.Release(), "1.2");
+  EXPECT_EQ(ss.str(), "");
+  ss << 1.234;
+  EXPECT_EQ(ss.str(), "1.234");
+}
+
+}  // namespace
+}  // namespace utils
+}  // namespace tint
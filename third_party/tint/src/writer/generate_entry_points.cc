@@ -0,0 +1,91 @@
+// Copyright 2022 The Tint Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/writer/generate_entry_points.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace tint {
+namespace writer {
+
+size_t DefaultGenerateThreadCount() {
+  return std::max(1u, std::thread::hardware_concurrency());
+}
+
+namespace detail {
+
+void ParallelFor(size_t count,
+                 const Executor& executor,
+                 size_t max_parallelism,
+                 const std::function<void(size_t)>& task) {
+  if (max_parallelism == 0) {
+    max_parallelism = DefaultGenerateThreadCount();
+  }
+  size_t num_helpers = executor ? std::min(count, max_parallelism) : 0;
+  if (num_helpers <= 1) {
+    for (size_t i = 0; i < count; i++) {
+      task(i);
+    }
+    return;
+  }
+
+  // The state is shared with the posted helpers, which may outlive this call
+  // if the executor only starts them after all the tasks have been taken.
+  // `task` is only reachable through a taken task, and this call waits for
+  // all the taken tasks to finish.
+  struct State {
+    std::mutex mutex;
+    std::condition_variable finished;
+    size_t next = 0;
+    size_t running = 0;
+    size_t count = 0;
+    const std::function<void(size_t)>* task = nullptr;
+  };
+  auto state = std::make_shared<State>();
+  state->count = count;
+  state->task = &task;
+
+  // Each helper repeatedly takes the next unstarted task, so a long running
+  // task does not hold back the tasks queued behind it.
+  auto run = [](State& s) {
+    std::unique_lock<std::mutex> lock(s.mutex);
+    while (s.next < s.count) {
+      size_t i = s.next++;
+      s.running++;
+      lock.unlock();
+      (*s.task)(i);
+      lock.lock();
+      s.running--;
+    }
+    if (s.running == 0) {
+      s.finished.notify_all();
+    }
+  };
+
+  for (size_t i = 1; i < num_helpers; i++) {
+    executor([state, run] { run(*state); });
+  }
+  run(*state);
+
+  std::unique_lock<std::mutex> lock(state->mutex);
+  state->finished.wait(lock, [&] { return state->running == 0; });
+}
+
+}  // namespace detail
+}  // namespace writer
+}  // namespace tint
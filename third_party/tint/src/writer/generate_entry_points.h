@@ -0,0 +1,101 @@
+// Copyright 2022 The Tint Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SRC_WRITER_GENERATE_ENTRY_POINTS_H_
+#define SRC_WRITER_GENERATE_ENTRY_POINTS_H_
+
+#include <functional>
+#include <type_traits>
+#include <vector>
+
+namespace tint {
+
+// Forward declarations
+class Program;
+
+namespace writer {
+
+/// Executor runs a function asynchronously, for example by posting it to a
+/// thread pool such as Dawn's dawn::platform::WorkerTaskPool. The function may
+/// be run on any thread, at any time, including after the call that posted it
+/// has returned.
+using Executor = std::function<void(std::function<void()>)>;
+
+/// @returns the parallelism used by GenerateEntryPoints() when
+/// `max_parallelism` is 0. This is the number of hardware threads, or 1 if
+/// that cannot be determined.
+size_t DefaultGenerateThreadCount();
+
+namespace detail {
+
+/// Calls `task(i)` once for each `i` in [0, `count`), on the calling thread and
+/// on up to `max_parallelism - 1` functions posted to `executor`. Returns once
+/// all the calls have returned. A posted function that only starts running
+/// after all the tasks have been taken returns without calling `task`, so
+/// ParallelFor() never waits for the executor to start a function.
+/// @param count the number of tasks
+/// @param executor the executor to post the helper functions to. If empty,
+/// all the tasks are called on the calling thread.
+/// @param max_parallelism the maximum number of tasks to run at once. If 0,
+/// then DefaultGenerateThreadCount() is used.
+/// @param task the function to call for each task
+void ParallelFor(size_t count,
+                 const Executor& executor,
+                 size_t max_parallelism,
+                 const std::function<void(size_t)>& task);
+
+}  // namespace detail
+
+/// GenerateEntryPoints produces one output for each of `configs` from a single
+/// resolved program, running the generations concurrently on `executor` and
+/// on the calling thread.
+///
+/// Each call to `generate` typically runs a transform::Manager over `program`
+/// (for example with a SingleEntryPoint transform for the configuration's
+/// entry point) and then calls a writer's Generate() on the transformed
+/// program. `program` is shared by all the calls, so `generate` must only
+/// read it. The `const` methods of Program, and of its SymbolTable,
+/// sem::Manager and sem::Info, are safe to call from several threads at once.
+///
+/// @param program the resolved program to generate the outputs from. It must
+/// not be modified or destructed until GenerateEntryPoints() returns.
+/// @param configs the per entry point configurations
+/// @param generate a function with the signature
+/// `RESULT(const Program* program, const CONFIG& config)`, where RESULT is
+/// default-constructible. It is called once for each configuration, possibly
+/// from different threads at the same time.
+/// @param executor the executor used to run generations concurrently with the
+/// calling thread. If empty, all the generations run on the calling thread.
+/// @param max_parallelism the maximum number of generations to run at once.
+/// If 0, then DefaultGenerateThreadCount() is used.
+/// @returns the results of `generate`, in the order of `configs`
+template <typename CONFIG, typename GENERATE>
+auto GenerateEntryPoints(const Program* program,
+                         const std::vector<CONFIG>& configs,
+                         GENERATE&& generate,
+                         const Executor& executor,
+                         size_t max_parallelism = 0) {
+  using Result = std::decay_t<
+      std::invoke_result_t<GENERATE&, const Program*, const CONFIG&>>;
+  std::vector<Result> results(configs.size());
+  detail::ParallelFor(configs.size(), executor, max_parallelism, [&](size_t i) {
+    results[i] = generate(program, configs[i]);
+  });
+  return results;
+}
+
+}  // namespace writer
+}  // namespace tint
+
+#endif  // SRC_WRITER_GENERATE_ENTRY_POINTS_H_
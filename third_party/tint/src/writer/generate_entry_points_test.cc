@@ -0,0 +1,243 @@
+// Copyright 2022 The Tint Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/writer/generate_entry_points.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "gtest/gtest.h"
+#include "src/program_builder.h"
+#include "src/transform/manager.h"
+#include "src/transform/single_entry_point.h"
+
+namespace tint {
+namespace writer {
+namespace {
+
+/// The output of the generate function used by the tests
+struct Output {
+  /// The names of the functions of the transformed program
+  std::vector<std::string> functions;
+  /// A new symbol created in a ProgramBuilder that wraps the transformed
+  /// program
+  std::string new_symbol;
+};
+
+/// Builds a program with `count` compute entry points named `main_<n>`, each
+/// calling a shared `helper` function.
+Program BuildProgram(size_t count) {
+  ProgramBuilder b;
+  b.Func("helper", {}, b.ty.void_(), {});
+  b.Func("unused", {}, b.ty.void_(), {});
+  for (size_t i = 0; i < count; i++) {
+    b.Func("main_" + std::to_string(i), {}, b.ty.void_(),
+           {b.CallStmt(b.Call("helper"))},
+           {b.Stage(ast::PipelineStage::kCompute), b.WorkgroupSize(1)});
+  }
+  return Program(std::move(b));
+}
+
+/// ThreadPool runs the functions posted to its executor on a fixed number of
+/// threads
+class ThreadPool {
+ public:
+  /// Constructor
+  /// @param num_threads the number of threads of the pool
+  explicit ThreadPool(size_t num_threads) {
+    for (size_t i = 0; i < num_threads; i++) {
+      threads_.emplace_back([this] {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (true) {
+          cv_.wait(lock, [this] { return stop_ || !queue_.empty(); });
+          if (queue_.empty()) {
+            return;
+          }
+          auto fn = std::move(queue_.front());
+          queue_.pop_front();
+          lock.unlock();
+          fn();
+          lock.lock();
+        }
+      });
+    }
+  }
+
+  /// Destructor. Runs the posted functions that have not started yet.
+  ~ThreadPool() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stop_ = true;
+    }
+    cv_.notify_all();
+    for (auto& thread : threads_) {
+      thread.join();
+    }
+  }
+
+  /// @returns an Executor that posts functions to this pool
+  Executor executor() {
+    return [this](std::function<void()> fn) {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        queue_.emplace_back(std::move(fn));
+      }
+      cv_.notify_one();
+    };
+  }
+
+ private:
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::deque<std::function<void()>> queue_;
+  bool stop_ = false;
+  std::vector<std::thread> threads_;
+};
+
+Output RunEntryPoint(const Program* program, const std::string& entry_point) {
+  transform::Manager manager;
+  transform::DataMap data;
+  manager.Add<transform::SingleEntryPoint>();
+  data.Add<transform::SingleEntryPoint::Config>(entry_point);
+  auto out = manager.Run(program, data);
+
+  Output output;
+  if (!out.program.IsValid()) {
+    output.functions.emplace_back(out.program.Diagnostics().str());
+    return output;
+  }
+  for (auto* fn : out.program.AST().Functions()) {
+    output.functions.emplace_back(out.program.Symbols().NameFor(fn->symbol));
+  }
+  auto builder = ProgramBuilder::Wrap(&out.program);
+  output.new_symbol =
+      builder.Symbols().NameFor(builder.Symbols().New("helper"));
+  return output;
+}
+
+TEST(GenerateEntryPointsTest, Empty) {
+  auto program = BuildProgram(0);
+  std::vector<std::string> configs;
+  auto results = GenerateEntryPoints(
+      &program, configs,
+      [](const Program*, const std::string&) -> int { return 1; },
+      Executor{});
+  EXPECT_TRUE(results.empty());
+}
+
+TEST(GenerateEntryPointsTest, ResultsInConfigOrder) {
+  auto program = BuildProgram(32);
+  std::vector<std::string> configs;
+  for (size_t i = 0; i < 32; i++) {
+    configs.emplace_back("main_" + std::to_string(i));
+  }
+
+  ThreadPool pool(3);
+  auto results = GenerateEntryPoints(&program, configs, RunEntryPoint,
+                                     pool.executor(), 4);
+  ASSERT_EQ(results.size(), configs.size());
+  for (size_t i = 0; i < configs.size(); i++) {
+    EXPECT_EQ(results[i].functions,
+              (std::vector<std::string>{"helper", configs[i]}));
+    EXPECT_EQ(results[i].new_symbol, "helper_1");
+  }
+
+  // The source program must be unchanged
+  EXPECT_EQ(program.AST().Functions().size(), 34u);
+  EXPECT_EQ(program.Symbols().NameFor(program.Symbols().Get("helper")),
+            "helper");
+}
+
+TEST(GenerateEntryPointsTest, MatchesSerialGeneration) {
+  auto program = BuildProgram(16);
+  std::vector<std::string> configs;
+  for (size_t i = 0; i < 16; i++) {
+    configs.emplace_back("main_" + std::to_string(15 - i));
+  }
+
+  ThreadPool pool(7);
+  auto serial =
+      GenerateEntryPoints(&program, configs, RunEntryPoint, Executor{});
+  auto parallel = GenerateEntryPoints(&program, configs, RunEntryPoint,
+                                      pool.executor(), 8);
+  ASSERT_EQ(serial.size(), parallel.size());
+  for (size_t i = 0; i < serial.size(); i++) {
+    EXPECT_EQ(serial[i].functions, parallel[i].functions);
+    EXPECT_EQ(serial[i].new_symbol, parallel[i].new_symbol);
+  }
+}
+
+TEST(GenerateEntryPointsTest, EachConfigGeneratedOnce) {
+  auto program = BuildProgram(0);
+  std::vector<int> configs(100);
+  std::atomic<int> calls{0};
+  ThreadPool pool(4);
+  auto results = GenerateEntryPoints(
+      &program, configs,
+      [&](const Program* p, const int&) {
+        EXPECT_EQ(p, &program);
+        return ++calls;
+      },
+      pool.executor());
+  EXPECT_EQ(calls, 100);
+  std::sort(results.begin(), results.end());
+  for (int i = 0; i < 100; i++) {
+    EXPECT_EQ(results[static_cast<size_t>(i)], i + 1);
+  }
+}
+
+TEST(GenerateEntryPointsTest, NoExecutorRunsOnCallingThread) {
+  auto program = BuildProgram(0);
+  std::vector<int> configs(8);
+  auto results = GenerateEntryPoints(
+      &program, configs,
+      [&](const Program*, const int&) { return std::this_thread::get_id(); },
+      Executor{}, 8);
+  for (auto id : results) {
+    EXPECT_EQ(id, std::this_thread::get_id());
+  }
+}
+
+TEST(GenerateEntryPointsTest, HelpersStartingLate) {
+  // An executor that only runs the posted functions after
+  // GenerateEntryPoints() has returned, as a busy pool could.
+  std::vector<std::function<void()>> posted;
+  Executor executor = [&](std::function<void()> fn) {
+    posted.emplace_back(std::move(fn));
+  };
+
+  auto program = BuildProgram(0);
+  std::vector<int> configs(8);
+  int calls = 0;
+  auto results = GenerateEntryPoints(
+      &program, configs, [&](const Program*, const int&) { return ++calls; },
+      executor, 4);
+  EXPECT_EQ(calls, 8);
+  EXPECT_EQ(results, (std::vector<int>{1, 2, 3, 4, 5, 6, 7, 8}));
+
+  EXPECT_EQ(posted.size(), 3u);
+  for (auto& fn : posted) {
+    fn();
+  }
+  EXPECT_EQ(calls, 8);
+}
+
+}  // namespace
+}  // namespace writer
+}  // namespace tint
@@ -34,14 +34,21 @@ void GenerateGLSL(benchmark::State& state, std::string input_name) {
     }
   }
 
+  size_t output_size = 0;
+  auto allocations = bench::AllocationCount();
+  bench::ResetPeakAllocatedBytes();
   for (auto _ : state) {
+    output_size = 0;
     for (auto& ep : entry_points) {
       auto res = Generate(&program, {}, ep);
       if (!res.error.empty()) {
         state.SkipWithError(res.error.c_str());
       }
+      output_size += res.glsl.size();
     }
   }
+  allocations = bench::AllocationCount() - allocations;
+  bench::ReportCounters(state, output_size, allocations);
 }
 
 TINT_BENCHMARK_WGSL_PROGRAMS(GenerateGLSL);
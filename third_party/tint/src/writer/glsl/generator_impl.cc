@@ -16,7 +16,6 @@
 
 #include <algorithm>
 #include <cmath>
-#include <iomanip>
 #include <set>
 #include <utility>
 #include <vector>
@@ -144,7 +143,7 @@ bool GeneratorImpl::Generate() {
     }
   }
 
-  auto helpers_insertion_point = current_buffer_->lines.size();
+  auto helpers_marker = current_buffer_->Mark();
 
   line();
 
@@ -198,26 +197,24 @@ bool GeneratorImpl::Generate() {
   auto indent = current_buffer_->current_indent;
 
   if (!extensions.lines.empty()) {
-    current_buffer_->Insert(extensions, helpers_insertion_point, indent);
-    helpers_insertion_point += extensions.lines.size();
+    current_buffer_->Insert(extensions, helpers_marker, indent);
   }
 
   if (version_.IsES() && requires_default_precision_qualifier_) {
-    current_buffer_->Insert("precision mediump float;",
-                            helpers_insertion_point++, indent);
+    current_buffer_->Insert("precision mediump float;", helpers_marker,
+                            indent);
   }
 
   if (!helpers_.lines.empty()) {
-    current_buffer_->Insert("", helpers_insertion_point++, indent);
-    current_buffer_->Insert(helpers_, helpers_insertion_point, indent);
-    helpers_insertion_point += helpers_.lines.size();
+    current_buffer_->Insert("", helpers_marker, indent);
+    current_buffer_->Insert(helpers_, helpers_marker, indent);
   }
 
   return true;
 }
 
 bool GeneratorImpl::EmitIndexAccessor(
-    std::ostream& out,
+    utils::StringStream& out,
     const ast::IndexAccessorExpression* expr) {
   if (!EmitExpression(out, expr->object)) {
     return false;
@@ -232,7 +229,7 @@ bool GeneratorImpl::EmitIndexAccessor(
   return true;
 }
 
-bool GeneratorImpl::EmitBitcast(std::ostream& out,
+bool GeneratorImpl::EmitBitcast(utils::StringStream& out,
                                 const ast::BitcastExpression* expr) {
   auto* src_type = TypeOf(expr->expr)->UnwrapRef();
   auto* dst_type = TypeOf(expr)->UnwrapRef();
@@ -288,7 +285,7 @@ bool GeneratorImpl::EmitAssign(const ast::AssignmentStatement* stmt) {
   return true;
 }
 
-bool GeneratorImpl::EmitVectorRelational(std::ostream& out,
+bool GeneratorImpl::EmitVectorRelational(utils::StringStream& out,
                                          const ast::BinaryExpression* expr) {
   switch (expr->op) {
     case ast::BinaryOp::kEqual:
@@ -324,7 +321,7 @@ bool GeneratorImpl::EmitVectorRelational(std::ostream& out,
   return true;
 }
 
-bool GeneratorImpl::EmitBinary(std::ostream& out,
+bool GeneratorImpl::EmitBinary(utils::StringStream& out,
                                const ast::BinaryExpression* expr) {
   if (IsRelational(expr->op) && !TypeOf(expr->lhs)->UnwrapRef()->is_scalar()) {
     return EmitVectorRelational(out, expr);
@@ -473,7 +470,7 @@ bool GeneratorImpl::EmitBreak(const ast::BreakStatement*) {
   return true;
 }
 
-bool GeneratorImpl::EmitCall(std::ostream& out,
+bool GeneratorImpl::EmitCall(utils::StringStream& out,
                              const ast::CallExpression* expr) {
   auto* call = builder_.Sem().Get(expr);
   auto* target = call->Target();
@@ -495,7 +492,8 @@ bool GeneratorImpl::EmitCall(std::ostream& out,
   return false;
 }
 
-bool GeneratorImpl::EmitFunctionCall(std::ostream& out, const sem::Call* call) {
+bool GeneratorImpl::EmitFunctionCall(utils::StringStream& out,
+                                     const sem::Call* call) {
   const auto& args = call->Arguments();
   auto* decl = call->Declaration();
   auto* ident = decl->target.name;
@@ -521,7 +519,7 @@ bool GeneratorImpl::EmitFunctionCall(std::ostream& out, const sem::Call* call) {
   return true;
 }
 
-bool GeneratorImpl::EmitBuiltinCall(std::ostream& out,
+bool GeneratorImpl::EmitBuiltinCall(utils::StringStream& out,
                                     const sem::Call* call,
                                     const sem::Builtin* builtin) {
   auto* expr = call->Declaration();
@@ -587,7 +585,7 @@ bool GeneratorImpl::EmitBuiltinCall(std::ostream& out,
   return true;
 }
 
-bool GeneratorImpl::EmitTypeConversion(std::ostream& out,
+bool GeneratorImpl::EmitTypeConversion(utils::StringStream& out,
                                        const sem::Call* call,
                                        const sem::TypeConversion* conv) {
   if (!EmitType(out, conv->Target(), ast::StorageClass::kNone,
@@ -604,7 +602,7 @@ bool GeneratorImpl::EmitTypeConversion(std::ostream& out,
   return true;
 }
 
-bool GeneratorImpl::EmitTypeConstructor(std::ostream& out,
+bool GeneratorImpl::EmitTypeConstructor(utils::StringStream& out,
                                         const sem::Call* call,
                                         const sem::TypeConstructor* ctor) {
   auto* type = ctor->ReturnType();
@@ -642,7 +640,7 @@ bool GeneratorImpl::EmitTypeConstructor(std::ostream& out,
   return true;
 }
 
-bool GeneratorImpl::EmitWorkgroupAtomicCall(std::ostream& out,
+bool GeneratorImpl::EmitWorkgroupAtomicCall(utils::StringStream& out,
                                             const ast::CallExpression* expr,
                                             const sem::Builtin* builtin) {
   auto call = [&](const char* name) {
@@ -751,7 +749,7 @@ bool GeneratorImpl::EmitWorkgroupAtomicCall(std::ostream& out,
   return false;
 }
 
-bool GeneratorImpl::EmitArrayLength(std::ostream& out,
+bool GeneratorImpl::EmitArrayLength(utils::StringStream& out,
                                     const ast::CallExpression* expr) {
   out << "uint(";
   if (!EmitExpression(out, expr->args[0])) {
@@ -761,7 +759,7 @@ bool GeneratorImpl::EmitArrayLength(std::ostream& out,
   return true;
 }
 
-bool GeneratorImpl::EmitSelectCall(std::ostream& out,
+bool GeneratorImpl::EmitSelectCall(utils::StringStream& out,
                                    const ast::CallExpression* expr) {
   auto* expr_false = expr->args[0];
   auto* expr_true = expr->args[1];
@@ -786,7 +784,7 @@ bool GeneratorImpl::EmitSelectCall(std::ostream& out,
   return true;
 }
 
-bool GeneratorImpl::EmitDotCall(std::ostream& out,
+bool GeneratorImpl::EmitDotCall(utils::StringStream& out,
                                 const ast::CallExpression* expr,
                                 const sem::Builtin* builtin) {
   auto* vec_ty = builtin->Parameters()[0]->Type()->As<sem::Vector>();
@@ -802,7 +800,7 @@ bool GeneratorImpl::EmitDotCall(std::ostream& out,
 
       std::string v;
       {
-        std::stringstream s;
+        utils::StringStream s;
         if (!EmitType(s, vec_ty->type(), ast::StorageClass::kNone,
                       ast::Access::kRead, "")) {
           return "";
@@ -858,7 +856,7 @@ bool GeneratorImpl::EmitDotCall(std::ostream& out,
   return true;
 }
 
-bool GeneratorImpl::EmitModfCall(std::ostream& out,
+bool GeneratorImpl::EmitModfCall(utils::StringStream& out,
                                  const ast::CallExpression* expr,
                                  const sem::Builtin* builtin) {
   if (expr->args.size() == 1) {
@@ -908,7 +906,7 @@ bool GeneratorImpl::EmitModfCall(std::ostream& out,
   return true;
 }
 
-bool GeneratorImpl::EmitFrexpCall(std::ostream& out,
+bool GeneratorImpl::EmitFrexpCall(utils::StringStream& out,
                                   const ast::CallExpression* expr,
                                   const sem::Builtin* builtin) {
   if (expr->args.size() == 1) {
@@ -979,7 +977,7 @@ bool GeneratorImpl::EmitFrexpCall(std::ostream& out,
       });
 }
 
-bool GeneratorImpl::EmitIsNormalCall(std::ostream& out,
+bool GeneratorImpl::EmitIsNormalCall(utils::StringStream& out,
                                      const ast::CallExpression* expr,
                                      const sem::Builtin* builtin) {
   // GLSL doesn't have a isNormal builtin, we need to emulate
@@ -1007,31 +1005,31 @@ bool GeneratorImpl::EmitIsNormalCall(std::ostream& out,
       });
 }
 
-bool GeneratorImpl::EmitDegreesCall(std::ostream& out,
+bool GeneratorImpl::EmitDegreesCall(utils::StringStream& out,
                                     const ast::CallExpression* expr,
                                     const sem::Builtin* builtin) {
   return CallBuiltinHelper(
       out, expr, builtin,
       [&](TextBuffer* b, const std::vector<std::string>& params) {
-        line(b) << "return " << params[0] << " * " << std::setprecision(20)
-                << sem::kRadToDeg << ";";
+        line(b) << "return " << params[0] << " * "
+                << utils::SetPrecision(20) << sem::kRadToDeg << ";";
         return true;
       });
 }
 
-bool GeneratorImpl::EmitRadiansCall(std::ostream& out,
+bool GeneratorImpl::EmitRadiansCall(utils::StringStream& out,
                                     const ast::CallExpression* expr,
                                     const sem::Builtin* builtin) {
   return CallBuiltinHelper(
       out, expr, builtin,
       [&](TextBuffer* b, const std::vector<std::string>& params) {
-        line(b) << "return " << params[0] << " * " << std::setprecision(20)
-                << sem::kDegToRad << ";";
+        line(b) << "return " << params[0] << " * "
+                << utils::SetPrecision(20) << sem::kDegToRad << ";";
         return true;
       });
 }
 
-bool GeneratorImpl::EmitDataPackingCall(std::ostream& out,
+bool GeneratorImpl::EmitDataPackingCall(utils::StringStream& out,
                                         const ast::CallExpression* expr,
                                         const sem::Builtin* builtin) {
   return CallBuiltinHelper(
@@ -1097,7 +1095,7 @@ bool GeneratorImpl::EmitDataPackingCall(std::ostream& out,
       });
 }
 
-bool GeneratorImpl::EmitDataUnpackingCall(std::ostream& out,
+bool GeneratorImpl::EmitDataUnpackingCall(utils::StringStream& out,
                                           const ast::CallExpression* expr,
                                           const sem::Builtin* builtin) {
   return CallBuiltinHelper(
@@ -1167,7 +1165,7 @@ bool GeneratorImpl::EmitDataUnpackingCall(std::ostream& out,
       });
 }
 
-bool GeneratorImpl::EmitBarrierCall(std::ostream& out,
+bool GeneratorImpl::EmitBarrierCall(utils::StringStream& out,
                                     const sem::Builtin* builtin) {
   // TODO(crbug.com/tint/661): Combine sequential barriers to a single
   // instruction.
@@ -1183,7 +1181,7 @@ bool GeneratorImpl::EmitBarrierCall(std::ostream& out,
   return true;
 }
 
-bool GeneratorImpl::EmitTextureCall(std::ostream& out,
+bool GeneratorImpl::EmitTextureCall(utils::StringStream& out,
                                     const sem::Call* call,
                                     const sem::Builtin* builtin) {
   using Usage = sem::ParameterUsage;
@@ -1552,7 +1550,7 @@ bool GeneratorImpl::EmitDiscard(const ast::DiscardStatement*) {
   return true;
 }
 
-bool GeneratorImpl::EmitExpression(std::ostream& out,
+bool GeneratorImpl::EmitExpression(utils::StringStream& out,
                                    const ast::Expression* expr) {
   if (auto* a = expr->As<ast::IndexAccessorExpression>()) {
     return EmitIndexAccessor(out, a);
@@ -1585,7 +1583,7 @@ bool GeneratorImpl::EmitExpression(std::ostream& out,
   return false;
 }
 
-bool GeneratorImpl::EmitIdentifier(std::ostream& out,
+bool GeneratorImpl::EmitIdentifier(utils::StringStream& out,
                                    const ast::IdentifierExpression* expr) {
   out << builder_.Symbols().NameFor(expr->symbol);
   return true;
@@ -1877,7 +1875,7 @@ bool GeneratorImpl::EmitIOVariable(const sem::Variable* var) {
 }
 
 void GeneratorImpl::EmitInterpolationQualifiers(
-    std::ostream& out,
+    utils::StringStream& out,
     const ast::AttributeList& attributes) {
   for (auto* attr : attributes) {
     if (auto* interpolate = attr->As<ast::InterpolateAttribute>()) {
@@ -1902,7 +1900,7 @@ void GeneratorImpl::EmitInterpolationQualifiers(
   }
 }
 
-bool GeneratorImpl::EmitAttributes(std::ostream& out,
+bool GeneratorImpl::EmitAttributes(utils::StringStream& out,
                                    const ast::AttributeList& attributes) {
   if (attributes.empty()) {
     return true;
@@ -1996,7 +1994,7 @@ bool GeneratorImpl::EmitEntryPointFunction(const ast::Function* func) {
     }
 
     if (!Is<ast::ReturnStatement>(func->body->Last())) {
-      ast::ReturnStatement ret(ProgramID(), Source{});
+      ast::ReturnStatement ret(ProgramID(), ast::NodeID(), Source{});
       if (!EmitStatement(&ret)) {
         return false;
       }
@@ -2008,7 +2006,7 @@ bool GeneratorImpl::EmitEntryPointFunction(const ast::Function* func) {
   return true;
 }
 
-bool GeneratorImpl::EmitLiteral(std::ostream& out,
+bool GeneratorImpl::EmitLiteral(utils::StringStream& out,
                                 const ast::LiteralExpression* lit) {
   if (auto* l = lit->As<ast::BoolLiteralExpression>()) {
     out << (l->value ? "true" : "false");
@@ -2032,7 +2030,8 @@ bool GeneratorImpl::EmitLiteral(std::ostream& out,
   return true;
 }
 
-bool GeneratorImpl::EmitZeroValue(std::ostream& out, const sem::Type* type) {
+bool GeneratorImpl::EmitZeroValue(utils::StringStream& out,
+                                  const sem::Type* type) {
   if (type->Is<sem::Bool>()) {
     out << "false";
   } else if (type->Is<sem::F32>()) {
@@ -2152,7 +2151,7 @@ bool GeneratorImpl::EmitForLoop(const ast::ForLoopStatement* stmt) {
   }
 
   TextBuffer cond_pre;
-  std::stringstream cond_buf;
+  utils::StringStream cond_buf;
   if (auto* cond = stmt->condition) {
     TINT_SCOPED_ASSIGNMENT(current_buffer_, &cond_pre);
     if (!EmitExpression(cond_buf, cond)) {
@@ -2243,7 +2242,7 @@ bool GeneratorImpl::EmitForLoop(const ast::ForLoopStatement* stmt) {
 }
 
 bool GeneratorImpl::EmitMemberAccessor(
-    std::ostream& out,
+    utils::StringStream& out,
     const ast::MemberAccessorExpression* expr) {
   if (!EmitExpression(out, expr->structure)) {
     return false;
@@ -2351,7 +2350,7 @@ bool GeneratorImpl::EmitSwitch(const ast::SwitchStatement* stmt) {
   return true;
 }
 
-bool GeneratorImpl::EmitType(std::ostream& out,
+bool GeneratorImpl::EmitType(utils::StringStream& out,
                              const sem::Type* type,
                              ast::StorageClass storage_class,
                              ast::Access access,
@@ -2507,7 +2506,7 @@ bool GeneratorImpl::EmitType(std::ostream& out,
   return true;
 }
 
-bool GeneratorImpl::EmitTypeAndName(std::ostream& out,
+bool GeneratorImpl::EmitTypeAndName(utils::StringStream& out,
                                     const sem::Type* type,
                                     ast::StorageClass storage_class,
                                     ast::Access access,
@@ -2556,7 +2555,7 @@ bool GeneratorImpl::EmitStructMembers(TextBuffer* b,
   return true;
 }
 
-bool GeneratorImpl::EmitUnaryOp(std::ostream& out,
+bool GeneratorImpl::EmitUnaryOp(utils::StringStream& out,
                                 const ast::UnaryOpExpression* expr) {
   switch (expr->op) {
     case ast::UnaryOp::kIndirection:
@@ -2676,7 +2675,7 @@ bool GeneratorImpl::EmitProgramConstVariable(const ast::Variable* var) {
 }
 
 template <typename F>
-bool GeneratorImpl::CallBuiltinHelper(std::ostream& out,
+bool GeneratorImpl::CallBuiltinHelper(utils::StringStream& out,
                                       const ast::CallExpression* call,
                                       const sem::Builtin* builtin,
                                       F&& build) {
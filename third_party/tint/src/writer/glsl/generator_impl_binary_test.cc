@@ -56,7 +56,7 @@ TEST_P(GlslBinaryTest, Emit_f32) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitExpression(out, expr)) << gen.error();
   EXPECT_EQ(out.str(), params.result);
 }
@@ -75,7 +75,7 @@ TEST_P(GlslBinaryTest, Emit_u32) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitExpression(out, expr)) << gen.error();
   EXPECT_EQ(out.str(), params.result);
 }
@@ -100,7 +100,7 @@ TEST_P(GlslBinaryTest, Emit_i32) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitExpression(out, expr)) << gen.error();
   EXPECT_EQ(out.str(), params.result);
 }
@@ -136,7 +136,7 @@ TEST_F(GlslGeneratorImplTest_Binary, Multiply_VectorScalar) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   EXPECT_TRUE(gen.EmitExpression(out, expr)) << gen.error();
   EXPECT_EQ(out.str(),
             "(vec3(1.0f, 1.0f, 1.0f) * "
@@ -154,7 +154,7 @@ TEST_F(GlslGeneratorImplTest_Binary, Multiply_ScalarVector) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   EXPECT_TRUE(gen.EmitExpression(out, expr)) << gen.error();
   EXPECT_EQ(out.str(),
             "(1.0f * vec3(1.0f, 1.0f, "
@@ -172,7 +172,7 @@ TEST_F(GlslGeneratorImplTest_Binary, Multiply_MatrixScalar) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   EXPECT_TRUE(gen.EmitExpression(out, expr)) << gen.error();
   EXPECT_EQ(out.str(), "(mat * 1.0f)");
 }
@@ -188,7 +188,7 @@ TEST_F(GlslGeneratorImplTest_Binary, Multiply_ScalarMatrix) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   EXPECT_TRUE(gen.EmitExpression(out, expr)) << gen.error();
   EXPECT_EQ(out.str(), "(1.0f * mat)");
 }
@@ -204,7 +204,7 @@ TEST_F(GlslGeneratorImplTest_Binary, Multiply_MatrixVector) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   EXPECT_TRUE(gen.EmitExpression(out, expr)) << gen.error();
   EXPECT_EQ(out.str(), "(mat * vec3(1.0f, 1.0f, 1.0f))");
 }
@@ -220,7 +220,7 @@ TEST_F(GlslGeneratorImplTest_Binary, Multiply_VectorMatrix) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   EXPECT_TRUE(gen.EmitExpression(out, expr)) << gen.error();
   EXPECT_EQ(out.str(), "(vec3(1.0f, 1.0f, 1.0f) * mat)");
 }
@@ -235,7 +235,7 @@ TEST_F(GlslGeneratorImplTest_Binary, Multiply_MatrixMatrix) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   EXPECT_TRUE(gen.EmitExpression(out, expr)) << gen.error();
   EXPECT_EQ(out.str(), "(lhs * rhs)");
 }
@@ -250,7 +250,7 @@ TEST_F(GlslGeneratorImplTest_Binary, Logical_And) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitExpression(out, expr)) << gen.error();
   EXPECT_EQ(out.str(), "(tint_tmp)");
   EXPECT_EQ(gen.result(), R"(bool tint_tmp = a;
@@ -277,7 +277,7 @@ TEST_F(GlslGeneratorImplTest_Binary, Logical_Multi) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitExpression(out, expr)) << gen.error();
   EXPECT_EQ(out.str(), "(tint_tmp)");
   EXPECT_EQ(gen.result(), R"(bool tint_tmp_1 = a;
@@ -305,7 +305,7 @@ TEST_F(GlslGeneratorImplTest_Binary, Logical_Or) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitExpression(out, expr)) << gen.error();
   EXPECT_EQ(out.str(), "(tint_tmp)");
   EXPECT_EQ(gen.result(), R"(bool tint_tmp = a;
@@ -27,7 +27,7 @@ TEST_F(GlslGeneratorImplTest_Bitcast, EmitExpression_Bitcast_Float) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitExpression(out, bitcast)) << gen.error();
   EXPECT_EQ(out.str(), "intBitsToFloat(1)");
 }
@@ -38,7 +38,7 @@ TEST_F(GlslGeneratorImplTest_Bitcast, EmitExpression_Bitcast_Int) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitExpression(out, bitcast)) << gen.error();
   EXPECT_EQ(out.str(), "int(1u)");
 }
@@ -49,7 +49,7 @@ TEST_F(GlslGeneratorImplTest_Bitcast, EmitExpression_Bitcast_Uint) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitExpression(out, bitcast)) << gen.error();
   EXPECT_EQ(out.str(), "uint(1)");
 }
@@ -262,7 +262,7 @@ TEST_F(GlslGeneratorImplTest_Builtin, Builtin_Call) {
   GeneratorImpl& gen = Build();
 
   gen.increment_indent();
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitExpression(out, call)) << gen.error();
   EXPECT_EQ(out.str(), "dot(param1, param2)");
 }
@@ -273,7 +273,7 @@ TEST_F(GlslGeneratorImplTest_Builtin, Select_Scalar) {
   GeneratorImpl& gen = Build();
 
   gen.increment_indent();
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitExpression(out, call)) << gen.error();
   EXPECT_EQ(out.str(), "(true ? 2.0f : 1.0f)");
 }
@@ -285,7 +285,7 @@ TEST_F(GlslGeneratorImplTest_Builtin, Select_Vector) {
   GeneratorImpl& gen = Build();
 
   gen.increment_indent();
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitExpression(out, call)) << gen.error();
   EXPECT_EQ(out.str(), "(bvec2(true, false) ? ivec2(3, 4) : ivec2(1, 2))");
 }
@@ -496,7 +496,7 @@ TEST_F(GlslGeneratorImplTest_Builtin, Pack4x8Snorm) {
   GeneratorImpl& gen = Build();
 
   gen.increment_indent();
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitExpression(out, call)) << gen.error();
   EXPECT_THAT(gen.result(), HasSubstr("ivec4 tint_tmp = ivec4(round(clamp(p1, "
                                       "-1.0, 1.0) * 127.0)) & 0xff;"));
@@ -511,7 +511,7 @@ TEST_F(GlslGeneratorImplTest_Builtin, Pack4x8Unorm) {
   GeneratorImpl& gen = Build();
 
   gen.increment_indent();
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitExpression(out, call)) << gen.error();
   EXPECT_THAT(gen.result(), HasSubstr("uvec4 tint_tmp = uvec4(round(clamp(p1, "
                                       "0.0, 1.0) * 255.0));"));
@@ -526,7 +526,7 @@ TEST_F(GlslGeneratorImplTest_Builtin, Pack2x16Snorm) {
   GeneratorImpl& gen = Build();
 
   gen.increment_indent();
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitExpression(out, call)) << gen.error();
   EXPECT_THAT(gen.result(), HasSubstr("int2 tint_tmp = int2(round(clamp(p1, "
                                       "-1.0, 1.0) * 32767.0)) & 0xffff;"));
@@ -540,7 +540,7 @@ TEST_F(GlslGeneratorImplTest_Builtin, Pack2x16Unorm) {
   GeneratorImpl& gen = Build();
 
   gen.increment_indent();
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitExpression(out, call)) << gen.error();
   EXPECT_THAT(gen.result(), HasSubstr("uint2 tint_tmp = uint2(round(clamp(p1, "
                                       "0.0, 1.0) * 65535.0));"));
@@ -554,7 +554,7 @@ TEST_F(GlslGeneratorImplTest_Builtin, Pack2x16Float) {
   GeneratorImpl& gen = Build();
 
   gen.increment_indent();
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitExpression(out, call)) << gen.error();
   EXPECT_THAT(gen.result(), HasSubstr("uint2 tint_tmp = f32tof16(p1);"));
   EXPECT_THAT(out.str(), HasSubstr("(tint_tmp.x | tint_tmp.y << 16)"));
@@ -567,7 +567,7 @@ TEST_F(GlslGeneratorImplTest_Builtin, Unpack4x8Snorm) {
   GeneratorImpl& gen = Build();
 
   gen.increment_indent();
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitExpression(out, call)) << gen.error();
   EXPECT_THAT(gen.result(), HasSubstr("int tint_tmp_1 = int(p1);"));
   EXPECT_THAT(gen.result(),
@@ -584,7 +584,7 @@ TEST_F(GlslGeneratorImplTest_Builtin, Unpack4x8Unorm) {
   GeneratorImpl& gen = Build();
 
   gen.increment_indent();
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitExpression(out, call)) << gen.error();
   EXPECT_THAT(gen.result(), HasSubstr("uint tint_tmp_1 = p1;"));
   EXPECT_THAT(
@@ -601,7 +601,7 @@ TEST_F(GlslGeneratorImplTest_Builtin, Unpack2x16Snorm) {
   GeneratorImpl& gen = Build();
 
   gen.increment_indent();
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitExpression(out, call)) << gen.error();
   EXPECT_THAT(gen.result(), HasSubstr("int tint_tmp_1 = int(p1);"));
   EXPECT_THAT(
@@ -618,7 +618,7 @@ TEST_F(GlslGeneratorImplTest_Builtin, Unpack2x16Unorm) {
   GeneratorImpl& gen = Build();
 
   gen.increment_indent();
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitExpression(out, call)) << gen.error();
   EXPECT_THAT(gen.result(), HasSubstr("uint tint_tmp_1 = p1;"));
   EXPECT_THAT(gen.result(),
@@ -634,7 +634,7 @@ TEST_F(GlslGeneratorImplTest_Builtin, Unpack2x16Float) {
   GeneratorImpl& gen = Build();
 
   gen.increment_indent();
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitExpression(out, call)) << gen.error();
   EXPECT_THAT(gen.result(), HasSubstr("uint tint_tmp = p1;"));
   EXPECT_THAT(out.str(),
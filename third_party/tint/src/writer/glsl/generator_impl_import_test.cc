@@ -40,7 +40,7 @@ TEST_P(GlslImportData_SingleParamTest, FloatScalar) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitCall(out, expr)) << gen.error();
   EXPECT_EQ(out.str(), std::string(param.glsl_name) + "(1.0f)");
 }
@@ -79,7 +79,7 @@ TEST_P(GlslImportData_SingleIntParamTest, IntScalar) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitCall(out, expr)) << gen.error();
   EXPECT_EQ(out.str(), std::string(param.glsl_name) + "(1)");
 }
@@ -97,7 +97,7 @@ TEST_P(GlslImportData_SingleVectorParamTest, FloatVector) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitCall(out, expr)) << gen.error();
   EXPECT_EQ(out.str(),
             std::string(param.glsl_name) + "(vec3(1.0f, 2.0f, 3.0f))");
@@ -139,7 +139,7 @@ TEST_P(GlslImportData_DualParam_ScalarTest, Float) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitCall(out, expr)) << gen.error();
   EXPECT_EQ(out.str(), std::string(param.glsl_name) + "(1.0f, 2.0f)");
 }
@@ -162,7 +162,7 @@ TEST_P(GlslImportData_DualParam_VectorTest, Float) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitCall(out, expr)) << gen.error();
   EXPECT_EQ(out.str(), std::string(param.glsl_name) +
                            "(vec3(1.0f, 2.0f, 3.0f), vec3(4.0f, 5.0f, 6.0f))");
@@ -187,7 +187,7 @@ TEST_P(GlslImportData_DualParam_Int_Test, IntScalar) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitCall(out, expr)) << gen.error();
   EXPECT_EQ(out.str(), std::string(param.glsl_name) + "(1, 2)");
 }
@@ -205,7 +205,7 @@ TEST_P(GlslImportData_TripleParam_ScalarTest, Float) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitCall(out, expr)) << gen.error();
   EXPECT_EQ(out.str(), std::string(param.glsl_name) + "(1.0f, 2.0f, 3.0f)");
 }
@@ -227,7 +227,7 @@ TEST_P(GlslImportData_TripleParam_VectorTest, Float) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitCall(out, expr)) << gen.error();
   EXPECT_EQ(
       out.str(),
@@ -255,7 +255,7 @@ TEST_P(GlslImportData_TripleParam_Int_Test, IntScalar) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitCall(out, expr)) << gen.error();
   EXPECT_EQ(out.str(), std::string(param.glsl_name) + "(1, 2, 3)");
 }
@@ -271,7 +271,7 @@ TEST_F(GlslGeneratorImplTest_Import, GlslImportData_Determinant) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitCall(out, expr)) << gen.error();
   EXPECT_EQ(out.str(), std::string("determinant(var)"));
 }
@@ -17,7 +17,6 @@
 #include <algorithm>
 #include <cmath>
 #include <functional>
-#include <iomanip>
 #include <set>
 #include <utility>
 #include <vector>
@@ -113,7 +112,8 @@ struct RegisterAndSpace {
   ast::VariableBindingPoint const binding_point;
 };
 
-std::ostream& operator<<(std::ostream& s, const RegisterAndSpace& rs) {
+utils::StringStream& operator<<(utils::StringStream& s,
+                                const RegisterAndSpace& rs) {
   s << " : register(" << rs.reg << rs.binding_point.binding->value << ", space"
     << rs.binding_point.group->value << ")";
   return s;
@@ -220,6 +220,7 @@ GeneratorImpl::~GeneratorImpl() = default;
 bool GeneratorImpl::Generate() {
   const TypeInfo* last_kind = nullptr;
   size_t last_padding_line = 0;
+  auto helpers_marker = current_buffer_->Mark();
 
   auto* mod = builder_.Sem().Module();
   for (auto* decl : mod->DependencyOrderedDeclarations()) {
@@ -278,7 +279,7 @@ bool GeneratorImpl::Generate() {
   }
 
   if (!helpers_.lines.empty()) {
-    current_buffer_->Insert(helpers_, 0, 0);
+    current_buffer_->Insert(helpers_, helpers_marker, 0);
   }
 
   return true;
@@ -291,7 +292,7 @@ bool GeneratorImpl::EmitDynamicVectorAssignment(
       utils::GetOrCreate(dynamic_vector_write_, vec, [&]() -> std::string {
         std::string fn;
         {
-          std::ostringstream ss;
+          utils::StringStream ss;
           if (!EmitType(ss, vec, tint::ast::StorageClass::kInvalid,
                         ast::Access::kUndefined, "")) {
             return "";
@@ -367,7 +368,7 @@ bool GeneratorImpl::EmitDynamicMatrixVectorAssignment(
       dynamic_matrix_vector_write_, mat, [&]() -> std::string {
         std::string fn;
         {
-          std::ostringstream ss;
+          utils::StringStream ss;
           if (!EmitType(ss, mat, tint::ast::StorageClass::kInvalid,
                         ast::Access::kUndefined, "")) {
             return "";
@@ -441,7 +442,7 @@ bool GeneratorImpl::EmitDynamicMatrixScalarAssignment(
       dynamic_matrix_scalar_write_, mat, [&]() -> std::string {
         std::string fn;
         {
-          std::ostringstream ss;
+          utils::StringStream ss;
           if (!EmitType(ss, mat, tint::ast::StorageClass::kInvalid,
                         ast::Access::kUndefined, "")) {
             return "";
@@ -536,7 +537,7 @@ bool GeneratorImpl::EmitDynamicMatrixScalarAssignment(
 }
 
 bool GeneratorImpl::EmitIndexAccessor(
-    std::ostream& out,
+    utils::StringStream& out,
     const ast::IndexAccessorExpression* expr) {
   if (!EmitExpression(out, expr->object)) {
     return false;
@@ -551,7 +552,7 @@ bool GeneratorImpl::EmitIndexAccessor(
   return true;
 }
 
-bool GeneratorImpl::EmitBitcast(std::ostream& out,
+bool GeneratorImpl::EmitBitcast(utils::StringStream& out,
                                 const ast::BitcastExpression* expr) {
   auto* type = TypeOf(expr);
   if (auto* vec = type->UnwrapRef()->As<sem::Vector>()) {
@@ -624,7 +625,7 @@ bool GeneratorImpl::EmitAssign(const ast::AssignmentStatement* stmt) {
   return true;
 }
 
-bool GeneratorImpl::EmitExpressionOrOneIfZero(std::ostream& out,
+bool GeneratorImpl::EmitExpressionOrOneIfZero(utils::StringStream& out,
                                               const ast::Expression* expr) {
   // For constants, replace literal 0 with 1.
   sem::Constant::Scalars elems;
@@ -676,13 +677,13 @@ bool GeneratorImpl::EmitExpressionOrOneIfZero(std::ostream& out,
   // and return 1 in that case.
   std::string zero;
   {
-    std::ostringstream ss;
+    utils::StringStream ss;
     EmitValue(ss, ty, 0);
     zero = ss.str();
   }
   std::string one;
   {
-    std::ostringstream ss;
+    utils::StringStream ss;
     EmitValue(ss, ty, 1);
     one = ss.str();
   }
@@ -712,7 +713,7 @@ bool GeneratorImpl::EmitExpressionOrOneIfZero(std::ostream& out,
         // }
         std::string ty_name;
         {
-          std::ostringstream ss;
+          utils::StringStream ss;
           if (!EmitType(ss, ty, tint::ast::StorageClass::kInvalid,
                         ast::Access::kUndefined, "")) {
             return "";
@@ -745,7 +746,7 @@ bool GeneratorImpl::EmitExpressionOrOneIfZero(std::ostream& out,
   return true;
 }
 
-bool GeneratorImpl::EmitBinary(std::ostream& out,
+bool GeneratorImpl::EmitBinary(utils::StringStream& out,
                                const ast::BinaryExpression* expr) {
   if (expr->op == ast::BinaryOp::kLogicalAnd ||
       expr->op == ast::BinaryOp::kLogicalOr) {
@@ -926,7 +927,7 @@ bool GeneratorImpl::EmitBreak(const ast::BreakStatement*) {
   return true;
 }
 
-bool GeneratorImpl::EmitCall(std::ostream& out,
+bool GeneratorImpl::EmitCall(utils::StringStream& out,
                              const ast::CallExpression* expr) {
   auto* call = builder_.Sem().Get(expr);
   auto* target = call->Target();
@@ -951,7 +952,7 @@ bool GeneratorImpl::EmitCall(std::ostream& out,
       });
 }
 
-bool GeneratorImpl::EmitFunctionCall(std::ostream& out,
+bool GeneratorImpl::EmitFunctionCall(utils::StringStream& out,
                                      const sem::Call* call,
                                      const sem::Function* func) {
   auto* expr = call->Declaration();
@@ -1005,7 +1006,7 @@ bool GeneratorImpl::EmitFunctionCall(std::ostream& out,
   return true;
 }
 
-bool GeneratorImpl::EmitBuiltinCall(std::ostream& out,
+bool GeneratorImpl::EmitBuiltinCall(utils::StringStream& out,
                                     const sem::Call* call,
                                     const sem::Builtin* builtin) {
   auto* expr = call->Declaration();
@@ -1065,7 +1066,7 @@ bool GeneratorImpl::EmitBuiltinCall(std::ostream& out,
   return true;
 }
 
-bool GeneratorImpl::EmitTypeConversion(std::ostream& out,
+bool GeneratorImpl::EmitTypeConversion(utils::StringStream& out,
                                        const sem::Call* call,
                                        const sem::TypeConversion* conv) {
   if (!EmitType(out, conv->Target(), ast::StorageClass::kNone,
@@ -1082,7 +1083,7 @@ bool GeneratorImpl::EmitTypeConversion(std::ostream& out,
   return true;
 }
 
-bool GeneratorImpl::EmitTypeConstructor(std::ostream& out,
+bool GeneratorImpl::EmitTypeConstructor(utils::StringStream& out,
                                         const sem::Call* call,
                                         const sem::TypeConstructor* ctor) {
   auto* type = call->Type();
@@ -1140,7 +1141,7 @@ bool GeneratorImpl::EmitTypeConstructor(std::ostream& out,
 }
 
 bool GeneratorImpl::EmitUniformBufferAccess(
-    std::ostream& out,
+    utils::StringStream& out,
     const ast::CallExpression* expr,
     const transform::DecomposeMemoryAccess::Intrinsic* intrinsic) {
   const auto& args = expr->args;
@@ -1279,7 +1280,7 @@ bool GeneratorImpl::EmitUniformBufferAccess(
 }
 
 bool GeneratorImpl::EmitStorageBufferAccess(
-    std::ostream& out,
+    utils::StringStream& out,
     const ast::CallExpression* expr,
     const transform::DecomposeMemoryAccess::Intrinsic* intrinsic) {
   const auto& args = expr->args;
@@ -1413,7 +1414,7 @@ bool GeneratorImpl::EmitStorageBufferAccess(
 }
 
 bool GeneratorImpl::EmitStorageAtomicCall(
-    std::ostream& out,
+    utils::StringStream& out,
     const ast::CallExpression* expr,
     const transform::DecomposeMemoryAccess::Intrinsic* intrinsic) {
   using Op = transform::DecomposeMemoryAccess::Intrinsic::Op;
@@ -1639,7 +1640,7 @@ bool GeneratorImpl::EmitStorageAtomicCall(
   return true;
 }
 
-bool GeneratorImpl::EmitWorkgroupAtomicCall(std::ostream& out,
+bool GeneratorImpl::EmitWorkgroupAtomicCall(utils::StringStream& out,
                                             const ast::CallExpression* expr,
                                             const sem::Builtin* builtin) {
   std::string result = UniqueIdentifier("atomic_result");
@@ -1812,7 +1813,7 @@ bool GeneratorImpl::EmitWorkgroupAtomicCall(std::ostream& out,
   return false;
 }
 
-bool GeneratorImpl::EmitSelectCall(std::ostream& out,
+bool GeneratorImpl::EmitSelectCall(utils::StringStream& out,
                                    const ast::CallExpression* expr) {
   auto* expr_false = expr->args[0];
   auto* expr_true = expr->args[1];
@@ -1837,7 +1838,7 @@ bool GeneratorImpl::EmitSelectCall(std::ostream& out,
   return true;
 }
 
-bool GeneratorImpl::EmitModfCall(std::ostream& out,
+bool GeneratorImpl::EmitModfCall(utils::StringStream& out,
                                  const ast::CallExpression* expr,
                                  const sem::Builtin* builtin) {
   return CallBuiltinHelper(
@@ -1873,7 +1874,7 @@ bool GeneratorImpl::EmitModfCall(std::ostream& out,
       });
 }
 
-bool GeneratorImpl::EmitFrexpCall(std::ostream& out,
+bool GeneratorImpl::EmitFrexpCall(utils::StringStream& out,
                                   const ast::CallExpression* expr,
                                   const sem::Builtin* builtin) {
   return CallBuiltinHelper(
@@ -1909,7 +1910,7 @@ bool GeneratorImpl::EmitFrexpCall(std::ostream& out,
       });
 }
 
-bool GeneratorImpl::EmitIsNormalCall(std::ostream& out,
+bool GeneratorImpl::EmitIsNormalCall(utils::StringStream& out,
                                      const ast::CallExpression* expr,
                                      const sem::Builtin* builtin) {
   // HLSL doesn't have a isNormal builtin, we need to emulate
@@ -1937,31 +1938,31 @@ bool GeneratorImpl::EmitIsNormalCall(std::ostream& out,
       });
 }
 
-bool GeneratorImpl::EmitDegreesCall(std::ostream& out,
+bool GeneratorImpl::EmitDegreesCall(utils::StringStream& out,
                                     const ast::CallExpression* expr,
                                     const sem::Builtin* builtin) {
   return CallBuiltinHelper(
       out, expr, builtin,
       [&](TextBuffer* b, const std::vector<std::string>& params) {
-        line(b) << "return " << params[0] << " * " << std::setprecision(20)
-                << sem::kRadToDeg << ";";
+        line(b) << "return " << params[0] << " * "
+                << utils::SetPrecision(20) << sem::kRadToDeg << ";";
         return true;
       });
 }
 
-bool GeneratorImpl::EmitRadiansCall(std::ostream& out,
+bool GeneratorImpl::EmitRadiansCall(utils::StringStream& out,
                                     const ast::CallExpression* expr,
                                     const sem::Builtin* builtin) {
   return CallBuiltinHelper(
       out, expr, builtin,
       [&](TextBuffer* b, const std::vector<std::string>& params) {
-        line(b) << "return " << params[0] << " * " << std::setprecision(20)
-                << sem::kDegToRad << ";";
+        line(b) << "return " << params[0] << " * "
+                << utils::SetPrecision(20) << sem::kDegToRad << ";";
         return true;
       });
 }
 
-bool GeneratorImpl::EmitDataPackingCall(std::ostream& out,
+bool GeneratorImpl::EmitDataPackingCall(utils::StringStream& out,
                                         const ast::CallExpression* expr,
                                         const sem::Builtin* builtin) {
   return CallBuiltinHelper(
@@ -2027,7 +2028,7 @@ bool GeneratorImpl::EmitDataPackingCall(std::ostream& out,
       });
 }
 
-bool GeneratorImpl::EmitDataUnpackingCall(std::ostream& out,
+bool GeneratorImpl::EmitDataUnpackingCall(utils::StringStream& out,
                                           const ast::CallExpression* expr,
                                           const sem::Builtin* builtin) {
   return CallBuiltinHelper(
@@ -2097,7 +2098,7 @@ bool GeneratorImpl::EmitDataUnpackingCall(std::ostream& out,
       });
 }
 
-bool GeneratorImpl::EmitBarrierCall(std::ostream& out,
+bool GeneratorImpl::EmitBarrierCall(utils::StringStream& out,
                                     const sem::Builtin* builtin) {
   // TODO(crbug.com/tint/661): Combine sequential barriers to a single
   // instruction.
@@ -2113,7 +2114,7 @@ bool GeneratorImpl::EmitBarrierCall(std::ostream& out,
   return true;
 }
 
-bool GeneratorImpl::EmitTextureCall(std::ostream& out,
+bool GeneratorImpl::EmitTextureCall(utils::StringStream& out,
                                     const sem::Call* call,
                                     const sem::Builtin* builtin) {
   using Usage = sem::ParameterUsage;
@@ -2642,7 +2643,7 @@ bool GeneratorImpl::EmitDiscard(const ast::DiscardStatement*) {
   return true;
 }
 
-bool GeneratorImpl::EmitExpression(std::ostream& out,
+bool GeneratorImpl::EmitExpression(utils::StringStream& out,
                                    const ast::Expression* expr) {
   return Switch(
       expr,
@@ -2678,7 +2679,7 @@ bool GeneratorImpl::EmitExpression(std::ostream& out,
       });
 }
 
-bool GeneratorImpl::EmitIdentifier(std::ostream& out,
+bool GeneratorImpl::EmitIdentifier(utils::StringStream& out,
                                    const ast::IdentifierExpression* expr) {
   out << builder_.Symbols().NameFor(expr->symbol);
   return true;
@@ -3079,7 +3080,7 @@ bool GeneratorImpl::EmitEntryPointFunction(const ast::Function* func) {
           out << std::to_string(wgsize[i].value);
         }
       }
-      out << ")]" << std::endl;
+      out << ")]\n";
     }
 
     out << func->return_type->FriendlyName(builder_.Symbols());
@@ -3121,7 +3122,7 @@ bool GeneratorImpl::EmitEntryPointFunction(const ast::Function* func) {
     }
 
     if (!Is<ast::ReturnStatement>(func->body->Last())) {
-      ast::ReturnStatement ret(ProgramID(), Source{});
+      ast::ReturnStatement ret(ProgramID(), ast::NodeID(), Source{});
       if (!EmitStatement(&ret)) {
         return false;
       }
@@ -3133,7 +3134,7 @@ bool GeneratorImpl::EmitEntryPointFunction(const ast::Function* func) {
   return true;
 }
 
-bool GeneratorImpl::EmitLiteral(std::ostream& out,
+bool GeneratorImpl::EmitLiteral(utils::StringStream& out,
                                 const ast::LiteralExpression* lit) {
   return Switch(
       lit,
@@ -3166,7 +3167,7 @@ bool GeneratorImpl::EmitLiteral(std::ostream& out,
       });
 }
 
-bool GeneratorImpl::EmitValue(std::ostream& out,
+bool GeneratorImpl::EmitValue(utils::StringStream& out,
                               const sem::Type* type,
                               int value) {
   return Switch(
@@ -3239,7 +3240,8 @@ bool GeneratorImpl::EmitValue(std::ostream& out,
       });
 }
 
-bool GeneratorImpl::EmitZeroValue(std::ostream& out, const sem::Type* type) {
+bool GeneratorImpl::EmitZeroValue(utils::StringStream& out,
+                                  const sem::Type* type) {
   return EmitValue(out, type, 0);
 }
 
@@ -3288,7 +3290,7 @@ bool GeneratorImpl::EmitForLoop(const ast::ForLoopStatement* stmt) {
   }
 
   TextBuffer cond_pre;
-  std::stringstream cond_buf;
+  utils::StringStream cond_buf;
   if (auto* cond = stmt->condition) {
     TINT_SCOPED_ASSIGNMENT(current_buffer_, &cond_pre);
     if (!EmitExpression(cond_buf, cond)) {
@@ -3379,7 +3381,7 @@ bool GeneratorImpl::EmitForLoop(const ast::ForLoopStatement* stmt) {
 }
 
 bool GeneratorImpl::EmitMemberAccessor(
-    std::ostream& out,
+    utils::StringStream& out,
     const ast::MemberAccessorExpression* expr) {
   if (!EmitExpression(out, expr->structure)) {
     return false;
@@ -3527,7 +3529,7 @@ bool GeneratorImpl::EmitSwitch(const ast::SwitchStatement* stmt) {
   return true;
 }
 
-bool GeneratorImpl::EmitType(std::ostream& out,
+bool GeneratorImpl::EmitType(utils::StringStream& out,
                              const sem::Type* type,
                              ast::StorageClass storage_class,
                              ast::Access access,
@@ -3732,7 +3734,7 @@ bool GeneratorImpl::EmitType(std::ostream& out,
       });
 }
 
-bool GeneratorImpl::EmitTypeAndName(std::ostream& out,
+bool GeneratorImpl::EmitTypeAndName(utils::StringStream& out,
                                     const sem::Type* type,
                                     ast::StorageClass storage_class,
                                     ast::Access access,
@@ -3833,7 +3835,7 @@ bool GeneratorImpl::EmitStructType(TextBuffer* b, const sem::Struct* str) {
   return true;
 }
 
-bool GeneratorImpl::EmitUnaryOp(std::ostream& out,
+bool GeneratorImpl::EmitUnaryOp(utils::StringStream& out,
                                 const ast::UnaryOpExpression* expr) {
   switch (expr->op) {
     case ast::UnaryOp::kIndirection:
@@ -3955,7 +3957,7 @@ bool GeneratorImpl::EmitProgramConstVariable(const ast::Variable* var) {
 }
 
 template <typename F>
-bool GeneratorImpl::CallBuiltinHelper(std::ostream& out,
+bool GeneratorImpl::CallBuiltinHelper(utils::StringStream& out,
                                       const ast::CallExpression* call,
                                       const sem::Builtin* builtin,
                                       F&& build) {
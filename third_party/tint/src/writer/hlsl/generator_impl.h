@@ -94,7 +94,7 @@ class GeneratorImpl : public TextGenerator {
   /// @param out the output of the expression stream
   /// @param expr the expression to emit
   /// @returns true if the index accessor was emitted
-  bool EmitIndexAccessor(std::ostream& out,
+  bool EmitIndexAccessor(utils::StringStream& out,
                          const ast::IndexAccessorExpression* expr);
   /// Handles an assignment statement
   /// @param stmt the statement to emit
@@ -104,18 +104,19 @@ class GeneratorImpl : public TextGenerator {
   /// @param out the output of the expression stream
   /// @param expr the expression
   /// @returns true if the expression was emitted, false otherwise
-  bool EmitExpressionOrOneIfZero(std::ostream& out,
+  bool EmitExpressionOrOneIfZero(utils::StringStream& out,
                                  const ast::Expression* expr);
   /// Handles generating a binary expression
   /// @param out the output of the expression stream
   /// @param expr the binary expression
   /// @returns true if the expression was emitted, false otherwise
-  bool EmitBinary(std::ostream& out, const ast::BinaryExpression* expr);
+  bool EmitBinary(utils::StringStream& out, const ast::BinaryExpression* expr);
   /// Handles generating a bitcast expression
   /// @param out the output of the expression stream
   /// @param expr the as expression
   /// @returns true if the bitcast was emitted
-  bool EmitBitcast(std::ostream& out, const ast::BitcastExpression* expr);
+  bool EmitBitcast(utils::StringStream& out,
+                   const ast::BitcastExpression* expr);
   /// Emits a list of statements
   /// @param stmts the statement list
   /// @returns true if the statements were emitted successfully
@@ -136,13 +137,13 @@ class GeneratorImpl : public TextGenerator {
   /// @param out the output of the expression stream
   /// @param expr the call expression
   /// @returns true if the call expression is emitted
-  bool EmitCall(std::ostream& out, const ast::CallExpression* expr);
+  bool EmitCall(utils::StringStream& out, const ast::CallExpression* expr);
   /// Handles generating a function call expression
   /// @param out the output of the expression stream
   /// @param call the call expression
   /// @param function the function being called
   /// @returns true if the expression is emitted
-  bool EmitFunctionCall(std::ostream& out,
+  bool EmitFunctionCall(utils::StringStream& out,
                         const sem::Call* call,
                         const sem::Function* function);
   /// Handles generating a builtin call expression
@@ -150,7 +151,7 @@ class GeneratorImpl : public TextGenerator {
   /// @param call the call expression
   /// @param builtin the builtin being called
   /// @returns true if the expression is emitted
-  bool EmitBuiltinCall(std::ostream& out,
+  bool EmitBuiltinCall(utils::StringStream& out,
                        const sem::Call* call,
                        const sem::Builtin* builtin);
   /// Handles generating a type conversion expression
@@ -158,7 +159,7 @@ class GeneratorImpl : public TextGenerator {
   /// @param call the call expression
   /// @param conv the type conversion
   /// @returns true if the expression is emitted
-  bool EmitTypeConversion(std::ostream& out,
+  bool EmitTypeConversion(utils::StringStream& out,
                           const sem::Call* call,
                           const sem::TypeConversion* conv);
   /// Handles generating a type constructor expression
@@ -166,7 +167,7 @@ class GeneratorImpl : public TextGenerator {
   /// @param call the call expression
   /// @param ctor the type constructor
   /// @returns true if the expression is emitted
-  bool EmitTypeConstructor(std::ostream& out,
+  bool EmitTypeConstructor(utils::StringStream& out,
                            const sem::Call* call,
                            const sem::TypeConstructor* ctor);
   /// Handles generating a call expression to a
@@ -176,7 +177,7 @@ class GeneratorImpl : public TextGenerator {
   /// @param intrinsic the transform::DecomposeMemoryAccess::Intrinsic
   /// @returns true if the call expression is emitted
   bool EmitUniformBufferAccess(
-      std::ostream& out,
+      utils::StringStream& out,
       const ast::CallExpression* expr,
       const transform::DecomposeMemoryAccess::Intrinsic* intrinsic);
   /// Handles generating a call expression to a
@@ -186,21 +187,21 @@ class GeneratorImpl : public TextGenerator {
   /// @param intrinsic the transform::DecomposeMemoryAccess::Intrinsic
   /// @returns true if the call expression is emitted
   bool EmitStorageBufferAccess(
-      std::ostream& out,
+      utils::StringStream& out,
       const ast::CallExpression* expr,
       const transform::DecomposeMemoryAccess::Intrinsic* intrinsic);
   /// Handles generating a barrier intrinsic call
   /// @param out the output of the expression stream
   /// @param builtin the semantic information for the barrier builtin
   /// @returns true if the call expression is emitted
-  bool EmitBarrierCall(std::ostream& out, const sem::Builtin* builtin);
+  bool EmitBarrierCall(utils::StringStream& out, const sem::Builtin* builtin);
   /// Handles generating an atomic intrinsic call for a storage buffer variable
   /// @param out the output of the expression stream
   /// @param expr the call expression
   /// @param intrinsic the atomic intrinsic
   /// @returns true if the call expression is emitted
   bool EmitStorageAtomicCall(
-      std::ostream& out,
+      utils::StringStream& out,
       const ast::CallExpression* expr,
       const transform::DecomposeMemoryAccess::Intrinsic* intrinsic);
   /// Handles generating an atomic intrinsic call for a workgroup variable
@@ -208,7 +209,7 @@ class GeneratorImpl : public TextGenerator {
   /// @param expr the call expression
   /// @param builtin the semantic information for the atomic builtin
   /// @returns true if the call expression is emitted
-  bool EmitWorkgroupAtomicCall(std::ostream& out,
+  bool EmitWorkgroupAtomicCall(utils::StringStream& out,
                                const ast::CallExpression* expr,
                                const sem::Builtin* builtin);
   /// Handles generating a call to a texture function (`textureSample`,
@@ -217,20 +218,21 @@ class GeneratorImpl : public TextGenerator {
   /// @param call the call expression
   /// @param builtin the semantic information for the texture builtin
   /// @returns true if the call expression is emitted
-  bool EmitTextureCall(std::ostream& out,
+  bool EmitTextureCall(utils::StringStream& out,
                        const sem::Call* call,
                        const sem::Builtin* builtin);
   /// Handles generating a call to the `select()` builtin
   /// @param out the output of the expression stream
   /// @param expr the call expression
   /// @returns true if the call expression is emitted
-  bool EmitSelectCall(std::ostream& out, const ast::CallExpression* expr);
+  bool EmitSelectCall(utils::StringStream& out,
+                      const ast::CallExpression* expr);
   /// Handles generating a call to the `modf()` builtin
   /// @param out the output of the expression stream
   /// @param expr the call expression
   /// @param builtin the semantic information for the builtin
   /// @returns true if the call expression is emitted
-  bool EmitModfCall(std::ostream& out,
+  bool EmitModfCall(utils::StringStream& out,
                     const ast::CallExpression* expr,
                     const sem::Builtin* builtin);
   /// Handles generating a call to the `frexp()` builtin
@@ -238,7 +240,7 @@ class GeneratorImpl : public TextGenerator {
   /// @param expr the call expression
   /// @param builtin the semantic information for the builtin
   /// @returns true if the call expression is emitted
-  bool EmitFrexpCall(std::ostream& out,
+  bool EmitFrexpCall(utils::StringStream& out,
                      const ast::CallExpression* expr,
                      const sem::Builtin* builtin);
   /// Handles generating a call to the `isNormal()` builtin
@@ -246,7 +248,7 @@ class GeneratorImpl : public TextGenerator {
   /// @param expr the call expression
   /// @param builtin the semantic information for the builtin
   /// @returns true if the call expression is emitted
-  bool EmitIsNormalCall(std::ostream& out,
+  bool EmitIsNormalCall(utils::StringStream& out,
                         const ast::CallExpression* expr,
                         const sem::Builtin* builtin);
   /// Handles generating a call to the `degrees()` builtin
@@ -254,7 +256,7 @@ class GeneratorImpl : public TextGenerator {
   /// @param expr the call expression
   /// @param builtin the semantic information for the builtin
   /// @returns true if the call expression is emitted
-  bool EmitDegreesCall(std::ostream& out,
+  bool EmitDegreesCall(utils::StringStream& out,
                        const ast::CallExpression* expr,
                        const sem::Builtin* builtin);
   /// Handles generating a call to the `radians()` builtin
@@ -262,7 +264,7 @@ class GeneratorImpl : public TextGenerator {
   /// @param expr the call expression
   /// @param builtin the semantic information for the builtin
   /// @returns true if the call expression is emitted
-  bool EmitRadiansCall(std::ostream& out,
+  bool EmitRadiansCall(utils::StringStream& out,
                        const ast::CallExpression* expr,
                        const sem::Builtin* builtin);
   /// Handles generating a call to data packing builtin
@@ -270,7 +272,7 @@ class GeneratorImpl : public TextGenerator {
   /// @param expr the call expression
   /// @param builtin the semantic information for the texture builtin
   /// @returns true if the call expression is emitted
-  bool EmitDataPackingCall(std::ostream& out,
+  bool EmitDataPackingCall(utils::StringStream& out,
                            const ast::CallExpression* expr,
                            const sem::Builtin* builtin);
   /// Handles generating a call to data unpacking builtin
@@ -278,7 +280,7 @@ class GeneratorImpl : public TextGenerator {
   /// @param expr the call expression
   /// @param builtin the semantic information for the texture builtin
   /// @returns true if the call expression is emitted
-  bool EmitDataUnpackingCall(std::ostream& out,
+  bool EmitDataUnpackingCall(utils::StringStream& out,
                              const ast::CallExpression* expr,
                              const sem::Builtin* builtin);
   /// Handles a case statement
@@ -298,7 +300,7 @@ class GeneratorImpl : public TextGenerator {
   /// @param out the output of the expression stream
   /// @param expr the expression
   /// @returns true if the expression was emitted
-  bool EmitExpression(std::ostream& out, const ast::Expression* expr);
+  bool EmitExpression(utils::StringStream& out, const ast::Expression* expr);
   /// Handles generating a function
   /// @param func the function to generate
   /// @returns true if the function was emitted
@@ -350,7 +352,7 @@ class GeneratorImpl : public TextGenerator {
   /// @param out the output stream
   /// @param lit the literal to emit
   /// @returns true if the literal was successfully emitted
-  bool EmitLiteral(std::ostream& out, const ast::LiteralExpression* lit);
+  bool EmitLiteral(utils::StringStream& out, const ast::LiteralExpression* lit);
   /// Handles a loop statement
   /// @param stmt the statement to emit
   /// @returns true if the statement was emitted
@@ -363,12 +365,13 @@ class GeneratorImpl : public TextGenerator {
   /// @param out the output of the expression stream
   /// @param expr the identifier expression
   /// @returns true if the identifeir was emitted
-  bool EmitIdentifier(std::ostream& out, const ast::IdentifierExpression* expr);
+  bool EmitIdentifier(utils::StringStream& out,
+                      const ast::IdentifierExpression* expr);
   /// Handles a member accessor expression
   /// @param out the output of the expression stream
   /// @param expr the member accessor expression
   /// @returns true if the member accessor was emitted
-  bool EmitMemberAccessor(std::ostream& out,
+  bool EmitMemberAccessor(utils::StringStream& out,
                           const ast::MemberAccessorExpression* expr);
   /// Handles return statements
   /// @param stmt the statement to emit
@@ -395,7 +398,7 @@ class GeneratorImpl : public TextGenerator {
   /// @param name_printed (optional) if not nullptr and an array was printed
   /// then the boolean is set to true.
   /// @returns true if the type is emitted
-  bool EmitType(std::ostream& out,
+  bool EmitType(utils::StringStream& out,
                 const sem::Type* type,
                 ast::StorageClass storage_class,
                 ast::Access access,
@@ -408,7 +411,7 @@ class GeneratorImpl : public TextGenerator {
   /// @param access the access control type of the variable
   /// @param name the name to emit
   /// @returns true if the type is emitted
-  bool EmitTypeAndName(std::ostream& out,
+  bool EmitTypeAndName(utils::StringStream& out,
                        const sem::Type* type,
                        ast::StorageClass storage_class,
                        ast::Access access,
@@ -422,18 +425,19 @@ class GeneratorImpl : public TextGenerator {
   /// @param out the output of the expression stream
   /// @param expr the expression to emit
   /// @returns true if the expression was emitted
-  bool EmitUnaryOp(std::ostream& out, const ast::UnaryOpExpression* expr);
+  bool EmitUnaryOp(utils::StringStream& out,
+                   const ast::UnaryOpExpression* expr);
   /// Emits `value` for the given type
   /// @param out the output stream
   /// @param type the type to emit the value for
   /// @param value the value to emit
   /// @returns true if the value was successfully emitted.
-  bool EmitValue(std::ostream& out, const sem::Type* type, int value);
+  bool EmitValue(utils::StringStream& out, const sem::Type* type, int value);
   /// Emits the zero value for the given type
   /// @param out the output stream
   /// @param type the type to emit the value for
   /// @returns true if the zero value was successfully emitted.
-  bool EmitZeroValue(std::ostream& out, const sem::Type* type);
+  bool EmitZeroValue(utils::StringStream& out, const sem::Type* type);
   /// Handles generating a variable
   /// @param var the variable to generate
   /// @returns true if the variable was emitted
@@ -527,7 +531,7 @@ class GeneratorImpl : public TextGenerator {
   ///          `params` is the name of all the generated function parameters
   /// @returns true if the call expression is emitted
   template <typename F>
-  bool CallBuiltinHelper(std::ostream& out,
+  bool CallBuiltinHelper(utils::StringStream& out,
                          const ast::CallExpression* call,
                          const sem::Builtin* builtin,
                          F&& build);
@@ -28,7 +28,7 @@ TEST_F(HlslGeneratorImplTest_Expression, IndexAccessor) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitExpression(out, expr)) << gen.error();
   EXPECT_EQ(out.str(), "ary[5]");
 }
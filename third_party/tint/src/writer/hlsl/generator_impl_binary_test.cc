@@ -63,7 +63,7 @@ TEST_P(HlslBinaryTest, Emit_f32) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitExpression(out, expr)) << gen.error();
   EXPECT_EQ(out.str(), params.result);
 }
@@ -86,7 +86,7 @@ TEST_P(HlslBinaryTest, Emit_u32) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitExpression(out, expr)) << gen.error();
   EXPECT_EQ(out.str(), params.result);
 }
@@ -115,7 +115,7 @@ TEST_P(HlslBinaryTest, Emit_i32) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitExpression(out, expr)) << gen.error();
   EXPECT_EQ(out.str(), params.result);
 }
@@ -155,7 +155,7 @@ TEST_F(HlslGeneratorImplTest_Binary, Multiply_VectorScalar) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   EXPECT_TRUE(gen.EmitExpression(out, expr)) << gen.error();
   EXPECT_EQ(out.str(),
             "(float3(1.0f, 1.0f, 1.0f) * "
@@ -173,7 +173,7 @@ TEST_F(HlslGeneratorImplTest_Binary, Multiply_ScalarVector) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   EXPECT_TRUE(gen.EmitExpression(out, expr)) << gen.error();
   EXPECT_EQ(out.str(),
             "(1.0f * float3(1.0f, 1.0f, "
@@ -191,7 +191,7 @@ TEST_F(HlslGeneratorImplTest_Binary, Multiply_MatrixScalar) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   EXPECT_TRUE(gen.EmitExpression(out, expr)) << gen.error();
   EXPECT_EQ(out.str(), "(mat * 1.0f)");
 }
@@ -207,7 +207,7 @@ TEST_F(HlslGeneratorImplTest_Binary, Multiply_ScalarMatrix) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   EXPECT_TRUE(gen.EmitExpression(out, expr)) << gen.error();
   EXPECT_EQ(out.str(), "(1.0f * mat)");
 }
@@ -223,7 +223,7 @@ TEST_F(HlslGeneratorImplTest_Binary, Multiply_MatrixVector) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   EXPECT_TRUE(gen.EmitExpression(out, expr)) << gen.error();
   EXPECT_EQ(out.str(), "mul(float3(1.0f, 1.0f, 1.0f), mat)");
 }
@@ -239,7 +239,7 @@ TEST_F(HlslGeneratorImplTest_Binary, Multiply_VectorMatrix) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   EXPECT_TRUE(gen.EmitExpression(out, expr)) << gen.error();
   EXPECT_EQ(out.str(), "mul(mat, float3(1.0f, 1.0f, 1.0f))");
 }
@@ -254,7 +254,7 @@ TEST_F(HlslGeneratorImplTest_Binary, Multiply_MatrixMatrix) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   EXPECT_TRUE(gen.EmitExpression(out, expr)) << gen.error();
   EXPECT_EQ(out.str(), "mul(rhs, lhs)");
 }
@@ -269,7 +269,7 @@ TEST_F(HlslGeneratorImplTest_Binary, Logical_And) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitExpression(out, expr)) << gen.error();
   EXPECT_EQ(out.str(), "(tint_tmp)");
   EXPECT_EQ(gen.result(), R"(bool tint_tmp = a;
@@ -296,7 +296,7 @@ TEST_F(HlslGeneratorImplTest_Binary, Logical_Multi) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitExpression(out, expr)) << gen.error();
   EXPECT_EQ(out.str(), "(tint_tmp)");
   EXPECT_EQ(gen.result(), R"(bool tint_tmp_1 = a;
@@ -324,7 +324,7 @@ TEST_F(HlslGeneratorImplTest_Binary, Logical_Or) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitExpression(out, expr)) << gen.error();
   EXPECT_EQ(out.str(), "(tint_tmp)");
   EXPECT_EQ(gen.result(), R"(bool tint_tmp = a;
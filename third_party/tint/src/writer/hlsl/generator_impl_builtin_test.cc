@@ -262,7 +262,7 @@ TEST_F(HlslGeneratorImplTest_Builtin, Builtin_Call) {
   GeneratorImpl& gen = Build();
 
   gen.increment_indent();
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitExpression(out, call)) << gen.error();
   EXPECT_EQ(out.str(), "dot(param1, param2)");
 }
@@ -273,7 +273,7 @@ TEST_F(HlslGeneratorImplTest_Builtin, Select_Scalar) {
   GeneratorImpl& gen = Build();
 
   gen.increment_indent();
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitExpression(out, call)) << gen.error();
   EXPECT_EQ(out.str(), "(true ? 2.0f : 1.0f)");
 }
@@ -285,7 +285,7 @@ TEST_F(HlslGeneratorImplTest_Builtin, Select_Vector) {
   GeneratorImpl& gen = Build();
 
   gen.increment_indent();
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitExpression(out, call)) << gen.error();
   EXPECT_EQ(out.str(), "(bool2(true, false) ? int2(3, 4) : int2(1, 2))");
 }
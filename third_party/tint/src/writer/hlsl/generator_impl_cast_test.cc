@@ -27,7 +27,7 @@ TEST_F(HlslGeneratorImplTest_Cast, EmitExpression_Cast_Scalar) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitExpression(out, cast)) << gen.error();
   EXPECT_EQ(out.str(), "float(1)");
 }
@@ -38,7 +38,7 @@ TEST_F(HlslGeneratorImplTest_Cast, EmitExpression_Cast_Vector) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitExpression(out, cast)) << gen.error();
   EXPECT_EQ(out.str(), "float3(int3(1, 2, 3))");
 }
@@ -29,7 +29,7 @@ TEST_F(HlslGeneratorImplTest_Identifier, EmitIdentifierExpression) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitExpression(out, i)) << gen.error();
   EXPECT_EQ(out.str(), "foo");
 }
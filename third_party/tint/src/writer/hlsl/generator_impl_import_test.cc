@@ -40,7 +40,7 @@ TEST_P(HlslImportData_SingleParamTest, FloatScalar) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitCall(out, expr)) << gen.error();
   EXPECT_EQ(out.str(), std::string(param.hlsl_name) + "(1.0f)");
 }
@@ -79,7 +79,7 @@ TEST_P(HlslImportData_SingleIntParamTest, IntScalar) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitCall(out, expr)) << gen.error();
   EXPECT_EQ(out.str(), std::string(param.hlsl_name) + "(1)");
 }
@@ -97,7 +97,7 @@ TEST_P(HlslImportData_SingleVectorParamTest, FloatVector) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitCall(out, expr)) << gen.error();
   EXPECT_EQ(out.str(),
             std::string(param.hlsl_name) + "(float3(1.0f, 2.0f, 3.0f))");
@@ -139,7 +139,7 @@ TEST_P(HlslImportData_DualParam_ScalarTest, Float) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitCall(out, expr)) << gen.error();
   EXPECT_EQ(out.str(), std::string(param.hlsl_name) + "(1.0f, 2.0f)");
 }
@@ -162,7 +162,7 @@ TEST_P(HlslImportData_DualParam_VectorTest, Float) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitCall(out, expr)) << gen.error();
   EXPECT_EQ(out.str(),
             std::string(param.hlsl_name) +
@@ -188,7 +188,7 @@ TEST_P(HlslImportData_DualParam_Int_Test, IntScalar) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitCall(out, expr)) << gen.error();
   EXPECT_EQ(out.str(), std::string(param.hlsl_name) + "(1, 2)");
 }
@@ -206,7 +206,7 @@ TEST_P(HlslImportData_TripleParam_ScalarTest, Float) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitCall(out, expr)) << gen.error();
   EXPECT_EQ(out.str(), std::string(param.hlsl_name) + "(1.0f, 2.0f, 3.0f)");
 }
@@ -228,7 +228,7 @@ TEST_P(HlslImportData_TripleParam_VectorTest, Float) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitCall(out, expr)) << gen.error();
   EXPECT_EQ(
       out.str(),
@@ -256,7 +256,7 @@ TEST_P(HlslImportData_TripleParam_Int_Test, IntScalar) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitCall(out, expr)) << gen.error();
   EXPECT_EQ(out.str(), std::string(param.hlsl_name) + "(1, 2, 3)");
 }
@@ -272,7 +272,7 @@ TEST_F(HlslGeneratorImplTest_Import, HlslImportData_Determinant) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitCall(out, expr)) << gen.error();
   EXPECT_EQ(out.str(), std::string("determinant(var)"));
 }
@@ -29,7 +29,7 @@ TEST_F(HlslUnaryOpTest, AddressOf) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitExpression(out, op)) << gen.error();
   EXPECT_EQ(out.str(), "expr");
 }
@@ -42,7 +42,7 @@ TEST_F(HlslUnaryOpTest, Complement) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitExpression(out, op)) << gen.error();
   EXPECT_EQ(out.str(), "~(expr)");
 }
@@ -58,7 +58,7 @@ TEST_F(HlslUnaryOpTest, Indirection) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitExpression(out, op)) << gen.error();
   EXPECT_EQ(out.str(), "expr");
 }
@@ -70,7 +70,7 @@ TEST_F(HlslUnaryOpTest, Not) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitExpression(out, op)) << gen.error();
   EXPECT_EQ(out.str(), "!(expr)");
 }
@@ -83,7 +83,7 @@ TEST_F(HlslUnaryOpTest, Negation) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitExpression(out, op)) << gen.error();
   EXPECT_EQ(out.str(), "-(expr)");
 }
@@ -16,7 +16,7 @@
 
 #include <algorithm>
 #include <cmath>
-#include <iomanip>
+#include <cstdio>
 #include <limits>
 #include <utility>
 #include <vector>
@@ -88,7 +88,7 @@ bool last_is_break_or_fallthrough(const ast::BlockStatement* stmts) {
 class ScopedBitCast {
  public:
   ScopedBitCast(GeneratorImpl* generator,
-                std::ostream& stream,
+                utils::StringStream& stream,
                 const sem::Type* curr_type,
                 const sem::Type* target_type)
       : s(stream) {
@@ -109,7 +109,7 @@ class ScopedBitCast {
   ~ScopedBitCast() { s << ")"; }
 
  private:
-  std::ostream& s;
+  utils::StringStream& s;
 };
 }  // namespace
 
@@ -203,7 +203,7 @@ bool GeneratorImpl::Generate() {
   line();
   line() << "using namespace metal;";
 
-  auto helpers_insertion_point = current_buffer_->lines.size();
+  auto helpers_marker = current_buffer_->Mark();
 
   auto* mod = builder_.Sem().Module();
   for (auto* decl : mod->DependencyOrderedDeclarations()) {
@@ -258,8 +258,8 @@ bool GeneratorImpl::Generate() {
   }
 
   if (!helpers_.lines.empty()) {
-    current_buffer_->Insert("", helpers_insertion_point++, 0);
-    current_buffer_->Insert(helpers_, helpers_insertion_point++, 0);
+    current_buffer_->Insert("", helpers_marker, 0);
+    current_buffer_->Insert(helpers_, helpers_marker, 0);
   }
 
   return true;
@@ -280,7 +280,7 @@ bool GeneratorImpl::EmitTypeDecl(const sem::Type* ty) {
 }
 
 bool GeneratorImpl::EmitIndexAccessor(
-    std::ostream& out,
+    utils::StringStream& out,
     const ast::IndexAccessorExpression* expr) {
   bool paren_lhs =
       !expr->object->IsAnyOf<ast::IndexAccessorExpression, ast::CallExpression,
@@ -307,7 +307,7 @@ bool GeneratorImpl::EmitIndexAccessor(
   return true;
 }
 
-bool GeneratorImpl::EmitBitcast(std::ostream& out,
+bool GeneratorImpl::EmitBitcast(utils::StringStream& out,
                                 const ast::BitcastExpression* expr) {
   out << "as_type<";
   if (!EmitType(out, TypeOf(expr)->UnwrapRef(), "")) {
@@ -341,7 +341,7 @@ bool GeneratorImpl::EmitAssign(const ast::AssignmentStatement* stmt) {
   return true;
 }
 
-bool GeneratorImpl::EmitBinary(std::ostream& out,
+bool GeneratorImpl::EmitBinary(utils::StringStream& out,
                                const ast::BinaryExpression* expr) {
   auto emit_op = [&] {
     out << " ";
@@ -534,7 +534,7 @@ bool GeneratorImpl::EmitBreak(const ast::BreakStatement*) {
   return true;
 }
 
-bool GeneratorImpl::EmitCall(std::ostream& out,
+bool GeneratorImpl::EmitCall(utils::StringStream& out,
                              const ast::CallExpression* expr) {
   auto* call = program_->Sem().Get(expr);
   auto* target = call->Target();
@@ -559,7 +559,7 @@ bool GeneratorImpl::EmitCall(std::ostream& out,
       });
 }
 
-bool GeneratorImpl::EmitFunctionCall(std::ostream& out,
+bool GeneratorImpl::EmitFunctionCall(utils::StringStream& out,
                                      const sem::Call* call,
                                      const sem::Function*) {
   auto* ident = call->Declaration()->target.name;
@@ -581,7 +581,7 @@ bool GeneratorImpl::EmitFunctionCall(std::ostream& out,
   return true;
 }
 
-bool GeneratorImpl::EmitBuiltinCall(std::ostream& out,
+bool GeneratorImpl::EmitBuiltinCall(utils::StringStream& out,
                                     const sem::Call* call,
                                     const sem::Builtin* builtin) {
   auto* expr = call->Declaration();
@@ -683,7 +683,7 @@ bool GeneratorImpl::EmitBuiltinCall(std::ostream& out,
   return true;
 }
 
-bool GeneratorImpl::EmitTypeConversion(std::ostream& out,
+bool GeneratorImpl::EmitTypeConversion(utils::StringStream& out,
                                        const sem::Call* call,
                                        const sem::TypeConversion* conv) {
   if (!EmitType(out, conv->Target(), "")) {
@@ -699,7 +699,7 @@ bool GeneratorImpl::EmitTypeConversion(std::ostream& out,
   return true;
 }
 
-bool GeneratorImpl::EmitTypeConstructor(std::ostream& out,
+bool GeneratorImpl::EmitTypeConstructor(utils::StringStream& out,
                                         const sem::Call* call,
                                         const sem::TypeConstructor* ctor) {
   auto* type = ctor->ReturnType();
@@ -741,7 +741,7 @@ bool GeneratorImpl::EmitTypeConstructor(std::ostream& out,
   return true;
 }
 
-bool GeneratorImpl::EmitAtomicCall(std::ostream& out,
+bool GeneratorImpl::EmitAtomicCall(utils::StringStream& out,
                                    const ast::CallExpression* expr,
                                    const sem::Builtin* builtin) {
   auto call = [&](const std::string& name, bool append_memory_order_relaxed) {
@@ -842,7 +842,7 @@ bool GeneratorImpl::EmitAtomicCall(std::ostream& out,
   return false;
 }
 
-bool GeneratorImpl::EmitTextureCall(std::ostream& out,
+bool GeneratorImpl::EmitTextureCall(utils::StringStream& out,
                                     const sem::Call* call,
                                     const sem::Builtin* builtin) {
   using Usage = sem::ParameterUsage;
@@ -1166,7 +1166,7 @@ bool GeneratorImpl::EmitTextureCall(std::ostream& out,
   return true;
 }
 
-bool GeneratorImpl::EmitDotCall(std::ostream& out,
+bool GeneratorImpl::EmitDotCall(utils::StringStream& out,
                                 const ast::CallExpression* expr,
                                 const sem::Builtin* builtin) {
   auto* vec_ty = builtin->Parameters()[0]->Type()->As<sem::Vector>();
@@ -1213,7 +1213,7 @@ bool GeneratorImpl::EmitDotCall(std::ostream& out,
   return true;
 }
 
-bool GeneratorImpl::EmitModfCall(std::ostream& out,
+bool GeneratorImpl::EmitModfCall(utils::StringStream& out,
                                  const ast::CallExpression* expr,
                                  const sem::Builtin* builtin) {
   return CallBuiltinHelper(
@@ -1241,7 +1241,7 @@ bool GeneratorImpl::EmitModfCall(std::ostream& out,
       });
 }
 
-bool GeneratorImpl::EmitFrexpCall(std::ostream& out,
+bool GeneratorImpl::EmitFrexpCall(utils::StringStream& out,
                                   const ast::CallExpression* expr,
                                   const sem::Builtin* builtin) {
   return CallBuiltinHelper(
@@ -1269,26 +1269,26 @@ bool GeneratorImpl::EmitFrexpCall(std::ostream& out,
       });
 }
 
-bool GeneratorImpl::EmitDegreesCall(std::ostream& out,
+bool GeneratorImpl::EmitDegreesCall(utils::StringStream& out,
                                     const ast::CallExpression* expr,
                                     const sem::Builtin* builtin) {
   return CallBuiltinHelper(
       out, expr, builtin,
       [&](TextBuffer* b, const std::vector<std::string>& params) {
-        line(b) << "return " << params[0] << " * " << std::setprecision(20)
-                << sem::kRadToDeg << ";";
+        line(b) << "return " << params[0] << " * "
+                << utils::SetPrecision(20) << sem::kRadToDeg << ";";
         return true;
       });
 }
 
-bool GeneratorImpl::EmitRadiansCall(std::ostream& out,
+bool GeneratorImpl::EmitRadiansCall(utils::StringStream& out,
                                     const ast::CallExpression* expr,
                                     const sem::Builtin* builtin) {
   return CallBuiltinHelper(
       out, expr, builtin,
       [&](TextBuffer* b, const std::vector<std::string>& params) {
-        line(b) << "return " << params[0] << " * " << std::setprecision(20)
-                << sem::kDegToRad << ";";
+        line(b) << "return " << params[0] << " * "
+                << utils::SetPrecision(20) << sem::kDegToRad << ";";
         return true;
       });
 }
@@ -1489,7 +1489,8 @@ bool GeneratorImpl::EmitContinue(const ast::ContinueStatement*) {
   return true;
 }
 
-bool GeneratorImpl::EmitZeroValue(std::ostream& out, const sem::Type* type) {
+bool GeneratorImpl::EmitZeroValue(utils::StringStream& out,
+                                  const sem::Type* type) {
   return Switch(
       type,
       [&](const sem::Bool*) {
@@ -1536,7 +1537,7 @@ bool GeneratorImpl::EmitZeroValue(std::ostream& out, const sem::Type* type) {
       });
 }
 
-bool GeneratorImpl::EmitLiteral(std::ostream& out,
+bool GeneratorImpl::EmitLiteral(utils::StringStream& out,
                                 const ast::LiteralExpression* lit) {
   return Switch(
       lit,
@@ -1579,7 +1580,7 @@ bool GeneratorImpl::EmitLiteral(std::ostream& out,
       });
 }
 
-bool GeneratorImpl::EmitExpression(std::ostream& out,
+bool GeneratorImpl::EmitExpression(utils::StringStream& out,
                                    const ast::Expression* expr) {
   return Switch(
       expr,
@@ -1615,7 +1616,8 @@ bool GeneratorImpl::EmitExpression(std::ostream& out,
       });
 }
 
-void GeneratorImpl::EmitStage(std::ostream& out, ast::PipelineStage stage) {
+void GeneratorImpl::EmitStage(utils::StringStream& out,
+                              ast::PipelineStage stage) {
   switch (stage) {
     case ast::PipelineStage::kFragment:
       out << "fragment";
@@ -1855,7 +1857,7 @@ bool GeneratorImpl::EmitEntryPointFunction(const ast::Function* func) {
     }
 
     if (!Is<ast::ReturnStatement>(func->body->Last())) {
-      ast::ReturnStatement ret(ProgramID{}, Source{});
+      ast::ReturnStatement ret(ProgramID{}, ast::NodeID(), Source{});
       if (!EmitStatement(&ret)) {
         return false;
       }
@@ -1866,7 +1868,7 @@ bool GeneratorImpl::EmitEntryPointFunction(const ast::Function* func) {
   return true;
 }
 
-bool GeneratorImpl::EmitIdentifier(std::ostream& out,
+bool GeneratorImpl::EmitIdentifier(utils::StringStream& out,
                                    const ast::IdentifierExpression* expr) {
   out << program_->Symbols().NameFor(expr->symbol);
   return true;
@@ -1908,7 +1910,7 @@ bool GeneratorImpl::EmitForLoop(const ast::ForLoopStatement* stmt) {
   }
 
   TextBuffer cond_pre;
-  std::stringstream cond_buf;
+  utils::StringStream cond_buf;
   if (auto* cond = stmt->condition) {
     TINT_SCOPED_ASSIGNMENT(current_buffer_, &cond_pre);
     if (!EmitExpression(cond_buf, cond)) {
@@ -2063,7 +2065,7 @@ bool GeneratorImpl::EmitIf(const ast::IfStatement* stmt) {
 }
 
 bool GeneratorImpl::EmitMemberAccessor(
-    std::ostream& out,
+    utils::StringStream& out,
     const ast::MemberAccessorExpression* expr) {
   auto write_lhs = [&] {
     bool paren_lhs = !expr->structure->IsAnyOf<
@@ -2237,7 +2239,7 @@ bool GeneratorImpl::EmitSwitch(const ast::SwitchStatement* stmt) {
   return true;
 }
 
-bool GeneratorImpl::EmitType(std::ostream& out,
+bool GeneratorImpl::EmitType(utils::StringStream& out,
                              const sem::Type* type,
                              const std::string& name,
                              bool* name_printed /* = nullptr */) {
@@ -2450,7 +2452,7 @@ bool GeneratorImpl::EmitType(std::ostream& out,
       });
 }
 
-bool GeneratorImpl::EmitTypeAndName(std::ostream& out,
+bool GeneratorImpl::EmitTypeAndName(utils::StringStream& out,
                                     const sem::Type* type,
                                     const std::string& name) {
   bool name_printed = false;
@@ -2463,7 +2465,8 @@ bool GeneratorImpl::EmitTypeAndName(std::ostream& out,
   return true;
 }
 
-bool GeneratorImpl::EmitStorageClass(std::ostream& out, ast::StorageClass sc) {
+bool GeneratorImpl::EmitStorageClass(utils::StringStream& out,
+                                     ast::StorageClass sc) {
   switch (sc) {
     case ast::StorageClass::kFunction:
     case ast::StorageClass::kPrivate:
@@ -2486,7 +2489,7 @@ bool GeneratorImpl::EmitStorageClass(std::ostream& out, ast::StorageClass sc) {
   return false;
 }
 
-bool GeneratorImpl::EmitPackedType(std::ostream& out,
+bool GeneratorImpl::EmitPackedType(utils::StringStream& out,
                                    const sem::Type* type,
                                    const std::string& name) {
   auto* vec = type->As<sem::Vector>();
@@ -2527,11 +2530,11 @@ bool GeneratorImpl::EmitStructType(TextBuffer* b, const sem::Struct* str) {
   bool is_host_shareable = str->IsHostShareable();
 
   // Emits a `/* 0xnnnn */` byte offset comment for a struct member.
-  auto add_byte_offset_comment = [&](std::ostream& out, uint32_t offset) {
-    std::ios_base::fmtflags saved_flag_state(out.flags());
-    out << "/* 0x" << std::hex << std::setfill('0') << std::setw(4) << offset
-        << " */ ";
-    out.flags(saved_flag_state);
+  auto add_byte_offset_comment = [&](utils::StringStream& out,
+                                     uint32_t offset) {
+    char comment[24];
+    snprintf(comment, sizeof(comment), "/* 0x%04x */ ", offset);
+    out << comment;
   };
 
   auto add_padding = [&](uint32_t size, uint32_t msl_offset) {
@@ -2684,7 +2687,7 @@ bool GeneratorImpl::EmitStructType(TextBuffer* b, const sem::Struct* str) {
   return true;
 }
 
-bool GeneratorImpl::EmitUnaryOp(std::ostream& out,
+bool GeneratorImpl::EmitUnaryOp(utils::StringStream& out,
                                 const ast::UnaryOpExpression* expr) {
   // Handle `-e` when `e` is signed, so that we ensure that if `e` is the
   // largest negative value, it returns `e`.
@@ -2953,7 +2956,7 @@ GeneratorImpl::SizeAndAlign GeneratorImpl::MslPackedTypeSizeAndAlign(
 }
 
 template <typename F>
-bool GeneratorImpl::CallBuiltinHelper(std::ostream& out,
+bool GeneratorImpl::CallBuiltinHelper(utils::StringStream& out,
                                       const ast::CallExpression* call,
                                       const sem::Builtin* builtin,
                                       F&& build) {
@@ -114,7 +114,7 @@ class GeneratorImpl : public TextGenerator {
   /// @param out the output of the expression stream
   /// @param expr the expression to emit
   /// @returns true if the index accessor was emitted
-  bool EmitIndexAccessor(std::ostream& out,
+  bool EmitIndexAccessor(utils::StringStream& out,
                          const ast::IndexAccessorExpression* expr);
   /// Handles an assignment statement
   /// @param stmt the statement to emit
@@ -124,12 +124,13 @@ class GeneratorImpl : public TextGenerator {
   /// @param out the output of the expression stream
   /// @param expr the binary expression
   /// @returns true if the expression was emitted, false otherwise
-  bool EmitBinary(std::ostream& out, const ast::BinaryExpression* expr);
+  bool EmitBinary(utils::StringStream& out, const ast::BinaryExpression* expr);
   /// Handles generating a bitcast expression
   /// @param out the output of the expression stream
   /// @param expr the bitcast expression
   /// @returns true if the bitcast was emitted
-  bool EmitBitcast(std::ostream& out, const ast::BitcastExpression* expr);
+  bool EmitBitcast(utils::StringStream& out,
+                   const ast::BitcastExpression* expr);
   /// Handles a block statement
   /// @param stmt the statement to emit
   /// @returns true if the statement was emitted successfully
@@ -142,13 +143,13 @@ class GeneratorImpl : public TextGenerator {
   /// @param out the output of the expression stream
   /// @param expr the call expression
   /// @returns true if the call expression is emitted
-  bool EmitCall(std::ostream& out, const ast::CallExpression* expr);
+  bool EmitCall(utils::StringStream& out, const ast::CallExpression* expr);
   /// Handles generating a builtin call expression
   /// @param out the output of the expression stream
   /// @param call the call expression
   /// @param builtin the builtin being called
   /// @returns true if the call expression is emitted
-  bool EmitBuiltinCall(std::ostream& out,
+  bool EmitBuiltinCall(utils::StringStream& out,
                        const sem::Call* call,
                        const sem::Builtin* builtin);
   /// Handles generating a type conversion expression
@@ -156,7 +157,7 @@ class GeneratorImpl : public TextGenerator {
   /// @param call the call expression
   /// @param conv the type conversion
   /// @returns true if the expression is emitted
-  bool EmitTypeConversion(std::ostream& out,
+  bool EmitTypeConversion(utils::StringStream& out,
                           const sem::Call* call,
                           const sem::TypeConversion* conv);
   /// Handles generating a type constructor
@@ -164,7 +165,7 @@ class GeneratorImpl : public TextGenerator {
   /// @param call the call expression
   /// @param ctor the type constructor
   /// @returns true if the constructor is emitted
-  bool EmitTypeConstructor(std::ostream& out,
+  bool EmitTypeConstructor(utils::StringStream& out,
                            const sem::Call* call,
                            const sem::TypeConstructor* ctor);
   /// Handles generating a function call
@@ -172,7 +173,7 @@ class GeneratorImpl : public TextGenerator {
   /// @param call the call expression
   /// @param func the target function
   /// @returns true if the call is emitted
-  bool EmitFunctionCall(std::ostream& out,
+  bool EmitFunctionCall(utils::StringStream& out,
                         const sem::Call* call,
                         const sem::Function* func);
   /// Handles generating a call to an atomic function (`atomicAdd`,
@@ -181,7 +182,7 @@ class GeneratorImpl : public TextGenerator {
   /// @param expr the call expression
   /// @param builtin the semantic information for the atomic builtin
   /// @returns true if the call expression is emitted
-  bool EmitAtomicCall(std::ostream& out,
+  bool EmitAtomicCall(utils::StringStream& out,
                       const ast::CallExpression* expr,
                       const sem::Builtin* builtin);
   /// Handles generating a call to a texture function (`textureSample`,
@@ -190,7 +191,7 @@ class GeneratorImpl : public TextGenerator {
   /// @param call the call expression
   /// @param builtin the semantic information for the texture builtin
   /// @returns true if the call expression is emitted
-  bool EmitTextureCall(std::ostream& out,
+  bool EmitTextureCall(utils::StringStream& out,
                        const sem::Call* call,
                        const sem::Builtin* builtin);
   /// Handles generating a call to the `dot()` builtin
@@ -198,7 +199,7 @@ class GeneratorImpl : public TextGenerator {
   /// @param expr the call expression
   /// @param builtin the semantic information for the builtin
   /// @returns true if the call expression is emitted
-  bool EmitDotCall(std::ostream& out,
+  bool EmitDotCall(utils::StringStream& out,
                    const ast::CallExpression* expr,
                    const sem::Builtin* builtin);
   /// Handles generating a call to the `modf()` builtin
@@ -206,7 +207,7 @@ class GeneratorImpl : public TextGenerator {
   /// @param expr the call expression
   /// @param builtin the semantic information for the builtin
   /// @returns true if the call expression is emitted
-  bool EmitModfCall(std::ostream& out,
+  bool EmitModfCall(utils::StringStream& out,
                     const ast::CallExpression* expr,
                     const sem::Builtin* builtin);
   /// Handles generating a call to the `frexp()` builtin
@@ -214,7 +215,7 @@ class GeneratorImpl : public TextGenerator {
   /// @param expr the call expression
   /// @param builtin the semantic information for the builtin
   /// @returns true if the call expression is emitted
-  bool EmitFrexpCall(std::ostream& out,
+  bool EmitFrexpCall(utils::StringStream& out,
                      const ast::CallExpression* expr,
                      const sem::Builtin* builtin);
   /// Handles generating a call to the `degrees()` builtin
@@ -222,7 +223,7 @@ class GeneratorImpl : public TextGenerator {
   /// @param expr the call expression
   /// @param builtin the semantic information for the builtin
   /// @returns true if the call expression is emitted
-  bool EmitDegreesCall(std::ostream& out,
+  bool EmitDegreesCall(utils::StringStream& out,
                        const ast::CallExpression* expr,
                        const sem::Builtin* builtin);
   /// Handles generating a call to the `radians()` builtin
@@ -230,7 +231,7 @@ class GeneratorImpl : public TextGenerator {
   /// @param expr the call expression
   /// @param builtin the semantic information for the builtin
   /// @returns true if the call expression is emitted
-  bool EmitRadiansCall(std::ostream& out,
+  bool EmitRadiansCall(utils::StringStream& out,
                        const ast::CallExpression* expr,
                        const sem::Builtin* builtin);
   /// Handles a case statement
@@ -253,7 +254,7 @@ class GeneratorImpl : public TextGenerator {
   /// @param out the output of the expression stream
   /// @param expr the expression
   /// @returns true if the expression was emitted
-  bool EmitExpression(std::ostream& out, const ast::Expression* expr);
+  bool EmitExpression(utils::StringStream& out, const ast::Expression* expr);
   /// Handles generating a function
   /// @param func the function to generate
   /// @returns true if the function was emitted
@@ -262,7 +263,8 @@ class GeneratorImpl : public TextGenerator {
   /// @param out the output of the expression stream
   /// @param expr the identifier expression
   /// @returns true if the identifier was emitted
-  bool EmitIdentifier(std::ostream& out, const ast::IdentifierExpression* expr);
+  bool EmitIdentifier(utils::StringStream& out,
+                      const ast::IdentifierExpression* expr);
   /// Handles an if statement
   /// @param stmt the statement to emit
   /// @returns true if the statement was successfully emitted
@@ -271,7 +273,7 @@ class GeneratorImpl : public TextGenerator {
   /// @param out the output of the expression stream
   /// @param lit the literal to emit
   /// @returns true if the literal was successfully emitted
-  bool EmitLiteral(std::ostream& out, const ast::LiteralExpression* lit);
+  bool EmitLiteral(utils::StringStream& out, const ast::LiteralExpression* lit);
   /// Handles a loop statement
   /// @param stmt the statement to emit
   /// @returns true if the statement was emitted
@@ -284,7 +286,7 @@ class GeneratorImpl : public TextGenerator {
   /// @param out the output of the expression stream
   /// @param expr the member accessor expression
   /// @returns true if the member accessor was emitted
-  bool EmitMemberAccessor(std::ostream& out,
+  bool EmitMemberAccessor(utils::StringStream& out,
                           const ast::MemberAccessorExpression* expr);
   /// Handles return statements
   /// @param stmt the statement to emit
@@ -293,7 +295,7 @@ class GeneratorImpl : public TextGenerator {
   /// Handles emitting a pipeline stage name
   /// @param out the output of the expression stream
   /// @param stage the stage to emit
-  void EmitStage(std::ostream& out, ast::PipelineStage stage);
+  void EmitStage(utils::StringStream& out, ast::PipelineStage stage);
   /// Handles statement
   /// @param stmt the statement to emit
   /// @returns true if the statement was emitted
@@ -316,7 +318,7 @@ class GeneratorImpl : public TextGenerator {
   /// @param name the name of the variable, only used for array emission
   /// @param name_printed (optional) if not nullptr and an array was printed
   /// @returns true if the type is emitted
-  bool EmitType(std::ostream& out,
+  bool EmitType(utils::StringStream& out,
                 const sem::Type* type,
                 const std::string& name,
                 bool* name_printed = nullptr);
@@ -325,14 +327,14 @@ class GeneratorImpl : public TextGenerator {
   /// @param type the type to generate
   /// @param name the name to emit
   /// @returns true if the type is emitted
-  bool EmitTypeAndName(std::ostream& out,
+  bool EmitTypeAndName(utils::StringStream& out,
                        const sem::Type* type,
                        const std::string& name);
   /// Handles generating a storage class
   /// @param out the output of the type stream
   /// @param sc the storage class to generate
   /// @returns true if the storage class is emitted
-  bool EmitStorageClass(std::ostream& out, ast::StorageClass sc);
+  bool EmitStorageClass(utils::StringStream& out, ast::StorageClass sc);
   /// Handles generating an MSL-packed storage type.
   /// If the type does not have a packed form, the standard non-packed form is
   /// emitted.
@@ -340,7 +342,7 @@ class GeneratorImpl : public TextGenerator {
   /// @param type the type to generate
   /// @param name the name of the variable, only used for array emission
   /// @returns true if the type is emitted
-  bool EmitPackedType(std::ostream& out,
+  bool EmitPackedType(utils::StringStream& out,
                       const sem::Type* type,
                       const std::string& name);
   /// Handles generating a struct declaration
@@ -352,7 +354,8 @@ class GeneratorImpl : public TextGenerator {
   /// @param out the output of the expression stream
   /// @param expr the expression to emit
   /// @returns true if the expression was emitted
-  bool EmitUnaryOp(std::ostream& out, const ast::UnaryOpExpression* expr);
+  bool EmitUnaryOp(utils::StringStream& out,
+                   const ast::UnaryOpExpression* expr);
   /// Handles generating a variable
   /// @param var the variable to generate
   /// @returns true if the variable was emitted
@@ -365,7 +368,7 @@ class GeneratorImpl : public TextGenerator {
   /// @param out the output of the expression stream
   /// @param type the type to emit the value for
   /// @returns true if the zero value was successfully emitted.
-  bool EmitZeroValue(std::ostream& out, const sem::Type* type);
+  bool EmitZeroValue(utils::StringStream& out, const sem::Type* type);
 
   /// Handles generating a builtin name
   /// @param builtin the semantic info for the builtin
@@ -406,7 +409,7 @@ class GeneratorImpl : public TextGenerator {
   ///          `params` is the name of all the generated function parameters
   /// @returns true if the call expression is emitted
   template <typename F>
-  bool CallBuiltinHelper(std::ostream& out,
+  bool CallBuiltinHelper(utils::StringStream& out,
                          const ast::CallExpression* call,
                          const sem::Builtin* builtin,
                          F&& build);
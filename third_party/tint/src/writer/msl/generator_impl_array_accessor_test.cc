@@ -28,7 +28,7 @@ TEST_F(MslGeneratorImplTest, IndexAccessor) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitExpression(out, expr)) << gen.error();
   EXPECT_EQ(out.str(), "ary[5]");
 }
@@ -42,7 +42,7 @@ TEST_F(MslGeneratorImplTest, IndexAccessor_OfDref) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitExpression(out, expr)) << gen.error();
   EXPECT_EQ(out.str(), "(*(p))[5]");
 }
@@ -47,7 +47,7 @@ TEST_P(MslBinaryTest, Emit) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitExpression(out, expr)) << gen.error();
   EXPECT_EQ(out.str(), params.result);
 }
@@ -93,7 +93,7 @@ TEST_P(MslBinaryTest_SignedOverflowDefinedBehaviour, Emit) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitExpression(out, expr)) << gen.error();
   EXPECT_EQ(out.str(), params.result);
 }
@@ -129,7 +129,7 @@ TEST_P(MslBinaryTest_SignedOverflowDefinedBehaviour_Chained, Emit) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitExpression(out, expr2)) << gen.error();
   EXPECT_EQ(out.str(), params.result);
 }
@@ -162,7 +162,7 @@ TEST_F(MslBinaryTest, ModF32) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitExpression(out, expr)) << gen.error();
   EXPECT_EQ(out.str(), "fmod(left, right)");
 }
@@ -176,7 +176,7 @@ TEST_F(MslBinaryTest, ModVec3F32) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitExpression(out, expr)) << gen.error();
   EXPECT_EQ(out.str(), "fmod(left, right)");
 }
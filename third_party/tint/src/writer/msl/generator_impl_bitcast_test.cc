@@ -27,7 +27,7 @@ TEST_F(MslGeneratorImplTest, EmitExpression_Bitcast) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitExpression(out, bitcast)) << gen.error();
   EXPECT_EQ(out.str(), "as_type<float>(1)");
 }
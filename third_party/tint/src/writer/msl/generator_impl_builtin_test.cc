@@ -287,7 +287,7 @@ TEST_F(MslGeneratorImplTest, Builtin_Call) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitExpression(out, call)) << gen.error();
   EXPECT_EQ(out.str(), "dot(param1, param2)");
 }
@@ -298,7 +298,7 @@ TEST_F(MslGeneratorImplTest, StorageBarrier) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitExpression(out, call)) << gen.error();
   EXPECT_EQ(out.str(), "threadgroup_barrier(mem_flags::mem_device)");
 }
@@ -309,7 +309,7 @@ TEST_F(MslGeneratorImplTest, WorkgroupBarrier) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitExpression(out, call)) << gen.error();
   EXPECT_EQ(out.str(), "threadgroup_barrier(mem_flags::mem_threadgroup)");
 }
@@ -421,7 +421,7 @@ TEST_F(MslGeneratorImplTest, Pack2x16Float) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitExpression(out, call)) << gen.error();
   EXPECT_EQ(out.str(), "as_type<uint>(half2(p1))");
 }
@@ -433,7 +433,7 @@ TEST_F(MslGeneratorImplTest, Unpack2x16Float) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitExpression(out, call)) << gen.error();
   EXPECT_EQ(out.str(), "float2(as_type<half2>(p1))");
 }
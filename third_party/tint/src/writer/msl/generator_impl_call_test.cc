@@ -30,7 +30,7 @@ TEST_F(MslGeneratorImplTest, EmitExpression_Call_WithoutParams) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitExpression(out, call)) << gen.error();
   EXPECT_EQ(out.str(), "my_func()");
 }
@@ -50,7 +50,7 @@ TEST_F(MslGeneratorImplTest, EmitExpression_Call_WithParams) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitExpression(out, call)) << gen.error();
   EXPECT_EQ(out.str(), "my_func(param1, param2)");
 }
@@ -81,7 +81,7 @@ TEST_F(MslGeneratorImplTest, MslImportData_SingleParamTest_IntScalar) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitCall(out, expr)) << gen.error();
   EXPECT_EQ(out.str(), R"(abs(1))");
 }
@@ -92,7 +92,7 @@ TEST_F(MslGeneratorImplTest, MslImportData_SingleParamTest_ScalarLength) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitCall(out, expr)) << gen.error();
   EXPECT_EQ(out.str(), R"(fabs(2.0f))");
 }
@@ -106,7 +106,7 @@ TEST_P(MslImportData_DualParam_ScalarTest, Float) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitCall(out, expr)) << gen.error();
   EXPECT_EQ(out.str(), std::string(param.msl_name) + "(1.0f, 2.0f)");
 }
@@ -124,7 +124,7 @@ TEST_F(MslGeneratorImplTest, MslImportData_DualParam_ScalarDistance) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitCall(out, expr)) << gen.error();
   EXPECT_EQ(out.str(), R"(fabs(2.0f - 3.0f))");
 }
@@ -139,7 +139,7 @@ TEST_P(MslImportData_DualParam_VectorTest, Float) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitCall(out, expr)) << gen.error();
   EXPECT_EQ(out.str(),
             std::string(param.msl_name) +
@@ -165,7 +165,7 @@ TEST_P(MslImportData_DualParam_Int_Test, IntScalar) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitCall(out, expr)) << gen.error();
   EXPECT_EQ(out.str(), std::string(param.msl_name) + "(1, 2)");
 }
@@ -183,7 +183,7 @@ TEST_P(MslImportData_TripleParam_ScalarTest, Float) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitCall(out, expr)) << gen.error();
   EXPECT_EQ(out.str(), std::string(param.msl_name) + "(1.0f, 2.0f, 3.0f)");
 }
@@ -205,7 +205,7 @@ TEST_P(MslImportData_TripleParam_VectorTest, Float) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitCall(out, expr)) << gen.error();
   EXPECT_EQ(
       out.str(),
@@ -229,7 +229,7 @@ TEST_P(MslImportData_TripleParam_Int_Test, IntScalar) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitCall(out, expr)) << gen.error();
   EXPECT_EQ(out.str(), std::string(param.msl_name) + "(1, 2, 3)");
 }
@@ -247,7 +247,7 @@ TEST_F(MslGeneratorImplTest, MslImportData_Determinant) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitCall(out, expr)) << gen.error();
   EXPECT_EQ(out.str(), std::string("determinant(var)"));
 }
@@ -68,7 +68,7 @@ TEST_F(MslGeneratorImplTest, EmitType_Array) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitType(out, program->TypeOf(arr), "ary")) << gen.error();
   EXPECT_EQ(out.str(), "bool ary[4]");
 }
@@ -80,7 +80,7 @@ TEST_F(MslGeneratorImplTest, EmitType_ArrayOfArray) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitType(out, program->TypeOf(b), "ary")) << gen.error();
   EXPECT_EQ(out.str(), "bool ary[5][4]");
 }
@@ -93,7 +93,7 @@ TEST_F(MslGeneratorImplTest, EmitType_ArrayOfArrayOfArray) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitType(out, program->TypeOf(c), "ary")) << gen.error();
   EXPECT_EQ(out.str(), "bool ary[6][5][4]");
 }
@@ -104,7 +104,7 @@ TEST_F(MslGeneratorImplTest, EmitType_Array_WithoutName) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitType(out, program->TypeOf(arr), "")) << gen.error();
   EXPECT_EQ(out.str(), "bool[4]");
 }
@@ -115,7 +115,7 @@ TEST_F(MslGeneratorImplTest, EmitType_RuntimeArray) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitType(out, program->TypeOf(arr), "ary")) << gen.error();
   EXPECT_EQ(out.str(), "bool ary[1]");
 }
@@ -150,7 +150,7 @@ TEST_F(MslGeneratorImplTest, EmitType_Bool) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitType(out, bool_, "")) << gen.error();
   EXPECT_EQ(out.str(), "bool");
 }
@@ -160,7 +160,7 @@ TEST_F(MslGeneratorImplTest, EmitType_F32) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitType(out, f32, "")) << gen.error();
   EXPECT_EQ(out.str(), "float");
 }
@@ -170,7 +170,7 @@ TEST_F(MslGeneratorImplTest, EmitType_I32) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitType(out, i32, "")) << gen.error();
   EXPECT_EQ(out.str(), "int");
 }
@@ -182,7 +182,7 @@ TEST_F(MslGeneratorImplTest, EmitType_Matrix) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitType(out, mat2x3, "")) << gen.error();
   EXPECT_EQ(out.str(), "float2x3");
 }
@@ -194,7 +194,7 @@ TEST_F(MslGeneratorImplTest, EmitType_Pointer) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitType(out, p, "")) << gen.error();
   EXPECT_EQ(out.str(), "threadgroup float* ");
 }
@@ -207,7 +207,7 @@ TEST_F(MslGeneratorImplTest, EmitType_Struct) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitType(out, program->TypeOf(s), "")) << gen.error();
   EXPECT_EQ(out.str(), "S");
 }
@@ -687,7 +687,7 @@ TEST_F(MslGeneratorImplTest, DISABLED_EmitType_Struct_WithAttribute) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitType(out, program->TypeOf(s), "")) << gen.error();
   EXPECT_EQ(out.str(), R"(struct {
   /* 0x0000 */ int a;
@@ -700,7 +700,7 @@ TEST_F(MslGeneratorImplTest, EmitType_U32) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitType(out, u32, "")) << gen.error();
   EXPECT_EQ(out.str(), "uint");
 }
@@ -711,7 +711,7 @@ TEST_F(MslGeneratorImplTest, EmitType_Vector) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitType(out, vec3, "")) << gen.error();
   EXPECT_EQ(out.str(), "float3");
 }
@@ -721,7 +721,7 @@ TEST_F(MslGeneratorImplTest, EmitType_Void) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitType(out, void_, "")) << gen.error();
   EXPECT_EQ(out.str(), "void");
 }
@@ -731,7 +731,7 @@ TEST_F(MslGeneratorImplTest, EmitType_Sampler) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitType(out, sampler, "")) << gen.error();
   EXPECT_EQ(out.str(), "sampler");
 }
@@ -741,7 +741,7 @@ TEST_F(MslGeneratorImplTest, EmitType_SamplerComparison) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitType(out, sampler, "")) << gen.error();
   EXPECT_EQ(out.str(), "sampler");
 }
@@ -762,7 +762,7 @@ TEST_P(MslDepthTexturesTest, Emit) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitType(out, &s, "")) << gen.error();
   EXPECT_EQ(out.str(), params.result);
 }
@@ -785,7 +785,7 @@ TEST_F(MslDepthMultisampledTexturesTest, Emit) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitType(out, &s, "")) << gen.error();
   EXPECT_EQ(out.str(), "depth2d_ms<float, access::read>");
 }
@@ -807,7 +807,7 @@ TEST_P(MslSampledtexturesTest, Emit) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitType(out, s, "")) << gen.error();
   EXPECT_EQ(out.str(), params.result);
 }
@@ -834,7 +834,7 @@ TEST_F(MslGeneratorImplTest, Emit_TypeMultisampledTexture) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitType(out, ms, "")) << gen.error();
   EXPECT_EQ(out.str(), "texture2d_ms<uint, access::read>");
 }
@@ -860,7 +860,7 @@ TEST_P(MslStorageTexturesTest, Emit) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitType(out, program->TypeOf(s), "")) << gen.error();
   EXPECT_EQ(out.str(), params.result);
 }
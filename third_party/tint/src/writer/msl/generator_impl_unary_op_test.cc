@@ -29,7 +29,7 @@ TEST_F(MslUnaryOpTest, AddressOf) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitExpression(out, op)) << gen.error();
   EXPECT_EQ(out.str(), "&(expr)");
 }
@@ -42,7 +42,7 @@ TEST_F(MslUnaryOpTest, Complement) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitExpression(out, op)) << gen.error();
   EXPECT_EQ(out.str(), "~(expr)");
 }
@@ -58,7 +58,7 @@ TEST_F(MslUnaryOpTest, Indirection) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitExpression(out, op)) << gen.error();
   EXPECT_EQ(out.str(), "*(expr)");
 }
@@ -70,7 +70,7 @@ TEST_F(MslUnaryOpTest, Not) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitExpression(out, op)) << gen.error();
   EXPECT_EQ(out.str(), "!(expr)");
 }
@@ -83,7 +83,7 @@ TEST_F(MslUnaryOpTest, Negation) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitExpression(out, op)) << gen.error();
   EXPECT_EQ(out.str(), "tint_unary_minus(expr)");
 }
@@ -95,7 +95,7 @@ TEST_F(MslUnaryOpTest, NegationOfIntMin) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitExpression(out, op)) << gen.error();
   EXPECT_EQ(out.str(), "tint_unary_minus((-2147483647 - 1))");
 }
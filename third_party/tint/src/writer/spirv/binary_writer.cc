@@ -14,8 +14,6 @@
 
 #include "src/writer/spirv/binary_writer.h"
 
-#include <cstring>
-
 namespace tint {
 namespace writer {
 namespace spirv {
@@ -32,11 +30,15 @@ BinaryWriter::~BinaryWriter() = default;
 void BinaryWriter::WriteBuilder(Builder* builder) {
   out_.reserve(builder->total_size());
   builder->iterate(
-      [this](const Instruction& inst) { this->process_instruction(inst); });
+      [this](const std::vector<uint32_t>& words) { this->append(words); });
 }
 
 void BinaryWriter::WriteInstruction(const Instruction& inst) {
-  process_instruction(inst);
+  append(inst.words());
+}
+
+void BinaryWriter::WriteInstructions(const InstructionList& insts) {
+  append(insts.words());
 }
 
 void BinaryWriter::WriteHeader(uint32_t bound) {
@@ -47,29 +49,8 @@ void BinaryWriter::WriteHeader(uint32_t bound) {
   out_.push_back(0);
 }
 
-void BinaryWriter::process_instruction(const Instruction& inst) {
-  out_.push_back(inst.word_length() << 16 |
-                 static_cast<uint32_t>(inst.opcode()));
-  for (const auto& op : inst.operands()) {
-    process_op(op);
-  }
-}
-
-void BinaryWriter::process_op(const Operand& op) {
-  if (op.IsFloat()) {
-    // Allocate space for the float
-    out_.push_back(0);
-    auto f = op.to_f();
-    uint8_t* ptr = reinterpret_cast<uint8_t*>(out_.data() + (out_.size() - 1));
-    memcpy(ptr, &f, 4);
-  } else if (op.IsInt()) {
-    out_.push_back(op.to_i());
-  } else {
-    auto idx = out_.size();
-    const auto& str = op.to_s();
-    out_.resize(out_.size() + op.length(), 0);
-    memcpy(out_.data() + idx, str.c_str(), str.size() + 1);
-  }
+void BinaryWriter::append(const std::vector<uint32_t>& words) {
+  out_.insert(out_.end(), words.begin(), words.end());
 }
 
 }  // namespace spirv
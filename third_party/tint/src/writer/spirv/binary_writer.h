@@ -44,12 +44,15 @@ class BinaryWriter {
   /// @param inst the instruction to assemble
   void WriteInstruction(const Instruction& inst);
 
+  /// Writes the given instructions into the binary.
+  /// @param insts the instructions to assemble
+  void WriteInstructions(const InstructionList& insts);
+
   /// @returns the assembled SPIR-V
   const std::vector<uint32_t>& result() const { return out_; }
 
  private:
-  void process_instruction(const Instruction& inst);
-  void process_op(const Operand& op);
+  void append(const std::vector<uint32_t>& words);
 
   std::vector<uint32_t> out_;
 };
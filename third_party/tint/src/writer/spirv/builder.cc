@@ -67,14 +67,6 @@ using BuiltinType = sem::BuiltinType;
 
 const char kGLSLstd450[] = "GLSL.std.450";
 
-uint32_t size_of(const InstructionList& instructions) {
-  uint32_t size = 0;
-  for (const auto& inst : instructions)
-    size += inst.word_length();
-
-  return size;
-}
-
 uint32_t pipeline_stage_to_execution_model(ast::PipelineStage stage) {
   SpvExecutionModel model = SpvExecutionModelVertex;
 
@@ -326,15 +318,15 @@ uint32_t Builder::total_size() const {
   // The 5 covers the magic, version, generator, id bound and reserved.
   uint32_t size = 5;
 
-  size += size_of(capabilities_);
-  size += size_of(extensions_);
-  size += size_of(ext_imports_);
-  size += size_of(memory_model_);
-  size += size_of(entry_points_);
-  size += size_of(execution_modes_);
-  size += size_of(debug_);
-  size += size_of(annotations_);
-  size += size_of(types_);
+  size += capabilities_.word_length();
+  size += extensions_.word_length();
+  size += ext_imports_.word_length();
+  size += memory_model_.word_length();
+  size += entry_points_.word_length();
+  size += execution_modes_.word_length();
+  size += debug_.word_length();
+  size += annotations_.word_length();
+  size += types_.word_length();
   for (const auto& func : functions_) {
     size += func.word_length();
   }
@@ -342,34 +334,17 @@ uint32_t Builder::total_size() const {
   return size;
 }
 
-void Builder::iterate(std::function<void(const Instruction&)> cb) const {
-  for (const auto& inst : capabilities_) {
-    cb(inst);
-  }
-  for (const auto& inst : extensions_) {
-    cb(inst);
-  }
-  for (const auto& inst : ext_imports_) {
-    cb(inst);
-  }
-  for (const auto& inst : memory_model_) {
-    cb(inst);
-  }
-  for (const auto& inst : entry_points_) {
-    cb(inst);
-  }
-  for (const auto& inst : execution_modes_) {
-    cb(inst);
-  }
-  for (const auto& inst : debug_) {
-    cb(inst);
-  }
-  for (const auto& inst : annotations_) {
-    cb(inst);
-  }
-  for (const auto& inst : types_) {
-    cb(inst);
-  }
+void Builder::iterate(
+    std::function<void(const std::vector<uint32_t>&)> cb) const {
+  cb(capabilities_.words());
+  cb(extensions_.words());
+  cb(ext_imports_.words());
+  cb(memory_model_.words());
+  cb(entry_points_.words());
+  cb(execution_modes_.words());
+  cb(debug_.words());
+  cb(annotations_.words());
+  cb(types_.words());
   for (const auto& func : functions_) {
     func.iterate(cb);
   }
@@ -378,8 +353,7 @@ void Builder::iterate(std::function<void(const Instruction&)> cb) const {
 void Builder::push_capability(uint32_t cap) {
   if (capability_set_.count(cap) == 0) {
     capability_set_.insert(cap);
-    capabilities_.push_back(
-        Instruction{spv::Op::OpCapability, {Operand::Int(cap)}});
+    capabilities_.push_back(spv::Op::OpCapability, {Operand::Int(cap)});
   }
 }
 
@@ -635,8 +609,8 @@ bool Builder::GenerateFunction(const ast::Function* func_ast) {
     push_debug(spv::Op::OpName, {Operand::Int(param_id),
                                  Operand::String(builder_.Symbols().NameFor(
                                      param->Declaration()->symbol))});
-    params.push_back(Instruction{spv::Op::OpFunctionParameter,
-                                 {Operand::Int(param_type_id), param_op}});
+    params.push_back(spv::Op::OpFunctionParameter,
+                     {Operand::Int(param_type_id), param_op});
 
     scope_stack_.Set(param->Declaration()->symbol, param_id);
   }
@@ -779,16 +753,18 @@ bool Builder::GenerateGlobalVariable(const ast::Variable* var) {
 
       // SPIR-V requires specialization constants to have initializers.
       if (type->Is<sem::F32>()) {
-        ast::FloatLiteralExpression l(ProgramID(), Source{}, 0.0f);
+        ast::FloatLiteralExpression l(ProgramID(), ast::NodeID(), Source{},
+                                      0.0f);
         init_id = GenerateLiteralIfNeeded(var, &l);
       } else if (type->Is<sem::U32>()) {
-        ast::UintLiteralExpression l(ProgramID(), Source{}, 0);
+        ast::UintLiteralExpression l(ProgramID(), ast::NodeID(), Source{}, 0);
         init_id = GenerateLiteralIfNeeded(var, &l);
       } else if (type->Is<sem::I32>()) {
-        ast::SintLiteralExpression l(ProgramID(), Source{}, 0);
+        ast::SintLiteralExpression l(ProgramID(), ast::NodeID(), Source{}, 0);
         init_id = GenerateLiteralIfNeeded(var, &l);
       } else if (type->Is<sem::Bool>()) {
-        ast::BoolLiteralExpression l(ProgramID(), Source{}, false);
+        ast::BoolLiteralExpression l(ProgramID(), ast::NodeID(), Source{},
+                                     false);
         init_id = GenerateLiteralIfNeeded(var, &l);
       } else {
         error_ = "invalid type for pipeline constant ID, must be scalar";
@@ -1368,8 +1344,8 @@ uint32_t Builder::GenerateTypeConstructorOrConversion(
     return GenerateConstantNullIfNeeded(result_type->UnwrapRef());
   }
 
-  std::ostringstream out;
-  out << "__const_" << result_type->FriendlyName(builder_.Symbols()) << "_";
+  TypeConstructorKey key;
+  key.type = result_type;
 
   result_type = result_type->UnwrapRef();
   bool constructor_is_const = IsConstructorConst(call->Declaration());
@@ -1421,7 +1397,7 @@ uint32_t Builder::GenerateTypeConstructorOrConversion(
     // value type is a correctly sized vector so we can just use it directly.
     if (result_type == value_type || result_type->Is<sem::Matrix>() ||
         result_type->Is<sem::Array>() || result_type->Is<sem::Struct>()) {
-      out << "_" << id;
+      key.ids.push_back(id);
 
       ops.push_back(Operand::Int(id));
       continue;
@@ -1432,7 +1408,7 @@ uint32_t Builder::GenerateTypeConstructorOrConversion(
     if (value_type->is_scalar() && result_type->is_scalar()) {
       id = GenerateCastOrCopyOrPassthrough(result_type, args[0]->Declaration(),
                                            global_var);
-      out << "_" << id;
+      key.ids.push_back(id);
       ops.push_back(Operand::Int(id));
       continue;
     }
@@ -1483,7 +1459,7 @@ uint32_t Builder::GenerateTypeConstructorOrConversion(
           result_is_spec_composite = true;
         }
 
-        out << "_" << extract_id;
+        key.ids.push_back(extract_id);
         ops.push_back(Operand::Int(extract_id));
       }
     } else {
@@ -1502,8 +1478,7 @@ uint32_t Builder::GenerateTypeConstructorOrConversion(
     }
   }
 
-  auto str = out.str();
-  auto val = type_constructor_to_id_.find(str);
+  auto val = type_constructor_to_id_.find(key);
   if (val != type_constructor_to_id_.end()) {
     return val->second;
   }
@@ -1512,7 +1487,7 @@ uint32_t Builder::GenerateTypeConstructorOrConversion(
   ops.insert(ops.begin(), result);
   ops.insert(ops.begin(), Operand::Int(type_id));
 
-  type_constructor_to_id_[str] = result.to_i();
+  type_constructor_to_id_.emplace(std::move(key), result.to_i());
 
   if (result_is_spec_composite) {
     push_type(spv::Op::OpSpecConstantComposite, ops);
@@ -1619,18 +1594,20 @@ uint32_t Builder::GenerateCastOrCopyOrPassthrough(
     uint32_t one_id;
     uint32_t zero_id;
     if (to_elem_type->Is<sem::F32>()) {
-      ast::FloatLiteralExpression one(ProgramID(), Source{}, 1.0f);
-      ast::FloatLiteralExpression zero(ProgramID(), Source{}, 0.0f);
+      ast::FloatLiteralExpression one(ProgramID(), ast::NodeID(), Source{},
+                                      1.0f);
+      ast::FloatLiteralExpression zero(ProgramID(), ast::NodeID(), Source{},
+                                       0.0f);
       one_id = GenerateLiteralIfNeeded(nullptr, &one);
       zero_id = GenerateLiteralIfNeeded(nullptr, &zero);
     } else if (to_elem_type->Is<sem::U32>()) {
-      ast::UintLiteralExpression one(ProgramID(), Source{}, 1);
-      ast::UintLiteralExpression zero(ProgramID(), Source{}, 0);
+      ast::UintLiteralExpression one(ProgramID(), ast::NodeID(), Source{}, 1);
+      ast::UintLiteralExpression zero(ProgramID(), ast::NodeID(), Source{}, 0);
       one_id = GenerateLiteralIfNeeded(nullptr, &one);
       zero_id = GenerateLiteralIfNeeded(nullptr, &zero);
     } else if (to_elem_type->Is<sem::I32>()) {
-      ast::SintLiteralExpression one(ProgramID(), Source{}, 1);
-      ast::SintLiteralExpression zero(ProgramID(), Source{}, 0);
+      ast::SintLiteralExpression one(ProgramID(), ast::NodeID(), Source{}, 1);
+      ast::SintLiteralExpression zero(ProgramID(), ast::NodeID(), Source{}, 0);
       one_id = GenerateLiteralIfNeeded(nullptr, &one);
       zero_id = GenerateLiteralIfNeeded(nullptr, &zero);
     } else {
@@ -1793,9 +1770,7 @@ uint32_t Builder::GenerateConstantNullIfNeeded(const sem::Type* type) {
     return 0;
   }
 
-  auto name = type->type_name();
-
-  auto it = const_null_to_id_.find(name);
+  auto it = const_null_to_id_.find(type);
   if (it != const_null_to_id_.end()) {
     return it->second;
   }
@@ -1805,7 +1780,7 @@ uint32_t Builder::GenerateConstantNullIfNeeded(const sem::Type* type) {
 
   push_type(spv::Op::OpConstantNull, {Operand::Int(type_id), result});
 
-  const_null_to_id_[name] = result_id;
+  const_null_to_id_[type] = result_id;
   return result_id;
 }
 
@@ -2929,7 +2904,8 @@ bool Builder::GenerateTextureBuiltin(const sem::Call* call,
         op = spv::Op::OpImageQuerySizeLod;
         spirv_params.emplace_back(gen(level));
       } else {
-        ast::SintLiteralExpression i32_0(ProgramID(), Source{}, 0);
+        ast::SintLiteralExpression i32_0(ProgramID(), ast::NodeID(), Source{},
+                                         0);
         op = spv::Op::OpImageQuerySizeLod;
         spirv_params.emplace_back(
             Operand::Int(GenerateLiteralIfNeeded(nullptr, &i32_0)));
@@ -2961,7 +2937,8 @@ bool Builder::GenerateTextureBuiltin(const sem::Call* call,
           texture_type->Is<sem::StorageTexture>()) {
         op = spv::Op::OpImageQuerySize;
       } else {
-        ast::SintLiteralExpression i32_0(ProgramID(), Source{}, 0);
+        ast::SintLiteralExpression i32_0(ProgramID(), ast::NodeID(), Source{},
+                                         0);
         op = spv::Op::OpImageQuerySizeLod;
         spirv_params.emplace_back(
             Operand::Int(GenerateLiteralIfNeeded(nullptr, &i32_0)));
@@ -3106,7 +3083,8 @@ bool Builder::GenerateTextureBuiltin(const sem::Call* call,
       }
       spirv_params.emplace_back(gen_arg(Usage::kDepthRef));
 
-      ast::FloatLiteralExpression float_0(ProgramID(), Source{}, 0.0);
+      ast::FloatLiteralExpression float_0(ProgramID(), ast::NodeID(), Source{},
+                                          0.0);
       image_operands.emplace_back(ImageOperand{
           SpvImageOperandsLodMask,
           Operand::Int(GenerateLiteralIfNeeded(nullptr, &float_0))});
@@ -3431,9 +3409,8 @@ uint32_t Builder::GenerateSampledImage(const sem::Type* texture_type,
                                        Operand texture_operand,
                                        Operand sampler_operand) {
   uint32_t sampled_image_type_id = 0;
-  auto val = texture_type_name_to_sampled_image_type_id_.find(
-      texture_type->type_name());
-  if (val != texture_type_name_to_sampled_image_type_id_.end()) {
+  auto val = texture_type_to_sampled_image_type_id_.find(texture_type);
+  if (val != texture_type_to_sampled_image_type_id_.end()) {
     // The sampled image type is already created.
     sampled_image_type_id = val->second;
   } else {
@@ -3443,7 +3420,7 @@ uint32_t Builder::GenerateSampledImage(const sem::Type* texture_type,
     auto texture_type_id = GenerateTypeIfNeeded(texture_type);
     push_type(spv::Op::OpTypeSampledImage,
               {sampled_image_type, Operand::Int(texture_type_id)});
-    texture_type_name_to_sampled_image_type_id_[texture_type->type_name()] =
+    texture_type_to_sampled_image_type_id_[texture_type] =
         sampled_image_type_id;
   }
 
@@ -3902,20 +3879,25 @@ uint32_t Builder::GenerateTypeIfNeeded(const sem::Type* type) {
   // definitions in the generated SPIR-V. Note that nested pointers and
   // references are not legal in WGSL, so only considering the top-level type is
   // fine.
-  std::string type_name;
+  // Storage textures with differing accesses, and samplers and comparison
+  // samplers, also map to a single SPIR-V type each, so they are deduplicated
+  // on the same key.
+  const sem::Type* key = type;
   if (auto* ptr = type->As<sem::Pointer>()) {
-    type_name =
-        sem::Pointer(ptr->StoreType(), ptr->StorageClass(), ast::kReadWrite)
-            .type_name();
+    key = builder_.create<sem::Pointer>(ptr->StoreType(), ptr->StorageClass(),
+                                        ast::kReadWrite);
   } else if (auto* ref = type->As<sem::Reference>()) {
-    type_name =
-        sem::Pointer(ref->StoreType(), ref->StorageClass(), ast::kReadWrite)
-            .type_name();
-  } else {
-    type_name = type->type_name();
+    key = builder_.create<sem::Pointer>(ref->StoreType(), ref->StorageClass(),
+                                        ast::kReadWrite);
+  } else if (auto* tex = type->As<sem::StorageTexture>()) {
+    key = builder_.create<sem::StorageTexture>(tex->dim(), tex->texel_format(),
+                                               ast::Access::kReadWrite,
+                                               tex->type());
+  } else if (type->Is<sem::Sampler>()) {
+    key = builder_.create<sem::Sampler>(ast::SamplerKind::kSampler);
   }
 
-  return utils::GetOrCreate(type_name_to_id_, type_name, [&]() -> uint32_t {
+  return utils::GetOrCreate(type_to_id_, key, [&]() -> uint32_t {
     auto result = result_op();
     auto id = result.to_i();
     bool ok = Switch(
@@ -3960,41 +3942,11 @@ uint32_t Builder::GenerateTypeIfNeeded(const sem::Type* type) {
           push_type(spv::Op::OpTypeVoid, {result});
           return true;
         },
-        [&](const sem::StorageTexture* tex) {
-          if (!GenerateTextureType(tex, result)) {
-            return false;
-          }
-
-          // Register all three access types of StorageTexture names. In
-          // SPIR-V, we must output a single type, while the variable is
-          // annotated with the access type. Doing this ensures we de-dupe.
-          type_name_to_id_[builder_
-                               .create<sem::StorageTexture>(
-                                   tex->dim(), tex->texel_format(),
-                                   ast::Access::kRead, tex->type())
-                               ->type_name()] = id;
-          type_name_to_id_[builder_
-                               .create<sem::StorageTexture>(
-                                   tex->dim(), tex->texel_format(),
-                                   ast::Access::kWrite, tex->type())
-                               ->type_name()] = id;
-          type_name_to_id_[builder_
-                               .create<sem::StorageTexture>(
-                                   tex->dim(), tex->texel_format(),
-                                   ast::Access::kReadWrite, tex->type())
-                               ->type_name()] = id;
-          return true;
-        },
         [&](const sem::Texture* tex) {
           return GenerateTextureType(tex, result);
         },
         [&](const sem::Sampler*) {
           push_type(spv::Op::OpTypeSampler, {result});
-
-          // Register both of the sampler type names. In SPIR-V they're the same
-          // sampler type, so we need to match that when we do the dedup check.
-          type_name_to_id_["__sampler_sampler"] = id;
-          type_name_to_id_["__sampler_comparison"] = id;
           return true;
         },
         [&](Default) {
@@ -4427,8 +4379,7 @@ bool Builder::InsideBasicBlock() const {
     // thing in the function is that entry block label.
     return true;
   }
-  const auto& inst = instructions.back();
-  switch (inst.opcode()) {
+  switch (instructions.last_opcode()) {
     case spv::Op::OpBranch:
     case spv::Op::OpBranchConditional:
     case spv::Op::OpSwitch:
@@ -37,6 +37,7 @@
 #include "src/scope_stack.h"
 #include "src/sem/builtin.h"
 #include "src/sem/storage_texture_type.h"
+#include "src/utils/hash.h"
 #include "src/writer/spirv/function.h"
 #include "src/writer/spirv/scalar_constant.h"
 
@@ -116,10 +117,10 @@ class Builder {
     return id;
   }
 
-  /// Iterates over all the instructions in the correct order and calls the
-  /// given callback
-  /// @param cb the callback to execute
-  void iterate(std::function<void(const Instruction&)> cb) const;
+  /// Iterates over all the encoded instructions in the correct order and calls
+  /// the given callback
+  /// @param cb the callback to execute with each block of encoded instructions
+  void iterate(std::function<void(const std::vector<uint32_t>&)> cb) const;
 
   /// Adds an instruction to the list of capabilities, if the capability
   /// hasn't already been added.
@@ -131,7 +132,7 @@ class Builder {
   /// @param op the op to set
   /// @param operands the operands for the instruction
   void push_extension(spv::Op op, const OperandList& operands) {
-    extensions_.push_back(Instruction{op, operands});
+    extensions_.push_back(op, operands);
   }
   /// @returns the extensions
   const InstructionList& extensions() const { return extensions_; }
@@ -139,7 +140,7 @@ class Builder {
   /// @param op the op to set
   /// @param operands the operands for the instruction
   void push_ext_import(spv::Op op, const OperandList& operands) {
-    ext_imports_.push_back(Instruction{op, operands});
+    ext_imports_.push_back(op, operands);
   }
   /// @returns the ext imports
   const InstructionList& ext_imports() const { return ext_imports_; }
@@ -147,7 +148,7 @@ class Builder {
   /// @param op the op to set
   /// @param operands the operands for the instruction
   void push_memory_model(spv::Op op, const OperandList& operands) {
-    memory_model_.push_back(Instruction{op, operands});
+    memory_model_.push_back(op, operands);
   }
   /// @returns the memory model
   const InstructionList& memory_model() const { return memory_model_; }
@@ -155,7 +156,7 @@ class Builder {
   /// @param op the op to set
   /// @param operands the operands for the instruction
   void push_entry_point(spv::Op op, const OperandList& operands) {
-    entry_points_.push_back(Instruction{op, operands});
+    entry_points_.push_back(op, operands);
   }
   /// @returns the entry points
   const InstructionList& entry_points() const { return entry_points_; }
@@ -163,7 +164,7 @@ class Builder {
   /// @param op the op to set
   /// @param operands the operands for the instruction
   void push_execution_mode(spv::Op op, const OperandList& operands) {
-    execution_modes_.push_back(Instruction{op, operands});
+    execution_modes_.push_back(op, operands);
   }
   /// @returns the execution modes
   const InstructionList& execution_modes() const { return execution_modes_; }
@@ -171,7 +172,7 @@ class Builder {
   /// @param op the op to set
   /// @param operands the operands for the instruction
   void push_debug(spv::Op op, const OperandList& operands) {
-    debug_.push_back(Instruction{op, operands});
+    debug_.push_back(op, operands);
   }
   /// @returns the debug instructions
   const InstructionList& debug() const { return debug_; }
@@ -179,7 +180,7 @@ class Builder {
   /// @param op the op to set
   /// @param operands the operands for the instruction
   void push_type(spv::Op op, const OperandList& operands) {
-    types_.push_back(Instruction{op, operands});
+    types_.push_back(op, operands);
   }
   /// @returns the type instructions
   const InstructionList& types() const { return types_; }
@@ -187,7 +188,7 @@ class Builder {
   /// @param op the op to set
   /// @param operands the operands for the instruction
   void push_annot(spv::Op op, const OperandList& operands) {
-    annotations_.push_back(Instruction{op, operands});
+    annotations_.push_back(op, operands);
   }
   /// @returns the annotations
   const InstructionList& annots() const { return annotations_; }
@@ -608,16 +609,46 @@ class Builder {
   InstructionList annotations_;
   std::vector<Function> functions_;
 
+  /// A map of sem::Type to SPIR-V id, comparing the types by structure
+  using TypeToIdMap = std::unordered_map<const sem::Type*,
+                                         uint32_t,
+                                         sem::Manager::Hasher,
+                                         sem::Manager::Equality>;
+
+  /// The key of a composite built by a type constructor: the constructed type
+  /// and the ids of the constructor arguments
+  struct TypeConstructorKey {
+    /// The constructed type
+    const sem::Type* type = nullptr;
+    /// The ids of the constructor arguments
+    std::vector<uint32_t> ids;
+
+    /// @param rhs the key to compare against
+    /// @returns true if this key is equal to `rhs`
+    bool operator==(const TypeConstructorKey& rhs) const {
+      return type->Equals(*rhs.type) && ids == rhs.ids;
+    }
+
+    /// Hasher is a std::hash function for TypeConstructorKey
+    struct Hasher {
+      /// @param key the key to hash
+      /// @returns the hash of `key`
+      std::size_t operator()(const TypeConstructorKey& key) const {
+        return utils::Hash(key.type->Hash(), key.ids);
+      }
+    };
+  };
+
   std::unordered_map<std::string, uint32_t> import_name_to_id_;
   std::unordered_map<Symbol, uint32_t> func_symbol_to_id_;
   std::unordered_map<sem::CallTargetSignature, uint32_t> func_sig_to_id_;
-  std::unordered_map<std::string, uint32_t> type_name_to_id_;
+  TypeToIdMap type_to_id_;
   std::unordered_map<ScalarConstant, uint32_t> const_to_id_;
-  std::unordered_map<std::string, uint32_t> type_constructor_to_id_;
-  std::unordered_map<std::string, uint32_t> const_null_to_id_;
+  std::unordered_map<TypeConstructorKey, uint32_t, TypeConstructorKey::Hasher>
+      type_constructor_to_id_;
+  TypeToIdMap const_null_to_id_;
   std::unordered_map<uint64_t, uint32_t> const_splat_to_id_;
-  std::unordered_map<std::string, uint32_t>
-      texture_type_name_to_sampled_image_type_id_;
+  TypeToIdMap texture_type_to_sampled_image_type_id_;
   ScopeStack<uint32_t> scope_stack_;
   std::unordered_map<uint32_t, const ast::Variable*> spirv_id_to_variable_;
   std::vector<uint32_t> merge_stack_;
@@ -80,9 +80,9 @@ TEST_P(Attribute_StageTest, Emit) {
   ASSERT_GE(preamble.size(), 1u);
   EXPECT_EQ(preamble[0].opcode(), spv::Op::OpEntryPoint);
 
-  ASSERT_GE(preamble[0].operands().size(), 3u);
-  EXPECT_EQ(preamble[0].operands()[0].to_i(),
-            static_cast<uint32_t>(params.model));
+  // The execution model is the first operand, after the opcode word.
+  ASSERT_GE(preamble[0].word_length(), 4u);
+  EXPECT_EQ(preamble[0].words()[1], static_cast<uint32_t>(params.model));
 }
 INSTANTIATE_TEST_SUITE_P(
     BuilderTest,
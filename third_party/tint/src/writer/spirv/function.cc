@@ -31,23 +31,14 @@ Function::Function(const Function& other) = default;
 
 Function::~Function() = default;
 
-void Function::iterate(std::function<void(const Instruction&)> cb) const {
-  cb(declaration_);
-
-  for (const auto& param : params_) {
-    cb(param);
-  }
-
-  cb(Instruction{spv::Op::OpLabel, {label_op_}});
-
-  for (const auto& var : vars_) {
-    cb(var);
-  }
-  for (const auto& inst : instructions_) {
-    cb(inst);
-  }
-
-  cb(Instruction{spv::Op::OpFunctionEnd, {}});
+void Function::iterate(
+    std::function<void(const std::vector<uint32_t>&)> cb) const {
+  cb(declaration_.words());
+  cb(params_.words());
+  cb(Instruction{spv::Op::OpLabel, {label_op_}}.words());
+  cb(vars_.words());
+  cb(instructions_.words());
+  cb(Instruction{spv::Op::OpFunctionEnd, {}}.words());
 }
 
 }  // namespace spirv
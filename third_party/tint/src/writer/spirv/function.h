@@ -16,6 +16,7 @@
 #define SRC_WRITER_SPIRV_FUNCTION_H_
 
 #include <functional>
+#include <vector>
 
 #include "src/writer/spirv/instruction.h"
 
@@ -42,9 +43,9 @@ class Function {
   Function(const Function& other);
   ~Function();
 
-  /// Iterates over the function call the cb on each instruction
-  /// @param cb the callback to call
-  void iterate(std::function<void(const Instruction&)> cb) const;
+  /// Iterates over the encoded instructions of the function, in order
+  /// @param cb the callback to call with each block of encoded instructions
+  void iterate(std::function<void(const std::vector<uint32_t>&)> cb) const;
 
   /// @returns the declaration
   const Instruction& declaration() const { return declaration_; }
@@ -56,7 +57,7 @@ class Function {
   /// @param op the op to set
   /// @param operands the operands for the instruction
   void push_inst(spv::Op op, const OperandList& operands) {
-    instructions_.push_back(Instruction{op, operands});
+    instructions_.push_back(op, operands);
   }
   /// @returns the instruction list
   const InstructionList& instructions() const { return instructions_; }
@@ -64,26 +65,16 @@ class Function {
   /// Adds a variable to the variable list
   /// @param operands the operands for the variable
   void push_var(const OperandList& operands) {
-    vars_.push_back(Instruction{spv::Op::OpVariable, operands});
+    vars_.push_back(spv::Op::OpVariable, operands);
   }
   /// @returns the variable list
   const InstructionList& variables() const { return vars_; }
 
   /// @returns the word length of the function
   uint32_t word_length() const {
-    // 1 for the Label and 1 for the FunctionEnd
-    uint32_t size = 2 + declaration_.word_length();
-
-    for (const auto& param : params_) {
-      size += param.word_length();
-    }
-    for (const auto& var : vars_) {
-      size += var.word_length();
-    }
-    for (const auto& inst : instructions_) {
-      size += inst.word_length();
-    }
-    return size;
+    // 2 for the Label and 1 for the FunctionEnd
+    return 3 + declaration_.word_length() + params_.word_length() +
+           vars_.word_length() + instructions_.word_length();
   }
 
  private:
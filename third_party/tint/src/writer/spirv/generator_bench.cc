@@ -15,6 +15,7 @@
 #include <string>
 
 #include "src/bench/benchmark.h"
+#include "src/writer/spirv/binary_writer.h"
 
 namespace tint::writer::spirv {
 namespace {
@@ -26,15 +27,73 @@ void GenerateSPIRV(benchmark::State& state, std::string input_name) {
     return;
   }
   auto& program = std::get<bench::ProgramAndFile>(res).program;
+  size_t spirv_words = 0;
+  auto allocations = bench::AllocationCount();
+  bench::ResetPeakAllocatedBytes();
   for (auto _ : state) {
     auto res = Generate(&program, {});
     if (!res.error.empty()) {
       state.SkipWithError(res.error.c_str());
     }
+    spirv_words = res.spirv.size();
   }
+  allocations = bench::AllocationCount() - allocations;
+  bench::ReportCounters(state, spirv_words * sizeof(uint32_t), allocations);
+}
+
+/// Benchmarks the Builder and BinaryWriter alone, on an already sanitized
+/// program.
+void BuildSPIRV(benchmark::State& state, std::string input_name) {
+  auto res = bench::LoadProgram(input_name);
+  if (auto err = std::get_if<bench::Error>(&res)) {
+    state.SkipWithError(err->msg.c_str());
+    return;
+  }
+  auto sanitized = Sanitize(&std::get<bench::ProgramAndFile>(res).program);
+  if (!sanitized.program.IsValid()) {
+    state.SkipWithError(sanitized.program.Diagnostics().str().c_str());
+    return;
+  }
+  size_t spirv_words = 0;
+  auto allocations = bench::AllocationCount();
+  bench::ResetPeakAllocatedBytes();
+  for (auto _ : state) {
+    Builder builder(&sanitized.program);
+    if (!builder.Build()) {
+      state.SkipWithError(builder.error().c_str());
+      break;
+    }
+    BinaryWriter writer;
+    writer.WriteHeader(builder.id_bound());
+    writer.WriteBuilder(&builder);
+    spirv_words = writer.result().size();
+  }
+  allocations = bench::AllocationCount() - allocations;
+  bench::ReportCounters(state, spirv_words * sizeof(uint32_t), allocations);
+}
+
+void SanitizeSPIRV(benchmark::State& state, std::string input_name) {
+  auto res = bench::LoadProgram(input_name);
+  if (auto err = std::get_if<bench::Error>(&res)) {
+    state.SkipWithError(err->msg.c_str());
+    return;
+  }
+  auto& program = std::get<bench::ProgramAndFile>(res).program;
+  auto allocations = bench::AllocationCount();
+  for (auto _ : state) {
+    auto res = Sanitize(&program);
+    if (res.program.Diagnostics().contains_errors()) {
+      state.SkipWithError(res.program.Diagnostics().str().c_str());
+    }
+  }
+  allocations = bench::AllocationCount() - allocations;
+  state.counters["allocations"] = benchmark::Counter(
+      static_cast<double>(allocations), benchmark::Counter::kAvgIterations);
 }
 
 TINT_BENCHMARK_WGSL_PROGRAMS(GenerateSPIRV);
+TINT_BENCHMARK_WGSL_PROGRAMS(BuildSPIRV);
+TINT_BENCHMARK_WGSL_PROGRAMS(SanitizeSPIRV);
 
 }  // namespace
 }  // namespace tint::writer::spirv
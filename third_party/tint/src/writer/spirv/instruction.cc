@@ -14,25 +14,95 @@
 
 #include "src/writer/spirv/instruction.h"
 
+#include <cstring>
 #include <utility>
 
 namespace tint {
 namespace writer {
 namespace spirv {
 
-Instruction::Instruction(spv::Op op, OperandList operands)
-    : op_(op), operands_(std::move(operands)) {}
+namespace {
+
+/// Encodes the instruction with the given op and operands at the end of `out`
+void Encode(std::vector<uint32_t>& out, spv::Op op, const OperandList& ops) {
+  uint32_t word_length = 1;  // Initial 1 for the op and size
+  for (const auto& operand : ops) {
+    word_length += operand.length();
+  }
+
+  auto offset = out.size();
+  out.resize(offset + word_length, 0);
+  uint32_t* words = out.data() + offset;
+  *words++ = word_length << 16 | static_cast<uint32_t>(op);
+  for (const auto& operand : ops) {
+    if (operand.IsInt()) {
+      *words = operand.to_i();
+    } else if (operand.IsFloat()) {
+      auto f = operand.to_f();
+      memcpy(words, &f, sizeof(f));
+    } else {
+      // The words are zero initialized, which nul-terminates and pads the
+      // string.
+      const auto& str = operand.to_s();
+      memcpy(words, str.data(), str.size());
+    }
+    words += operand.length();
+  }
+}
+
+}  // namespace
+
+Instruction::Instruction(spv::Op op, const OperandList& operands) {
+  Encode(words_, op, operands);
+}
+
+Instruction::Instruction(std::vector<uint32_t> words)
+    : words_(std::move(words)) {}
 
 Instruction::Instruction(const Instruction&) = default;
 
+Instruction::Instruction(Instruction&&) = default;
+
 Instruction::~Instruction() = default;
 
-uint32_t Instruction::word_length() const {
-  uint32_t size = 1;  // Initial 1 for the op and size
-  for (const auto& op : operands_) {
-    size += op.length();
+InstructionList::InstructionList() = default;
+
+InstructionList::InstructionList(const InstructionList&) = default;
+
+InstructionList::InstructionList(InstructionList&&) = default;
+
+InstructionList::~InstructionList() = default;
+
+InstructionList& InstructionList::operator=(const InstructionList&) = default;
+
+InstructionList& InstructionList::operator=(InstructionList&&) = default;
+
+void InstructionList::push_back(spv::Op op, const OperandList& operands) {
+  last_ = words_.size();
+  count_++;
+  Encode(words_, op, operands);
+}
+
+void InstructionList::push_back(const Instruction& inst) {
+  last_ = words_.size();
+  count_++;
+  words_.insert(words_.end(), inst.words().begin(), inst.words().end());
+}
+
+Instruction InstructionList::operator[](size_t index) const {
+  size_t offset = 0;
+  for (size_t i = 0; i < index; i++) {
+    offset += words_[offset] >> 16;
+  }
+  auto begin = words_.begin() + static_cast<std::ptrdiff_t>(offset);
+  return Instruction(std::vector<uint32_t>(begin, begin + (*begin >> 16)));
+}
+
+spv::Op InstructionList::last_opcode() const {
+  if (words_.empty()) {
+    return spv::Op::OpNop;
   }
-  return size;
+  return static_cast<spv::Op>(words_[last_] & 0xffff);
 }
 
 }  // namespace spirv
@@ -24,33 +24,93 @@ namespace tint {
 namespace writer {
 namespace spirv {
 
-/// A single SPIR-V instruction
+/// A single SPIR-V instruction, encoded as SPIR-V words.
 class Instruction {
  public:
   /// Constructor
   /// @param op the op to generate
   /// @param operands the operand values for the instruction
-  Instruction(spv::Op op, OperandList operands);
+  Instruction(spv::Op op, const OperandList& operands);
+  /// Constructor
+  /// @param words the encoded instruction, starting with the word holding the
+  /// word count and the opcode
+  explicit Instruction(std::vector<uint32_t> words);
   /// Copy Constructor
   Instruction(const Instruction&);
+  /// Move Constructor
+  Instruction(Instruction&&);
   ~Instruction();
 
   /// @returns the instructions op
-  spv::Op opcode() const { return op_; }
+  spv::Op opcode() const { return static_cast<spv::Op>(words_[0] & 0xffff); }
 
-  /// @returns the instructions operands
-  const OperandList& operands() const { return operands_; }
+  /// @returns the encoded instruction, starting with the word holding the word
+  /// count and the opcode, followed by the operands
+  const std::vector<uint32_t>& words() const { return words_; }
 
   /// @returns the number of uint32_t's needed to hold the instruction
-  uint32_t word_length() const;
+  uint32_t word_length() const { return static_cast<uint32_t>(words_.size()); }
 
  private:
-  spv::Op op_ = spv::Op::OpNop;
-  OperandList operands_;
+  std::vector<uint32_t> words_;
 };
 
-/// A list of instructions
-using InstructionList = std::vector<Instruction>;
+/// A list of instructions, encoded back to back in a single buffer of SPIR-V
+/// words.
+class InstructionList {
+ public:
+  /// Constructor
+  InstructionList();
+  /// Copy Constructor
+  InstructionList(const InstructionList&);
+  /// Move Constructor
+  InstructionList(InstructionList&&);
+  ~InstructionList();
+
+  /// Copy assignment
+  /// @param other the list to copy
+  /// @returns this list
+  InstructionList& operator=(const InstructionList& other);
+  /// Move assignment
+  /// @param other the list to move
+  /// @returns this list
+  InstructionList& operator=(InstructionList&& other);
+
+  /// Encodes an instruction at the end of the list
+  /// @param op the op to generate
+  /// @param operands the operand values for the instruction
+  void push_back(spv::Op op, const OperandList& operands);
+  /// Appends an instruction to the end of the list
+  /// @param inst the instruction
+  void push_back(const Instruction& inst);
+
+  /// @returns true if the list holds no instructions
+  bool empty() const { return words_.empty(); }
+  /// @returns the number of instructions in the list
+  size_t size() const { return count_; }
+
+  /// @param index the index of the instruction
+  /// @returns a copy of the instruction at `index`
+  /// @note this walks the list from the start, and is intended for testing.
+  Instruction operator[](size_t index) const;
+
+  /// @returns the op of the last instruction of the list, or OpNop if the list
+  /// is empty
+  spv::Op last_opcode() const;
+
+  /// @returns the encoded instructions
+  const std::vector<uint32_t>& words() const { return words_; }
+
+  /// @returns the number of uint32_t's needed to hold the instructions
+  uint32_t word_length() const { return static_cast<uint32_t>(words_.size()); }
+
+ private:
+  std::vector<uint32_t> words_;
+  /// The number of instructions in #words_
+  size_t count_ = 0;
+  /// The offset in #words_ of the last instruction
+  size_t last_ = 0;
+};
 
 }  // namespace spirv
 }  // namespace writer
@@ -14,6 +14,8 @@
 
 #include "src/writer/spirv/instruction.h"
 
+#include <cstring>
+
 #include "gtest/gtest.h"
 
 namespace tint {
@@ -27,17 +29,21 @@ TEST_F(InstructionTest, Create) {
   Instruction i(spv::Op::OpEntryPoint, {Operand::Float(1.2f), Operand::Int(1),
                                         Operand::String("my_str")});
   EXPECT_EQ(i.opcode(), spv::Op::OpEntryPoint);
-  ASSERT_EQ(i.operands().size(), 3u);
+  ASSERT_EQ(i.words().size(), 5u);
+
+  const auto& words = i.words();
+  EXPECT_EQ(words[0], 5u << 16 | static_cast<uint32_t>(spv::Op::OpEntryPoint));
 
-  const auto& ops = i.operands();
-  EXPECT_TRUE(ops[0].IsFloat());
-  EXPECT_FLOAT_EQ(ops[0].to_f(), 1.2f);
+  float f;
+  memcpy(&f, &words[1], 4);
+  EXPECT_FLOAT_EQ(f, 1.2f);
 
-  EXPECT_TRUE(ops[1].IsInt());
-  EXPECT_EQ(ops[1].to_i(), 1u);
+  EXPECT_EQ(words[2], 1u);
 
-  EXPECT_TRUE(ops[2].IsString());
-  EXPECT_EQ(ops[2].to_s(), "my_str");
+  char str[8];
+  memcpy(str, &words[3], 8);
+  EXPECT_STREQ(str, "my_str");
+  EXPECT_EQ(str[7], '\0');
 }
 
 TEST_F(InstructionTest, Length) {
@@ -46,6 +52,38 @@ TEST_F(InstructionTest, Length) {
   EXPECT_EQ(i.word_length(), 5u);
 }
 
+using InstructionListTest = testing::Test;
+
+TEST_F(InstructionListTest, Empty) {
+  InstructionList list;
+  EXPECT_TRUE(list.empty());
+  EXPECT_EQ(list.size(), 0u);
+  EXPECT_EQ(list.word_length(), 0u);
+  EXPECT_EQ(list.last_opcode(), spv::Op::OpNop);
+}
+
+TEST_F(InstructionListTest, PushBack) {
+  InstructionList list;
+  list.push_back(spv::Op::OpName, {Operand::Int(1), Operand::String("name")});
+  list.push_back(Instruction{spv::Op::OpTypeBool, {Operand::Int(2)}});
+  list.push_back(spv::Op::OpReturn, {});
+
+  EXPECT_FALSE(list.empty());
+  ASSERT_EQ(list.size(), 3u);
+  EXPECT_EQ(list.word_length(), 7u);
+  EXPECT_EQ(list.last_opcode(), spv::Op::OpReturn);
+
+  EXPECT_EQ(list[0].opcode(), spv::Op::OpName);
+  EXPECT_EQ(list[0].word_length(), 4u);
+  EXPECT_EQ(list[0].words()[1], 1u);
+  EXPECT_EQ(list[1].opcode(), spv::Op::OpTypeBool);
+  EXPECT_EQ(list[1].words(),
+            (std::vector<uint32_t>{
+                2u << 16 | static_cast<uint32_t>(spv::Op::OpTypeBool), 2u}));
+  EXPECT_EQ(list[2].opcode(), spv::Op::OpReturn);
+  EXPECT_EQ(list[2].word_length(), 1u);
+}
+
 }  // namespace
 }  // namespace spirv
 }  // namespace writer
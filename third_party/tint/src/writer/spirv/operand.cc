@@ -14,50 +14,64 @@
 
 #include "src/writer/spirv/operand.h"
 
+#include <utility>
+
 namespace tint {
 namespace writer {
 namespace spirv {
 
 // static
 Operand Operand::Float(float val) {
-  Operand o(Kind::kFloat);
-  o.set_float(val);
-  return o;
+  return Operand(val);
 }
 
 // static
 Operand Operand::Int(uint32_t val) {
-  Operand o(Kind::kInt);
-  o.set_int(val);
-  return o;
+  return Operand(val);
 }
 
 // static
-Operand Operand::String(const std::string& val) {
-  Operand o(Kind::kString);
-  o.set_string(val);
-  return o;
+Operand Operand::String(std::string val) {
+  return Operand(std::move(val));
 }
 
-Operand::Operand(Kind kind) : kind_(kind) {}
+Operand::Operand(std::variant<uint32_t, float, std::string> value)
+    : value_(std::move(value)) {}
+
+Operand::Operand(const Operand&) = default;
+
+Operand::Operand(Operand&&) = default;
 
 Operand::~Operand() = default;
 
+Operand& Operand::operator=(const Operand&) = default;
+
+Operand& Operand::operator=(Operand&&) = default;
+
+float Operand::to_f() const {
+  auto* val = std::get_if<float>(&value_);
+  return val ? *val : 0.0f;
+}
+
+uint32_t Operand::to_i() const {
+  auto* val = std::get_if<uint32_t>(&value_);
+  return val ? *val : 0u;
+}
+
+const std::string& Operand::to_s() const {
+  static const std::string kEmpty;
+  auto* val = std::get_if<std::string>(&value_);
+  return val ? *val : kEmpty;
+}
+
 uint32_t Operand::length() const {
-  uint32_t val = 0;
-  switch (kind_) {
-    case Kind::kFloat:
-    case Kind::kInt:
-      val = 1;
-      break;
-    case Kind::kString:
-      // SPIR-V always nul-terminates strings. The length is rounded up to a
-      // multiple of 4 bytes with 0 bytes padding the end. Accounting for the
-      // nul terminator is why '+ 4u' is used here instead of '+ 3u'.
-      val = static_cast<uint32_t>((str_val_.length() + 4u) >> 2);
-      break;
+  if (auto* str = std::get_if<std::string>(&value_)) {
+    // SPIR-V always nul-terminates strings. The length is rounded up to a
+    // multiple of 4 bytes with 0 bytes padding the end. Accounting for the
+    // nul terminator is why '+ 4u' is used here instead of '+ 3u'.
+    return static_cast<uint32_t>((str->length() + 4u) >> 2);
   }
-  return val;
+  return 1;
 }
 
 }  // namespace spirv
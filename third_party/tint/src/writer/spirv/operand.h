@@ -16,6 +16,7 @@
 #define SRC_WRITER_SPIRV_OPERAND_H_
 
 #include <string>
+#include <variant>
 #include <vector>
 
 namespace tint {
@@ -25,11 +26,6 @@ namespace spirv {
 /// A single SPIR-V instruction operand
 class Operand {
  public:
-  /// The kind of the operand
-  // Note, the `kInt` will cover most cases as things like IDs in SPIR-V are
-  // just ints for the purpose of converting to binary.
-  enum class Kind { kInt = 0, kFloat, kString };
-
   /// Creates a float operand
   /// @param val the float value
   /// @returns the operand
@@ -41,52 +37,49 @@ class Operand {
   /// Creates a string operand
   /// @param val the string value
   /// @returns the operand
-  static Operand String(const std::string& val);
+  static Operand String(std::string val);
 
-  /// Constructor
-  /// @param kind the type of operand
-  explicit Operand(Kind kind);
   /// Copy Constructor
-  Operand(const Operand&) = default;
+  Operand(const Operand&);
+  /// Move Constructor
+  Operand(Operand&&);
   ~Operand();
 
   /// Copy assignment
   /// @param b the operand to copy
   /// @returns a copy of this operand
-  Operand& operator=(const Operand& b) = default;
-
-  /// Sets the float value
-  /// @param val the value to set
-  void set_float(float val) { float_val_ = val; }
-  /// Sets the int value
-  /// @param val the value to set
-  void set_int(uint32_t val) { int_val_ = val; }
-  /// Sets the string value
-  /// @param val the value to set
-  void set_string(const std::string& val) { str_val_ = val; }
+  Operand& operator=(const Operand& b);
+  /// Move assignment
+  /// @param b the operand to move
+  /// @returns this operand
+  Operand& operator=(Operand&& b);
 
   /// @returns true if this is a float operand
-  bool IsFloat() const { return kind_ == Kind::kFloat; }
+  bool IsFloat() const { return std::holds_alternative<float>(value_); }
   /// @returns true if this is an integer operand
-  bool IsInt() const { return kind_ == Kind::kInt; }
+  bool IsInt() const { return std::holds_alternative<uint32_t>(value_); }
   /// @returns true if this is a string operand
-  bool IsString() const { return kind_ == Kind::kString; }
+  bool IsString() const { return std::holds_alternative<std::string>(value_); }
 
   /// @returns the number of uint32_t's needed for this operand
   uint32_t length() const;
 
-  /// @returns the float value
-  float to_f() const { return float_val_; }
-  /// @returns the int value
-  uint32_t to_i() const { return int_val_; }
-  /// @returns the string value
-  const std::string& to_s() const { return str_val_; }
+  /// @returns the float value, or 0 if this is not a float operand
+  float to_f() const;
+  /// @returns the int value, or 0 if this is not an integer operand
+  uint32_t to_i() const;
+  /// @returns the string value, or an empty string if this is not a string
+  /// operand
+  const std::string& to_s() const;
 
  private:
-  Kind kind_ = Kind::kInt;
-  float float_val_ = 0.0;
-  uint32_t int_val_ = 0;
-  std::string str_val_;
+  /// Constructor
+  /// @param value the value of the operand
+  explicit Operand(std::variant<uint32_t, float, std::string> value);
+
+  /// Most operands are ids and literal integers, so the value is only a
+  /// std::string for the few string literal operands.
+  std::variant<uint32_t, float, std::string> value_;
 };
 
 /// A list of operands
@@ -78,9 +78,7 @@ std::string DumpInstruction(const Instruction& inst) {
 std::string DumpInstructions(const InstructionList& insts) {
   BinaryWriter writer;
   writer.WriteHeader(kDefaultMaxIdBound);
-  for (const auto& inst : insts) {
-    writer.WriteInstruction(inst);
-  }
+  writer.WriteInstructions(insts);
   return Disassemble(writer.result());
 }
 
@@ -15,12 +15,33 @@
 #include "src/writer/text_generator.h"
 
 #include <algorithm>
-#include <limits>
+#include <cstring>
 
 #include "src/utils/map.h"
 
 namespace tint {
 namespace writer {
+namespace {
+
+/// The minimum size in bytes of each TextBuffer chunk
+constexpr size_t kChunkSize = 4096;
+
+/// @returns the characters of `line` as stored by the TextBuffer, including
+/// the indentation and the trailing newline character
+std::string_view StoredText(const TextGenerator::Line& line) {
+  if (line.content.empty()) {
+    return std::string_view(line.content.data(), 1);
+  }
+  return std::string_view(line.content.data() - line.indent,
+                          line.indent + line.content.size() + 1);
+}
+
+}  // namespace
+
+std::vector<std::string>& TextGenerator::LineWriter::FreeLines() {
+  thread_local std::vector<std::string> free_lines;
+  return free_lines;
+}
 
 TextGenerator::TextGenerator(const Program* program)
     : program_(program), builder_(ProgramBuilder::Wrap(program)) {}
@@ -40,100 +61,188 @@ std::string TextGenerator::StructName(const sem::Struct* s) {
   return name;
 }
 
-std::string TextGenerator::TrimSuffix(std::string str,
-                                      const std::string& suffix) {
+std::string TextGenerator::TrimSuffix(std::string_view str,
+                                      std::string_view suffix) {
   if (str.size() >= suffix.size()) {
     if (str.substr(str.size() - suffix.size(), suffix.size()) == suffix) {
-      return str.substr(0, str.size() - suffix.size());
+      str.remove_suffix(suffix.size());
     }
   }
-  return str;
+  return std::string(str);
 }
 
-TextGenerator::LineWriter::LineWriter(TextBuffer* buf) : buffer(buf) {}
+TextGenerator::LineWriter::LineWriter(TextBuffer* buf) : buffer(buf) {
+  auto& free_lines = FreeLines();
+  if (!free_lines.empty()) {
+    os = utils::StringStream(std::move(free_lines.back()));
+    free_lines.pop_back();
+  }
+}
 
-TextGenerator::LineWriter::LineWriter(LineWriter&& other) {
-  buffer = other.buffer;
+TextGenerator::LineWriter::LineWriter(LineWriter&& other)
+    : os(std::move(other.os)), buffer(other.buffer) {
   other.buffer = nullptr;
 }
 
 TextGenerator::LineWriter::~LineWriter() {
   if (buffer) {
     buffer->Append(os.str());
+    auto storage = os.Release();
+    storage.clear();
+    FreeLines().emplace_back(std::move(storage));
   }
 }
 
 TextGenerator::TextBuffer::TextBuffer() = default;
+
+TextGenerator::TextBuffer::TextBuffer(const TextBuffer& other) {
+  *this = other;
+}
+
 TextGenerator::TextBuffer::~TextBuffer() = default;
 
-void TextGenerator::TextBuffer::IncrementIndent() {
-  current_indent += 2;
+TextGenerator::TextBuffer& TextGenerator::TextBuffer::operator=(
+    const TextBuffer& other) {
+  if (this != &other) {
+    current_indent = other.current_indent;
+    lines.clear();
+    splices_.clear();
+    spliced_lines_.clear();
+    chunks_.clear();
+    free_ = nullptr;
+    free_size_ = 0;
+    // The inserted lines of `other` become regular lines of the copy
+    other.ForEachLine([&](const Line& line) {
+      lines.emplace_back(Store(line.indent, line.content));
+    });
+  }
+  return *this;
 }
 
-void TextGenerator::TextBuffer::DecrementIndent() {
-  current_indent = std::max(2u, current_indent) - 2u;
+template <typename F>
+void TextGenerator::TextBuffer::ForEachLine(F&& callback) const {
+  size_t splice = 0;
+  for (size_t i = 0; i <= lines.size(); i++) {
+    // Splices past the end of `lines` are emitted after the last line
+    for (; splice < splices_.size() &&
+           (splices_[splice].before <= i || i == lines.size());
+         splice++) {
+      auto& s = splices_[splice];
+      for (size_t j = s.first; j < s.first + s.count; j++) {
+        callback(spliced_lines_[j]);
+      }
+    }
+    if (i < lines.size()) {
+      callback(lines[i]);
+    }
+  }
 }
 
-void TextGenerator::TextBuffer::Append(const std::string& line) {
-  lines.emplace_back(Line{current_indent, line});
+TextGenerator::Line TextGenerator::TextBuffer::Store(uint32_t indent,
+                                                     std::string_view content) {
+  size_t size = content.empty() ? 1 : indent + content.size() + 1;
+  if (size > free_size_) {
+    auto chunk_size = std::max(kChunkSize, size);
+    chunks_.emplace_back(new char[chunk_size]);
+    free_ = chunks_.back().get();
+    free_size_ = chunk_size;
+  }
+  char* dst = free_;
+  free_ += size;
+  free_size_ -= size;
+  if (content.empty()) {
+    dst[0] = '\n';
+    return Line{indent, std::string_view(dst, 0)};
+  }
+  memset(dst, ' ', indent);
+  memcpy(dst + indent, content.data(), content.size());
+  dst[size - 1] = '\n';
+  return Line{indent, std::string_view(dst + indent, content.size())};
 }
 
-void TextGenerator::TextBuffer::Insert(const std::string& line,
-                                       size_t before,
-                                       uint32_t indent) {
-  if (before >= lines.size()) {
+void TextGenerator::TextBuffer::AddSplice(Marker at, size_t first) {
+  if (at.line > lines.size()) {
     diag::List d;
     TINT_ICE(Writer, d)
-        << "TextBuffer::Insert() called with before >= lines.size()\n"
-        << "  before:" << before << "\n"
+        << "TextBuffer::Insert() called with a marker past the last line\n"
+        << "  marker: " << at.line << "\n"
         << "  lines.size(): " << lines.size();
+    spliced_lines_.resize(first);
     return;
   }
-  lines.insert(lines.begin() + before, Line{indent, line});
+  auto it = std::upper_bound(
+      splices_.begin(), splices_.end(), at.line,
+      [](size_t before, const Splice& s) { return before < s.before; });
+  splices_.insert(it, Splice{at.line, first, spliced_lines_.size() - first});
+}
+
+void TextGenerator::TextBuffer::IncrementIndent() {
+  current_indent += 2;
+}
+
+void TextGenerator::TextBuffer::DecrementIndent() {
+  current_indent = std::max(2u, current_indent) - 2u;
+}
+
+void TextGenerator::TextBuffer::Append(std::string_view line) {
+  lines.emplace_back(Store(current_indent, line));
+}
+
+void TextGenerator::TextBuffer::Insert(std::string_view line,
+                                       Marker at,
+                                       uint32_t indent) {
+  size_t first = spliced_lines_.size();
+  spliced_lines_.emplace_back(Store(indent, line));
+  AddSplice(at, first);
 }
 
 void TextGenerator::TextBuffer::Append(const TextBuffer& tb) {
-  for (auto& line : tb.lines) {
-    // TODO(bclayton): inefficent, consider optimizing
-    lines.emplace_back(Line{current_indent + line.indent, line.content});
+  if (&tb == this) {
+    TextBuffer copy(tb);
+    Append(copy);
+    return;
   }
+  tb.ForEachLine([&](const Line& line) {
+    lines.emplace_back(Store(current_indent + line.indent, line.content));
+  });
 }
 
 void TextGenerator::TextBuffer::Insert(const TextBuffer& tb,
-                                       size_t before,
+                                       Marker at,
                                        uint32_t indent) {
-  if (before >= lines.size()) {
-    diag::List d;
-    TINT_ICE(Writer, d)
-        << "TextBuffer::Insert() called with before >= lines.size()\n"
-        << "  before:" << before << "\n"
-        << "  lines.size(): " << lines.size();
+  if (&tb == this) {
+    TextBuffer copy(tb);
+    Insert(copy, at, indent);
     return;
   }
-  size_t idx = 0;
-  for (auto& line : tb.lines) {
-    // TODO(bclayton): inefficent, consider optimizing
-    lines.insert(lines.begin() + before + idx,
-                 Line{indent + line.indent, line.content});
-    idx++;
-  }
+  size_t first = spliced_lines_.size();
+  tb.ForEachLine([&](const Line& line) {
+    spliced_lines_.emplace_back(Store(indent + line.indent, line.content));
+  });
+  AddSplice(at, first);
 }
 
 std::string TextGenerator::TextBuffer::String(uint32_t indent /* = 0 */) const {
-  std::stringstream ss;
-  for (auto& line : lines) {
+  size_t size = 0;
+  ForEachLine([&](const Line& line) {
     if (!line.content.empty()) {
-      for (uint32_t i = 0; i < indent + line.indent; i++) {
-        ss << " ";
-      }
-      ss << line.content;
+      size += indent;
     }
-    ss << std::endl;
-  }
-  return ss.str();
+    size += StoredText(line).size();
+  });
+  std::string out;
+  out.reserve(size);
+  ForEachLine([&](const Line& line) {
+    if (indent > 0 && !line.content.empty()) {
+      out.append(indent, ' ');
+    }
+    out.append(StoredText(line));
+  });
+  return out;
 }
 
-TextGenerator::ScopedParen::ScopedParen(std::ostream& stream) : s(stream) {
+TextGenerator::ScopedParen::ScopedParen(utils::StringStream& stream)
+    : s(stream) {
   s << "(";
 }
 TextGenerator::ScopedParen::~ScopedParen() {
@@ -15,14 +15,16 @@
 #ifndef SRC_WRITER_TEXT_GENERATOR_H_
 #define SRC_WRITER_TEXT_GENERATOR_H_
 
-#include <sstream>
+#include <memory>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include "src/diagnostic/diagnostic.h"
 #include "src/program_builder.h"
+#include "src/utils/string_stream.h"
 
 namespace tint {
 namespace writer {
@@ -34,18 +36,41 @@ class TextGenerator {
   struct Line {
     /// The indentation of the line in whitespaces
     uint32_t indent = 0;
-    /// The content of the line, without a trailing newline character
-    std::string content;
+    /// The content of the line, without the indentation and the trailing
+    /// newline character. The characters are owned by the TextBuffer holding
+    /// the line, which stores them preceded by the indentation and followed by
+    /// the newline character.
+    std::string_view content;
   };
 
   /// TextBuffer holds a list of lines of text.
+  /// The lines are written to fixed size chunks, already indented and newline
+  /// terminated, as they are appended, so String() only has to concatenate
+  /// them.
   struct TextBuffer {
+    /// Marker is a position between two lines of a TextBuffer. Lines can be
+    /// inserted at a Marker after more lines were appended to the TextBuffer,
+    /// without moving the lines that follow it.
+    struct Marker {
+      /// The number of lines of the TextBuffer before the marker
+      size_t line = 0;
+    };
+
     // Constructor
     TextBuffer();
 
+    /// Copy constructor
+    /// @param other the TextBuffer to copy
+    TextBuffer(const TextBuffer& other);
+
     // Destructor
     ~TextBuffer();
 
+    /// Copy assignment operator
+    /// @param other the TextBuffer to copy
+    /// @returns this TextBuffer
+    TextBuffer& operator=(const TextBuffer& other);
+
     /// IncrementIndent increases the indentation of lines that will be written
     /// to the TextBuffer
     void IncrementIndent();
@@ -54,26 +79,30 @@ class TextGenerator {
     /// to the TextBuffer
     void DecrementIndent();
 
+    /// @returns a Marker at the end of the TextBuffer
+    Marker Mark() const { return Marker{lines.size()}; }
+
     /// Appends the line to the end of the TextBuffer
     /// @param line the line to append to the TextBuffer
-    void Append(const std::string& line);
+    void Append(std::string_view line);
 
-    /// Inserts the line to the TextBuffer before the line with index `before`
-    /// @param line the line to append to the TextBuffer
-    /// @param before the zero-based index of the line to insert the text before
-    /// @param indent the indentation to apply to the inserted lines
-    void Insert(const std::string& line, size_t before, uint32_t indent);
+    /// Inserts the line to the TextBuffer at the Marker `at`, after any lines
+    /// previously inserted at the same Marker
+    /// @param line the line to insert into the TextBuffer
+    /// @param at the position to insert the line at
+    /// @param indent the indentation to apply to the inserted line
+    void Insert(std::string_view line, Marker at, uint32_t indent);
 
     /// Appends the lines of `tb` to the end of this TextBuffer
     /// @param tb the TextBuffer to append to the end of this TextBuffer
     void Append(const TextBuffer& tb);
 
-    /// Inserts the lines of `tb` to the TextBuffer before the line with index
-    /// `before`
+    /// Inserts the lines of `tb` to the TextBuffer at the Marker `at`, after
+    /// any lines previously inserted at the same Marker
     /// @param tb the TextBuffer to insert into this TextBuffer
-    /// @param before the zero-based index of the line to insert the text before
+    /// @param at the position to insert the lines at
     /// @param indent the indentation to apply to the inserted lines
-    void Insert(const TextBuffer& tb, size_t before, uint32_t indent);
+    void Insert(const TextBuffer& tb, Marker at, uint32_t indent);
 
     /// @returns the buffer's content as a single string
     /// @param indent additional indentation to apply to each line
@@ -83,8 +112,51 @@ class TextGenerator {
     /// TextBuffer will use this indentation.
     uint32_t current_indent = 0;
 
-    /// The lines
+    /// The lines appended to the TextBuffer. Lines inserted at a Marker are
+    /// not part of this list, they are spliced in by String() and by the
+    /// TextBuffers that this TextBuffer is appended or inserted into.
     std::vector<Line> lines;
+
+   private:
+    /// Splice is a run of inserted lines
+    struct Splice {
+      /// The index of the line in `lines` that the run is inserted before
+      size_t before;
+      /// The index of the first line of the run in `spliced_lines_`
+      size_t first;
+      /// The number of lines in the run
+      size_t count;
+    };
+
+    /// Calls `callback` with each line of the TextBuffer, in order, including
+    /// the inserted lines
+    /// @param callback the function to call with each `const Line&`
+    template <typename F>
+    void ForEachLine(F&& callback) const;
+
+    /// Writes the line to the chunks, preceded by `indent` whitespaces and
+    /// followed by a newline character. Empty lines are not indented.
+    /// @param indent the indentation of the line
+    /// @param content the content of the line
+    /// @returns the Line referring to the written characters
+    Line Store(uint32_t indent, std::string_view content);
+
+    /// Inserts the lines in `spliced_lines_` from `first` to the end as a
+    /// Splice at `at`
+    /// @param at the position to insert the lines at
+    /// @param first the index of the first line in `spliced_lines_`
+    void AddSplice(Marker at, size_t first);
+
+    /// The runs of inserted lines, sorted by Splice::before
+    std::vector<Splice> splices_;
+    /// The inserted lines
+    std::vector<Line> spliced_lines_;
+    /// The chunks holding the characters of the lines
+    std::vector<std::unique_ptr<char[]>> chunks_;
+    /// The first unused character of the last chunk
+    char* free_ = nullptr;
+    /// The number of unused characters at free_
+    size_t free_size_ = 0;
   };
 
   /// Constructor
@@ -122,11 +194,13 @@ class TextGenerator {
   /// @param suffix the suffix to remove
   /// @return returns str without the provided trailing suffix string. If str
   /// doesn't end with suffix, str is returned unchanged.
-  std::string TrimSuffix(std::string str, const std::string& suffix);
+  std::string TrimSuffix(std::string_view str, std::string_view suffix);
 
  protected:
   /// LineWriter is a helper that acts as a string buffer, who's content is
   /// emitted to the TextBuffer as a single line on destruction.
+  /// The storage of the line is recycled between LineWriters, so creating a
+  /// LineWriter does not allocate.
   struct LineWriter {
    public:
     /// Constructor
@@ -140,29 +214,34 @@ class TextGenerator {
     /// Destructor
     ~LineWriter();
 
-    /// @returns the ostringstream
-    operator std::ostream&() { return os; }
+    /// @returns the utils::StringStream that writes to the line
+    operator utils::StringStream&() { return os; }
 
     /// @param rhs the value to write to the line
-    /// @returns the ostream so calls can be chained
+    /// @returns this LineWriter so calls can be chained
     template <typename T>
-    std::ostream& operator<<(T&& rhs) {
-      return os << std::forward<T>(rhs);
+    LineWriter& operator<<(T&& rhs) {
+      os << std::forward<T>(rhs);
+      return *this;
     }
 
    private:
     LineWriter(const LineWriter&) = delete;
     LineWriter& operator=(const LineWriter&) = delete;
 
-    std::ostringstream os;
+    /// @returns the line storage released by LineWriters on this thread,
+    /// ready to be reused
+    static std::vector<std::string>& FreeLines();
+
+    utils::StringStream os;
     TextBuffer* buffer;
   };
 
   /// Helper for writing a '(' on construction and a ')' destruction.
   struct ScopedParen {
     /// Constructor
-    /// @param stream the std::ostream that will be written to
-    explicit ScopedParen(std::ostream& stream);
+    /// @param stream the utils::StringStream that will be written to
+    explicit ScopedParen(utils::StringStream& stream);
     /// Destructor
     ~ScopedParen();
 
@@ -170,7 +249,7 @@ class TextGenerator {
     ScopedParen(ScopedParen&& rhs) = delete;
     ScopedParen(const ScopedParen&) = delete;
     ScopedParen& operator=(const ScopedParen&) = delete;
-    std::ostream& s;
+    utils::StringStream& s;
   };
 
   /// Helper for incrementing indentation on construction and decrementing
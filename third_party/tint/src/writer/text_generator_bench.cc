@@ -0,0 +1,183 @@
+// Copyright 2022 The Tint Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <string>
+#include <utility>
+
+// The writers must be included before benchmark.h, as ProgramBuilder cannot
+// be included after tint.h.
+#if TINT_BUILD_GLSL_WRITER
+#include "src/transform/glsl.h"
+#include "src/writer/glsl/generator_impl.h"
+#endif  // TINT_BUILD_GLSL_WRITER
+#if TINT_BUILD_HLSL_WRITER
+#include "src/writer/hlsl/generator_impl.h"
+#endif  // TINT_BUILD_HLSL_WRITER
+#if TINT_BUILD_MSL_WRITER
+#include "src/writer/msl/generator_impl.h"
+#endif  // TINT_BUILD_MSL_WRITER
+#if TINT_BUILD_WGSL_WRITER
+#include "src/writer/wgsl/generator_impl.h"
+#endif  // TINT_BUILD_WGSL_WRITER
+
+#include "src/bench/benchmark.h"
+
+namespace tint::writer {
+namespace {
+
+/// The number of functions in the generated shader
+constexpr int kFunctionCount = 200;
+
+/// @returns the WGSL source of a large shader made of many functions with
+/// nested blocks, for-loops and builtin calls that need helper functions, so
+/// that the text generators spend their time emitting lines and expressions
+/// rather than running transforms.
+std::string LargeShaderWGSL() {
+  std::string wgsl;
+  for (int i = 0; i < kFunctionCount; i++) {
+    auto n = std::to_string(i);
+    wgsl += "fn func" + n + "(x : f32, v : vec4<f32>) -> vec4<f32> {\n";
+    wgsl += "  var r = v;\n";
+    wgsl += "  for (var i = 0; i < " + n + "; i = i + 1) {\n";
+    wgsl += "    if (x > f32(i)) {\n";
+    wgsl += "      r = r * vec4<f32>(x, modf(x).fract, frexp(x).sig, 1.0) + "
+            "v.wzyx;\n";
+    wgsl += "    } else {\n";
+    wgsl += "      r = normalize(r) - vec4<f32>(f32(i) * 0.5);\n";
+    wgsl += "    }\n";
+    wgsl += "  }\n";
+    wgsl += "  return r;\n";
+    wgsl += "}\n\n";
+  }
+  wgsl += "@stage(compute) @workgroup_size(1) fn main() {\n";
+  wgsl += "  var v = vec4<f32>(1.0);\n";
+  for (int i = 0; i < kFunctionCount; i++) {
+    wgsl += "  v = func" + std::to_string(i) + "(1.0, v);\n";
+  }
+  wgsl += "}\n";
+  return wgsl;
+}
+
+/// The generated text, or the error of a writer
+struct Output {
+  /// The error, empty on success
+  std::string error;
+  /// The generated text
+  std::string text;
+};
+
+/// Benchmarks the text generation of the large shader by `generate`, which
+/// runs a writer's GeneratorImpl on the program and returns the text as an
+/// Output. The program is first prepared for the writer with `sanitize`,
+/// which is not timed, as the sanitizer transforms would otherwise dominate
+/// the time spent generating the text.
+template <typename SANITIZE, typename GENERATE>
+void GenerateLargeShader(benchmark::State& state,
+                         SANITIZE&& sanitize,
+                         GENERATE&& generate) {
+  Source::File file("large-shader.wgsl", LargeShaderWGSL());
+  auto parsed = reader::wgsl::Parse(&file);
+  if (parsed.Diagnostics().contains_errors()) {
+    state.SkipWithError(parsed.Diagnostics().str().c_str());
+    return;
+  }
+  Program program = sanitize(&parsed);
+  if (!program.IsValid()) {
+    state.SkipWithError(program.Diagnostics().str().c_str());
+    return;
+  }
+  size_t output_size = 0;
+  auto allocations = bench::AllocationCount();
+  bench::ResetPeakAllocatedBytes();
+  for (auto _ : state) {
+    auto res = generate(&program);
+    if (!res.error.empty()) {
+      state.SkipWithError(res.error.c_str());
+      return;
+    }
+    output_size = res.text.size();
+  }
+  allocations = bench::AllocationCount() - allocations;
+  bench::ReportCounters(state, output_size, allocations);
+}
+
+#if TINT_BUILD_GLSL_WRITER
+void GenerateLargeShaderGLSL(benchmark::State& state) {
+  GenerateLargeShader(
+      state,
+      [](const Program* program) {
+        transform::DataMap data;
+        data.Add<transform::Glsl::Config>("main");
+        return transform::Glsl().Run(program, data).program;
+      },
+      [](const Program* program) {
+        glsl::GeneratorImpl gen(program, glsl::Version());
+        gen.Generate();
+        return Output{gen.error(), gen.result()};
+      });
+}
+BENCHMARK(GenerateLargeShaderGLSL);
+#endif  // TINT_BUILD_GLSL_WRITER
+
+#if TINT_BUILD_HLSL_WRITER
+void GenerateLargeShaderHLSL(benchmark::State& state) {
+  GenerateLargeShader(
+      state,
+      [](const Program* program) {
+        return std::move(hlsl::Sanitize(program).program);
+      },
+      [](const Program* program) {
+        hlsl::GeneratorImpl gen(program);
+        gen.Generate();
+        return Output{gen.error(), gen.result()};
+      });
+}
+BENCHMARK(GenerateLargeShaderHLSL);
+#endif  // TINT_BUILD_HLSL_WRITER
+
+#if TINT_BUILD_MSL_WRITER
+void GenerateLargeShaderMSL(benchmark::State& state) {
+  GenerateLargeShader(
+      state,
+      [](const Program* program) {
+        msl::Options options;
+        return std::move(
+            msl::Sanitize(program, options.buffer_size_ubo_index).program);
+      },
+      [](const Program* program) {
+        msl::GeneratorImpl gen(program);
+        gen.Generate();
+        return Output{gen.error(), gen.result()};
+      });
+}
+BENCHMARK(GenerateLargeShaderMSL);
+#endif  // TINT_BUILD_MSL_WRITER
+
+#if TINT_BUILD_WGSL_WRITER
+void GenerateLargeShaderWGSL(benchmark::State& state) {
+  GenerateLargeShader(
+      state,
+      // The WGSL writer does not have a sanitizer
+      [](const Program* program) { return program->Clone(); },
+      [](const Program* program) {
+        wgsl::GeneratorImpl gen(program);
+        gen.Generate();
+        return Output{gen.error(), gen.result()};
+      });
+}
+BENCHMARK(GenerateLargeShaderWGSL);
+#endif  // TINT_BUILD_WGSL_WRITER
+
+}  // namespace
+}  // namespace tint::writer
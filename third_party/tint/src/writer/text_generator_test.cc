@@ -43,6 +43,106 @@ TEST(TextGeneratorTest, UniqueIdentifier_ConflictWithExisting) {
   ASSERT_EQ(gen.UniqueIdentifier("ident"), "ident_5");
 }
 
+TEST(TextGeneratorTest, TextBuffer_AppendAndInsert) {
+  TextGenerator::TextBuffer tb;
+  tb.Append("a");
+  auto marker = tb.Mark();
+  tb.IncrementIndent();
+  tb.Append("b");
+  tb.Append("");
+  tb.DecrementIndent();
+  tb.Append("c");
+  tb.Insert("d", marker, 4);
+
+  // Inserted lines are not part of `lines`
+  ASSERT_EQ(tb.lines.size(), 4u);
+  EXPECT_EQ(tb.lines[1].content, "b");
+  EXPECT_EQ(tb.lines[1].indent, 2u);
+  EXPECT_EQ(tb.String(), "a\n    d\n  b\n\nc\n");
+  EXPECT_EQ(tb.String(1), " a\n     d\n   b\n\n c\n");
+}
+
+TEST(TextGeneratorTest, TextBuffer_AppendAndInsertBuffer) {
+  TextGenerator::TextBuffer tb;
+  tb.Append("x");
+  auto marker = tb.Mark();
+  tb.Append("y");
+  {
+    TextGenerator::TextBuffer other;
+    other.Append("a");
+    other.IncrementIndent();
+    other.Append("b");
+    tb.IncrementIndent();
+    tb.Append(other);
+    tb.Insert(other, marker, 4);
+  }
+  // The lines of `other` must outlive it
+  tb.Append("z");
+  EXPECT_EQ(tb.String(), "x\n    a\n      b\ny\n  a\n    b\n  z\n");
+}
+
+TEST(TextGeneratorTest, TextBuffer_InsertOrder) {
+  TextGenerator::TextBuffer tb;
+  auto start = tb.Mark();
+  tb.Append("a");
+  auto middle = tb.Mark();
+  tb.Append("b");
+  auto end = tb.Mark();
+  tb.Insert("1", middle, 0);
+  tb.Insert("2", middle, 0);
+  tb.Insert("3", end, 0);
+  tb.Insert("4", start, 0);
+  tb.Insert("5", middle, 0);
+  EXPECT_EQ(tb.String(), "4\na\n1\n2\n5\nb\n3\n");
+}
+
+TEST(TextGeneratorTest, TextBuffer_AppendBufferWithInsertedLines) {
+  TextGenerator::TextBuffer inner;
+  inner.Append("a");
+  auto marker = inner.Mark();
+  inner.Append("c");
+  inner.Insert("b", marker, 2);
+
+  TextGenerator::TextBuffer tb;
+  tb.IncrementIndent();
+  tb.Append(inner);
+  tb.Insert(inner, tb.Mark(), 0);
+  ASSERT_EQ(tb.lines.size(), 3u);
+  EXPECT_EQ(tb.lines[1].content, "b");
+  EXPECT_EQ(tb.lines[1].indent, 4u);
+  EXPECT_EQ(tb.String(), "  a\n    b\n  c\na\n  b\nc\n");
+}
+
+TEST(TextGeneratorTest, TextBuffer_LongLines) {
+  std::string long_line(10000, 'x');
+  TextGenerator::TextBuffer tb;
+  for (int i = 0; i < 3; i++) {
+    tb.Append(long_line);
+    tb.Append(std::to_string(i));
+  }
+  EXPECT_EQ(tb.String(), long_line + "\n0\n" + long_line + "\n1\n" +
+                             long_line + "\n2\n");
+}
+
+TEST(TextGeneratorTest, TextBuffer_Copy) {
+  TextGenerator::TextBuffer tb;
+  tb.Append("a");
+  TextGenerator::TextBuffer copy(tb);
+  copy.Append("b");
+  tb.Append("c");
+  EXPECT_EQ(tb.String(), "a\nc\n");
+  EXPECT_EQ(copy.String(), "a\nb\n");
+}
+
+TEST(TextGeneratorTest, TextBuffer_CopyWithInsertedLines) {
+  TextGenerator::TextBuffer tb;
+  tb.Append("b");
+  tb.Insert("a", TextGenerator::TextBuffer::Marker{}, 0);
+  TextGenerator::TextBuffer copy(tb);
+  ASSERT_EQ(copy.lines.size(), 2u);
+  EXPECT_EQ(copy.String(), "a\nb\n");
+}
+
 }  // namespace
 }  // namespace writer
 }  // namespace tint
@@ -26,12 +26,18 @@ void GenerateWGSL(benchmark::State& state, std::string input_name) {
     return;
   }
   auto& program = std::get<bench::ProgramAndFile>(res).program;
+  size_t output_size = 0;
+  auto allocations = bench::AllocationCount();
+  bench::ResetPeakAllocatedBytes();
   for (auto _ : state) {
     auto res = Generate(&program, {});
     if (!res.error.empty()) {
       state.SkipWithError(res.error.c_str());
     }
+    output_size = res.wgsl.size();
   }
+  allocations = bench::AllocationCount() - allocations;
+  bench::ReportCounters(state, output_size, allocations);
 }
 
 TINT_BENCHMARK_WGSL_PROGRAMS(GenerateWGSL);
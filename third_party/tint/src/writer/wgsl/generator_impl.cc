@@ -110,7 +110,7 @@ bool GeneratorImpl::EmitTypeDecl(const ast::TypeDecl* ty) {
       });
 }
 
-bool GeneratorImpl::EmitExpression(std::ostream& out,
+bool GeneratorImpl::EmitExpression(utils::StringStream& out,
                                    const ast::Expression* expr) {
   return Switch(
       expr,
@@ -149,7 +149,7 @@ bool GeneratorImpl::EmitExpression(std::ostream& out,
 }
 
 bool GeneratorImpl::EmitIndexAccessor(
-    std::ostream& out,
+    utils::StringStream& out,
     const ast::IndexAccessorExpression* expr) {
   bool paren_lhs =
       !expr->object->IsAnyOf<ast::IndexAccessorExpression, ast::CallExpression,
@@ -175,7 +175,7 @@ bool GeneratorImpl::EmitIndexAccessor(
 }
 
 bool GeneratorImpl::EmitMemberAccessor(
-    std::ostream& out,
+    utils::StringStream& out,
     const ast::MemberAccessorExpression* expr) {
   bool paren_lhs =
       !expr->structure->IsAnyOf<ast::IndexAccessorExpression,
@@ -196,7 +196,7 @@ bool GeneratorImpl::EmitMemberAccessor(
   return EmitExpression(out, expr->member);
 }
 
-bool GeneratorImpl::EmitBitcast(std::ostream& out,
+bool GeneratorImpl::EmitBitcast(utils::StringStream& out,
                                 const ast::BitcastExpression* expr) {
   out << "bitcast<";
   if (!EmitType(out, expr->type)) {
@@ -212,7 +212,7 @@ bool GeneratorImpl::EmitBitcast(std::ostream& out,
   return true;
 }
 
-bool GeneratorImpl::EmitCall(std::ostream& out,
+bool GeneratorImpl::EmitCall(utils::StringStream& out,
                              const ast::CallExpression* expr) {
   if (expr->target.name) {
     if (!EmitExpression(out, expr->target.name)) {
@@ -247,7 +247,7 @@ bool GeneratorImpl::EmitCall(std::ostream& out,
   return true;
 }
 
-bool GeneratorImpl::EmitLiteral(std::ostream& out,
+bool GeneratorImpl::EmitLiteral(utils::StringStream& out,
                                 const ast::LiteralExpression* lit) {
   return Switch(
       lit,
@@ -273,7 +273,7 @@ bool GeneratorImpl::EmitLiteral(std::ostream& out,
       });
 }
 
-bool GeneratorImpl::EmitIdentifier(std::ostream& out,
+bool GeneratorImpl::EmitIdentifier(utils::StringStream& out,
                                    const ast::IdentifierExpression* expr) {
   out << program_->Symbols().NameFor(expr->symbol);
   return true;
@@ -343,7 +343,7 @@ bool GeneratorImpl::EmitFunction(const ast::Function* func) {
   return true;
 }
 
-bool GeneratorImpl::EmitImageFormat(std::ostream& out,
+bool GeneratorImpl::EmitImageFormat(utils::StringStream& out,
                                     const ast::TexelFormat fmt) {
   switch (fmt) {
     case ast::TexelFormat::kNone:
@@ -355,7 +355,8 @@ bool GeneratorImpl::EmitImageFormat(std::ostream& out,
   return true;
 }
 
-bool GeneratorImpl::EmitAccess(std::ostream& out, const ast::Access access) {
+bool GeneratorImpl::EmitAccess(utils::StringStream& out,
+                               const ast::Access access) {
   switch (access) {
     case ast::Access::kRead:
       out << "read";
@@ -373,7 +374,7 @@ bool GeneratorImpl::EmitAccess(std::ostream& out, const ast::Access access) {
   return false;
 }
 
-bool GeneratorImpl::EmitType(std::ostream& out, const ast::Type* ty) {
+bool GeneratorImpl::EmitType(utils::StringStream& out, const ast::Type* ty) {
   return Switch(
       ty,
       [&](const ast::Array* ary) {
@@ -638,7 +639,8 @@ bool GeneratorImpl::EmitStructType(const ast::Struct* str) {
   return true;
 }
 
-bool GeneratorImpl::EmitVariable(std::ostream& out, const ast::Variable* var) {
+bool GeneratorImpl::EmitVariable(utils::StringStream& out,
+                                 const ast::Variable* var) {
   if (!var->attributes.empty()) {
     if (!EmitAttributes(out, var->attributes)) {
       return false;
@@ -684,7 +686,7 @@ bool GeneratorImpl::EmitVariable(std::ostream& out, const ast::Variable* var) {
   return true;
 }
 
-bool GeneratorImpl::EmitAttributes(std::ostream& out,
+bool GeneratorImpl::EmitAttributes(utils::StringStream& out,
                                    const ast::AttributeList& attrs) {
   bool first = true;
   for (auto* attr : attrs) {
@@ -784,7 +786,7 @@ bool GeneratorImpl::EmitAttributes(std::ostream& out,
   return true;
 }
 
-bool GeneratorImpl::EmitBinary(std::ostream& out,
+bool GeneratorImpl::EmitBinary(utils::StringStream& out,
                                const ast::BinaryExpression* expr) {
   out << "(";
 
@@ -863,7 +865,7 @@ bool GeneratorImpl::EmitBinary(std::ostream& out,
   return true;
 }
 
-bool GeneratorImpl::EmitUnaryOp(std::ostream& out,
+bool GeneratorImpl::EmitUnaryOp(utils::StringStream& out,
                                 const ast::UnaryOpExpression* expr) {
   switch (expr->op) {
     case ast::UnaryOp::kAddressOf:
@@ -1104,13 +1106,13 @@ bool GeneratorImpl::EmitForLoop(const ast::ForLoopStatement* stmt) {
         case 1:  // Single line initializer statement
           out << TrimSuffix(init_buf.lines[0].content, ";");
           break;
-        default:  // Block initializer statement
-          for (size_t i = 1; i < init_buf.lines.size(); i++) {
-            // Indent all by the first line
-            init_buf.lines[i].indent += current_buffer_->current_indent;
-          }
-          out << TrimSuffix(init_buf.String(), "\n");
+        default: {  // Block initializer statement
+          // Indent all by the first line
+          auto indent = current_buffer_->current_indent;
+          auto str = init_buf.String(indent);
+          out << TrimSuffix(std::string_view(str).substr(indent), "\n");
           break;
+        }
       }
 
       out << "; ";
@@ -1129,13 +1131,13 @@ bool GeneratorImpl::EmitForLoop(const ast::ForLoopStatement* stmt) {
         case 1:  // Single line continuing statement
           out << TrimSuffix(cont_buf.lines[0].content, ";");
           break;
-        default:  // Block continuing statement
-          for (size_t i = 1; i < cont_buf.lines.size(); i++) {
-            // Indent all by the first line
-            cont_buf.lines[i].indent += current_buffer_->current_indent;
-          }
-          out << TrimSuffix(cont_buf.String(), "\n");
+        default: {  // Block continuing statement
+          // Indent all by the first line
+          auto indent = current_buffer_->current_indent;
+          auto str = cont_buf.String(indent);
+          out << TrimSuffix(std::string_view(str).substr(indent), "\n");
           break;
+        }
       }
     }
     out << " {";
@@ -61,7 +61,7 @@ class GeneratorImpl : public TextGenerator {
   /// @param out the output of the expression stream
   /// @param expr the expression to emit
   /// @returns true if the index accessor was emitted
-  bool EmitIndexAccessor(std::ostream& out,
+  bool EmitIndexAccessor(utils::StringStream& out,
                          const ast::IndexAccessorExpression* expr);
   /// Handles an assignment statement
   /// @param stmt the statement to emit
@@ -71,12 +71,13 @@ class GeneratorImpl : public TextGenerator {
   /// @param out the output of the expression stream
   /// @param expr the binary expression
   /// @returns true if the expression was emitted, false otherwise
-  bool EmitBinary(std::ostream& out, const ast::BinaryExpression* expr);
+  bool EmitBinary(utils::StringStream& out, const ast::BinaryExpression* expr);
   /// Handles generating a bitcast expression
   /// @param out the output of the expression stream
   /// @param expr the bitcast expression
   /// @returns true if the bitcast was emitted
-  bool EmitBitcast(std::ostream& out, const ast::BitcastExpression* expr);
+  bool EmitBitcast(utils::StringStream& out,
+                   const ast::BitcastExpression* expr);
   /// Handles a block statement
   /// @param stmt the statement to emit
   /// @returns true if the statement was emitted successfully
@@ -89,7 +90,7 @@ class GeneratorImpl : public TextGenerator {
   /// @param out the output of the expression stream
   /// @param expr the call expression
   /// @returns true if the call expression is emitted
-  bool EmitCall(std::ostream& out, const ast::CallExpression* expr);
+  bool EmitCall(utils::StringStream& out, const ast::CallExpression* expr);
   /// Handles a case statement
   /// @param stmt the statement
   /// @returns true if the statment was emitted successfully
@@ -98,7 +99,8 @@ class GeneratorImpl : public TextGenerator {
   /// @param out the output of the expression stream
   /// @param expr the literal expression expression
   /// @returns true if the literal expression is emitted
-  bool EmitLiteral(std::ostream& out, const ast::LiteralExpression* expr);
+  bool EmitLiteral(utils::StringStream& out,
+                   const ast::LiteralExpression* expr);
   /// Handles a continue statement
   /// @param stmt the statement to emit
   /// @returns true if the statement was emitted successfully
@@ -107,7 +109,7 @@ class GeneratorImpl : public TextGenerator {
   /// @param out the output of the expression stream
   /// @param expr the expression
   /// @returns true if the expression was emitted
-  bool EmitExpression(std::ostream& out, const ast::Expression* expr);
+  bool EmitExpression(utils::StringStream& out, const ast::Expression* expr);
   /// Handles generating a fallthrough statement
   /// @param stmt the fallthrough statement
   /// @returns true if the statement was successfully emitted
@@ -120,7 +122,8 @@ class GeneratorImpl : public TextGenerator {
   /// @param out the output of the expression stream
   /// @param expr the identifier expression
   /// @returns true if the identifier was emitted
-  bool EmitIdentifier(std::ostream& out, const ast::IdentifierExpression* expr);
+  bool EmitIdentifier(utils::StringStream& out,
+                      const ast::IdentifierExpression* expr);
   /// Handles an if statement
   /// @param stmt the statement to emit
   /// @returns true if the statement was successfully emitted
@@ -141,7 +144,7 @@ class GeneratorImpl : public TextGenerator {
   /// @param out the output of the expression stream
   /// @param expr the member accessor expression
   /// @returns true if the member accessor was emitted
-  bool EmitMemberAccessor(std::ostream& out,
+  bool EmitMemberAccessor(utils::StringStream& out,
                           const ast::MemberAccessorExpression* expr);
   /// Handles return statements
   /// @param stmt the statement to emit
@@ -167,7 +170,7 @@ class GeneratorImpl : public TextGenerator {
   /// @param out the output of the expression stream
   /// @param type the type to generate
   /// @returns true if the type is emitted
-  bool EmitType(std::ostream& out, const ast::Type* type);
+  bool EmitType(utils::StringStream& out, const ast::Type* type);
   /// Handles generating a struct declaration
   /// @param str the struct
   /// @returns true if the struct is emitted
@@ -176,27 +179,29 @@ class GeneratorImpl : public TextGenerator {
   /// @param out the output of the expression stream
   /// @param fmt the format to generate
   /// @returns true if the format is emitted
-  bool EmitImageFormat(std::ostream& out, const ast::TexelFormat fmt);
+  bool EmitImageFormat(utils::StringStream& out, const ast::TexelFormat fmt);
   /// Handles emitting an access control
   /// @param out the output of the expression stream
   /// @param access the access to generate
   /// @returns true if the access is emitted
-  bool EmitAccess(std::ostream& out, const ast::Access access);
+  bool EmitAccess(utils::StringStream& out, const ast::Access access);
   /// Handles a unary op expression
   /// @param out the output of the expression stream
   /// @param expr the expression to emit
   /// @returns true if the expression was emitted
-  bool EmitUnaryOp(std::ostream& out, const ast::UnaryOpExpression* expr);
+  bool EmitUnaryOp(utils::StringStream& out,
+                   const ast::UnaryOpExpression* expr);
   /// Handles generating a variable
   /// @param out the output of the expression stream
   /// @param var the variable to generate
   /// @returns true if the variable was emitted
-  bool EmitVariable(std::ostream& out, const ast::Variable* var);
+  bool EmitVariable(utils::StringStream& out, const ast::Variable* var);
   /// Handles generating a attribute list
   /// @param out the output of the expression stream
   /// @param attrs the attribute list
   /// @returns true if the attributes were emitted
-  bool EmitAttributes(std::ostream& out, const ast::AttributeList& attrs);
+  bool EmitAttributes(utils::StringStream& out,
+                      const ast::AttributeList& attrs);
 };
 
 }  // namespace wgsl
@@ -50,7 +50,7 @@ TEST_P(WgslBinaryTest, Emit) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitExpression(out, expr)) << gen.error();
   EXPECT_EQ(out.str(), params.result);
 }
@@ -27,7 +27,7 @@ TEST_F(WgslGeneratorImplTest, EmitExpression_Bitcast) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitExpression(out, bitcast)) << gen.error();
   EXPECT_EQ(out.str(), "bitcast<f32>(1)");
 }
@@ -28,7 +28,7 @@ TEST_F(WgslGeneratorImplTest, EmitIdentifierExpression_Single) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitExpression(out, i)) << gen.error();
   EXPECT_EQ(out.str(), "glsl");
 }
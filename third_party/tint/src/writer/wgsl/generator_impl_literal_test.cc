@@ -58,7 +58,7 @@ TEST_P(WgslGenerator_FloatLiteralTest, Emit) {
   SetResolveOnBuild(false);
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitLiteral(out, v)) << gen.error();
   EXPECT_EQ(out.str(), GetParam().expected);
 }
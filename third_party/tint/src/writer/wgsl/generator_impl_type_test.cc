@@ -32,7 +32,7 @@ TEST_F(WgslGeneratorImplTest, EmitType_Alias) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitType(out, alias_ty)) << gen.error();
   EXPECT_EQ(out.str(), "alias");
 }
@@ -43,7 +43,7 @@ TEST_F(WgslGeneratorImplTest, EmitType_Array) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitType(out, arr)) << gen.error();
   EXPECT_EQ(out.str(), "array<bool, 4>");
 }
@@ -54,7 +54,7 @@ TEST_F(WgslGeneratorImplTest, EmitType_Array_Attribute) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitType(out, a)) << gen.error();
   EXPECT_EQ(out.str(), "@stride(16) array<bool, 4>");
 }
@@ -65,7 +65,7 @@ TEST_F(WgslGeneratorImplTest, EmitType_RuntimeArray) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitType(out, a)) << gen.error();
   EXPECT_EQ(out.str(), "array<bool>");
 }
@@ -76,7 +76,7 @@ TEST_F(WgslGeneratorImplTest, EmitType_Bool) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitType(out, bool_)) << gen.error();
   EXPECT_EQ(out.str(), "bool");
 }
@@ -87,7 +87,7 @@ TEST_F(WgslGeneratorImplTest, EmitType_F32) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitType(out, f32)) << gen.error();
   EXPECT_EQ(out.str(), "f32");
 }
@@ -98,7 +98,7 @@ TEST_F(WgslGeneratorImplTest, EmitType_I32) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitType(out, i32)) << gen.error();
   EXPECT_EQ(out.str(), "i32");
 }
@@ -109,7 +109,7 @@ TEST_F(WgslGeneratorImplTest, EmitType_Matrix) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitType(out, mat2x3)) << gen.error();
   EXPECT_EQ(out.str(), "mat2x3<f32>");
 }
@@ -120,7 +120,7 @@ TEST_F(WgslGeneratorImplTest, EmitType_Pointer) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitType(out, p)) << gen.error();
   EXPECT_EQ(out.str(), "ptr<workgroup, f32>");
 }
@@ -132,7 +132,7 @@ TEST_F(WgslGeneratorImplTest, EmitType_PointerAccessMode) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitType(out, p)) << gen.error();
   EXPECT_EQ(out.str(), "ptr<storage, f32, read_write>");
 }
@@ -147,7 +147,7 @@ TEST_F(WgslGeneratorImplTest, EmitType_Struct) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitType(out, s_ty)) << gen.error();
   EXPECT_EQ(out.str(), "S");
 }
@@ -279,7 +279,7 @@ TEST_F(WgslGeneratorImplTest, EmitType_U32) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitType(out, u32)) << gen.error();
   EXPECT_EQ(out.str(), "u32");
 }
@@ -290,7 +290,7 @@ TEST_F(WgslGeneratorImplTest, EmitType_Vector) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitType(out, vec3)) << gen.error();
   EXPECT_EQ(out.str(), "vec3<f32>");
 }
@@ -313,7 +313,7 @@ TEST_P(WgslGenerator_DepthTextureTest, EmitType_DepthTexture) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitType(out, d)) << gen.error();
   EXPECT_EQ(out.str(), param.name);
 }
@@ -336,7 +336,7 @@ TEST_P(WgslGenerator_SampledTextureTest, EmitType_SampledTexture_F32) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitType(out, t)) << gen.error();
   EXPECT_EQ(out.str(), std::string(param.name) + "<f32>");
 }
@@ -349,7 +349,7 @@ TEST_P(WgslGenerator_SampledTextureTest, EmitType_SampledTexture_I32) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitType(out, t)) << gen.error();
   EXPECT_EQ(out.str(), std::string(param.name) + "<i32>");
 }
@@ -362,7 +362,7 @@ TEST_P(WgslGenerator_SampledTextureTest, EmitType_SampledTexture_U32) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitType(out, t)) << gen.error();
   EXPECT_EQ(out.str(), std::string(param.name) + "<u32>");
 }
@@ -386,7 +386,7 @@ TEST_P(WgslGenerator_MultiampledTextureTest, EmitType_MultisampledTexture_F32) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitType(out, t)) << gen.error();
   EXPECT_EQ(out.str(), std::string(param.name) + "<f32>");
 }
@@ -399,7 +399,7 @@ TEST_P(WgslGenerator_MultiampledTextureTest, EmitType_MultisampledTexture_I32) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitType(out, t)) << gen.error();
   EXPECT_EQ(out.str(), std::string(param.name) + "<i32>");
 }
@@ -412,7 +412,7 @@ TEST_P(WgslGenerator_MultiampledTextureTest, EmitType_MultisampledTexture_U32) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitType(out, t)) << gen.error();
   EXPECT_EQ(out.str(), std::string(param.name) + "<u32>");
 }
@@ -445,7 +445,7 @@ TEST_P(WgslGenerator_StorageTextureTest, EmitType_StorageTexture) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitType(out, t)) << gen.error();
   EXPECT_EQ(out.str(), param.name);
 }
@@ -480,7 +480,7 @@ TEST_P(WgslGenerator_ImageFormatTest, EmitType_StorageTexture_ImageFormat) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitImageFormat(out, param.fmt)) << gen.error();
   EXPECT_EQ(out.str(), param.name);
 }
@@ -512,7 +512,7 @@ TEST_F(WgslGeneratorImplTest, EmitType_Sampler) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitType(out, sampler)) << gen.error();
   EXPECT_EQ(out.str(), "sampler");
 }
@@ -523,7 +523,7 @@ TEST_F(WgslGeneratorImplTest, EmitType_SamplerComparison) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitType(out, sampler)) << gen.error();
   EXPECT_EQ(out.str(), "sampler_comparison");
 }
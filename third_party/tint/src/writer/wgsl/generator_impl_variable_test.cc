@@ -28,7 +28,7 @@ TEST_F(WgslGeneratorImplTest, EmitVariable) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitVariable(out, v)) << gen.error();
   EXPECT_EQ(out.str(), R"(var<private> a : f32;)");
 }
@@ -38,7 +38,7 @@ TEST_F(WgslGeneratorImplTest, EmitVariable_StorageClass) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitVariable(out, v)) << gen.error();
   EXPECT_EQ(out.str(), R"(var<private> a : f32;)");
 }
@@ -55,7 +55,7 @@ TEST_F(WgslGeneratorImplTest, EmitVariable_Access_Read) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitVariable(out, v)) << gen.error();
   EXPECT_EQ(out.str(), R"(@binding(0) @group(0) var<storage, read> a : S;)");
 }
@@ -72,7 +72,7 @@ TEST_F(WgslGeneratorImplTest, EmitVariable_Access_Write) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitVariable(out, v)) << gen.error();
   EXPECT_EQ(out.str(), R"(@binding(0) @group(0) var<storage, write> a : S;)");
 }
@@ -89,7 +89,7 @@ TEST_F(WgslGeneratorImplTest, EmitVariable_Access_ReadWrite) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitVariable(out, v)) << gen.error();
   EXPECT_EQ(out.str(),
             R"(@binding(0) @group(0) var<storage, read_write> a : S;)");
@@ -105,7 +105,7 @@ TEST_F(WgslGeneratorImplTest, EmitVariable_Decorated) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitVariable(out, v)) << gen.error();
   EXPECT_EQ(out.str(), R"(@group(1) @binding(2) var a : sampler;)");
 }
@@ -115,7 +115,7 @@ TEST_F(WgslGeneratorImplTest, EmitVariable_Constructor) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitVariable(out, v)) << gen.error();
   EXPECT_EQ(out.str(), R"(var<private> a : f32 = 1.0;)");
 }
@@ -126,7 +126,7 @@ TEST_F(WgslGeneratorImplTest, EmitVariable_Const) {
 
   GeneratorImpl& gen = Build();
 
-  std::stringstream out;
+  utils::StringStream out;
   ASSERT_TRUE(gen.EmitVariable(out, v)) << gen.error();
   EXPECT_EQ(out.str(), R"(let a : f32 = 1.0;)");
 }